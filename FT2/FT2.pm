@@ -72,6 +72,18 @@ sub _draw {
   }
 }
 
+sub _draw_many {
+  my $self = shift;
+
+  $self->_valid
+    or return;
+
+  my %input = @_;
+  i_ft2_text_multi($self->{id}, $input{image}{IMG}, $input{strings},
+                   $input{size}, $input{sizew} || 0, $input{align},
+                   $input{aa}, $input{vlayout}, $input{utf8});
+}
+
 sub _bounding_box {
   my $self = shift;
   my %input = @_;
@@ -139,6 +151,37 @@ sub utf8 {
   return 1;
 }
 
+sub glyph_cache_size {
+  my ($self, %opts) = @_;
+
+  $self->_valid
+    or return;
+
+  my $old = i_ft2_glyph_cache_size($self->{id});
+  if (defined $opts{size}) {
+    unless ($opts{size} =~ /^\d+$/) {
+      Imager->_set_error("glyph_cache_size: size must be a non-negative integer");
+      return;
+    }
+    i_ft2_set_glyph_cache_size($self->{id}, $opts{size});
+  }
+
+  return $old;
+}
+
+sub glyph_cache_stats {
+  my ($self) = @_;
+
+  $self->_valid
+    or return;
+
+  my %stats;
+  @stats{qw(size bytes entries hits misses)} =
+    i_ft2_glyph_cache_stats($self->{id});
+
+  return %stats;
+}
+
 # check if the font has the characters in the given string
 sub has_chars {
   my ($self, %hsh) = @_;
@@ -288,6 +331,58 @@ Imager::Font::FT2 - font support using FreeType 2
 
 This provides font support on FreeType 2.
 
+=head1 GLYPH CACHE
+
+Each font object keeps a cache of the glyphs it has loaded and
+rendered, so drawing or measuring the same characters again at the
+same size doesn't need FreeType to load and render them again.  The
+cache is shared between bounding_box() and drawing, and is emptied
+when the transformation or resolution of the font changes.
+
+=over
+
+=item glyph_cache_size()
+
+=item glyph_cache_size(size => $bytes)
+
+Returns the number of bytes the cache may use, before setting it to
+C<size> if supplied.  When the cache is full the least recently used
+glyphs are discarded.  A C<size> of 0 disables the cache.  Default:
+1048576.
+
+  my $old_size = $font->glyph_cache_size(size => 4_000_000);
+
+=item glyph_cache_stats()
+
+Returns a list of key/value pairs describing the cache:
+
+=over
+
+=item *
+
+C<size> - the number of bytes the cache may use.
+
+=item *
+
+C<bytes> - the number of bytes currently used.
+
+=item *
+
+C<entries> - the number of glyphs currently cached.
+
+=item *
+
+C<hits>, C<misses> - the number of glyph lookups that were found in
+the cache, or had to be loaded by FreeType, since the font was
+created.
+
+=back
+
+  my %stats = $font->glyph_cache_stats;
+  print "hit rate: ", $stats{hits} / ($stats{hits} + $stats{misses}), "\n";
+
+=back
+
 =head1 CAVEATS
 
 Unfortunately, older versions of Imager would install
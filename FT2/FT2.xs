@@ -177,6 +177,59 @@ i_ft2_text(font, im, tx, ty, cl, cheight, cwidth, text_sv, align, aa, vlayout, u
       OUTPUT:
         RETVAL
 
+undef_int
+i_ft2_text_multi(font, im, strings, cheight, cwidth, align, aa, vlayout, utf8)
+        Imager::Font::FT2x font
+        Imager::ImgRaw im
+        AV *strings
+        double cheight
+        double cwidth
+        int align
+        int aa
+        int vlayout
+        int utf8
+      PREINIT:
+        i_ft2_text_item *text_items;
+        SSize_t count, i;
+      CODE:
+        count = av_len(strings) + 1;
+        /* released on croak too */
+        Newx(text_items, count ? count : 1, i_ft2_text_item);
+        SAVEFREEPV(text_items);
+        for (i = 0; i < count; ++i) {
+          SV **entry = av_fetch(strings, i, 0);
+          AV *string_av;
+          SV **x_sv, **y_sv, **text_sv, **cl_sv;
+          i_ft2_text_item *item = text_items + i;
+          STRLEN len;
+
+          if (!entry || !SvROK(*entry) || SvTYPE(SvRV(*entry)) != SVt_PVAV)
+            croak("i_ft2_text_multi: strings[%d] isn't an array reference", (int)i);
+          string_av = (AV *)SvRV(*entry);
+          x_sv = av_fetch(string_av, 0, 0);
+          y_sv = av_fetch(string_av, 1, 0);
+          text_sv = av_fetch(string_av, 2, 0);
+          cl_sv = av_fetch(string_av, 3, 0);
+          if (!x_sv || !y_sv || !text_sv || !cl_sv)
+            croak("i_ft2_text_multi: strings[%d] needs x, y, text and color", (int)i);
+          if (!SvROK(*cl_sv) || !sv_derived_from(*cl_sv, "Imager::Color"))
+            croak("i_ft2_text_multi: strings[%d] color isn't an Imager::Color object", (int)i);
+          item->x = SvIV(*x_sv);
+          item->y = SvIV(*y_sv);
+          item->cl = INT2PTR(i_color *, SvIV((SV *)SvRV(*cl_sv)));
+          item->text = SvPV(*text_sv, len);
+          item->len = len;
+          item->utf8 = utf8;
+#ifdef SvUTF8
+          if (SvUTF8(*text_sv))
+            item->utf8 = 1;
+#endif
+        }
+        RETVAL = i_ft2_text_multi(font, im, text_items, count, cheight, cwidth,
+                                  align, aa, vlayout);
+      OUTPUT:
+        RETVAL
+
 undef_int
 i_ft2_cp(font, im, tx, ty, channel, cheight, cwidth, text_sv, align, aa, vlayout, utf8)
         Imager::Font::FT2x font
@@ -373,6 +426,28 @@ i_ft2_set_mm_coords(handle, ...)
       OUTPUT:
         RETVAL
 
+size_t
+i_ft2_glyph_cache_size(handle)
+        Imager::Font::FT2x handle
+
+undef_int
+i_ft2_set_glyph_cache_size(handle, size)
+        Imager::Font::FT2x handle
+        size_t size
+
+void
+i_ft2_glyph_cache_stats(handle)
+        Imager::Font::FT2x handle
+      PREINIT:
+        i_ft2_cache_stats stats;
+      PPCODE:
+        i_ft2_glyph_cache_stats(handle, &stats);
+        EXTEND(SP, 5);
+        PUSHs(sv_2mortal(newSVuv(stats.size)));
+        PUSHs(sv_2mortal(newSVuv(stats.bytes)));
+        PUSHs(sv_2mortal(newSVuv(stats.entries)));
+        PUSHs(sv_2mortal(newSVuv(stats.hits)));
+        PUSHs(sv_2mortal(newSVuv(stats.misses)));
 
 BOOT:
 	PERL_INITIALIZE_IMAGER_CALLBACKS;
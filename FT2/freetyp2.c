@@ -164,6 +164,46 @@ ft2_final(void *state) {
   myfree(state);
 }
 
+/* number of hash chains in each font's glyph cache */
+#define FT2_CACHE_BUCKETS 1024
+
+#define FT2_GLYPH_HASH(index, char_width, char_height, load_flags) \
+  (((unsigned long)(index) * 31 + (unsigned long)(char_height) * 7 \
+    + (unsigned long)(char_width) + (unsigned long)(load_flags))  \
+   % FT2_CACHE_BUCKETS)
+
+/* default byte budget for each font's glyph cache */
+#define FT2_CACHE_DEFAULT_SIZE (1024 * 1024)
+
+/* render mode for a glyph only loaded for its metrics */
+#define FT2_NOT_RENDERED (-1)
+
+/* a glyph as loaded (and possibly rendered) at a given size */
+typedef struct ft2_glyph ft2_glyph;
+struct ft2_glyph {
+  /* the key */
+  FT_UInt index;
+  FT_F26Dot6 char_width, char_height;
+  int load_flags;
+  int render_mode;
+
+  FT_Glyph_Metrics metrics;
+  FT_Vector advance;
+
+  /* the rendered glyph as 0..255 coverage, width bytes per row, NULL
+     if not rendered or empty */
+  unsigned char *bitmap;
+  int left, top;
+  unsigned width, rows;
+
+  /* bytes charged against the cache budget */
+  size_t bytes;
+
+  ft2_glyph *hash_next;
+  /* the LRU list, newest first */
+  ft2_glyph *newer, *older;
+};
+
 struct FT2_Fonthandle {
   FT_Face face;
   ft2_state *state;
@@ -179,8 +219,38 @@ struct FT2_Fonthandle {
   int has_mm;
   FT_Multi_Master mm;
 #endif
+
+  /* glyph cache */
+  ft2_glyph **cache_buckets;
+  ft2_glyph *cache_newest, *cache_oldest;
+  /* the last glyph fetched if it was too large to cache */
+  ft2_glyph *cache_scratch;
+  size_t cache_size;
+  size_t cache_bytes;
+  size_t cache_entries;
+  unsigned long cache_hits, cache_misses;
 };
 
+static ft2_glyph *
+ft2_get_glyph(FT2_Fonthandle *handle, unsigned long c, FT_UInt index,
+              FT_F26Dot6 char_width, FT_F26Dot6 char_height, int load_flags,
+              int render_mode);
+static void
+ft2_cache_remove(FT2_Fonthandle *handle, ft2_glyph *glyph);
+static void
+ft2_cache_clear(FT2_Fonthandle *handle);
+static void
+ft2_glyph_free(ft2_glyph *glyph);
+static int
+ft2_bbox(FT2_Fonthandle *handle, FT_F26Dot6 char_width,
+         FT_F26Dot6 char_height, char const *text, size_t len,
+         i_img_dim *bbox, int utf8);
+static int
+ft2_text(FT2_Fonthandle *handle, i_render *render, i_img_dim tx,
+         i_img_dim ty, const i_color *cl, FT_F26Dot6 char_width,
+         FT_F26Dot6 char_height, char const *text, size_t len, int align,
+         int load_flags, int render_mode, int utf8);
+
 /* the following is used to select a "best" encoding */
 static struct enc_score {
   FT_Encoding encoding;
@@ -277,6 +347,14 @@ i_ft2_new(const char *name, int index) {
   result->matrix[0] = 1; result->matrix[1] = 0; result->matrix[2] = 0;
   result->matrix[3] = 0; result->matrix[4] = 1; result->matrix[5] = 0;
 
+  result->cache_buckets = NULL;
+  result->cache_newest = result->cache_oldest = NULL;
+  result->cache_scratch = NULL;
+  result->cache_size = FT2_CACHE_DEFAULT_SIZE;
+  result->cache_bytes = 0;
+  result->cache_entries = 0;
+  result->cache_hits = result->cache_misses = 0;
+
 #ifdef IM_FT2_MM
  {
    FT_Multi_Master *mm = &result->mm;
@@ -311,6 +389,9 @@ i_ft2_new().
 */
 void
 i_ft2_destroy(FT2_Fonthandle *handle) {
+  ft2_cache_clear(handle);
+  if (handle->cache_buckets)
+    myfree(handle->cache_buckets);
   FT_Done_Face(handle->face);
   myfree(handle);
 }
@@ -331,6 +412,8 @@ int
 i_ft2_setdpi(FT2_Fonthandle *handle, int xdpi, int ydpi) {
   i_clear_error();
   if (xdpi > 0 && ydpi > 0) {
+    if (xdpi != handle->xdpi || ydpi != handle->ydpi)
+      ft2_cache_clear(handle);
     handle->xdpi = xdpi;
     handle->ydpi = ydpi;
     return 1;
@@ -383,6 +466,7 @@ i_ft2_settransform(FT2_Fonthandle *handle, const double *matrix) {
   v.y  = matrix[5]; /* see just above */
 
   FT_Set_Transform(handle->face, &m, &v);
+  ft2_cache_clear(handle);
 
   for (i = 0; i < 6; ++i)
     handle->matrix[i] = matrix[i];
@@ -420,28 +504,49 @@ int
 i_ft2_bbox(FT2_Fonthandle *handle, double cheight, double cwidth, 
            char const *text, size_t len, i_img_dim *bbox, int utf8) {
   FT_Error error;
-  i_img_dim width;
-  int index;
-  int first;
-  int ascent = 0, descent = 0;
-  int glyph_ascent, glyph_descent;
-  FT_Glyph_Metrics *gm;
-  int start = 0;
-  int loadFlags = FT_LOAD_DEFAULT;
-  int rightb = 0;
+  FT_F26Dot6 char_width = cwidth * 64;
+  FT_F26Dot6 char_height = cheight * 64;
 
   i_clear_error();
 
   mm_log((1, "i_ft2_bbox(handle %p, cheight %f, cwidth %f, text %p, len %u, bbox %p)\n",
 	  handle, cheight, cwidth, text, (unsigned)len, bbox));
 
-  error = FT_Set_Char_Size(handle->face, cwidth*64, cheight*64, 
+  error = FT_Set_Char_Size(handle->face, char_width, char_height, 
                            handle->xdpi, handle->ydpi);
   if (error) {
     ft2_push_message(error);
     i_push_error(0, "setting size");
   }
 
+  return ft2_bbox(handle, char_width, char_height, text, len, bbox, utf8);
+}
+
+/*
+=item ft2_bbox(handle, char_width, char_height, text, len, bbox, utf8)
+
+Implements i_ft2_bbox() once the character size has been set on the
+face, so that i_ft2_text_multi() can measure several strings without
+setting it again.
+
+=cut
+*/
+
+static int
+ft2_bbox(FT2_Fonthandle *handle, FT_F26Dot6 char_width,
+         FT_F26Dot6 char_height, char const *text, size_t len,
+         i_img_dim *bbox, int utf8) {
+  i_img_dim width;
+  int index;
+  int first;
+  int ascent = 0, descent = 0;
+  int glyph_ascent, glyph_descent;
+  FT_Glyph_Metrics *gm;
+  int start = 0;
+  int loadFlags = FT_LOAD_DEFAULT;
+  int rightb = 0;
+  ft2_glyph *glyph;
+
   if (!handle->hint)
     loadFlags |= FT_LOAD_NO_HINTING;
 
@@ -462,14 +567,11 @@ i_ft2_bbox(FT2_Fonthandle *handle, double cheight, double cwidth,
     }
 
     index = FT_Get_Char_Index(handle->face, c);
-    error = FT_Load_Glyph(handle->face, index, loadFlags);
-    if (error) {
-      ft2_push_message(error);
-      i_push_errorf(0, "loading glyph for character \\x%02lx (glyph 0x%04X)", 
-                    c, index);
+    glyph = ft2_get_glyph(handle, c, index, char_width, char_height,
+                          loadFlags, FT2_NOT_RENDERED);
+    if (!glyph)
       return 0;
-    }
-    gm = &handle->face->glyph->metrics;
+    gm = &glyph->metrics;
     glyph_ascent = gm->horiBearingY / 64;
     glyph_descent = glyph_ascent - gm->height/64;
     if (first) {
@@ -601,15 +703,17 @@ i_ft2_bbox_r(FT2_Fonthandle *handle, double cheight, double cwidth,
   i_img_dim bounds[4] = { 0 };
   double x = 0, y = 0;
   int i;
-  FT_GlyphSlot slot;
   int loadFlags = FT_LOAD_DEFAULT;
+  FT_F26Dot6 char_width = cwidth * 64;
+  FT_F26Dot6 char_height = cheight * 64;
+  ft2_glyph *glyph;
 
   if (vlayout)
     loadFlags |= FT_LOAD_VERTICAL_LAYOUT;
   if (!handle->hint)
     loadFlags |= FT_LOAD_NO_HINTING;
 
-  error = FT_Set_Char_Size(handle->face, cwidth*64, cheight*64, 
+  error = FT_Set_Char_Size(handle->face, char_width, char_height, 
                            handle->xdpi, handle->ydpi);
   if (error) {
     ft2_push_message(error);
@@ -632,15 +736,11 @@ i_ft2_bbox_r(FT2_Fonthandle *handle, double cheight, double cwidth,
     }
 
     index = FT_Get_Char_Index(handle->face, c);
-    error = FT_Load_Glyph(handle->face, index, loadFlags);
-    if (error) {
-      ft2_push_message(error);
-      i_push_errorf(0, "loading glyph for character \\x%02lx (glyph 0x%04X)",
-                    c, index);
+    glyph = ft2_get_glyph(handle, c, index, char_width, char_height,
+                          loadFlags, FT2_NOT_RENDERED);
+    if (!glyph)
       return 0;
-    }
-    slot = handle->face->glyph; 
-    gm = &slot->metrics;
+    gm = &glyph->metrics;
 
     /* these probably don't mean much for vertical layouts */
     glyph_ascent = gm->horiBearingY / 64;
@@ -678,8 +778,8 @@ i_ft2_bbox_r(FT2_Fonthandle *handle, double cheight, double cwidth,
     else {
       expand_bounds(bounds, work);
     }
-    x += slot->advance.x / 64;
-    y += slot->advance.y / 64;
+    x += glyph->advance.x / 64;
+    y += glyph->advance.y / 64;
 
     if (glyph_ascent > ascent)
       ascent = glyph_ascent;
@@ -737,25 +837,58 @@ int
 i_ft2_text(FT2_Fonthandle *handle, i_img *im, i_img_dim tx, i_img_dim ty, const i_color *cl,
            double cheight, double cwidth, char const *text, size_t len,
 	   int align, int aa, int vlayout, int utf8) {
-  FT_Error error;
-  int index;
-  FT_Glyph_Metrics *gm;
-  i_img_dim bbox[BOUNDING_BOX_COUNT];
-  FT_GlyphSlot slot;
-  unsigned x, y;
-  unsigned char map[256];
-  char last_mode = ft_pixel_mode_none; 
-  int last_grays = -1;
-  int loadFlags = FT_LOAD_DEFAULT;
-  i_render *render = NULL;
-  unsigned char *work_bmp = NULL;
-  size_t work_bmp_size = 0;
+  i_ft2_text_item item;
 
   mm_log((1, "i_ft2_text(handle %p, im %p, (tx,ty) (" i_DFp "), cl %p (#%02x%02x%02x%02x), cheight %f, cwidth %f, text %p, len %u, align %d, aa %d, vlayout %d, utf8 %d)\n",
 	  handle, im, i_DFcp(tx, ty), cl, cl->rgba.r, cl->rgba.g, cl->rgba.b,
 	  cl->rgba.a, cheight, cwidth, text, (unsigned)len, align, aa,
 	  vlayout, utf8));
 
+  item.x = tx;
+  item.y = ty;
+  item.cl = cl;
+  item.text = text;
+  item.len = len;
+  item.utf8 = utf8;
+
+  return i_ft2_text_multi(handle, im, &item, 1, cheight, cwidth, align, aa,
+                          vlayout);
+}
+
+/*
+=item i_ft2_text_multi(handle, im, items, count, cheight, cwidth, align, aa, vlayout)
+
+Renders each of the I<count> strings in I<items> to I<im>, each at
+its own position and color, with the same size and drawing options.
+
+The character size is set once, and the render object is shared
+between the strings, so drawing many short strings, such as map
+labels, is cheaper than calling i_ft2_text() for each.
+
+Stops at the first string that fails to draw, returning 0.
+
+Returns non-zero on success.
+
+=cut
+*/
+
+int
+i_ft2_text_multi(FT2_Fonthandle *handle, i_img *im,
+                 const i_ft2_text_item *items, size_t count,
+                 double cheight, double cwidth, int align, int aa,
+                 int vlayout) {
+  int loadFlags = FT_LOAD_DEFAULT;
+  i_render *render;
+  FT_Error error;
+  FT_F26Dot6 char_width = cwidth * 64;
+  FT_F26Dot6 char_height = cheight * 64;
+  int render_mode = aa ? ft_render_mode_normal : ft_render_mode_mono;
+  size_t i;
+
+  mm_log((1, "i_ft2_text_multi(handle %p, im %p, items %p, count %u, cheight %f, cwidth %f, align %d, aa %d, vlayout %d)\n",
+	  handle, im, items, (unsigned)count, cheight, cwidth, align, aa,
+	  vlayout));
+
   i_clear_error();
 
   if (vlayout) {
@@ -768,16 +901,55 @@ i_ft2_text(FT2_Fonthandle *handle, i_img *im, i_img_dim tx, i_img_dim ty, const
   if (!handle->hint)
     loadFlags |= FT_LOAD_NO_HINTING;
 
-  /* set the base-line based on the string ascent */
-  if (!i_ft2_bbox(handle, cheight, cwidth, text, len, bbox, utf8))
-    return 0;
+  error = FT_Set_Char_Size(handle->face, char_width, char_height, 
+                           handle->xdpi, handle->ydpi);
+  if (error) {
+    ft2_push_message(error);
+    i_push_error(0, "setting size");
+  }
+
+  render = i_render_new(im, 0);
+  for (i = 0; i < count; ++i) {
+    const i_ft2_text_item *item = items + i;
+    if (!ft2_text(handle, render, item->x, item->y, item->cl, char_width,
+                  char_height, item->text, item->len, align, loadFlags,
+                  render_mode, item->utf8)) {
+      i_render_delete(render);
+      return 0;
+    }
+  }
+  i_render_delete(render);
+
+  return 1;
+}
 
-  render = i_render_new(im, bbox[BBOX_POS_WIDTH] - bbox[BBOX_NEG_WIDTH]);
+/*
+=item ft2_text(handle, render, tx, ty, cl, char_width, char_height, text, len, align, load_flags, render_mode, utf8)
+
+Draws a single string for i_ft2_text_multi() through I<render>.
 
-  work_bmp_size = bbox[BBOX_POS_WIDTH] - bbox[BBOX_NEG_WIDTH];
-  work_bmp = mymalloc(work_bmp_size);
+The character size must already be set on the face.
+
+=cut
+*/
+
+static int
+ft2_text(FT2_Fonthandle *handle, i_render *render, i_img_dim tx,
+         i_img_dim ty, const i_color *cl, FT_F26Dot6 char_width,
+         FT_F26Dot6 char_height, char const *text, size_t len, int align,
+         int load_flags, int render_mode, int utf8) {
+  int index;
+  unsigned y;
+  ft2_glyph *glyph;
 
   if (!align) {
+    /* position the top-left of the first character, based on the
+       string ascent */
+    i_img_dim bbox[BOUNDING_BOX_COUNT];
+
+    if (!ft2_bbox(handle, char_width, char_height, text, len, bbox, utf8))
+      return 0;
+
     /* this may need adjustment */
     tx -= bbox[0] * handle->matrix[0] + bbox[5] * handle->matrix[1] + handle->matrix[2];
     ty += bbox[0] * handle->matrix[3] + bbox[5] * handle->matrix[4] + handle->matrix[5];
@@ -797,88 +969,24 @@ i_ft2_text(FT2_Fonthandle *handle, i_img *im, i_img_dim tx, i_img_dim ty, const
     }
     
     index = FT_Get_Char_Index(handle->face, c);
-    error = FT_Load_Glyph(handle->face, index, loadFlags);
-    if (error) {
-      ft2_push_message(error);
-      i_push_errorf(0, "loading glyph for character \\x%02lx (glyph 0x%04X)",
-                    c, index);
-      if (render)
-        i_render_delete(render);
+    glyph = ft2_get_glyph(handle, c, index, char_width, char_height,
+                          load_flags, render_mode);
+    if (!glyph)
       return 0;
-    }
-    slot = handle->face->glyph;
-    gm = &slot->metrics;
-
-    if (gm->width) {
-      error = FT_Render_Glyph(slot, aa ? ft_render_mode_normal : ft_render_mode_mono);
-      if (error) {
-	ft2_push_message(error);
-	i_push_errorf(0, "rendering glyph 0x%04lX (character \\x%02X)", c, index);
-	if (render)
-	  i_render_delete(render);
-	return 0;
-      }
-      if (slot->bitmap.pixel_mode == ft_pixel_mode_mono) {
-	unsigned char *bmp = slot->bitmap.buffer;
-	if (work_bmp_size < slot->bitmap.width) {
-	  work_bmp_size = slot->bitmap.width;
-	  work_bmp =  myrealloc(work_bmp, work_bmp_size);
-	}
-	for (y = 0; y < slot->bitmap.rows; ++y) {
-	  int pos = 0;
-	  int bit = 0x80;
-	  unsigned char *p = work_bmp;
-	  for (x = 0; x < slot->bitmap.width; ++x) {
-	    *p++ = (bmp[pos] & bit) ? 0xff : 0;
-
-	    bit >>= 1;
-	    if (bit == 0) {
-	      bit = 0x80;
-	      ++pos;
-	    }
-	  }
-          i_render_color(render, tx + slot->bitmap_left, ty-slot->bitmap_top+y,
-                         slot->bitmap.width, work_bmp, cl);
-
-	  bmp += slot->bitmap.pitch;
-	}
-      }
-      else {
-	unsigned char *bmp = slot->bitmap.buffer;
-
-	/* grey scale or something we can treat as greyscale */
-	/* we create a map to convert from the bitmap values to 0-255 */
-	if (last_mode != slot->bitmap.pixel_mode 
-	    || last_grays != slot->bitmap.num_grays) {
-	  if (!make_bmp_map(&slot->bitmap, map))
-	    return 0;
-	  last_mode = slot->bitmap.pixel_mode;
-	  last_grays = slot->bitmap.num_grays;
-	}
-
-	for (y = 0; y < slot->bitmap.rows; ++y) {
-          if (last_mode == ft_pixel_mode_grays &&
-              last_grays != 255) {
-            for (x = 0; x < slot->bitmap.width; ++x) 
-              bmp[x] = map[bmp[x]];
-          }
-          i_render_color(render, tx + slot->bitmap_left, ty-slot->bitmap_top+y,
-                         slot->bitmap.width, bmp, cl);
-	  bmp += slot->bitmap.pitch;
-	}
+
+    if (glyph->bitmap) {
+      unsigned char const *bmp = glyph->bitmap;
+      for (y = 0; y < glyph->rows; ++y) {
+        i_render_color(render, tx + glyph->left, ty - glyph->top + y,
+                       glyph->width, bmp, cl);
+        bmp += glyph->width;
       }
     }
 
-    tx += slot->advance.x / 64;
-    ty -= slot->advance.y / 64;
+    tx += glyph->advance.x / 64;
+    ty -= glyph->advance.y / 64;
   }
 
-  if (render)
-    i_render_delete(render);
-
-  if (work_bmp)
-    myfree(work_bmp);
-
   return 1;
 }
 
@@ -993,6 +1101,57 @@ i_ft2_has_chars(FT2_Fonthandle *handle, char const *text, size_t len,
   return count;
 }
 
+/*
+=item i_ft2_glyph_cache_size(handle)
+
+Returns the byte budget for the font's glyph cache.
+
+=cut
+*/
+
+size_t
+i_ft2_glyph_cache_size(FT2_Fonthandle *handle) {
+  return handle->cache_size;
+}
+
+/*
+=item i_ft2_set_glyph_cache_size(handle, size)
+
+Sets the byte budget for the font's glyph cache, discarding the least
+recently used glyphs if the cache is now over budget.
+
+A size of 0 disables caching.
+
+=cut
+*/
+
+int
+i_ft2_set_glyph_cache_size(FT2_Fonthandle *handle, size_t size) {
+  handle->cache_size = size;
+  while (handle->cache_oldest && handle->cache_bytes > size)
+    ft2_cache_remove(handle, handle->cache_oldest);
+
+  return 1;
+}
+
+/*
+=item i_ft2_glyph_cache_stats(handle, stats)
+
+Fills in I<stats> with the current size, usage and hit counts for the
+font's glyph cache.
+
+=cut
+*/
+
+void
+i_ft2_glyph_cache_stats(FT2_Fonthandle *handle, i_ft2_cache_stats *stats) {
+  stats->size = handle->cache_size;
+  stats->bytes = handle->cache_bytes;
+  stats->entries = handle->cache_entries;
+  stats->hits = handle->cache_hits;
+  stats->misses = handle->cache_misses;
+}
+
 /* uses a method described in fterrors.h to build an error translation
    function
 */
@@ -1066,6 +1225,239 @@ make_bmp_map(FT_Bitmap *bitmap, unsigned char *map) {
   return 1;
 }
 
+/*
+=item ft2_get_glyph(handle, c, index, char_width, char_height, load_flags, render_mode)
+
+Returns the metrics, and if I<render_mode> isn't FT2_NOT_RENDERED the
+bitmap, of the given glyph, from the font's glyph cache if possible,
+otherwise by loading and rendering it with FreeType.
+
+The size should already be set with FT_Set_Char_Size() to
+I<char_width> and I<char_height>, which are only used as part of the
+cache key.  Other settings that change the loaded glyph, such as the
+transformation and resolution, clear the cache when they change.
+
+Any glyph, rendered or not, satisfies a request with FT2_NOT_RENDERED.
+
+The result is only valid until the next call.
+
+Returns NULL on failure.
+
+=cut
+*/
+
+static ft2_glyph *
+ft2_get_glyph(FT2_Fonthandle *handle, unsigned long c, FT_UInt index,
+              FT_F26Dot6 char_width, FT_F26Dot6 char_height, int load_flags,
+              int render_mode) {
+  unsigned long hash = 
+    FT2_GLYPH_HASH(index, char_width, char_height, load_flags);
+  ft2_glyph *glyph;
+  ft2_glyph *unrendered = NULL;
+  FT_GlyphSlot slot;
+  FT_Error error;
+
+  if (handle->cache_buckets) {
+    for (glyph = handle->cache_buckets[hash]; glyph; 
+         glyph = glyph->hash_next) {
+      if (glyph->index == index
+          && glyph->char_width == char_width
+          && glyph->char_height == char_height
+          && glyph->load_flags == load_flags) {
+        if (render_mode == FT2_NOT_RENDERED
+            || glyph->render_mode == render_mode) {
+          ++handle->cache_hits;
+          if (glyph != handle->cache_newest) {
+            /* move to the front of the LRU list */
+            glyph->newer->older = glyph->older;
+            if (glyph->older)
+              glyph->older->newer = glyph->newer;
+            else
+              handle->cache_oldest = glyph->newer;
+            glyph->newer = NULL;
+            glyph->older = handle->cache_newest;
+            handle->cache_newest->newer = glyph;
+            handle->cache_newest = glyph;
+          }
+          return glyph;
+        }
+        else if (glyph->render_mode == FT2_NOT_RENDERED) {
+          /* replaced by the rendered glyph below */
+          unrendered = glyph;
+        }
+      }
+    }
+  }
+  ++handle->cache_misses;
+
+  error = FT_Load_Glyph(handle->face, index, load_flags);
+  if (error) {
+    ft2_push_message(error);
+    i_push_errorf(0, "loading glyph for character \\x%02lx (glyph 0x%04X)",
+                  c, index);
+    return NULL;
+  }
+  slot = handle->face->glyph;
+
+  glyph = mymalloc(sizeof(ft2_glyph));
+  glyph->index = index;
+  glyph->char_width = char_width;
+  glyph->char_height = char_height;
+  glyph->load_flags = load_flags;
+  glyph->render_mode = render_mode;
+  glyph->metrics = slot->metrics;
+  glyph->advance = slot->advance;
+  glyph->bitmap = NULL;
+  glyph->left = glyph->top = 0;
+  glyph->width = glyph->rows = 0;
+  glyph->bytes = sizeof(ft2_glyph);
+
+  if (render_mode != FT2_NOT_RENDERED && slot->metrics.width) {
+    unsigned x, y;
+    unsigned char const *bmp;
+    unsigned char *out;
+
+    error = FT_Render_Glyph(slot, render_mode);
+    if (error) {
+      ft2_push_message(error);
+      i_push_errorf(0, "rendering glyph 0x%04lX (character \\x%02X)", c, index);
+      myfree(glyph);
+      return NULL;
+    }
+
+    glyph->left = slot->bitmap_left;
+    glyph->top = slot->bitmap_top;
+    glyph->width = slot->bitmap.width;
+    glyph->rows = slot->bitmap.rows;
+    if (glyph->width && glyph->rows) {
+      size_t bitmap_size = (size_t)glyph->width * glyph->rows;
+
+      bmp = slot->bitmap.buffer;
+      glyph->bitmap = out = mymalloc(bitmap_size);
+      glyph->bytes += bitmap_size;
+      if (slot->bitmap.pixel_mode == ft_pixel_mode_mono) {
+        for (y = 0; y < glyph->rows; ++y) {
+          for (x = 0; x < glyph->width; ++x)
+            *out++ = (bmp[x / 8] & (0x80 >> (x % 8))) ? 0xff : 0;
+          bmp += slot->bitmap.pitch;
+        }
+      }
+      else {
+        /* grey scale or something we can treat as greyscale */
+        /* we create a map to convert from the bitmap values to 0-255 */
+        unsigned char map[256];
+
+        if (!make_bmp_map(&slot->bitmap, map)) {
+          myfree(glyph->bitmap);
+          myfree(glyph);
+          return NULL;
+        }
+        for (y = 0; y < glyph->rows; ++y) {
+          for (x = 0; x < glyph->width; ++x)
+            *out++ = map[bmp[x]];
+          bmp += slot->bitmap.pitch;
+        }
+      }
+    }
+  }
+
+  if (unrendered)
+    ft2_cache_remove(handle, unrendered);
+
+  if (glyph->bytes > handle->cache_size) {
+    /* too big to cache, but the caller still needs it */
+    if (handle->cache_scratch)
+      ft2_glyph_free(handle->cache_scratch);
+    handle->cache_scratch = glyph;
+    return glyph;
+  }
+
+  while (handle->cache_oldest
+         && handle->cache_bytes + glyph->bytes > handle->cache_size)
+    ft2_cache_remove(handle, handle->cache_oldest);
+
+  if (!handle->cache_buckets) {
+    size_t i;
+    handle->cache_buckets = mymalloc(sizeof(ft2_glyph *) * FT2_CACHE_BUCKETS);
+    for (i = 0; i < FT2_CACHE_BUCKETS; ++i)
+      handle->cache_buckets[i] = NULL;
+  }
+  glyph->hash_next = handle->cache_buckets[hash];
+  handle->cache_buckets[hash] = glyph;
+  glyph->newer = NULL;
+  glyph->older = handle->cache_newest;
+  if (handle->cache_newest)
+    handle->cache_newest->newer = glyph;
+  else
+    handle->cache_oldest = glyph;
+  handle->cache_newest = glyph;
+  handle->cache_bytes += glyph->bytes;
+  ++handle->cache_entries;
+
+  return glyph;
+}
+
+/*
+=item ft2_cache_remove(handle, glyph)
+
+Removes I<glyph> from the glyph cache and releases it.
+
+=cut
+*/
+
+static void
+ft2_cache_remove(FT2_Fonthandle *handle, ft2_glyph *glyph) {
+  unsigned long hash = 
+    FT2_GLYPH_HASH(glyph->index, glyph->char_width, glyph->char_height,
+                   glyph->load_flags);
+  ft2_glyph **chain = handle->cache_buckets + hash;
+
+  while (*chain != glyph)
+    chain = &(*chain)->hash_next;
+  *chain = glyph->hash_next;
+
+  if (glyph->newer)
+    glyph->newer->older = glyph->older;
+  else
+    handle->cache_newest = glyph->older;
+  if (glyph->older)
+    glyph->older->newer = glyph->newer;
+  else
+    handle->cache_oldest = glyph->newer;
+
+  handle->cache_bytes -= glyph->bytes;
+  --handle->cache_entries;
+  ft2_glyph_free(glyph);
+}
+
+/*
+=item ft2_cache_clear(handle)
+
+Empties the glyph cache, for when a font setting that changes the
+loaded glyphs changes.
+
+The hit and miss counts are kept.
+
+=cut
+*/
+
+static void
+ft2_cache_clear(FT2_Fonthandle *handle) {
+  while (handle->cache_oldest)
+    ft2_cache_remove(handle, handle->cache_oldest);
+  if (handle->cache_scratch) {
+    ft2_glyph_free(handle->cache_scratch);
+    handle->cache_scratch = NULL;
+  }
+}
+
+static void
+ft2_glyph_free(ft2_glyph *glyph) {
+  if (glyph->bitmap)
+    myfree(glyph->bitmap);
+  myfree(glyph);
+}
+
 /* FREETYPE_PATCH was introduced in 2.0.6, we don't want a false 
    positive on 2.0.0 to 2.0.4, so we accept a false negative in 2.0.5 */
 #ifndef FREETYPE_PATCH
@@ -1259,6 +1651,7 @@ i_ft2_set_mm_coords(FT2_Fonthandle *handle, int coord_count, const long *coords)
     ft2_push_message(error);
     return 0;
   }
+  ft2_cache_clear(handle);
   
   return 1;
 #else 
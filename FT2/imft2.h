@@ -7,6 +7,23 @@ typedef struct FT2_Fonthandle FT2_Fonthandle;
 
 typedef FT2_Fonthandle* Imager__Font__FT2x;
 
+typedef struct {
+  size_t size;
+  size_t bytes;
+  size_t entries;
+  unsigned long hits;
+  unsigned long misses;
+} i_ft2_cache_stats;
+
+/* one string for i_ft2_text_multi() */
+typedef struct {
+  i_img_dim x, y;
+  const i_color *cl;
+  char const *text;
+  size_t len;
+  int utf8;
+} i_ft2_text_item;
+
 extern int i_ft2_version(int runtime, char *buf, size_t buf_size);
 extern void i_ft2_start(void);
 extern FT2_Fonthandle * i_ft2_new(const char *name, int index);
@@ -23,6 +40,10 @@ extern int i_ft2_text(FT2_Fonthandle *handle, i_img *im, i_img_dim tx, i_img_dim
                       const i_color *cl, double cheight, double cwidth, 
                       char const *text, size_t len, int align, int aa, 
                       int vlayout, int utf8);
+extern int i_ft2_text_multi(FT2_Fonthandle *handle, i_img *im,
+                            const i_ft2_text_item *items, size_t count,
+                            double cheight, double cwidth, int align,
+                            int aa, int vlayout);
 extern int i_ft2_cp(FT2_Fonthandle *handle, i_img *im, i_img_dim tx, i_img_dim ty, 
                     int channel, double cheight, double cwidth, 
                     char const *text, size_t len, int align, int aa, 
@@ -49,5 +70,10 @@ i_ft2_set_mm_coords(FT2_Fonthandle *handle, int coord_count, const long *coords)
 
 void ft2_transform_box(FT2_Fonthandle *handle, i_img_dim bbox[4]);
 
+extern size_t i_ft2_glyph_cache_size(FT2_Fonthandle *handle);
+extern int i_ft2_set_glyph_cache_size(FT2_Fonthandle *handle, size_t size);
+extern void i_ft2_glyph_cache_stats(FT2_Fonthandle *handle,
+                                    i_ft2_cache_stats *stats);
+
 #endif
 
@@ -595,6 +595,111 @@ SKIP:
     ok($im->write(file => "testout/noaanorm.ppm"), "save test image")
       or diag "Saving result image: ", $im->errstr;
   }
+
+  { # glyph cache
+    my $font = Imager::Font->new(file => $deffont, type => "ft2");
+    ok($font, "make font for glyph cache tests");
+    is($font->glyph_cache_size, 1048576, "default cache size");
+    my %stats = $font->glyph_cache_stats;
+    is_deeply(\%stats,
+	      { size => 1048576, bytes => 0, entries => 0, hits => 0, misses => 0 },
+	      "cache starts empty");
+
+    my %common = (font => $font, size => 30, x => 5, y => 40,
+		  color => "#FFF", aa => 1, string => "ABBA");
+    my $im = Imager->new(xsize => 150, ysize => 50);
+    ok($im->string(%common), "draw text");
+    %stats = $font->glyph_cache_stats;
+    is($stats{entries}, 2, "two glyphs cached");
+    ok($stats{bytes} > 0, "cache uses some memory");
+    my $misses = $stats{misses};
+    my $hits = $stats{hits};
+
+    my $im2 = Imager->new(xsize => 150, ysize => 50);
+    ok($im2->string(%common), "draw text again");
+    is_image($im2, $im, "same result from cached glyphs");
+    %stats = $font->glyph_cache_stats;
+    is($stats{misses}, $misses, "no misses the second time");
+    ok($stats{hits} > $hits, "only hits");
+    $hits = $stats{hits};
+
+    my @bbox = $font->bounding_box(%common);
+    ok(@bbox, "bounding box of the same text");
+    %stats = $font->glyph_cache_stats;
+    is($stats{hits}, $hits + 4, "bbox uses the rendered glyphs");
+    is($stats{misses}, $misses, "without loading them again");
+
+    is($font->glyph_cache_size(size => 0), 1048576,
+       "disable cache, returns the old size");
+    is($font->glyph_cache_size, 0, "check new size");
+    %stats = $font->glyph_cache_stats;
+    is($stats{entries}, 0, "shrinking the cache discards glyphs");
+    my $im3 = Imager->new(xsize => 150, ysize => 50);
+    ok($im3->string(%common), "draw text without the cache");
+    is_image($im3, $im, "same result without the cache");
+    %stats = $font->glyph_cache_stats;
+    is($stats{entries}, 0, "nothing cached");
+    is($stats{bytes}, 0, "and no memory used");
+
+    ok(!$font->glyph_cache_size(size => -1), "negative size fails");
+    is(Imager->errstr, "glyph_cache_size: size must be a non-negative integer",
+       "check message");
+
+    my $tfont = Imager::Font->new(file => $deffont, type => "ft2");
+    ok($tfont->bounding_box(%common, font => $tfont), "load some glyphs");
+    %stats = $tfont->glyph_cache_stats;
+    is($stats{entries}, 2, "glyphs cached");
+    ok($tfont->transform(matrix => Imager::Matrix2d->rotate(degrees => 10)),
+       "set a transform");
+    %stats = $tfont->glyph_cache_stats;
+    is($stats{entries}, 0, "transform empties the cache");
+    is($stats{bytes}, 0, "and frees the memory");
+  }
+
+  { # draw_many
+    my $font = Imager::Font->new(file => $deffont, type => "ft2", size => 16,
+				 color => "#FFFFFF");
+    ok($font, "make font for draw_many");
+    my @strings =
+      (
+       [ 10, 20, "Alpha" ],
+       [ 100, 30, "Beta", "#FF0000" ],
+       [ -5, 60, "Gamma \x{e9}", Imager::Color->new(0, 0, 255) ],
+       [ 150, 95, "Delta" ],
+       [ 30, 45, "" ],
+      );
+    for my $aa (0, 1) {
+      for my $align (0, 1) {
+	my $im = Imager->new(xsize => 200, ysize => 100);
+	ok($font->draw_many(image => $im, strings => \@strings, aa => $aa,
+			    align => $align),
+	   "aa $aa align $align: draw_many")
+	  or diag $im->errstr;
+	my $cmp = Imager->new(xsize => 200, ysize => 100);
+	for my $entry (@strings) {
+	  my ($x, $y, $text, $color) = @$entry;
+	  $cmp->string(font => $font, x => $x, y => $y, text => $text,
+		       aa => $aa, align => $align,
+		       defined $color ? (color => $color) : ());
+	}
+	is_image($im, $cmp, "aa $aa align $align: matches string() calls");
+      }
+    }
+
+    my $im = Imager->new(xsize => 200, ysize => 100);
+    ok(!$font->draw_many(image => $im, strings => [ [ 0, 0 ] ]),
+       "fail with missing text");
+    is($im->errstr, "draw_many: strings[0] must be [ x, y, string, color ]",
+       "check message");
+    ok(!$font->draw_many(image => $im, strings => "abc"),
+       "fail with strings not an array");
+    is($im->errstr, "draw_many: strings must be an array reference",
+       "check message");
+    ok(!$font->draw_many(image => $im, vlayout => 1,
+			 strings => [ [ 0, 0, "abc" ] ]),
+       "fail with no vertical metrics");
+    is($im->errstr, "face has no vertical metrics", "check message");
+  }
 }
 
 Imager->close_log();
@@ -4,7 +4,7 @@ use strict;
 use Imager;
 
 BEGIN {
-  our $VERSION = "1.005";
+  our $VERSION = "1.006";
 
   require XSLoader;
   XSLoader::load('Imager::File::GIF', $VERSION);
@@ -56,6 +56,19 @@ Imager->register_reader
 
      return map bless({ IMG => $_, ERRSTR => undef }, "Imager"), @imgs;
    },
+   iter =>
+   sub {
+     my ($io, %hsh) = @_;
+
+     my $iter = i_readgif_iter_new($io, $hsh{composite} ? 1 : 0);
+     unless ($iter) {
+       Imager->_set_error(Imager->_error_as_msg);
+       return;
+     }
+
+     # keep the io object alive as long as the iterator
+     return bless { ITER => $iter, IO => $io }, "Imager::File::GIF::Iter";
+   },
   );
 
 Imager->register_writer
@@ -90,6 +103,23 @@ Imager->register_writer
    },
   );
 
+package Imager::File::GIF::Iter;
+
+sub next {
+  my ($self) = @_;
+
+  my $img = Imager::File::GIF::i_readgif_iter_next($self->{ITER});
+  unless ($img) {
+    my $msg = Imager->_error_as_msg;
+    Imager->_set_error(length $msg ? $msg : undef);
+    return;
+  }
+
+  return bless { IMG => $img, ERRSTR => undef }, "Imager";
+}
+
+1;
+
 __END__
 
 =head1 NAME
@@ -13,6 +13,22 @@ extern "C" {
 DEFINE_IMAGER_CALLBACKS;
 DEFINE_IMAGER_PERL_CALLBACKS;
 
+MODULE = Imager::File::GIF  PACKAGE = Imager::File::GIF::IterRaw  PREFIX=gifiter_
+
+#define gifiter_DESTROY(iter) i_readgif_iter_destroy(iter)
+
+void
+gifiter_DESTROY(iter)
+        Imager::File::GIF::IterRaw iter
+
+int
+gifiter_CLONE_SKIP(...)
+    CODE:
+        (void)items;
+        RETVAL = 1;
+    OUTPUT:
+        RETVAL
+
 MODULE = Imager::File::GIF  PACKAGE = Imager::File::GIF
 
 double
@@ -142,6 +158,14 @@ i_readgif_multi_wiol(ig)
           myfree(imgs);
         }
 
+Imager::File::GIF::IterRaw
+i_readgif_iter_new(ig, composite = 0)
+        Imager::IO ig
+        int composite
+
+Imager::ImgRaw
+i_readgif_iter_next(iter)
+        Imager::File::GIF::IterRaw iter
 
 BOOT:
 	PERL_INITIALIZE_IMAGER_CALLBACKS;
@@ -133,6 +133,7 @@ myEGifCloseFile(GifFileType *GifFile, int *ErrorCode) {
 
 static char const *gif_error_msg(int code);
 static void gif_push_error(int code);
+static int can_optimize(i_img **imgs, int count);
 
 /* Make some variables global, so we could access them faster: */
 
@@ -536,366 +537,413 @@ standard.
 =cut
 */
 
-static i_img **
-i_readgif_multi_low(GifFileType *GifFile, int *count, int page) {
-  i_img *img;
-  int i, j, Width, Height, ExtCode;
-  size_t Size;
-  int ImageNum = 0, ColorMapSize = 0;
-  ColorMapObject *ColorMap;
- 
-  GifRecordType RecordType;
-  GifByteType *Extension;
-  
+/* state carried between images while reading a GIF file */
+typedef struct {
+  GifFileType *GifFile;
   GifRowType GifRow;
-  int got_gce = 0;
-  int trans_index = 0; /* transparent index if we see a GCE */
-  int gif_delay = 0; /* delay from a GCE */
-  int user_input = 0; /* user input flag from a GCE */
-  int disposal = 0; /* disposal method from a GCE */
-  int got_ns_loop = 0;
-  int ns_loop = 0;
-  char *comment = NULL; /* a comment */
-  i_img **results = NULL;
-  int result_alloc = 0;
+  int ImageNum; /* images seen so far, read or skipped */
+  int got_gce;
+  int trans_index; /* transparent index if we see a GCE */
+  int gif_delay; /* delay from a GCE */
+  int user_input; /* user input flag from a GCE */
+  int disposal; /* disposal method from a GCE */
+  int got_ns_loop;
+  int ns_loop;
+  char *comment; /* a comment */
+} gif_read_state;
+
+static void
+gif_read_init(gif_read_state *st, GifFileType *GifFile) {
+  st->GifFile = GifFile;
+  st->GifRow = (GifRowType) mymalloc(GifFile->SWidth * sizeof(GifPixelType));
+  st->ImageNum = 0;
+  st->got_gce = 0;
+  st->trans_index = 0;
+  st->gif_delay = 0;
+  st->user_input = 0;
+  st->disposal = 0;
+  st->got_ns_loop = 0;
+  st->ns_loop = 0;
+  st->comment = NULL;
+}
+
+static void
+gif_read_cleanup(gif_read_state *st) {
+  if (st->GifRow) {
+    myfree(st->GifRow);
+    st->GifRow = NULL;
+  }
+  if (st->comment) {
+    myfree(st->comment);
+    st->comment = NULL;
+  }
+}
+
+/*
+=item gif_read_line(st, img, y, width, &image_colors)
+
+Read a line of image data into row y of img, expanding the palette if
+the line refers to colors outside the color map.
+
+If img is NULL the line is read and discarded.
+
+=cut
+*/
+
+static int
+gif_read_line(gif_read_state *st, i_img *img, i_img_dim y, int Width,
+	      int *image_colors) {
+  GifRowType GifRow = st->GifRow;
+
+  if (DGifGetLine(st->GifFile, GifRow, Width) == GIF_ERROR) {
+    gif_push_error(myGifError(st->GifFile));
+    i_push_error(0, "Reading GIF line");
+    return 0;
+  }
+  if (!img)
+    return 1;
+
+  /* range check the scanline if needed */
+  if (*image_colors != 256) {
+    int x;
+    i_color black; /* used to expand the palette if needed */
+    int i;
+
+    for (i = 0; i < MAXCHANNELS; ++i)
+      black.channel[i] = 0;
+    for (x = 0; x < Width; ++x) {
+      while (GifRow[x] >= *image_colors) {
+	/* expand the palette since a palette index is too big */
+	i_addcolors(img, &black, 1);
+	++*image_colors;
+      }
+    }
+  }
+
+  i_ppal(img, 0, Width, y, GifRow);
+
+  return 1;
+}
+
+/*
+=item gif_read_frame(st, want, &img)
+
+Read the image following an image descriptor record.
+
+If want is zero the image data is skipped and *img is set to NULL,
+otherwise *img is set to a new paletted image tagged as described for
+i_readgif_multi_low().
+
+Returns non-zero on success.
+
+=cut
+*/
+
+static int
+gif_read_frame(gif_read_state *st, int want, i_img **pimg) {
+  GifFileType *GifFile = st->GifFile;
+  int i, j, Width, Height;
+  int ColorMapSize = 0;
+  ColorMapObject *ColorMap;
   int channels;
   int image_colors = 0;
-  i_color black; /* used to expand the palette if needed */
-  int error;
+  i_img *img = NULL;
 
-  for (i = 0; i < MAXCHANNELS; ++i)
-    black.channel[i] = 0;
-  
-  *count = 0;
+  *pimg = NULL;
 
-  mm_log((1,"i_readgif_multi_low(GifFile %p, , count %p)\n", GifFile, count));
+  if (DGifGetImageDesc(GifFile) == GIF_ERROR) {
+    gif_push_error(myGifError(GifFile));
+    i_push_error(0, "Unable to get image descriptor");
+    return 0;
+  }
 
-  Size = GifFile->SWidth * sizeof(GifPixelType);
-  
-  GifRow = (GifRowType) mymalloc(Size);
+  Width = GifFile->Image.Width;
+  Height = GifFile->Image.Height;
+  mm_log((1,"gif_read_frame: Image %d at (%d, %d) [%dx%d]: \n",
+	  st->ImageNum, GifFile->Image.Left, GifFile->Image.Top, Width,
+	  Height));
 
-  /* Scan the content of the GIF file and load the image(s) in: */
-  do {
-    if (DGifGetRecordType(GifFile, &RecordType) == GIF_ERROR) {
-      gif_push_error(myGifError(GifFile));
-      i_push_error(0, "Unable to get record type");
-      free_images(results, *count);
-      (void)myDGifCloseFile(GifFile, NULL);
-      myfree(GifRow);
-      if (comment)
-	myfree(comment);
-      return NULL;
+  if (GifFile->Image.Left + GifFile->Image.Width > GifFile->SWidth ||
+      GifFile->Image.Top + GifFile->Image.Height > GifFile->SHeight) {
+    i_push_errorf(0, "Image %d is not confined to screen dimension, aborted.\n", st->ImageNum);
+    return 0;
+  }
+
+  if (want) {
+    if (( ColorMap = (GifFile->Image.ColorMap ? GifFile->Image.ColorMap : GifFile->SColorMap) )) {
+      mm_log((1, "Adding local colormap\n"));
+      ColorMapSize = ColorMap->ColorCount;
+    } else {
+      /* No colormap and we are about to read in the image - 
+	 abandon for now */
+      mm_log((1, "Going in with no colormap\n"));
+      i_push_error(0, "Image does not have a local or a global color map");
+      return 0;
     }
-    
-    switch (RecordType) {
-    case IMAGE_DESC_RECORD_TYPE:
-      if (DGifGetImageDesc(GifFile) == GIF_ERROR) {
-	gif_push_error(myGifError(GifFile));
-	i_push_error(0, "Unable to get image descriptor");
-        free_images(results, *count);
-	(void)myDGifCloseFile(GifFile, NULL);
-	myfree(GifRow);
-	if (comment)
-	  myfree(comment);
-	return NULL;
-      }
 
-      Width = GifFile->Image.Width;
-      Height = GifFile->Image.Height;
-      mm_log((1,"i_readgif_multi_low: Image %d at (%d, %d) [%dx%d]: \n",
-              ImageNum, GifFile->Image.Left, GifFile->Image.Top, Width,
-              Height));
+    channels = 3;
+    if (st->got_gce && st->trans_index >= 0)
+      channels = 4;
+    if (!i_int_check_image_file_limits(Width, Height, channels, sizeof(i_sample_t))) {
+      mm_log((1, "i_readgif: image size exceeds limits\n"));
+      return 0;
+    }
+    img = i_img_pal_new(Width, Height, channels, 256);
+    if (!img)
+      return 0;
 
-      if (GifFile->Image.Left + GifFile->Image.Width > GifFile->SWidth ||
-          GifFile->Image.Top + GifFile->Image.Height > GifFile->SHeight) {
-        i_push_errorf(0, "Image %d is not confined to screen dimension, aborted.\n",ImageNum);
-        free_images(results, *count);
-        (void)myDGifCloseFile(GifFile, NULL);
-        myfree(GifRow);
-        if (comment)
-          myfree(comment);
-        return(0);
-      }
+    /* populate the palette of the new image */
+    mm_log((1, "ColorMapSize %d\n", ColorMapSize));
+    for (i = 0; i < ColorMapSize; ++i) {
+      i_color col;
+      col.rgba.r = ColorMap->Colors[i].Red;
+      col.rgba.g = ColorMap->Colors[i].Green;
+      col.rgba.b = ColorMap->Colors[i].Blue;
+      if (channels == 4 && st->trans_index == i)
+	col.rgba.a = 0;
+      else
+	col.rgba.a = 255;
 
-      if (page == -1 || page == ImageNum) {
-	if (( ColorMap = (GifFile->Image.ColorMap ? GifFile->Image.ColorMap : GifFile->SColorMap) )) {
-	  mm_log((1, "Adding local colormap\n"));
-	  ColorMapSize = ColorMap->ColorCount;
-	} else {
-	  /* No colormap and we are about to read in the image - 
-	     abandon for now */
-	  mm_log((1, "Going in with no colormap\n"));
-	  i_push_error(0, "Image does not have a local or a global color map");
-	  free_images(results, *count);
-	  (void)myDGifCloseFile(GifFile, NULL);
-	  myfree(GifRow);
-	  if (comment)
-	    myfree(comment);
-	  return NULL;
-	}
-	
-	channels = 3;
-	if (got_gce && trans_index >= 0)
-	  channels = 4;
-	if (!i_int_check_image_file_limits(Width, Height, channels, sizeof(i_sample_t))) {
-	  free_images(results, *count);
-	  mm_log((1, "i_readgif: image size exceeds limits\n"));
-	  (void)myDGifCloseFile(GifFile, NULL);
-	  myfree(GifRow);
-	  if (comment)
-	    myfree(comment);
-	  return NULL;
-	}
-	img = i_img_pal_new(Width, Height, channels, 256);
-	if (!img) {
-	  free_images(results, *count);
-	  (void)myDGifCloseFile(GifFile, NULL);
-	  if (comment)
-	    myfree(comment);
-	  myfree(GifRow);
-	  return NULL;
-	}
-	/* populate the palette of the new image */
-	mm_log((1, "ColorMapSize %d\n", ColorMapSize));
-	for (i = 0; i < ColorMapSize; ++i) {
-	  i_color col;
-	  col.rgba.r = ColorMap->Colors[i].Red;
-	  col.rgba.g = ColorMap->Colors[i].Green;
-	  col.rgba.b = ColorMap->Colors[i].Blue;
-	  if (channels == 4 && trans_index == i)
-	    col.rgba.a = 0;
-	  else
-	    col.rgba.a = 255;
-	  
-	  i_addcolors(img, &col, 1);
-	}
-	image_colors = ColorMapSize;
-	++*count;
-	if (*count > result_alloc) {
-	  if (result_alloc == 0) {
-	    result_alloc = 5;
-	    results = mymalloc(result_alloc * sizeof(i_img *));
-	  }
-	  else {
-	    /* myrealloc never fails (it just dies if it can't allocate) */
-	    result_alloc *= 2;
-	    results = myrealloc(results, result_alloc * sizeof(i_img *));
-	  }
-	}
-	results[*count-1] = img;
-	i_tags_set(&img->tags, "i_format", "gif", -1);
-	i_tags_setn(&img->tags, "gif_left", GifFile->Image.Left);
-	/**(char *)0 = 1;*/
-	i_tags_setn(&img->tags, "gif_top",  GifFile->Image.Top);
-	i_tags_setn(&img->tags, "gif_interlace", GifFile->Image.Interlace);
-	i_tags_setn(&img->tags, "gif_screen_width", GifFile->SWidth);
-	i_tags_setn(&img->tags, "gif_screen_height", GifFile->SHeight);
-	i_tags_setn(&img->tags, "gif_colormap_size", ColorMapSize);
-	if (GifFile->SColorMap && !GifFile->Image.ColorMap) {
-	  i_tags_setn(&img->tags, "gif_background",
-		      GifFile->SBackGroundColor);
-	}
-	if (GifFile->Image.ColorMap) {
-	  i_tags_setn(&img->tags, "gif_localmap", 1);
-	}
-	if (got_gce) {
-	    i_color trans;
-	  if (trans_index >= 0
-              && i_getcolors(img, trans_index, &trans, 1) == 1) {
-	    i_tags_setn(&img->tags, "gif_trans_index", trans_index);
-	    i_tags_set_color(&img->tags, "gif_trans_color", 0, &trans);
-	  }
-	  i_tags_setn(&img->tags, "gif_delay", gif_delay);
-	  i_tags_setn(&img->tags, "gif_user_input", user_input);
-	  i_tags_setn(&img->tags, "gif_disposal", disposal);
-	}
-	got_gce = 0;
-	if (got_ns_loop)
-	  i_tags_setn(&img->tags, "gif_loop", ns_loop);
-	if (comment) {
-	  i_tags_set(&img->tags, "gif_comment", comment, strlen(comment));
-	  myfree(comment);
-	  comment = NULL;
-	}
-	
-	if (GifFile->Image.Interlace) {
-	  for (i = 0; i < 4; i++) {
-	    for (j = InterlacedOffset[i]; j < Height; 
-		 j += InterlacedJumps[i]) {
-	      if (DGifGetLine(GifFile, GifRow, Width) == GIF_ERROR) {
-		gif_push_error(myGifError(GifFile));
-		i_push_error(0, "Reading GIF line");
-		free_images(results, *count);
-		(void)myDGifCloseFile(GifFile, NULL);
-		myfree(GifRow);
-		if (comment)
-		  myfree(comment);
-		return NULL;
-	      }
-
-	      /* range check the scanline if needed */
-	      if (image_colors != 256) {
-		int x;
-		for (x = 0; x < Width; ++x) {
-		  while (GifRow[x] >= image_colors) {
-		    /* expand the palette since a palette index is too big */
-		    i_addcolors(img, &black, 1);
-		    ++image_colors;
-		  }
-		}
-	      }
-
-	      i_ppal(img, 0, Width, j, GifRow);
-	    }
-	  }
-	}
-	else {
-	  for (i = 0; i < Height; i++) {
-	    if (DGifGetLine(GifFile, GifRow, Width) == GIF_ERROR) {
-	      gif_push_error(myGifError(GifFile));
-	      i_push_error(0, "Reading GIF line");
-	      free_images(results, *count);
-	      (void)myDGifCloseFile(GifFile, NULL);
-	      myfree(GifRow);
-	      if (comment)
-		myfree(comment);
-	      return NULL;
-	    }
-	    
-	    /* range check the scanline if needed */
-	    if (image_colors != 256) {
-	      int x;
-	      for (x = 0; x < Width; ++x) {
-		while (GifRow[x] >= image_colors) {
-		  /* expand the palette since a palette index is too big */
-		  i_addcolors(img, &black, 1);
-		  ++image_colors;
-		}
-	      }
-	    }
+      i_addcolors(img, &col, 1);
+    }
+    image_colors = ColorMapSize;
+    i_tags_set(&img->tags, "i_format", "gif", -1);
+    i_tags_setn(&img->tags, "gif_left", GifFile->Image.Left);
+    i_tags_setn(&img->tags, "gif_top",  GifFile->Image.Top);
+    i_tags_setn(&img->tags, "gif_interlace", GifFile->Image.Interlace);
+    i_tags_setn(&img->tags, "gif_screen_width", GifFile->SWidth);
+    i_tags_setn(&img->tags, "gif_screen_height", GifFile->SHeight);
+    i_tags_setn(&img->tags, "gif_colormap_size", ColorMapSize);
+    if (GifFile->SColorMap && !GifFile->Image.ColorMap) {
+      i_tags_setn(&img->tags, "gif_background",
+		  GifFile->SBackGroundColor);
+    }
+    if (GifFile->Image.ColorMap) {
+      i_tags_setn(&img->tags, "gif_localmap", 1);
+    }
+    if (st->got_gce) {
+      i_color trans;
+      if (st->trans_index >= 0
+	  && i_getcolors(img, st->trans_index, &trans, 1) == 1) {
+	i_tags_setn(&img->tags, "gif_trans_index", st->trans_index);
+	i_tags_set_color(&img->tags, "gif_trans_color", 0, &trans);
+      }
+      i_tags_setn(&img->tags, "gif_delay", st->gif_delay);
+      i_tags_setn(&img->tags, "gif_user_input", st->user_input);
+      i_tags_setn(&img->tags, "gif_disposal", st->disposal);
+    }
+    if (st->got_ns_loop)
+      i_tags_setn(&img->tags, "gif_loop", st->ns_loop);
+    if (st->comment) {
+      i_tags_set(&img->tags, "gif_comment", st->comment, strlen(st->comment));
+    }
+  }
 
-	    i_ppal(img, 0, Width, i, GifRow);
-	  }
-	}
+  /* a GCE and comment only apply to the image that follows them */
+  st->got_gce = 0;
+  if (st->comment) {
+    myfree(st->comment);
+    st->comment = NULL;
+  }
 
-	/* must be only one image wanted and that was it */
-	if (page != -1) {
-	  myfree(GifRow);
-	  (void)myDGifCloseFile(GifFile, NULL);
-	  if (comment)
-	    myfree(comment);
-	  return results;
+  if (img && GifFile->Image.Interlace) {
+    for (i = 0; i < 4; i++) {
+      for (j = InterlacedOffset[i]; j < Height; j += InterlacedJumps[i]) {
+	if (!gif_read_line(st, img, j, Width, &image_colors)) {
+	  i_img_destroy(img);
+	  return 0;
 	}
       }
-      else {
-	/* skip the image */
-	/* whether interlaced or not, it has the same number of lines */
-	/* giflib does't have an interface to skip the image data */
-	for (i = 0; i < Height; i++) {
-	  if (DGifGetLine(GifFile, GifRow, Width) == GIF_ERROR) {
-	    gif_push_error(myGifError(GifFile));
-	    i_push_error(0, "Reading GIF line");
-	    free_images(results, *count);
-	    myfree(GifRow);
-	    (void)myDGifCloseFile(GifFile, NULL);
-	    if (comment) 
-	      myfree(comment);
-	    return NULL;
-	  }
-	}
-
-	/* kill the comment so we get the right comment for the page */
-	if (comment) {
-	  myfree(comment);
-	  comment = NULL;
-	}
+    }
+  }
+  else {
+    /* whether interlaced or not, a skipped image has the same number
+       of lines, giflib doesn't have an interface to skip the image data */
+    for (i = 0; i < Height; i++) {
+      if (!gif_read_line(st, img, i, Width, &image_colors)) {
+	if (img)
+	  i_img_destroy(img);
+	return 0;
       }
-      ImageNum++;
-      break;
-    case EXTENSION_RECORD_TYPE:
-      /* Skip any extension blocks in file: */
-      if (DGifGetExtension(GifFile, &ExtCode, &Extension) == GIF_ERROR) {
+    }
+  }
+
+  ++st->ImageNum;
+  *pimg = img;
+
+  return 1;
+}
+
+/*
+=item gif_read_extension(st)
+
+Read an extension record, saving any information we use into st.
+
+Returns non-zero on success.
+
+=cut
+*/
+
+static int
+gif_read_extension(gif_read_state *st) {
+  GifFileType *GifFile = st->GifFile;
+  GifByteType *Extension;
+  int ExtCode;
+
+  /* Skip any extension blocks in file: */
+  if (DGifGetExtension(GifFile, &ExtCode, &Extension) == GIF_ERROR) {
+    gif_push_error(myGifError(GifFile));
+    i_push_error(0, "Reading extension record");
+    return 0;
+  }
+  /* possibly this should be an error, but "be liberal in what you accept" */
+  if (!Extension)
+    return 1;
+  if (ExtCode == 0xF9) {
+    st->got_gce = 1;
+    if (Extension[1] & 1)
+      st->trans_index = Extension[4];
+    else
+      st->trans_index = -1;
+    st->gif_delay = Extension[2] + 256 * Extension[3];
+    st->user_input = (Extension[1] & 2) != 0;
+    st->disposal = ((unsigned)Extension[1] >> 2) & 7;
+  }
+  if (ExtCode == 0xFF && *Extension == 11) {
+    if (memcmp(Extension+1, "NETSCAPE2.0", 11) == 0) {
+      if (DGifGetExtensionNext(GifFile, &Extension) == GIF_ERROR) {
 	gif_push_error(myGifError(GifFile));
-	i_push_error(0, "Reading extension record");
-        free_images(results, *count);
-	myfree(GifRow);
-	(void)myDGifCloseFile(GifFile, NULL);
-	if (comment)
-	  myfree(comment);
-	return NULL;
-      }
-      /* possibly this should be an error, but "be liberal in what you accept" */
-      if (!Extension)
-	break;
-      if (ExtCode == 0xF9) {
-        got_gce = 1;
-        if (Extension[1] & 1)
-          trans_index = Extension[4];
-        else
-          trans_index = -1;
-        gif_delay = Extension[2] + 256 * Extension[3];
-        user_input = (Extension[1] & 2) != 0;
-        disposal = ((unsigned)Extension[1] >> 2) & 7;
-      }
-      if (ExtCode == 0xFF && *Extension == 11) {
-        if (memcmp(Extension+1, "NETSCAPE2.0", 11) == 0) {
-          if (DGifGetExtensionNext(GifFile, &Extension) == GIF_ERROR) {
-            gif_push_error(myGifError(GifFile));
-            i_push_error(0, "reading loop extension");
-            free_images(results, *count);
-	    myfree(GifRow);
-	    (void)myDGifCloseFile(GifFile, NULL);
-	    if (comment)
-	      myfree(comment);
-            return NULL;
-          }
-          if (Extension && *Extension == 3) {
-            got_ns_loop = 1;
-            ns_loop = Extension[2] + 256 * Extension[3];
-          }
-        }
-      }
-      else if (ExtCode == 0xFE) {
-        /* while it's possible for a GIF file to contain more than one
-           comment, I'm only implementing a single comment per image, 
-           with the comment saved into the following image.
-           If someone wants more than that they can implement it.
-           I also don't handle comments that take more than one block.
-        */
-        if (!comment) {
-          comment = mymalloc(*Extension+1);
-          memcpy(comment, Extension+1, *Extension);
-          comment[*Extension] = '\0';
-        }
+	i_push_error(0, "reading loop extension");
+	return 0;
       }
-      while (Extension != NULL) {
-	if (DGifGetExtensionNext(GifFile, &Extension) == GIF_ERROR) {
-	  gif_push_error(myGifError(GifFile));
-	  i_push_error(0, "reading next block of extension");
-          free_images(results, *count);
-	  myfree(GifRow);
-	  (void)myDGifCloseFile(GifFile, NULL);
-	  if (comment)
-	    myfree(comment);
-	  return NULL;
-	}
+      if (Extension && *Extension == 3) {
+	st->got_ns_loop = 1;
+	st->ns_loop = Extension[2] + 256 * Extension[3];
       }
+    }
+  }
+  else if (ExtCode == 0xFE) {
+    /* while it's possible for a GIF file to contain more than one
+       comment, I'm only implementing a single comment per image, 
+       with the comment saved into the following image.
+       If someone wants more than that they can implement it.
+       I also don't handle comments that take more than one block.
+    */
+    if (!st->comment) {
+      st->comment = mymalloc(*Extension+1);
+      memcpy(st->comment, Extension+1, *Extension);
+      st->comment[*Extension] = '\0';
+    }
+  }
+  while (Extension != NULL) {
+    if (DGifGetExtensionNext(GifFile, &Extension) == GIF_ERROR) {
+      gif_push_error(myGifError(GifFile));
+      i_push_error(0, "reading next block of extension");
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/*
+=item gif_read_image(st, want, &img)
+
+Read records up to and including the next image.
+
+Returns 1 if an image was read or skipped, setting *img to the image,
+or to NULL if want was zero.  Returns 0 at the end of the file and -1
+on error.
+
+=cut
+*/
+
+static int
+gif_read_image(gif_read_state *st, int want, i_img **pimg) {
+  GifRecordType RecordType;
+
+  *pimg = NULL;
+  while (1) {
+    if (DGifGetRecordType(st->GifFile, &RecordType) == GIF_ERROR) {
+      gif_push_error(myGifError(st->GifFile));
+      i_push_error(0, "Unable to get record type");
+      return -1;
+    }
+
+    switch (RecordType) {
+    case IMAGE_DESC_RECORD_TYPE:
+      return gif_read_frame(st, want, pimg) ? 1 : -1;
+
+    case EXTENSION_RECORD_TYPE:
+      if (!gif_read_extension(st))
+	return -1;
       break;
+
     case TERMINATE_RECORD_TYPE:
+      return 0;
+
     default:		    /* Should be trapped by DGifGetRecordType. */
       break;
     }
-  } while (RecordType != TERMINATE_RECORD_TYPE);
+  }
+}
+
+static i_img **
+i_readgif_multi_low(GifFileType *GifFile, int *count, int page) {
+  gif_read_state st;
+  i_img *img;
+  i_img **results = NULL;
+  int result_alloc = 0;
+  int ImageNum;
+  int error;
+  int rc;
 
-  if (comment) {
-    if (*count) {
-      i_tags_set(&(results[*count-1]->tags), "gif_comment", comment, 
-                 strlen(comment));
+  *count = 0;
+
+  mm_log((1,"i_readgif_multi_low(GifFile %p, , count %p)\n", GifFile, count));
+
+  gif_read_init(&st, GifFile);
+
+  /* Scan the content of the GIF file and load the image(s) in: */
+  while ((rc = gif_read_image(&st, page == -1 || page == st.ImageNum, &img)) > 0) {
+    if (!img)
+      continue;
+
+    ++*count;
+    if (*count > result_alloc) {
+      if (result_alloc == 0) {
+	result_alloc = 5;
+	results = mymalloc(result_alloc * sizeof(i_img *));
+      }
+      else {
+	/* myrealloc never fails (it just dies if it can't allocate) */
+	result_alloc *= 2;
+	results = myrealloc(results, result_alloc * sizeof(i_img *));
+      }
+    }
+    results[*count-1] = img;
+
+    /* must be only one image wanted and that was it */
+    if (page != -1) {
+      gif_read_cleanup(&st);
+      (void)myDGifCloseFile(GifFile, NULL);
+      return results;
     }
-    myfree(comment);
   }
-  
-  myfree(GifRow);
+
+  if (rc < 0) {
+    free_images(results, *count);
+    gif_read_cleanup(&st);
+    (void)myDGifCloseFile(GifFile, NULL);
+    return NULL;
+  }
+
+  if (st.comment && *count) {
+    i_tags_set(&(results[*count-1]->tags), "gif_comment", st.comment, 
+	       strlen(st.comment));
+  }
+  ImageNum = st.ImageNum;
+  gif_read_cleanup(&st);
   
   if (myDGifCloseFile(GifFile, &error) == GIF_ERROR) {
     gif_push_error(error);
@@ -1053,8 +1101,243 @@ i_readgif_single_wiol(io_glue *ig, int page) {
   return result;
 }
 
+struct i_gif_iter_tag {
+  gif_read_state st;
+  int composite;
+  int done;
+
+  /* the composited logical screen */
+  i_img *screen;
+
+  /* the area under the last frame if its disposal is 3 */
+  i_img *saved;
+
+  /* where the last frame was drawn and how to dispose of it */
+  i_img_dim last_left, last_top, last_width, last_height;
+  int last_disposal;
+};
+
 /*
-=item do_write(GifFileType *gf, i_gif_opts *opts, i_img *img, i_palidx *data)
+=item i_readgif_iter_new(ig, composite)
+
+Start reading the images from a GIF file one at a time.
+
+If composite is non-zero, each image returned by
+i_readgif_iter_next() is the full logical screen as it would be
+displayed after that frame, taking the disposal method of the
+previous frame into account, as an 8-bit RGBA image.
+
+Otherwise each image is the frame as returned by
+i_readgif_multi_wiol().
+
+Only the data for the current frame is held in memory, so large
+animations can be processed without reading every frame first.
+
+=cut
+*/
+
+i_gif_iter *
+i_readgif_iter_new(io_glue *ig, int composite) {
+  GifFileType *GifFile;
+  int gif_error;
+  i_gif_iter *iter;
+
+  i_clear_error();
+
+  gif_mutex_lock(mutex);
+
+  if ((GifFile = myDGifOpen((void *)ig, io_glue_read_cb, &gif_error )) == NULL) {
+    gif_push_error(gif_error);
+    i_push_error(0, "Cannot create giflib callback object");
+    mm_log((1,"i_readgif_iter_new: Unable to open callback datasource.\n"));
+    gif_mutex_unlock(mutex);
+    return NULL;
+  }
+
+  if (composite
+      && !i_int_check_image_file_limits(GifFile->SWidth, GifFile->SHeight,
+					4, sizeof(i_sample_t))) {
+    mm_log((1, "i_readgif_iter_new: screen size exceeds limits\n"));
+    (void)myDGifCloseFile(GifFile, NULL);
+    gif_mutex_unlock(mutex);
+    return NULL;
+  }
+
+  gif_mutex_unlock(mutex);
+
+  iter = mymalloc(sizeof(i_gif_iter));
+  gif_read_init(&iter->st, GifFile);
+  iter->composite = composite;
+  iter->done = 0;
+  iter->screen = NULL;
+  iter->saved = NULL;
+  iter->last_left = iter->last_top = 0;
+  iter->last_width = iter->last_height = 0;
+  iter->last_disposal = 0;
+
+  return iter;
+}
+
+static i_img *
+iter_composite(i_gif_iter *iter, i_img *frame) {
+  GifFileType *GifFile = iter->st.GifFile;
+  i_img *result;
+  i_img_dim left, top;
+  int disposal;
+
+  if (!iter->screen) {
+    iter->screen = i_img_8_new(GifFile->SWidth, GifFile->SHeight, 4);
+    if (!iter->screen)
+      return NULL;
+  }
+
+  /* dispose of the previous frame */
+  if (iter->last_disposal == 2) {
+    i_color clear;
+    memset(&clear, 0, sizeof(clear));
+    i_box_filled(iter->screen, iter->last_left, iter->last_top,
+		 iter->last_left + iter->last_width - 1,
+		 iter->last_top + iter->last_height - 1, &clear);
+  }
+  else if (iter->last_disposal == 3 && iter->saved) {
+    i_copyto(iter->screen, iter->saved, 0, 0, iter->last_width,
+	     iter->last_height, iter->last_left, iter->last_top);
+  }
+  if (iter->saved) {
+    i_img_destroy(iter->saved);
+    iter->saved = NULL;
+  }
+
+  left = GifFile->Image.Left;
+  top = GifFile->Image.Top;
+  if (!i_tags_get_int(&frame->tags, "gif_disposal", 0, &disposal))
+    disposal = 0;
+
+  if (disposal == 3) {
+    /* keep what's under the frame to restore before the next */
+    iter->saved = i_img_8_new(frame->xsize, frame->ysize, 4);
+    if (!iter->saved)
+      return NULL;
+    i_copyto(iter->saved, iter->screen, left, top, left + frame->xsize,
+	     top + frame->ysize, 0, 0);
+  }
+
+  if (frame->channels == 4) {
+    i_rubthru(iter->screen, frame, left, top, 0, 0,
+	      frame->xsize, frame->ysize);
+  }
+  else {
+    /* no transparency, the palette alpha is all 255 */
+    i_copyto(iter->screen, frame, 0, 0, frame->xsize, frame->ysize,
+	     left, top);
+  }
+
+  iter->last_left = left;
+  iter->last_top = top;
+  iter->last_width = frame->xsize;
+  iter->last_height = frame->ysize;
+  iter->last_disposal = disposal;
+
+  result = i_copy(iter->screen);
+  if (!result)
+    return NULL;
+
+  /* take the frame's tags, dropping those that only describe the
+     frame as stored in the file */
+  i_tags_destroy(&result->tags);
+  result->tags = frame->tags;
+  i_tags_new(&frame->tags);
+  i_tags_delbyname(&result->tags, "gif_trans_index");
+  i_tags_delbyname(&result->tags, "gif_trans_color");
+  i_tags_delbyname(&result->tags, "gif_disposal");
+  i_tags_delbyname(&result->tags, "gif_localmap");
+  i_tags_delbyname(&result->tags, "gif_colormap_size");
+  i_tags_setn(&result->tags, "gif_left", 0);
+  i_tags_setn(&result->tags, "gif_top", 0);
+
+  return result;
+}
+
+/*
+=item i_readgif_iter_next(iter)
+
+Read the next image from the file.
+
+Returns NULL with no error message at the end of the file, or NULL
+with an error message on failure.
+
+=cut
+*/
+
+i_img *
+i_readgif_iter_next(i_gif_iter *iter) {
+  i_img *img;
+  int rc;
+
+  i_clear_error();
+
+  if (iter->done)
+    return NULL;
+
+  gif_mutex_lock(mutex);
+
+  rc = gif_read_image(&iter->st, 1, &img);
+  if (rc <= 0) {
+    int error;
+    iter->done = 1;
+    if (rc == 0) {
+      if (myDGifCloseFile(iter->st.GifFile, &error) == GIF_ERROR) {
+	gif_push_error(error);
+	i_push_error(0, "Closing GIF file object");
+      }
+      else if (!iter->st.ImageNum) {
+	i_push_error(0, "no images found in file");
+      }
+    }
+    else {
+      (void)myDGifCloseFile(iter->st.GifFile, NULL);
+    }
+    iter->st.GifFile = NULL;
+    gif_mutex_unlock(mutex);
+    return NULL;
+  }
+
+  gif_mutex_unlock(mutex);
+
+  if (iter->composite) {
+    i_img *frame = img;
+    img = iter_composite(iter, frame);
+    i_img_destroy(frame);
+  }
+
+  return img;
+}
+
+/*
+=item i_readgif_iter_destroy(iter)
+
+Release the iterator, closing the file if it's still open.
+
+=cut
+*/
+
+void
+i_readgif_iter_destroy(i_gif_iter *iter) {
+  if (iter->st.GifFile) {
+    gif_mutex_lock(mutex);
+    (void)myDGifCloseFile(iter->st.GifFile, NULL);
+    gif_mutex_unlock(mutex);
+  }
+  gif_read_cleanup(&iter->st);
+  if (iter->screen)
+    i_img_destroy(iter->screen);
+  if (iter->saved)
+    i_img_destroy(iter->saved);
+  myfree(iter);
+}
+
+/*
+=item do_write(GifFileType *gf, int interlace, i_img_dim width, i_img_dim height, i_palidx *data)
 
 Internal.  Low level image write function.  Writes in interlace if
 that was requested in the GIF options.
@@ -1064,12 +1347,13 @@ Returns non-zero on success.
 =cut
 */
 static undef_int 
-do_write(GifFileType *gf, int interlace, i_img *img, i_palidx *data) {
+do_write(GifFileType *gf, int interlace, i_img_dim width, i_img_dim height,
+	 i_palidx *data) {
   if (interlace) {
     int i, j;
     for (i = 0; i < 4; ++i) {
-      for (j = InterlacedOffset[i]; j < img->ysize; j += InterlacedJumps[i]) {
-	if (EGifPutLine(gf, data+j*img->xsize, gf->Image.Width) == GIF_ERROR) {
+      for (j = InterlacedOffset[i]; j < height; j += InterlacedJumps[i]) {
+	if (EGifPutLine(gf, data+j*width, gf->Image.Width) == GIF_ERROR) {
 	  gif_push_error(myGifError(gf));
 	  i_push_error(0, "Could not save image data:");
 	  mm_log((1, "Error in EGifPutLine\n"));
@@ -1080,14 +1364,14 @@ do_write(GifFileType *gf, int interlace, i_img *img, i_palidx *data) {
   }
   else {
     int y;
-    for (y = 0; y < img->ysize; ++y) {
+    for (y = 0; y < height; ++y) {
       if (EGifPutLine(gf, data, gf->Image.Width) == GIF_ERROR) {
 	gif_push_error(myGifError(gf));
 	i_push_error(0, "Could not save image data:");
 	mm_log((1, "Error in EGifPutLine\n"));
 	return 0;
       }
-      data += img->xsize;
+      data += width;
     }
   }
 
@@ -1095,17 +1379,21 @@ do_write(GifFileType *gf, int interlace, i_img *img, i_palidx *data) {
 }
 
 /*
-=item do_gce(GifFileType *gf, int index, i_gif_opts *opts, int want_trans, int trans_index)
+=item do_gce(GifFileType *gf, i_img *img, int want_trans, int trans_index, int disposal)
 
 Internal. Writes the GIF graphics control extension, if necessary.
 
+If C<disposal> is negative the disposal method is taken from the
+C<gif_disposal> tag.
+
 Returns non-zero on success.
 
 =cut
 */
 
 static int
-do_gce(GifFileType *gf, i_img *img, int want_trans, int trans_index)
+do_gce(GifFileType *gf, i_img *img, int want_trans, int trans_index,
+       int disposal)
 {
   unsigned char gce[4] = {0};
   int want_gce = 0;
@@ -1128,7 +1416,11 @@ do_gce(GifFileType *gf, i_img *img, int want_trans, int trans_index)
     gce[0] |= 2U;
     ++want_gce;
   }
-  if (i_tags_get_int(&img->tags, "gif_disposal", 0, &disposal_method)) {
+  if (disposal >= 0) {
+    gce[0] |= (disposal & 3) << 2;
+    ++want_gce;
+  }
+  else if (i_tags_get_int(&img->tags, "gif_disposal", 0, &disposal_method)) {
     gce[0] |= (disposal_method & 3) << 2;
     ++want_gce;
   }
@@ -1327,6 +1619,9 @@ need_version_89a(i_quantize *quant, i_img **imgs, int count) {
       break;
     }
   }
+  /* optimized frames set the disposal method */
+  if (can_optimize(imgs, count))
+    need_89a = 1;
 
   return need_89a;
 }
@@ -1442,6 +1737,208 @@ quant_paletted(i_quantize *quant, i_img *img) {
   return data;
 }
 
+/*
+=item gif_optimizer
+
+State for the C<gif_optimize> write option.  Tracks what a viewer
+displays after each frame so later frames only need to contain what
+changed.
+
+=cut
+*/
+
+typedef struct {
+  /* logical screen size */
+  i_img_dim width, height;
+
+  /* screen contents, alpha is zero where nothing has been drawn */
+  i_color *shown;
+} gif_optimizer;
+
+/* the part of a frame that's written */
+typedef struct {
+  i_img_dim left, top, width, height;
+  i_palidx *data;
+
+  /* non-zero if data contains the transparent index */
+  int use_trans;
+} gif_frame;
+
+static int
+opt_init(gif_optimizer *opt, i_img_dim width, i_img_dim height) {
+  size_t pixels = (size_t)width * height;
+
+  if (pixels > (size_t)-1 / sizeof(i_color))
+    return 0;
+
+  opt->width = width;
+  opt->height = height;
+  opt->shown = mymalloc(pixels * sizeof(i_color));
+  memset(opt->shown, 0, pixels * sizeof(i_color));
+
+  return 1;
+}
+
+static int
+opt_same(const i_color *color, const i_color *shown) {
+  return shown->channel[3]
+    && color->channel[0] == shown->channel[0]
+    && color->channel[1] == shown->channel[1]
+    && color->channel[2] == shown->channel[2];
+}
+
+/*
+=item opt_draw(opt, left, top, width, height, data, colors, trans_index)
+
+Record the non-transparent pixels of a frame as displayed.
+
+=cut
+*/
+
+static void
+opt_draw(gif_optimizer *opt, i_img_dim left, i_img_dim top,
+	 i_img_dim width, i_img_dim height, const i_palidx *data,
+	 const i_color *colors, int trans_index) {
+  i_img_dim x, y;
+
+  for (y = 0; y < height; ++y) {
+    i_color *row = opt->shown + (top + y) * opt->width + left;
+    for (x = 0; x < width; ++x) {
+      int index = *data++;
+      if (index != trans_index) {
+	row[x] = colors[index];
+	row[x].channel[3] = 255;
+      }
+    }
+  }
+}
+
+/*
+=item opt_frame(opt, left, top, width, height, data, colors, trans_index, frame)
+
+Crop a frame to the rectangle of pixels that change what's displayed.
+
+If there's a transparent index, pixels within that rectangle that
+don't change may be written as transparent instead.  That's only done
+if it reduces the number of changes in index from one pixel to the
+next, as a cheap estimate of whether it makes the LZW stream smaller.
+
+=cut
+*/
+
+static void
+opt_frame(gif_optimizer *opt, i_img_dim left, i_img_dim top,
+	  i_img_dim width, i_img_dim height, const i_palidx *data,
+	  const i_color *colors, int trans_index, gif_frame *frame) {
+  i_img_dim x, y;
+  i_img_dim minx = width, maxx = -1, miny = height, maxy = -1;
+  size_t plain_changes = 0, marked_changes = 0;
+  int last_plain = -1, last_marked = -1;
+  int mark;
+  i_palidx *out;
+
+  for (y = 0; y < height; ++y) {
+    const i_color *row = opt->shown + (top + y) * opt->width + left;
+    const i_palidx *p = data + y * width;
+    for (x = 0; x < width; ++x) {
+      if (p[x] != trans_index && !opt_same(colors + p[x], row + x)) {
+	if (x < minx)
+	  minx = x;
+	if (x > maxx)
+	  maxx = x;
+	if (y < miny)
+	  miny = y;
+	maxy = y;
+      }
+    }
+  }
+
+  if (maxy < 0) {
+    /* nothing changed, but the frame still needs writing for its
+       delay, the first pixel is either transparent or already shown */
+    minx = maxx = miny = maxy = 0;
+  }
+
+  frame->left = left + minx;
+  frame->top = top + miny;
+  frame->width = maxx - minx + 1;
+  frame->height = maxy - miny + 1;
+  frame->data = out = mymalloc(frame->width * frame->height);
+
+  for (y = miny; y <= maxy; ++y) {
+    const i_color *row = opt->shown + (top + y) * opt->width + left;
+    const i_palidx *p = data + y * width;
+    for (x = minx; x <= maxx; ++x) {
+      int marked = p[x];
+      if (trans_index >= 0 && opt_same(colors + p[x], row + x))
+	marked = trans_index;
+      if (p[x] != last_plain)
+	++plain_changes;
+      if (marked != last_marked)
+	++marked_changes;
+      last_plain = p[x];
+      last_marked = marked;
+    }
+  }
+
+  mark = marked_changes < plain_changes;
+  frame->use_trans = 0;
+  for (y = miny; y <= maxy; ++y) {
+    const i_color *row = opt->shown + (top + y) * opt->width + left;
+    const i_palidx *p = data + y * width;
+    for (x = minx; x <= maxx; ++x) {
+      int index = p[x];
+      if (mark && opt_same(colors + index, row + x))
+	index = trans_index;
+      if (index == trans_index)
+	frame->use_trans = 1;
+      *out++ = index;
+    }
+  }
+
+  mm_log((1, "opt_frame: position " i_DFp " size " i_DFp " of " i_DFp
+	  ", %s unchanged pixels\n", i_DFcp(frame->left, frame->top),
+	  i_DFcp(frame->width, frame->height), i_DFcp(width, height),
+	  mark ? "transparent" : "kept"));
+
+  opt_draw(opt, left, top, width, height, data, colors, trans_index);
+}
+
+/*
+=item can_optimize(imgs, count)
+
+Returns non-zero if the C<gif_optimize> option is set and the
+animation can be optimized.
+
+Optimized frames are written as changes to the frames before them,
+so frames that ask for the previous frame to be disposed of can't be
+optimized.
+
+=cut
+*/
+
+static int
+can_optimize(i_img **imgs, int count) {
+  int optimize;
+  int i;
+
+  if (count < 2
+      || !i_tags_get_int(&imgs[0]->tags, "gif_optimize", 0, &optimize)
+      || !optimize)
+    return 0;
+
+  for (i = 0; i < count; ++i) {
+    int disposal;
+    if (i_tags_get_int(&imgs[i]->tags, "gif_disposal", 0, &disposal)
+	&& (disposal & 3) >= 2) {
+      mm_log((1, "  image %d has disposal %d, not optimizing\n", i, disposal));
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
 /*
 =item i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count, i_gif_opts *opts)
 
@@ -1470,12 +1967,20 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
   i_color *glob_colors = NULL;
   int glob_color_count = 0;
   int glob_want_trans;
+  int glob_trans_slot; /* the global map has a transparent entry */
   int glob_paletted = 0; /* the global map was made from the image palettes */
   int colors_paletted = 0;
   int want_trans = 0;
+  int trans_slot = 0;
   int interlace;
   int gif_background;
   int error;
+  int optimize;
+  gif_optimizer opt;
+  gif_frame frame;
+
+  opt.shown = NULL;
+  frame.data = NULL;
 
   mm_log((1, "i_writegif_low(quant %p, gf  %p, imgs %p, count %d)\n", 
 	  quant, gf, imgs, count));
@@ -1493,6 +1998,8 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
   if (quant->mc_count > quant->mc_size)
     quant->mc_count = quant->mc_size;
 
+  optimize = can_optimize(imgs, count);
+
   if (!i_tags_get_int(&imgs[0]->tags, "gif_screen_width", 0, &scrw))
     scrw = 0;
   if (!i_tags_get_int(&imgs[0]->tags, "gif_screen_height", 0, &scrh))
@@ -1531,12 +2038,19 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
     }
   }
   glob_want_trans = glob_want_trans && quant->transp != tr_none ;
+  /* optimized frames use transparency for unchanged pixels */
+  glob_trans_slot = glob_want_trans || optimize;
 
   if (scrw > 0xFFFF || scrh > 0xFFFF) {
     i_push_error(0, "screen size too large for GIF");
     goto fail_cleanup;
   }
 
+  if (optimize && !opt_init(&opt, scrw, scrh)) {
+    mm_log((1, "  screen too large to optimize\n"));
+    optimize = 0;
+  }
+
   orig_count = quant->mc_count;
   orig_size = quant->mc_size;
 
@@ -1546,11 +2060,11 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
     quant->mc_colors = glob_colors;
     memcpy(glob_colors, orig_colors, sizeof(i_color) * quant->mc_count);
     /* we have some images that want to use the global map */
-    if (glob_want_trans && quant->mc_count == 256) {
+    if (glob_trans_slot && quant->mc_count == 256) {
       mm_log((2, "  disabling transparency for global map - no space\n"));
-      glob_want_trans = 0;
+      glob_want_trans = glob_trans_slot = 0;
     }
-    if (glob_want_trans && quant->mc_size == 256) {
+    if (glob_trans_slot && quant->mc_size == 256) {
       mm_log((2, "  reserving color for transparency\n"));
       --quant->mc_size;
     }
@@ -1567,6 +2081,7 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
     quant->mc_colors = glob_colors;
     quant->mc_count = glob_color_count;
     want_trans = glob_want_trans && imgs[0]->channels == 4;
+    trans_slot = want_trans || (optimize && glob_trans_slot);
 
     if (!i_tags_get_int(&imgs[0]->tags, "gif_background", 0, &gif_background))
       gif_background = 0;
@@ -1577,11 +2092,12 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
   }
   else {
     want_trans = quant->transp != tr_none && imgs[0]->channels == 4;
+    trans_slot = want_trans;
     i_quant_makemap(quant, imgs, 1);
     colors_paletted = has_common_palette(imgs, 1, quant);
   }
 
-  if ((map = make_gif_map(quant, imgs[0], want_trans)) == NULL) {
+  if ((map = make_gif_map(quant, imgs[0], trans_slot)) == NULL) {
     mm_log((1, "Error in MakeMapObject"));
     goto fail_cleanup;
   }
@@ -1594,7 +2110,7 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
   }
   else {
     int count = quant->mc_count;
-    if (want_trans)
+    if (trans_slot)
       ++count;
     while (count > (1 << color_bits))
       ++color_bits;
@@ -1614,6 +2130,11 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
     posx = 0;
   if (!i_tags_get_int(&imgs[0]->tags, "gif_top", 0, &posy))
     posy = 0;
+  if (optimize) {
+    /* as for the screen size */
+    if (posx < 0) posx = 0;
+    if (posy < 0) posy = 0;
+  }
 
   if (!localmaps[0]) {
     map = NULL;
@@ -1666,7 +2187,8 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
     goto fail_cleanup;
   }
 
-  if (!do_gce(gf, imgs[0], want_trans, trans_index)) {
+  /* optimized frames draw over the frames before them */
+  if (!do_gce(gf, imgs[0], want_trans, trans_index, optimize ? 1 : -1)) {
     goto fail_cleanup;
   }
 
@@ -1688,9 +2210,13 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
   if (map)
     FreeMapObject(map);
 
-  if (!do_write(gf, interlace, imgs[0], result)) {
+  if (!do_write(gf, interlace, imgs[0]->xsize, imgs[0]->ysize, result)) {
     goto fail_cleanup;
   }
+  if (optimize) {
+    opt_draw(&opt, posx, posy, imgs[0]->xsize, imgs[0]->ysize, result,
+	     quant->mc_colors, want_trans ? trans_index : -1);
+  }
   myfree(result);
   result = NULL;
 
@@ -1703,12 +2229,13 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
 
       want_trans = quant->transp != tr_none 
 	&& imgs[imgn]->channels == 4;
+      trans_slot = want_trans || optimize;
       /* if the caller gives us too many colours we can't do transparency */
-      if (want_trans && quant->mc_count == 256)
-	want_trans = 0;
+      if (trans_slot && quant->mc_count == 256)
+	want_trans = trans_slot = 0;
       /* if they want transparency but give us a big size, make it smaller
 	 to give room for a transparency colour */
-      if (want_trans && quant->mc_size == 256)
+      if (trans_slot && quant->mc_size == 256)
 	--quant->mc_size;
 
       if (has_common_palette(imgs+imgn, 1, quant)) {
@@ -1722,12 +2249,12 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
         mm_log((1, "error in i_quant_translate()"));
         goto fail_cleanup;
       }
-      if (want_trans) {
+      if (want_trans)
         i_quant_transparent(quant, result, imgs[imgn], quant->mc_count);
+      if (trans_slot)
         trans_index = quant->mc_count;
-      }
 
-      if ((map = make_gif_map(quant, imgs[imgn], want_trans)) == NULL) {
+      if ((map = make_gif_map(quant, imgs[imgn], trans_slot)) == NULL) {
         mm_log((1, "Error in MakeMapObject."));
         goto fail_cleanup;
       }
@@ -1740,30 +2267,55 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
       else
         result = i_quant_translate(quant, imgs[imgn]);
       want_trans = glob_want_trans && imgs[imgn]->channels == 4;
-      if (want_trans) {
+      trans_slot = want_trans || (optimize && glob_trans_slot);
+      if (want_trans)
         i_quant_transparent(quant, result, imgs[imgn], quant->mc_count);
+      if (trans_slot)
         trans_index = quant->mc_count;
-      }
       map = NULL;
     }
 
-    if (!do_gce(gf, imgs[imgn], want_trans, trans_index)) {
+    if (!i_tags_get_int(&imgs[imgn]->tags, "gif_left", 0, &posx))
+      posx = 0;
+    if (!i_tags_get_int(&imgs[imgn]->tags, "gif_top", 0, &posy))
+      posy = 0;
+
+    if (optimize) {
+      if (posx < 0) posx = 0;
+      if (posy < 0) posy = 0;
+      opt_frame(&opt, posx, posy, imgs[imgn]->xsize, imgs[imgn]->ysize,
+		result, quant->mc_colors, trans_slot ? trans_index : -1,
+		&frame);
+      myfree(result);
+      result = NULL;
+    }
+    else {
+      frame.left = posx;
+      frame.top = posy;
+      frame.width = imgs[imgn]->xsize;
+      frame.height = imgs[imgn]->ysize;
+      frame.data = result;
+      frame.use_trans = want_trans;
+      result = NULL;
+    }
+
+    if (!do_gce(gf, imgs[imgn], frame.use_trans, trans_index,
+		optimize ? 1 : -1)) {
+      if (map)
+        FreeMapObject(map);
       goto fail_cleanup;
     }
 
     if (!do_comments(gf, imgs[imgn])) {
+      if (map)
+        FreeMapObject(map);
       goto fail_cleanup;
     }
 
-    if (!i_tags_get_int(&imgs[imgn]->tags, "gif_left", 0, &posx))
-      posx = 0;
-    if (!i_tags_get_int(&imgs[imgn]->tags, "gif_top", 0, &posy))
-      posy = 0;
-
     if (!i_tags_get_int(&imgs[imgn]->tags, "gif_interlace", 0, &interlace))
       interlace = 0;
-    if (EGifPutImageDesc(gf, posx, posy, imgs[imgn]->xsize, 
-                         imgs[imgn]->ysize, interlace, map) == GIF_ERROR) {
+    if (EGifPutImageDesc(gf, frame.left, frame.top, frame.width,
+                         frame.height, interlace, map) == GIF_ERROR) {
       gif_push_error(myGifError(gf));
       i_push_error(0, "Could not save image descriptor");
       if (map)
@@ -1774,11 +2326,11 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
     if (map)
       FreeMapObject(map);
     
-    if (!do_write(gf, interlace, imgs[imgn], result)) {
+    if (!do_write(gf, interlace, frame.width, frame.height, frame.data)) {
       goto fail_cleanup;
     }
-    myfree(result);
-    result = NULL;
+    myfree(frame.data);
+    frame.data = NULL;
   }
 
   if (myEGifCloseFile(gf, &error) == GIF_ERROR) {
@@ -1795,6 +2347,7 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
   myfree(glob_colors);
   myfree(localmaps);
   myfree(glob_imgs);
+  myfree(opt.shown);
   quant->mc_colors = orig_colors;
 
   return 1;
@@ -1802,6 +2355,8 @@ i_writegif_low(i_quantize *quant, GifFileType *gf, i_img **imgs, int count) {
  fail_cleanup:
   quant->mc_colors = orig_colors;
   myfree(result);
+  myfree(frame.data);
+  myfree(opt.shown);
   myfree(glob_colors);
   myfree(localmaps);
   myfree(glob_imgs);
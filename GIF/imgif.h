@@ -8,6 +8,13 @@ double i_giflib_version(void);
 i_img *i_readgif_wiol(io_glue *ig, int **colour_table, int *colours);
 i_img *i_readgif_single_wiol(io_glue *ig, int page);
 extern i_img **i_readgif_multi_wiol(io_glue *ig, int *count);
+
+typedef struct i_gif_iter_tag i_gif_iter;
+typedef i_gif_iter *Imager__File__GIF__IterRaw;
+i_gif_iter *i_readgif_iter_new(io_glue *ig, int composite);
+i_img *i_readgif_iter_next(i_gif_iter *iter);
+void i_readgif_iter_destroy(i_gif_iter *iter);
+
 undef_int i_writegif_wiol(io_glue *ig, i_quantize *quant, 
                           i_img **imgs, int count);
 
@@ -4,7 +4,8 @@ use strict;
 $|=1;
 use Test::More;
 use Imager qw(:all);
-use Imager::Test qw(is_color3 test_image test_image_raw test_image_mono);
+use Imager::Test qw(is_color3 test_image test_image_raw test_image_mono
+                    is_image);
 use Imager::File::GIF;
 
 use Carp 'confess';
@@ -14,7 +15,7 @@ $SIG{__DIE__} = sub { confess @_ };
 
 init_log("testout/t105gif.log",1);
 
-plan tests => 147;
+plan tests => 175;
 
 my $green=i_color_new(0,255,0,255);
 my $blue=i_color_new(0,0,255,255);
@@ -743,6 +744,92 @@ SKIP:
 	 "check error message");
 }
 
+{ # gif_optimize writes frames as changes from the previous frame
+  my @frames;
+  for my $i (0 .. 3) {
+    my $im = Imager->new(xsize => 40, ysize => 30);
+    $im->box(filled => 1, color => "#404080");
+    $im->box(filled => 1, color => "#FF0000", xmin => 2 + $i * 5,
+	     ymin => 10, xmax => 10 + $i * 5, ymax => 18);
+    push @frames, $im;
+  }
+  my ($plain, $opt);
+  ok(Imager->write_multi({ data => \$plain, type => "gif",
+			   make_colors => "webmap" },
+			 map $_->copy, @frames),
+     "write unoptimized animation");
+  ok(Imager->write_multi({ data => \$opt, type => "gif",
+			   make_colors => "webmap", gif_optimize => 1 },
+			 map $_->copy, @frames),
+     "write optimized animation");
+  cmp_ok(length $opt, '<', length $plain, "optimized is smaller");
+  my @plain = Imager->read_multi(data => $plain);
+  my @opt = Imager->read_multi(data => $opt);
+  my $screen = Imager->new(xsize => 40, ysize => 30);
+  for my $i (0 .. 3) {
+    my $im = $opt[$i];
+    is($im->tags(name => "gif_disposal"), 1, "frame $i: not disposed");
+    $i and ok($im->getwidth * $im->getheight < 40 * 30,
+	      "frame $i: only changed area written");
+    $screen->rubthrough(src => $im, tx => $im->tags(name => "gif_left"),
+			ty => $im->tags(name => "gif_top"));
+    is_image($screen, $plain[$i]->to_rgb8, "frame $i: displays the same");
+  }
+}
+
+{ # read_multi_iter() reads a frame at a time
+  my @frames;
+  for my $i (0 .. 3) {
+    my $im = Imager->new(xsize => 20, ysize => 15, channels => 4);
+    $im->box(filled => 1, color => [ 255, 80 * $i, 0 ],
+	     xmin => 2, ymin => 2, xmax => 12, ymax => 10);
+    $im->settag(name => "gif_left", value => $i * 4);
+    $im->settag(name => "gif_top", value => $i * 3);
+    $im->settag(name => "gif_disposal", value => $i + 1);
+    push @frames, $im;
+  }
+  my $data;
+  ok(Imager->write_multi({ data => \$data, type => "gif",
+			   make_colors => "webmap",
+			   gif_screen_width => 40, gif_screen_height => 30 },
+			 @frames),
+     "write animation to iterate over");
+  my @multi = Imager->read_multi(data => $data);
+  my $iter = Imager->read_multi_iter(data => $data);
+  ok($iter, "make an iterator");
+  my @got;
+  while (my $im = $iter->next) {
+    push @got, $im;
+  }
+  ok(!Imager->errstr, "no error at the end");
+  is(@got, 4, "got every frame");
+  for my $i (0 .. 3) {
+    is_image($got[$i], $multi[$i], "frame $i matches read_multi()");
+  }
+
+  my $citer = Imager->read_multi_iter(data => $data, composite => 1);
+  ok($citer, "make a compositing iterator");
+  my $screen = Imager->new(xsize => 40, ysize => 30, channels => 4);
+  my $saved;
+  for my $i (0 .. 3) {
+    my ($left, $top) = ($i * 4, $i * 3);
+    # disposal 3 restores the area under frame 2 before frame 3
+    $i == 3 and $screen->paste(src => $saved, left => 8, top => 6);
+    $i == 2
+      and $saved = $screen->crop(left => $left, top => $top,
+				 width => 20, height => 15);
+    $screen->rubthrough(src => $multi[$i], tx => $left, ty => $top);
+    my $im = $citer->next;
+    is_image($im, $screen, "composited frame $i");
+    # disposal 2 clears the area of frame 1 before frame 2
+    $i == 1
+      and $screen->box(filled => 1, color => [ 0, 0, 0, 0 ],
+		       xmin => $left, ymin => $top,
+		       xmax => $left + 19, ymax => $top + 14);
+  }
+  ok(!$citer->next, "end of composited frames");
+}
+
 ext_test(1, <<'CODE', 1, "CVE-2026-8454");
 use Imager;
 my $im = Imager->new(file => "testimg/cve-2026-8454.gif", page => 1);
@@ -0,0 +1,17106 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of Imager.xs. Do not edit this file, edit Imager.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "Imager.xs"
+#define PERL_NO_GET_CONTEXT
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+#define NEED_newRV_noinc
+#define NEED_sv_2pv_nolen
+#define NEED_sv_2pvbyte
+#include "ppport.h"
+#ifdef __cplusplus
+}
+#endif
+
+#define i_int_hlines_testing() 1
+
+#include "imager.h"
+#include "feat.h"
+#include "dynaload.h"
+#include "regmach.h"
+#include "imextdef.h"
+#include "imextpltypes.h"
+#include "imperlio.h"
+#include <float.h>
+
+#if i_int_hlines_testing()
+#include "imageri.h"
+#endif
+
+#include "imperl.h"
+
+#define ARRAY_COUNT(array) (sizeof(array)/sizeof(*array))
+
+#ifndef SSize_t_MAX
+#define SSize_t_MAX (SSize_t)(~(Size_t)0 >> 1)
+#endif
+
+/*
+
+Context object management
+
+*/
+
+#ifdef PERL_IMPLICIT_CONTEXT
+
+#define MY_CXT_KEY "Imager::_context" XS_VERSION
+
+typedef struct {
+  im_context_t ctx;
+} my_cxt_t;
+
+START_MY_CXT
+
+static void
+start_context(pTHX) {
+  dMY_CXT;
+  MY_CXT.ctx = im_context_new();
+  sv_setref_pv(get_sv("Imager::_context", GV_ADD), "Imager::Context", MY_CXT.ctx);
+}
+
+static im_context_t
+perl_get_context(void) {
+  dTHX;
+  dMY_CXT;
+  
+  return MY_CXT.ctx;
+}
+
+#else
+
+static im_context_t perl_context;
+
+static void
+start_context(pTHX) {
+  perl_context = im_context_new();
+
+  /* just so it gets destroyed */
+  sv_setref_pv(get_sv("Imager::_context", GV_ADD), "Imager::Context", perl_context);
+}
+
+static im_context_t
+perl_get_context(void) {
+  return perl_context;
+}
+
+#endif
+
+typedef im_context_t Imager__Context;
+
+static void
+S_im_context_DESTROY(pTHX_ im_context_t ctx) {
+#ifdef PERL_IMPLICIT_CONTEXT
+  dMY_CXT;
+
+  if (ctx == MY_CXT.ctx)
+    MY_CXT.ctx = NULL;
+#else
+  perl_context = NULL;
+#endif
+
+  im_context_refdec(ctx, "DESTROY");
+}
+
+#define im_context_DESTROY(ctx) S_im_context_DESTROY(aTHX_ (ctx))
+
+/* used to represent channel lists parameters */
+typedef struct i_channel_list_tag {
+  int *channels;
+  int count;
+} i_channel_list;
+
+typedef struct {
+  size_t count;
+  const i_sample_t *samples;
+} i_sample_list;
+
+typedef struct {
+  size_t count;
+  const i_fsample_t *samples;
+} i_fsample_list;
+
+typedef struct {
+  size_t count;
+  const i_polygon_t *polygons;
+} i_polygon_list;
+
+typedef struct {
+  SV *sv;
+  SV *rsv;
+  size_t count;
+  i_trim_colors_t *colors;
+} i_trim_color_list;
+
+/*
+
+Allocate memory that will be discarded when mortals are discarded.
+
+*/
+
+static void *
+malloc_temp(pTHX_ size_t size) {
+  void *result;
+  Newx(result, size, char);
+  SAVEFREEPV(result);
+
+  return result;
+}
+
+static void *
+calloc_temp(pTHX_ size_t size) {
+  void *result;
+  Newxz(result, size, char);
+  SAVEFREEPV(result);
+
+  return result;
+}
+
+/* for use with the T_AVARRAY typemap */
+#define doublePtr(size) ((double *)calloc_temp(aTHX_ sizeof(double) * (size)))
+#define SvDouble(sv, pname) (SvNV(sv))
+
+#define intPtr(size) ((int *)calloc_temp(aTHX_ sizeof(int) * (size)))
+#define SvInt(sv, pname) (SvIV(sv))
+
+#define i_img_dimPtr(size) ((i_img_dim *)calloc_temp(aTHX_ sizeof(i_img_dim) * (size)))
+#define SvI_img_dim(sv, pname) (SvIV(sv))
+
+#define i_colorPtr(size) ((i_color *)calloc_temp(aTHX_ sizeof(i_color) * (size)))
+
+#define SvI_color(sv, pname) S_sv_to_i_color(aTHX_ sv, pname)
+
+static i_color
+S_sv_to_i_color(pTHX_ SV *sv, const char *pname) {
+  if (!sv_derived_from(sv, "Imager::Color")) {
+    croak("%s: not a color object", pname);
+  }
+  return *INT2PTR(i_color *, SvIV((SV *)SvRV(sv)));
+}
+
+/* These functions are all shared - then comes platform dependant code */
+static int getstr(void *hv_t,char *key,char **store) {
+  dTHX;
+  SV** svpp;
+  HV* hv=(HV*)hv_t;
+
+  mm_log((1,"getstr(hv_t %p, key %s, store %p)\n",hv_t,key,store));
+
+  if ( !hv_exists(hv,key,strlen(key)) ) return 0;
+
+  svpp=hv_fetch(hv, key, strlen(key), 0);
+  *store=SvPV(*svpp, PL_na );
+
+  return 1;
+}
+
+static int getint(void *hv_t,char *key,int *store) {
+  dTHX;
+  SV** svpp;
+  HV* hv=(HV*)hv_t;  
+
+  mm_log((1,"getint(hv_t %p, key %s, store %p)\n",hv_t,key,store));
+
+  if ( !hv_exists(hv,key,strlen(key)) ) return 0;
+
+  svpp=hv_fetch(hv, key, strlen(key), 0);
+  *store=(int)SvIV(*svpp);
+  return 1;
+}
+
+static int getdouble(void *hv_t,char* key,double *store) {
+  dTHX;
+  SV** svpp;
+  HV* hv=(HV*)hv_t;
+
+  mm_log((1,"getdouble(hv_t %p, key %s, store %p)\n",hv_t,key,store));
+
+  if ( !hv_exists(hv,key,strlen(key)) ) return 0;
+  svpp=hv_fetch(hv, key, strlen(key), 0);
+  *store=(double)SvNV(*svpp);
+  return 1;
+}
+
+static int getvoid(void *hv_t,char* key,void **store) {
+  dTHX;
+  SV** svpp;
+  HV* hv=(HV*)hv_t;
+
+  mm_log((1,"getvoid(hv_t %p, key %s, store %p)\n",hv_t,key,store));
+
+  if ( !hv_exists(hv,key,strlen(key)) ) return 0;
+
+  svpp=hv_fetch(hv, key, strlen(key), 0);
+  *store = INT2PTR(void*, SvIV(*svpp));
+
+  return 1;
+}
+
+static int getobj(void *hv_t,char *key,char *type,void **store) {
+  dTHX;
+  SV** svpp;
+  HV* hv=(HV*)hv_t;
+
+  mm_log((1,"getobj(hv_t %p, key %s,type %s, store %p)\n",hv_t,key,type,store));
+
+  if ( !hv_exists(hv,key,strlen(key)) ) return 0;
+
+  svpp=hv_fetch(hv, key, strlen(key), 0);
+
+  if (sv_derived_from(*svpp,type)) {
+    IV tmp = SvIV((SV*)SvRV(*svpp));
+    *store = INT2PTR(void*, tmp);
+  } else {
+    mm_log((1,"getobj: key exists in hash but is not of correct type"));
+    return 0;
+  }
+
+  return 1;
+}
+
+UTIL_table_t i_UTIL_table={getstr,getint,getdouble,getvoid,getobj};
+
+static void
+free_buffer(void *p) {
+  myfree(p);
+}
+
+
+static void
+i_log_entry(char *string, int level) {
+  mm_log((level, "%s", string));
+}
+
+static SV *
+make_i_color_sv(pTHX_ const i_color *c) {
+  SV *sv;
+  i_color *col = mymalloc(sizeof(i_color));
+  *col = *c;
+  sv = newSV(0);
+  sv_setref_pv(sv, "Imager::Color", (void *)col);
+
+  return sv;
+}
+
+static SV *
+make_i_color_sv_mortal(pTHX_ const i_color *c) {
+  return sv_2mortal(make_i_color_sv(aTHX_ c));
+}
+
+static SV *
+make_i_fcolor_sv(pTHX_ const i_fcolor *c) {
+  SV *sv;
+  i_fcolor *col = mymalloc(sizeof(i_fcolor));
+  *col = *c;
+  sv = newSV(0);
+  sv_setref_pv(sv, "Imager::Color::Float", (void *)col);
+
+  return sv;
+}
+
+static SV *
+make_i_fcolor_sv_mortal(pTHX_ const i_fcolor *c) {
+  return sv_2mortal(make_i_fcolor_sv(aTHX_ c));
+}
+
+#define CBDATA_BUFSIZE 8192
+
+struct cbdata {
+  /* the SVs we use to call back to Perl */
+  SV *writecb;
+  SV *readcb;
+  SV *seekcb;
+  SV *closecb;
+};
+
+static ssize_t
+call_reader(struct cbdata *cbd, void *buf, size_t size, 
+            size_t maxread) {
+  dTHX;
+  int count;
+  int result;
+  SV *data;
+  dSP;
+
+  if (!SvOK(cbd->readcb)) {
+    mm_log((1, "read callback called but no readcb supplied\n"));
+    i_push_error(0, "read callback called but no readcb supplied");
+    return -1;
+  }
+
+  ENTER;
+  SAVETMPS;
+  EXTEND(SP, 2);
+  PUSHMARK(SP);
+  PUSHs(sv_2mortal(newSViv(size)));
+  PUSHs(sv_2mortal(newSViv(maxread)));
+  PUTBACK;
+
+  count = perl_call_sv(cbd->readcb, G_SCALAR);
+
+  SPAGAIN;
+
+  if (count != 1)
+    croak("Result of perl_call_sv(..., G_SCALAR) != 1");
+
+  data = POPs;
+
+  if (SvOK(data)) {
+    STRLEN len;
+    char *ptr = SvPVbyte(data, len);
+    if (len > maxread)
+      croak("Too much data returned in reader callback (wanted %d, got %d, expected %d)",
+      (int)size, (int)len, (int)maxread);
+    
+    memcpy(buf, ptr, len);
+    result = len;
+  }
+  else {
+    result = -1;
+  }
+
+  PUTBACK;
+  FREETMPS;
+  LEAVE;
+
+  return result;
+}
+
+static off_t
+io_seeker(void *p, off_t offset, int whence) {
+  dTHX;
+  struct cbdata *cbd = p;
+  int count;
+  off_t result;
+  dSP;
+
+  if (!SvOK(cbd->seekcb)) {
+    mm_log((1, "seek callback called but no seekcb supplied\n"));
+    i_push_error(0, "seek callback called but no seekcb supplied");
+    return -1;
+  }
+
+  ENTER;
+  SAVETMPS;
+  EXTEND(SP, 2);
+  PUSHMARK(SP);
+  PUSHs(sv_2mortal(newSViv(offset)));
+  PUSHs(sv_2mortal(newSViv(whence)));
+  PUTBACK;
+
+  count = perl_call_sv(cbd->seekcb, G_SCALAR);
+
+  SPAGAIN;
+
+  if (count != 1)
+    croak("Result of perl_call_sv(..., G_SCALAR) != 1");
+
+  result = POPi;
+
+  PUTBACK;
+  FREETMPS;
+  LEAVE;
+
+  return result;
+}
+
+static ssize_t
+io_writer(void *p, void const *data, size_t size) {
+  dTHX;
+  struct cbdata *cbd = p;
+  I32 count;
+  SV *sv;
+  dSP;
+  bool success;
+
+  if (!SvOK(cbd->writecb)) {
+    mm_log((1, "write callback called but no writecb supplied\n"));
+    i_push_error(0, "write callback called but no writecb supplied");
+    return -1;
+  }
+
+  ENTER;
+  SAVETMPS;
+  EXTEND(SP, 1);
+  PUSHMARK(SP);
+  PUSHs(sv_2mortal(newSVpv((char *)data, size)));
+  PUTBACK;
+
+  count = perl_call_sv(cbd->writecb, G_SCALAR);
+
+  SPAGAIN;
+  if (count != 1)
+    croak("Result of perl_call_sv(..., G_SCALAR) != 1");
+
+  sv = POPs;
+  success = SvTRUE(sv);
+
+
+  PUTBACK;
+  FREETMPS;
+  LEAVE;
+
+  return success ? (ssize_t)size : -1;
+}
+
+static ssize_t 
+io_reader(void *p, void *data, size_t size) {
+  struct cbdata *cbd = p;
+
+  return call_reader(cbd, data, size, size);
+}
+
+static int io_closer(void *p) {
+  dTHX;
+  struct cbdata *cbd = p;
+  int success = 1;
+
+  if (SvOK(cbd->closecb)) {
+    dSP;
+    I32 count;
+
+    ENTER;
+    SAVETMPS;
+    PUSHMARK(SP);
+    PUTBACK;
+
+    count = perl_call_sv(cbd->closecb, G_SCALAR);
+
+    SPAGAIN;
+    
+    if (count) {
+      SV *sv = POPs;
+      success = SvTRUE(sv);
+    }
+    else
+      success = 0;
+
+    PUTBACK;
+    FREETMPS;
+    LEAVE;
+  }
+
+  return success ? 0 : -1;
+}
+
+static void io_destroyer(void *p) {
+  dTHX;
+  struct cbdata *cbd = p;
+
+  SvREFCNT_dec(cbd->writecb);
+  SvREFCNT_dec(cbd->readcb);
+  SvREFCNT_dec(cbd->seekcb);
+  SvREFCNT_dec(cbd->closecb);
+  myfree(cbd);
+}
+
+static bool
+im_SvREFSCALAR(SV *sv) {
+  svtype type = SvTYPE(sv);
+
+  switch (type) {
+  case SVt_PV:
+  case SVt_PVIV:
+  case SVt_PVNV:
+  case SVt_PVMG:
+  case SVt_IV:
+  case SVt_NV:
+  case SVt_PVLV:
+#if PERL_VERSION > 10
+  case SVt_REGEXP:
+#endif
+    return 1;
+
+  default:
+    return 0;
+  }
+}
+
+static const char *
+describe_sv(SV *sv) {
+  if (SvOK(sv)) {
+    if (SvROK(sv)) {
+      svtype type = SvTYPE(SvRV(sv));
+      switch (type) {
+      case SVt_PVCV: return "CV";
+      case SVt_PVGV: return "GV";
+      case SVt_PVLV: return "LV";
+      default: return "some reference";
+      }
+    }
+    else {
+      return "non-reference scalar";
+    }
+  }
+  else {
+    return "undef";
+  }
+}
+
+static i_io_glue_t *
+do_io_new_buffer(pTHX_ SV *data_sv) {
+  const char *data;
+  char *data_copy;
+  STRLEN length;
+  SV *sv;
+
+  SvGETMAGIC(data_sv);
+  if (SvROK(data_sv)) {
+    if (im_SvREFSCALAR(SvRV(data_sv))) {
+      sv = SvRV(data_sv);
+    }
+    else {
+      i_push_errorf(0, "data is not a scalar or a reference to scalar");
+      return NULL;
+    }
+  }
+  else {
+    sv = data_sv;
+  }
+
+  /* previously this would keep the SV around, but this is unsafe in
+     many ways, so always copy the bytes */
+  data = SvPVbyte(sv, length);
+  data_copy = mymalloc(length);
+  memcpy(data_copy, data, length);
+  return io_new_buffer(data_copy, length, free_buffer, data_copy);
+}
+
+static i_io_glue_t *
+do_io_new_cb(pTHX_ SV *writecb, SV *readcb, SV *seekcb, SV *closecb) {
+  struct cbdata *cbd;
+
+  cbd = mymalloc(sizeof(struct cbdata));
+  cbd->writecb = newSVsv(writecb);
+  cbd->readcb = newSVsv(readcb);
+  cbd->seekcb = newSVsv(seekcb);
+  cbd->closecb = newSVsv(closecb);
+
+  mm_log((1, "do_io_new_cb(writecb %p (%s), readcb %p (%s), seekcb %p (%s), closecb %p (%s))\n", writecb, describe_sv(writecb), readcb, describe_sv(readcb), seekcb, describe_sv(seekcb), closecb, describe_sv(closecb)));
+
+  return io_new_cb(cbd, io_reader, io_writer, io_seeker, io_closer, 
+		   io_destroyer);
+}
+
+struct value_name {
+  const char *name;
+  int value;
+};
+static int
+lookup_name(const struct value_name *names, int count, char *name, int def_value, int push_errors, const char *id, int *failed)
+{
+  int i;
+
+  if (push_errors)
+    *failed = 0;
+
+  for (i = 0; i < count; ++i)
+    if (strEQ(names[i].name, name))
+      return names[i].value;
+
+  if (push_errors) {
+    i_push_errorf(0, "unknown value '%s' for %s", name, id);
+    *failed = 1;
+  }
+
+  return def_value;
+}
+
+static struct value_name transp_names[] =
+{
+  { "none", tr_none },
+  { "threshold", tr_threshold },
+  { "errdiff", tr_errdiff },
+  { "ordered", tr_ordered, },
+};
+
+static struct value_name make_color_names[] =
+{
+  { "none", mc_none, },
+  { "webmap", mc_web_map, },
+  { "addi", mc_addi, },
+  { "mediancut", mc_median_cut, },
+  { "mono", mc_mono, },
+  { "monochrome", mc_mono, },
+  { "gray", mc_gray, },
+  { "gray4", mc_gray4, },
+  { "gray16", mc_gray16, },
+};
+
+static struct value_name translate_names[] =
+{
+  { "giflib", pt_giflib, },
+  { "closest", pt_closest, },
+  { "perturb", pt_perturb, },
+  { "errdiff", pt_errdiff, },
+  { "ordered", pt_ordered, },
+  { "bluenoise", pt_bluenoise, },
+};
+
+static struct value_name errdiff_names[] =
+{
+  { "floyd", ed_floyd, },
+  { "jarvis", ed_jarvis, },
+  { "stucki", ed_stucki, },
+  { "custom", ed_custom, },
+};
+
+static struct value_name orddith_names[] =
+{
+  { "random", od_random, },
+  { "dot8", od_dot8, },
+  { "dot4", od_dot4, },
+  { "hline", od_hline, },
+  { "vline", od_vline, },
+  { "/line", od_slashline, },
+  { "slashline", od_slashline, },
+  { "\\line", od_backline, },
+  { "backline", od_backline, },
+  { "tiny", od_tiny, },
+  { "custom", od_custom, },
+};
+
+/* look through the hash for quantization options */
+static int
+ip_handle_quant_opts_low(pTHX_ i_quantize *quant, HV *hv, int push_errors)
+{
+  SV **sv;
+  int i;
+  STRLEN len;
+  char *str;
+  int failed = 0;
+
+  quant->mc_colors = mymalloc(quant->mc_size * sizeof(i_color));
+
+  sv = hv_fetch(hv, "transp", 6, 0);
+  if (sv && *sv && (str = SvPV(*sv, len))) {
+    quant->transp = 
+      lookup_name(transp_names, sizeof(transp_names)/sizeof(*transp_names), 
+		  str, tr_none, push_errors, "transp", &failed);
+    if (failed)
+       return 0;
+    if (quant->transp != tr_none) {
+      quant->tr_threshold = 127;
+      sv = hv_fetch(hv, "tr_threshold", 12, 0);
+      if (sv && *sv)
+	quant->tr_threshold = SvIV(*sv);
+    }
+    if (quant->transp == tr_errdiff) {
+      sv = hv_fetch(hv, "tr_errdiff", 10, 0);
+      if (sv && *sv && (str = SvPV(*sv, len))) {
+	quant->tr_errdiff = lookup_name(errdiff_names, sizeof(errdiff_names)/sizeof(*errdiff_names), str, ed_floyd, push_errors, "tr_errdiff", &failed);
+	if (failed)
+	  return 0;
+      }
+    }
+    if (quant->transp == tr_ordered) {
+      quant->tr_orddith = od_tiny;
+      sv = hv_fetch(hv, "tr_orddith", 10, 0);
+      if (sv && *sv && (str = SvPV(*sv, len))) {
+	quant->tr_orddith = lookup_name(orddith_names, sizeof(orddith_names)/sizeof(*orddith_names), str, od_random, push_errors, "tr_orddith", &failed);
+	if (failed)
+	   return 0;
+      }
+
+      if (quant->tr_orddith == od_custom) {
+	sv = hv_fetch(hv, "tr_map", 6, 0);
+	if (sv && *sv && SvTYPE(SvRV(*sv)) == SVt_PVAV) {
+	  AV *av = (AV*)SvRV(*sv);
+          unsigned index;
+	  len = av_len(av) + 1;
+	  if (len > sizeof(quant->tr_custom))
+	    len = sizeof(quant->tr_custom);
+	  for (index = 0; index < len; ++index) {
+	    SV **sv2 = av_fetch(av, index, 0);
+	    if (sv2 && *sv2) {
+	      quant->tr_custom[index] = SvIV(*sv2);
+	    }
+	  }
+	  while (index < sizeof(quant->tr_custom))
+	    quant->tr_custom[index++] = 0;
+	}
+      }
+    }
+  }
+  quant->make_colors = mc_median_cut;
+  sv = hv_fetch(hv, "make_colors", 11, 0);
+  if (sv && *sv && (str = SvPV(*sv, len))) {
+    quant->make_colors = 
+      lookup_name(make_color_names, sizeof(make_color_names)/sizeof(*make_color_names), str, mc_median_cut, push_errors, "make_colors", &failed);
+    if (failed)
+      return 0;
+  }
+  sv = hv_fetch(hv, "colors", 6, 0);
+  if (sv && *sv && SvROK(*sv) && SvTYPE(SvRV(*sv)) == SVt_PVAV) {
+    /* needs to be an array of Imager::Color
+       note that the caller allocates the mc_color array and sets mc_size
+       to it's size */
+    AV *av = (AV *)SvRV(*sv);
+    quant->mc_count = av_len(av)+1;
+    if (quant->mc_count > quant->mc_size)
+      quant->mc_count = quant->mc_size;
+    for (i = 0; i < quant->mc_count; ++i) {
+      SV **sv1 = av_fetch(av, i, 0);
+      if (sv1 && *sv1 && SvROK(*sv1) && sv_derived_from(*sv1, "Imager::Color")) {
+	i_color *col = INT2PTR(i_color *, SvIV((SV*)SvRV(*sv1)));
+	quant->mc_colors[i] = *col;
+      }
+      else if (push_errors) {
+        i_push_errorf(0, "colors[%d] isn't an Imager::Color object", i);
+	return 0;
+      }
+    }
+  }
+  sv = hv_fetch(hv, "max_colors", 10, 0);
+  if (sv && *sv) {
+    IV iv = SvIV(*sv);
+    if (iv <= 0) {
+      i_push_errorf(0, "max_colors of %ld is invalid", (long)iv);
+      return 0;
+    }
+    if (iv <= quant->mc_size && iv >= quant->mc_count)
+      quant->mc_size = iv;
+  }
+
+  quant->translate = pt_closest;
+  sv = hv_fetch(hv, "translate", 9, 0);
+  if (sv && *sv && (str = SvPV(*sv, len))) {
+    quant->translate = lookup_name(translate_names, sizeof(translate_names)/sizeof(*translate_names), str, pt_closest, push_errors, "translate", &failed);
+    if (failed)
+      return 0;
+  }
+  sv = hv_fetch(hv, "errdiff", 7, 0);
+  if (sv && *sv && (str = SvPV(*sv, len))) {
+    quant->errdiff = lookup_name(errdiff_names, sizeof(errdiff_names)/sizeof(*errdiff_names), str, ed_floyd, push_errors, "errdiff", &failed);
+    if (failed)
+      return 0;
+  }
+  if (quant->translate == pt_errdiff && quant->errdiff == ed_custom) {
+    /* get the error diffusion map */
+    sv = hv_fetch(hv, "errdiff_width", 13, 0);
+    if (sv && *sv)
+      quant->ed_width = SvIV(*sv);
+    sv = hv_fetch(hv, "errdiff_height", 14, 0);
+    if (sv && *sv)
+      quant->ed_height = SvIV(*sv);
+    sv = hv_fetch(hv, "errdiff_orig", 12, 0);
+    if (sv && *sv)
+      quant->ed_orig = SvIV(*sv);
+    if (quant->ed_width > 0 && quant->ed_height > 0) {
+      int sum = 0;
+      quant->ed_map = mymalloc(sizeof(int) * quant->ed_width * quant->ed_height);
+      sv = hv_fetch(hv, "errdiff_map", 11, 0);
+      if (sv && *sv && SvROK(*sv) && SvTYPE(SvRV(*sv)) == SVt_PVAV) {
+	AV *av = (AV*)SvRV(*sv);
+        size_t avi;
+        len = av_len(av) + 1;
+        if (len > (size_t)quant->ed_width * quant->ed_height)
+          len = (size_t)quant->ed_width * quant->ed_height;
+        for (avi = 0; avi < len; ++avi) {
+          SV **sv2 = av_fetch(av, avi, 0);
+          if (sv2 && *sv2) {
+            IV iv = SvIV(*sv2);
+            if (push_errors && iv < 0) {
+              i_push_errorf(0, "errdiff_map values must be non-negative, errdiff[%lu] is negative",
+                            (unsigned long)avi);
+              return 0;
+            }
+            quant->ed_map[avi] = iv;
+            sum += quant->ed_map[avi];
+          }
+        }
+      }
+      if (!sum) {
+	/* broken map */
+	myfree(quant->ed_map);
+	quant->ed_map = 0;
+	quant->errdiff = ed_floyd;
+	if (push_errors) {
+	  i_push_error(0, "error diffusion map must contain some non-zero values");
+	  return 0;
+	}
+      }
+    }
+  }
+  sv = hv_fetch(hv, "perturb", 7, 0);
+  if (sv && *sv)
+    quant->perturb = SvIV(*sv);
+
+  return 1;
+}
+
+static void
+ip_cleanup_quant_opts(pTHX_ i_quantize *quant) {
+  myfree(quant->mc_colors);
+  if (quant->ed_map)
+    myfree(quant->ed_map);
+}
+
+static int
+ip_handle_quant_opts2(pTHX_ i_quantize *quant, HV *hv) {
+  int result = ip_handle_quant_opts_low(aTHX_ quant, hv, 1);
+  if (!result) {
+     ip_cleanup_quant_opts(aTHX_ quant);
+  }
+  return result;
+}
+
+static void
+ip_handle_quant_opts(pTHX_ i_quantize *quant, HV *hv) {
+  (void)ip_handle_quant_opts_low(aTHX_ quant, hv, 0);
+}
+
+/* copies the color map from the hv into the colors member of the HV */
+static void
+ip_copy_colors_back(pTHX_ HV *hv, i_quantize *quant) {
+  SV **sv;
+  AV *av;
+  int i;
+  SV *work;
+
+  sv = hv_fetch(hv, "colors", 6, 0);
+  if (!sv || !*sv || !SvROK(*sv) || SvTYPE(SvRV(*sv)) != SVt_PVAV) {
+    /* nothing to do */
+    return;
+  }
+
+  av = (AV *)SvRV(*sv);
+  av_clear(av);
+  av_extend(av, quant->mc_count+1);
+  for (i = 0; i < quant->mc_count; ++i) {
+    i_color *in = quant->mc_colors+i;
+    Imager__Color c = ICL_new_internal(in->rgb.r, in->rgb.g, in->rgb.b, 255);
+    work = sv_newmortal();
+    sv_setref_pv(work, "Imager::Color", (void *)c);
+    SvREFCNT_inc(work);
+    av_push(av, work);
+  }
+}
+
+static struct value_name
+poly_fill_mode_names[] =
+{
+  { "evenodd", i_pfm_evenodd },
+  { "nonzero", i_pfm_nonzero }
+};
+
+static i_poly_fill_mode_t
+S_get_poly_fill_mode(pTHX_ SV *sv) {	
+  if (looks_like_number(sv)) {
+    IV work = SvIV(sv);
+    if (work < (IV)i_pfm_evenodd || work > (IV)i_pfm_nonzero)
+      work = (IV)i_pfm_evenodd;
+    return (i_poly_fill_mode_t)work;
+  }
+  else {
+    return (i_poly_fill_mode_t)lookup_name
+    (poly_fill_mode_names, ARRAY_COUNT(poly_fill_mode_names),
+     SvPV_nolen(sv), i_pfm_evenodd, 0, NULL, NULL);
+  }
+}
+
+static void
+S_get_polygon_list(pTHX_ i_polygon_list *polys, SV *sv) {
+  AV *av;
+  size_t poly_index;
+  i_polygon_t *s;
+
+  SvGETMAGIC(sv);
+  if (!SvOK(sv) || !SvROK(sv) || SvTYPE(SvRV(sv)) != SVt_PVAV) 
+    croak("polys must be an arrayref");
+
+  av = (AV*)SvRV(sv);
+  polys->count = av_len(av) + 1;
+  if (polys->count < 1)
+    croak("polypolygon: no polygons provided");
+  s = malloc_temp(aTHX_ sizeof(i_polygon_t) * polys->count);
+  for (poly_index = 0; poly_index < polys->count; ++poly_index) {
+    SV **poly_sv = av_fetch(av, poly_index, 0);
+    AV *poly_av;
+    SV **x_sv, **y_sv;
+    AV *x_av, *y_av;
+    double *x_data, *y_data;
+    ssize_t j;
+    ssize_t point_count;
+
+    if (!poly_sv)
+      croak("poly_polygon: nothing found for polygon %zu", poly_index);
+    /* needs to be another av */
+    SvGETMAGIC(*poly_sv);
+    if (!SvOK(*poly_sv) || !SvROK(*poly_sv) || SvTYPE(SvRV(*poly_sv)) != SVt_PVAV)
+      croak("poly_polygon: polygon %zu isn't an arrayref", poly_index);
+    poly_av = (AV*)SvRV(*poly_sv);
+    /* with two elements */
+    if (av_len(poly_av) != 1)
+      croak("poly_polygon: polygon %zu should contain two arrays", poly_index);
+    x_sv = av_fetch(poly_av, 0, 0);
+    y_sv = av_fetch(poly_av, 1, 0);
+    if (!x_sv)
+      croak("poly_polygon: polygon %zu has no x elements", poly_index);
+    if (!y_sv)
+      croak("poly_polygon: polygon %zu has no y elements", poly_index);
+    SvGETMAGIC(*x_sv);
+    SvGETMAGIC(*y_sv);
+    if (!SvOK(*x_sv) || !SvROK(*x_sv) || SvTYPE(SvRV(*x_sv)) != SVt_PVAV) {
+      croak("poly_polygon: polygon %zu x elements isn't an array",
+            poly_index);
+    }
+    if (!SvOK(*y_sv) || !SvROK(*y_sv) || SvTYPE(SvRV(*y_sv)) != SVt_PVAV) {
+      croak("poly_polygon: polygon %zu y elements isn't an array",
+            poly_index);
+    }
+    x_av = (AV*)SvRV(*x_sv);
+    y_av = (AV*)SvRV(*y_sv);
+    if (av_len(x_av) != av_len(y_av)) {
+      croak("poly_polygon: polygon %zu x and y arrays different lengths",
+            poly_index+1);
+    }
+    point_count = av_len(x_av)+1;
+    x_data = malloc_temp(aTHX_ sizeof(double) * point_count * 2);
+    y_data = x_data + point_count;
+
+    for (j = 0; j < point_count; ++j) {
+      SV **x_item_sv = av_fetch(x_av, j, 0);
+      SV **y_item_sv = av_fetch(y_av, j, 0);
+      x_data[j] = x_item_sv ? SvNV(*x_item_sv) : 0;
+      y_data[j] = y_item_sv ? SvNV(*y_item_sv) : 0;
+    }
+    s[poly_index].x = x_data;
+    s[poly_index].y = y_data;
+    s[poly_index].count = point_count;
+  }
+  polys->polygons = s;
+}
+
+/* loads the segments of a fountain fill into an array */
+static i_fountain_seg *
+load_fount_segs(pTHX_ AV *asegs, int *count) {
+  /* Each element of segs must contain:
+     [ start, middle, end, c0, c1, segtype, colortrans ]
+     start, middle, end are doubles from 0 to 1
+     c0, c1 are Imager::Color::Float or Imager::Color objects
+     segtype, colortrans are ints
+  */
+  int i, j;
+  AV *aseg;
+  i_fountain_seg *segs;
+  double work[3];
+  int worki[2];
+
+  *count = av_len(asegs)+1;
+  if (*count < 1) 
+    croak("i_fountain must have at least one segment");
+  segs = mymalloc(sizeof(i_fountain_seg) * *count);
+  for(i = 0; i < *count; i++) {
+    SV **sv1 = av_fetch(asegs, i, 0);
+    if (!sv1 || !*sv1 || !SvROK(*sv1) 
+        || SvTYPE(SvRV(*sv1)) != SVt_PVAV) {
+      myfree(segs);
+      croak("i_fountain: segs must be an arrayref of arrayrefs");
+    }
+    aseg = (AV *)SvRV(*sv1);
+    if (av_len(aseg) != 7-1) {
+      myfree(segs);
+      croak("i_fountain: a segment must have 7 members");
+    }
+    for (j = 0; j < 3; ++j) {
+      SV **sv2 = av_fetch(aseg, j, 0);
+      if (!sv2 || !*sv2) {
+        myfree(segs);
+        croak("i_fountain: XS error");
+      }
+      work[j] = SvNV(*sv2);
+    }
+    segs[i].start  = work[0];
+    segs[i].middle = work[1];
+    segs[i].end    = work[2];
+    for (j = 0; j < 2; ++j) {
+      SV **sv3 = av_fetch(aseg, 3+j, 0);
+      if (!sv3 || !*sv3 || !SvROK(*sv3) ||
+          (!sv_derived_from(*sv3, "Imager::Color")
+           && !sv_derived_from(*sv3, "Imager::Color::Float"))) {
+        myfree(segs);
+        croak("i_fountain: segs must contain colors in elements 3 and 4");
+      }
+      if (sv_derived_from(*sv3, "Imager::Color::Float")) {
+        segs[i].c[j] = *INT2PTR(i_fcolor *, SvIV((SV *)SvRV(*sv3)));
+      }
+      else {
+        i_color c = *INT2PTR(i_color *, SvIV((SV *)SvRV(*sv3)));
+        int ch;
+        for (ch = 0; ch < MAXCHANNELS; ++ch) {
+          segs[i].c[j].channel[ch] = c.channel[ch] / 255.0;
+        }
+      }
+    }
+    for (j = 0; j < 2; ++j) {
+      SV **sv2 = av_fetch(aseg, j+5, 0);
+      if (!sv2 || !*sv2) {
+        myfree(segs);
+        croak("i_fountain: XS error");
+      }
+      worki[j] = SvIV(*sv2);
+    }
+    segs[i].type = worki[0];
+    segs[i].color = worki[1];
+  }
+
+  return segs;
+}
+
+/* validates the indexes supplied to i_ppal
+
+i_ppal() doesn't do that for speed, but I'm not comfortable doing that
+for calls from perl.
+
+*/
+static void
+validate_i_ppal(i_img *im, i_palidx const *indexes, int count) {
+  int color_count = i_colorcount(im);
+  int i;
+
+  if (color_count == -1)
+    croak("i_plin() called on direct color image");
+  
+  for (i = 0; i < count; ++i) {
+    if (indexes[i] >= color_count) {
+      croak("i_plin() called with out of range color index %d (max %d)",
+        indexes[i], color_count-1);
+    }
+  }
+}
+
+/* I don't think ICLF_* names belong at the C interface
+   this makes the XS code think we have them, to let us avoid 
+   putting function bodies in the XS code
+*/
+#define ICLF_new_internal(r, g, b, a) i_fcolor_new((r), (g), (b), (a))
+#define ICLF_DESTROY(cl) i_fcolor_destroy(cl)
+
+#ifdef IMAGER_LOG
+#define i_log_enabled() 1
+#else
+#define i_log_enabled() 0
+#endif
+
+#if i_int_hlines_testing()
+
+typedef i_int_hlines *Imager__Internal__Hlines;
+
+static i_int_hlines *
+i_int_hlines_new(i_img_dim start_y, i_img_dim count_y, i_img_dim start_x, i_img_dim count_x) {
+  i_int_hlines *result = mymalloc(sizeof(i_int_hlines));
+  i_int_init_hlines(result, start_y, count_y, start_x, count_x);
+
+  return result;
+}
+
+static i_int_hlines *
+i_int_hlines_new_img(i_img *im) {
+  i_int_hlines *result = mymalloc(sizeof(i_int_hlines));
+  i_int_init_hlines_img(result, im);
+
+  return result;
+}
+
+static void
+i_int_hlines_DESTROY(i_int_hlines *hlines) {
+  i_int_hlines_destroy(hlines);
+  myfree(hlines);
+}
+
+#define i_int_hlines_CLONE_SKIP(cls) 1
+
+static int seg_compare(const void *vleft, const void *vright) {
+  const i_int_hline_seg *left = vleft;
+  const i_int_hline_seg *right = vright;
+
+  return left->minx - right->minx;
+}
+
+static SV *
+i_int_hlines_dump(i_int_hlines *hlines) {
+  dTHX;
+  SV *dump = newSVpvf("start_y: %" i_DF " limit_y: %" i_DF " start_x: %" i_DF " limit_x: %" i_DF"\n",
+	i_DFc(hlines->start_y), i_DFc(hlines->limit_y), i_DFc(hlines->start_x), i_DFc(hlines->limit_x));
+  i_img_dim y;
+  
+  for (y = hlines->start_y; y < hlines->limit_y; ++y) {
+    i_int_hline_entry *entry = hlines->entries[y-hlines->start_y];
+    if (entry) {
+      int i;
+      /* sort the segments, if any */
+      if (entry->count)
+        qsort(entry->segs, entry->count, sizeof(i_int_hline_seg), seg_compare);
+
+      sv_catpvf(dump, " %" i_DF " (%" i_DF "):", i_DFc(y), i_DFc(entry->count));
+      for (i = 0; i < entry->count; ++i) {
+        sv_catpvf(dump, " [%" i_DF ", %" i_DF ")", i_DFc(entry->segs[i].minx), 
+                  i_DFc(entry->segs[i].x_limit));
+      }
+      sv_catpv(dump, "\n");
+    }
+  }
+
+  return dump;
+}
+
+#endif
+
+static off_t
+i_sv_off_t(pTHX_ SV *sv) {
+#if LSEEKSIZE > IVSIZE
+  return (off_t)SvNV(sv);
+#else
+  return (off_t)SvIV(sv);
+#endif
+}
+
+static SV *
+i_new_sv_off_t(pTHX_ off_t off) {
+#if LSEEKSIZE > IVSIZE
+  return newSVnv(off);
+#else
+  return newSViv(off);
+#endif
+}
+
+static im_pl_ext_funcs im_perl_funcs =
+{
+  IMAGER_PL_API_VERSION,
+  IMAGER_PL_API_LEVEL,
+  ip_handle_quant_opts,
+  ip_cleanup_quant_opts,
+  ip_copy_colors_back,
+  ip_handle_quant_opts2
+};
+
+#define trim_color_list__new() S_trim_color_list__new(aTHX)
+static i_trim_color_list
+S_trim_color_list__new(pTHX) {
+  i_trim_color_list r;
+
+  r.count = 0;
+  r.rsv = newSV(0);
+  sv_setref_pvn(r.rsv, "Imager::TrimColorList", "", 0);
+  r.sv = SvRV(r.rsv);
+  r.colors = (i_trim_colors_t *)SvPVX(r.sv);
+
+  return r;
+}
+
+static int
+trim_color_list_grow(pTHX_ i_trim_color_list *t) {
+  STRLEN old_cur = SvCUR(t->sv);
+  char *p;
+  SvGROW(t->sv, SvCUR(t->sv)+sizeof(i_trim_colors_t)+1);
+  p = SvPVX(t->sv);
+  memset(p+old_cur, 0, sizeof(i_trim_colors_t));
+  t->colors = (i_trim_colors_t *)p;
+
+  return 1;
+}
+
+#define trim_color_list_add_color(t, c1, c2) S_trim_color_list_add_color(aTHX_ (t), (c1), (c2))
+static int
+S_trim_color_list_add_color(pTHX_ i_trim_color_list t, const i_color *c1, const i_color *c2) {
+  i_trim_colors_t *e;
+  if (!trim_color_list_grow(aTHX_ &t))
+    return 0;
+
+  e = t.colors + t.count;
+
+  e->is_float = 0;
+  e->c1 = *c1;
+  e->c2 = *c2;
+
+  ++t.count;
+  SvCUR_set(t.sv, t.count * sizeof(i_trim_colors_t));
+  *SvEND(t.sv) = '\0';
+
+  return 1;
+}
+
+#define trim_color_list_add_fcolor(t, c1, c2) S_trim_color_list_add_fcolor(aTHX_ (t), (c1), (c2))
+static int
+S_trim_color_list_add_fcolor(pTHX_ i_trim_color_list t, const i_fcolor *c1, const i_fcolor *c2) {
+  i_trim_colors_t *e;
+  if (!trim_color_list_grow(aTHX_ &t))
+    return 0;
+
+  e = t.colors + t.count;
+
+  e->is_float = 1;
+  e->cf1 = *c1;
+  e->cf2 = *c2;
+
+  ++t.count;
+  SvCUR_set(t.sv, t.count * sizeof(i_trim_colors_t));
+  *SvEND(t.sv) = '\0';
+
+  return 1;
+}
+
+#define trim_color_list_get(t, i) S_trim_color_list_get(aTHX_ (t), (i))
+static SV *
+S_trim_color_list_get(pTHX_ i_trim_color_list t, IV i) {
+  SV *r;
+  AV *av;
+  const i_trim_colors_t *e;
+
+  if (i < 0 || (size_t)i >= t.count) {
+    return &PL_sv_undef;
+  }
+
+  av = newAV();
+  r = newRV_noinc((SV*)av);
+  e = t.colors+i;
+
+  if (e->is_float) {
+    av_push(av, make_i_fcolor_sv(aTHX_ &e->cf1));
+    av_push(av, make_i_fcolor_sv(aTHX_ &e->cf2));
+  }
+  else {
+    av_push(av, make_i_color_sv(aTHX_ &e->c1));
+    av_push(av, make_i_color_sv(aTHX_ &e->c2));
+  }
+
+  return r;
+}
+
+/* given a ref to an Imager::TrimColorList fill in an i_trim_color_list structure */
+static bool
+S_get_trim_color_list(pTHX_ SV *sv, i_trim_color_list *t) {
+  STRLEN len;
+  t->rsv = sv;
+  SvGETMAGIC(sv);
+  if (!SvROK(sv))
+    return FALSE;
+  t->sv = SvRV(sv);
+  if (!SvPOK(t->sv) || SvMAGIC(t->sv))
+    return FALSE;
+  len = SvCUR(t->sv);
+  if (len % sizeof(i_trim_colors_t) != 0)
+    return FALSE;
+  t->colors = (i_trim_colors_t *)SvPVX(t->sv);
+  t->count = len / sizeof(i_trim_colors_t);
+
+  return TRUE;
+}
+
+typedef i_trim_color_list Imager__TrimColorList;
+#define trim_color_list_count(t) ((t).count)
+
+#define PERL_PL_SET_GLOBAL_CALLBACKS \
+  sv_setiv(get_sv(PERL_PL_FUNCTION_TABLE_NAME, 1), PTR2IV(&im_perl_funcs));
+
+#define IIM_new i_img_8_new
+#define IIM_DESTROY i_img_destroy
+typedef int SysRet;
+
+#ifdef IMEXIF_ENABLE
+#define i_exif_enabled() 1
+#else
+#define i_exif_enabled() 0
+#endif
+
+/* trying to use more C style names, map them here */
+#define i_io_DESTROY(ig) io_glue_destroy(ig)
+
+#define i_img_get_width(im) ((im)->xsize)
+#define i_img_get_height(im) ((im)->ysize)
+
+#define i_img_epsilonf() (DBL_EPSILON * 4)
+
+/* avoid some xsubpp strangeness */
+#define NEWLINE '\n'
+
+#define ICL_red(c) ((c)->rgba.r)
+#define ICL_green(c) ((c)->rgba.g)
+#define ICL_blue(c) ((c)->rgba.b)
+#define ICL_alpha(c) ((c)->rgba.a)
+
+#define ICLF_red(c) ((c)->rgba.r)
+#define ICLF_green(c) ((c)->rgba.g)
+#define ICLF_blue(c) ((c)->rgba.b)
+#define ICLF_alpha(c) ((c)->rgba.a)
+
+#line 1338 "Imager.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 1482 "Imager.c"
+
+XS_EUPXS(XS_Imager__Color_new_internal); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_new_internal)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "r, g, b, a");
+    {
+	unsigned char	r = (unsigned char)SvUV(ST(0))
+;
+	unsigned char	g = (unsigned char)SvUV(ST(1))
+;
+	unsigned char	b = (unsigned char)SvUV(ST(2))
+;
+	unsigned char	a = (unsigned char)SvUV(ST(3))
+;
+	Imager__Color	RETVAL;
+
+	RETVAL = ICL_new_internal(r, g, b, a);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Color", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "cl");
+    {
+	Imager__Color	cl;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"Imager::Color::DESTROY",
+			"cl")
+;
+
+	ICL_DESTROY(cl);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__Color_set_internal); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_set_internal)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "cl, r, g, b, a");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__Color	cl;
+	unsigned char	r = (unsigned char)SvUV(ST(1))
+;
+	unsigned char	g = (unsigned char)SvUV(ST(2))
+;
+	unsigned char	b = (unsigned char)SvUV(ST(3))
+;
+	unsigned char	a = (unsigned char)SvUV(ST(4))
+;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::set_internal",
+			"cl", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1350 "Imager.xs"
+	       cl->rgba.r = r;
+	       cl->rgba.g = g;
+	       cl->rgba.b = b;
+	       cl->rgba.a = a;
+	       EXTEND(SP, 1);
+	       PUSHs(ST(0));
+#line 1577 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__Color_info); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_info)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "cl");
+    {
+	Imager__Color	cl;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::info",
+			"cl", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+
+	ICL_info(cl);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__Color_rgba); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_rgba)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "cl");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__Color	cl;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::rgba",
+			"cl", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1366 "Imager.xs"
+		EXTEND(SP, 4);
+		PUSHs(sv_2mortal(newSViv(cl->rgba.r)));
+		PUSHs(sv_2mortal(newSViv(cl->rgba.g)));
+		PUSHs(sv_2mortal(newSViv(cl->rgba.b)));
+		PUSHs(sv_2mortal(newSViv(cl->rgba.a)));
+#line 1643 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__Color_i_hsv_to_rgb); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_i_hsv_to_rgb)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color	c;
+	Imager__Color	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::i_hsv_to_rgb",
+			"c", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1376 "Imager.xs"
+        RETVAL = mymalloc(sizeof(i_color));
+        *RETVAL = *c;
+        i_hsv_to_rgb(RETVAL);
+#line 1677 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Color", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color_i_rgb_to_hsv); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_i_rgb_to_hsv)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color	c;
+	Imager__Color	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::i_rgb_to_hsv",
+			"c", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1386 "Imager.xs"
+        RETVAL = mymalloc(sizeof(i_color));
+        *RETVAL = *c;
+        i_rgb_to_hsv(RETVAL);
+#line 1716 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Color", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color_red); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_red)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color	c;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::red",
+			"c", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = ICL_red(c);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color_green); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_green)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color	c;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::green",
+			"c", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = ICL_green(c);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color_blue); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_blue)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color	c;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::blue",
+			"c", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = ICL_blue(c);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color_alpha); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color_alpha)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color	c;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::alpha",
+			"c", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = ICL_alpha(c);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_new_internal); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_new_internal)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "r, g, b, a");
+    {
+	im_double	r;
+	im_double	g;
+	im_double	b;
+	im_double	a;
+	Imager__Color__Float	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'r' shouldn't be a reference");
+	    }
+	    else {
+	    	r = (im_double)SvNV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'g' shouldn't be a reference");
+	    }
+	    else {
+	    	g = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'b' shouldn't be a reference");
+	    }
+	    else {
+	    	b = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'a' shouldn't be a reference");
+	    }
+	    else {
+	    	a = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	RETVAL = ICLF_new_internal(r, g, b, a);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Color::Float", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "cl");
+    {
+	Imager__Color__Float	cl;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"Imager::Color::Float::DESTROY",
+			"cl")
+;
+
+	ICLF_DESTROY(cl);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_rgba); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_rgba)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "cl");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__Color__Float	cl;
+#line 1425 "Imager.xs"
+        int ch;
+#line 1966 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::Float::rgba",
+			"cl", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1427 "Imager.xs"
+        EXTEND(SP, MAXCHANNELS);
+        for (ch = 0; ch < MAXCHANNELS; ++ch) {
+        /* printf("%d: %g\n", ch, cl->channel[ch]); */
+          PUSHs(sv_2mortal(newSVnv(cl->channel[ch])));
+        }
+#line 1987 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_set_internal); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_set_internal)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "cl, r, g, b, a");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__Color__Float	cl;
+	im_double	r;
+	im_double	g;
+	im_double	b;
+	im_double	a;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::Float::set_internal",
+			"cl", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'r' shouldn't be a reference");
+	    }
+	    else {
+	    	r = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'g' shouldn't be a reference");
+	    }
+	    else {
+	    	g = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'b' shouldn't be a reference");
+	    }
+	    else {
+	    	b = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'a' shouldn't be a reference");
+	    }
+	    else {
+	    	a = (im_double)SvNV(ST(4));
+	    }
+	}
+;
+#line 1441 "Imager.xs"
+        cl->rgba.r = r;
+        cl->rgba.g = g;
+        cl->rgba.b = b;
+        cl->rgba.a = a;                
+        EXTEND(SP, 1);
+        PUSHs(ST(0));
+#line 2073 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_i_hsv_to_rgb); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_i_hsv_to_rgb)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color__Float	c;
+	Imager__Color__Float	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::Float::i_hsv_to_rgb",
+			"c", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1452 "Imager.xs"
+        RETVAL = mymalloc(sizeof(i_fcolor));
+        *RETVAL = *c;
+        i_hsv_to_rgbf(RETVAL);
+#line 2107 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Color::Float", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_i_rgb_to_hsv); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_i_rgb_to_hsv)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color__Float	c;
+	Imager__Color__Float	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::Float::i_rgb_to_hsv",
+			"c", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1462 "Imager.xs"
+        RETVAL = mymalloc(sizeof(i_fcolor));
+        *RETVAL = *c;
+        i_rgb_to_hsvf(RETVAL);
+#line 2146 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Color::Float", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_red); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_red)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color__Float	c;
+	double	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::Float::red",
+			"c", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = ICLF_red(c);
+	XSprePUSH;
+	PUSHn((double)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_green); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_green)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color__Float	c;
+	double	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::Float::green",
+			"c", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = ICLF_green(c);
+	XSprePUSH;
+	PUSHn((double)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_blue); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_blue)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color__Float	c;
+	double	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::Float::blue",
+			"c", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = ICLF_blue(c);
+	XSprePUSH;
+	PUSHn((double)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Color__Float_alpha); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Color__Float_alpha)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "c");
+    {
+	Imager__Color__Float	c;
+	double	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    c = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Color::Float::alpha",
+			"c", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = ICLF_alpha(c);
+	XSprePUSH;
+	PUSHn((double)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__ImgRaw_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__ImgRaw_new)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "xsize, ysize, ch");
+    {
+	i_img_dim	xsize;
+	i_img_dim	ysize;
+	int	ch = (int)SvIV(ST(2))
+;
+	Imager__ImgRaw	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'xsize' shouldn't be a reference");
+	    }
+	    else {
+	    	xsize = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'ysize' shouldn't be a reference");
+	    }
+	    else {
+	    	ysize = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = IIM_new(xsize, ysize, ch);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__ImgRaw_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__ImgRaw_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	IIM_DESTROY(im);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_io_new_fd); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_io_new_fd)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "fd");
+    {
+	int	fd = (int)SvIV(ST(0))
+;
+	Imager__IO	RETVAL;
+
+	RETVAL = io_new_fd(fd);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_io_new_mmap); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_io_new_mmap)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "fd");
+    {
+	int	fd = (int)SvIV(ST(0))
+;
+	Imager__IO	RETVAL;
+#line 1511 "Imager.xs"
+	i_clear_error();
+	RETVAL = io_new_mmap(fd);
+	if (!RETVAL)
+	  XSRETURN(0);
+#line 2409 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_io_new_bufchain); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_io_new_bufchain)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    {
+	Imager__IO	RETVAL;
+
+	RETVAL = io_new_bufchain();
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_io_new_buffer); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_io_new_buffer)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "data_sv");
+    {
+	SV *	data_sv = ST(0)
+;
+	Imager__IO	RETVAL;
+#line 1526 "Imager.xs"
+	  i_clear_error();
+	  RETVAL = do_io_new_buffer(aTHX_ data_sv);
+	  if (!RETVAL)
+	    XSRETURN(0);
+#line 2457 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_io_new_cb); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_io_new_cb)
+{
+    dVAR; dXSARGS;
+    if (items < 4 || items > 5)
+       croak_xs_usage(cv,  "writecb, readcb, seekcb, closecb, maxwrite = CBDATA_BUFSIZE");
+    {
+	SV *	writecb = ST(0)
+;
+	SV *	readcb = ST(1)
+;
+	SV *	seekcb = ST(2)
+;
+	SV *	closecb = ST(3)
+;
+	Imager__IO	RETVAL;
+#line 1540 "Imager.xs"
+        RETVAL = do_io_new_cb(aTHX_ writecb, readcb, seekcb, closecb);
+#line 2487 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_io_slurp); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_io_slurp)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+#line 1548 "Imager.xs"
+	      unsigned char*    data;
+	      size_t    tlength;
+#line 2510 "Imager.c"
+	SV *	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::io_slurp",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1551 "Imager.xs"
+ 	      data    = NULL;
+              tlength = io_slurp(ig, &data);
+              RETVAL = newSVpv((char *)data,tlength);
+              myfree(data);
+#line 2531 "Imager.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_set_image_file_limits); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_set_image_file_limits)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "width, height, bytes");
+    {
+	i_img_dim	width;
+	i_img_dim	height;
+	size_t	bytes = (size_t)SvUV(ST(2))
+;
+	undef_int	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'width' shouldn't be a reference");
+	    }
+	    else {
+	    	width = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'height' shouldn't be a reference");
+	    }
+	    else {
+	    	height = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_set_image_file_limits(width, height, bytes);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_get_image_file_limits); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_get_image_file_limits)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 1568 "Imager.xs"
+        i_img_dim width, height;
+	size_t bytes;
+#line 2599 "Imager.c"
+#line 1571 "Imager.xs"
+        if (i_get_image_file_limits(&width, &height, &bytes)) {
+	  EXTEND(SP, 3);
+          PUSHs(sv_2mortal(newSViv(width)));
+          PUSHs(sv_2mortal(newSViv(height)));
+          PUSHs(sv_2mortal(newSVuv(bytes)));
+        }
+#line 2607 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_set_threads); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_set_threads)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "threads");
+    {
+	int	threads = (int)SvIV(ST(0))
+;
+	undef_int	RETVAL;
+
+	RETVAL = i_set_threads(threads);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_get_threads); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_get_threads)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    {
+	int	RETVAL;
+	dXSTARG;
+
+	RETVAL = i_get_threads();
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_int_check_image_file_limits); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_int_check_image_file_limits)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "width, height, channels, sample_size");
+    {
+	i_img_dim	width;
+	i_img_dim	height;
+	int	channels = (int)SvIV(ST(2))
+;
+	size_t	sample_size = (size_t)SvUV(ST(3))
+;
+	bool	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'width' shouldn't be a reference");
+	    }
+	    else {
+	    	width = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'height' shouldn't be a reference");
+	    }
+	    else {
+	    	height = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_int_check_image_file_limits(width, height, channels, sample_size);
+	ST(0) = boolSV(RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_trim_rect); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_trim_rect)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, transp_threshold, cls");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 1596 "Imager.xs"
+    i_img_dim left, top, right, bottom;
+#line 2711 "Imager.c"
+	Imager__ImgRaw	im;
+	double	transp_threshold = (double)SvNV(ST(1))
+;
+	Imager__TrimColorList	cls;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (!S_get_trim_color_list(aTHX_ ST(2), &cls)) {
+	    Perl_croak(aTHX_ "%s: " "cls" " is not a valid Imager::TrimColorList",
+	               "Imager::i_trim_rect");
+	}
+;
+#line 1598 "Imager.xs"
+    if (!i_trim_rect(im, transp_threshold, cls.count, cls.colors, &left, &top, &right, &bottom))
+      XSRETURN(0);
+      EXTEND(SP, 4);
+      PUSHs(newSViv(left));
+      PUSHs(newSViv(top));
+      PUSHs(newSViv(right));
+      PUSHs(newSViv(bottom));
+#line 2749 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__IO_new_fd); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_new_fd)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "class, fd");
+    {
+	int	fd = (int)SvIV(ST(1))
+;
+	Imager__IO	RETVAL;
+#line 1612 "Imager.xs"
+	RETVAL = io_new_fd(fd);
+#line 2768 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_new_mmap); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_new_mmap)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "class, fd");
+    {
+	int	fd = (int)SvIV(ST(1))
+;
+	Imager__IO	RETVAL;
+#line 1620 "Imager.xs"
+	i_clear_error();
+	RETVAL = io_new_mmap(fd);
+	if (!RETVAL)
+	  XSRETURN(0);
+#line 2795 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_new_buffer); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_new_buffer)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "class, data_sv");
+    {
+	SV *	data_sv = ST(1)
+;
+	Imager__IO	RETVAL;
+#line 1631 "Imager.xs"
+        i_clear_error();
+        RETVAL = do_io_new_buffer(aTHX_ data_sv);
+	if (!RETVAL)
+	  XSRETURN(0);
+#line 2822 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_new_cb); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_new_cb)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "class, writecb, readcb, seekcb, closecb");
+    {
+	SV *	writecb = ST(1)
+;
+	SV *	readcb = ST(2)
+;
+	SV *	seekcb = ST(3)
+;
+	SV *	closecb = ST(4)
+;
+	Imager__IO	RETVAL;
+#line 1645 "Imager.xs"
+        RETVAL = do_io_new_cb(aTHX_ writecb, readcb, seekcb, closecb);
+#line 2852 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_new_bufchain); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_new_bufchain)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "class");
+    {
+	Imager__IO	RETVAL;
+#line 1652 "Imager.xs"
+	RETVAL = io_new_bufchain();
+#line 2874 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO__new_perlio); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO__new_perlio)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "class, io");
+    {
+	PerlIO *	io = IoIFP(sv_2io(ST(1)))
+;
+	Imager__IO	RETVAL;
+#line 1660 "Imager.xs"
+        RETVAL = im_io_new_perlio(aTHX_ io);
+#line 2898 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::IO", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_slurp); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_slurp)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "class, ig");
+    {
+	Imager__IO	ig;
+#line 1668 "Imager.xs"
+	unsigned char*    data;
+	size_t    tlength;
+#line 2921 "Imager.c"
+	SV *	RETVAL;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::slurp",
+			"ig", "Imager::IO",
+			refstr, ST(1)
+		);
+	}
+;
+#line 1671 "Imager.xs"
+	data    = NULL;
+	tlength = io_slurp(ig, &data);
+	RETVAL = newSVpv((char *)data,tlength);
+	myfree(data);
+#line 2942 "Imager.c"
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_raw_write); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_raw_write)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, data_sv");
+    {
+	Imager__IO	ig;
+	SV *	data_sv = ST(1)
+;
+#line 1685 "Imager.xs"
+        void *data;
+	STRLEN size;
+#line 2963 "Imager.c"
+	IV	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::raw_write",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1688 "Imager.xs"
+	data = SvPVbyte(data_sv, size);
+        RETVAL = i_io_raw_write(ig, data, size);
+#line 2983 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_raw_read); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_raw_read)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "ig, buffer_sv, size");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__IO	ig;
+	SV *	buffer_sv = ST(1)
+;
+	IV	size = (IV)SvIV(ST(2))
+;
+#line 1699 "Imager.xs"
+        void *buffer;
+	ssize_t result;
+#line 3008 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::raw_read",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1702 "Imager.xs"
+        if (size <= 0)
+	  croak("size %" IVdf " non-positive in call to i_io_raw_read()", size);
+        if (size >= SSize_t_MAX)
+          croak("size %" IVdf " too large in call to i_io_raw_read()", size);
+        /* prevent an undefined value warning if they supplied an 
+          undef buffer.
+           Orginally conditional on !SvOK(), but this will prevent the
+          downgrade from croaking */
+       sv_setpvn(buffer_sv, "", 0);
+#ifdef SvUTF8
+       if (SvUTF8(buffer_sv))
+          sv_utf8_downgrade(buffer_sv, FALSE);
+#endif
+	buffer = SvGROW(buffer_sv, (STRLEN)size+1);
+        result = i_io_raw_read(ig, buffer, size);
+        if (result >= 0) {
+	  SvCUR_set(buffer_sv, result);
+	  *SvEND(buffer_sv) = '\0';
+	  SvPOK_only(buffer_sv);
+	  EXTEND(SP, 1);
+	  PUSHs(sv_2mortal(newSViv(result)));
+	}
+	ST(1) = buffer_sv;
+	SvSETMAGIC(ST(1));
+#line 3048 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__IO_raw_read2); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_raw_read2)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, size");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__IO	ig;
+	IV	size = (IV)SvIV(ST(1))
+;
+#line 1732 "Imager.xs"
+	SV *buffer_sv;
+        void *buffer;
+	ssize_t result;
+#line 3071 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::raw_read2",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1736 "Imager.xs"
+        if (size <= 0)
+	  croak("size %" IVdf " negative in call to i_io_read2()", size);
+        if (size >= SSize_t_MAX)
+          croak("size %" IVdf " too large in i_io_read2()", size);
+	buffer_sv = newSV(size+1);
+	buffer = SvGROW(buffer_sv, (STRLEN)size+1);
+        result = i_io_raw_read(ig, buffer, size);
+        if (result >= 0) {
+	  SvCUR_set(buffer_sv, result);
+	  *SvEND(buffer_sv) = '\0';
+	  SvPOK_only(buffer_sv);
+	  EXTEND(SP, 1);
+	  PUSHs(sv_2mortal(buffer_sv));
+	}
+	else {
+          /* discard it */
+	  SvREFCNT_dec(buffer_sv);
+        }
+#line 3105 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__IO_raw_seek); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_raw_seek)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "ig, position, whence");
+    {
+	Imager__IO	ig;
+	off_t  position = i_sv_off_t(aTHX_ ST(1))
+;
+	int	whence = (int)SvIV(ST(2))
+;
+	off_t	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::raw_seek",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_raw_seek(ig, position, whence);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = i_new_sv_off_t(aTHX_ RETVAL);
+	    RETVALSV = sv_2mortal(RETVALSV);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_raw_close); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_raw_close)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::raw_close",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_raw_close(ig);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"Imager::IO::DESTROY",
+			"ig")
+;
+
+	i_io_DESTROY(ig);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__IO_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 1772 "Imager.xs"
+        (void)items; /* avoid unused warning for XS variable */
+	RETVAL = 1;
+#line 3222 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_getc); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_getc)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::getc",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_getc(ig);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_nextc); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_nextc)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::nextc",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	i_io_nextc(ig);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__IO_putc); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_putc)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, c");
+    {
+	Imager__IO	ig;
+	int	c = (int)SvIV(ST(1))
+;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::putc",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_putc(ig, c);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_close); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_close)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::close",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_close(ig);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_flush); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_flush)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::flush",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_flush(ig);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_peekc); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_peekc)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::peekc",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_peekc(ig);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_seek); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_seek)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "ig, off, whence");
+    {
+	Imager__IO	ig;
+	off_t  off = i_sv_off_t(aTHX_ ST(1))
+;
+	int	whence = (int)SvIV(ST(2))
+;
+	int	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::seek",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_seek(ig, off, whence);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_peekn); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_peekn)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, size");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__IO	ig;
+	STRLEN	size = (STRLEN)SvUV(ST(1))
+;
+#line 1813 "Imager.xs"
+	SV *buffer_sv;
+        void *buffer;
+	ssize_t result;
+#line 3479 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::peekn",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1817 "Imager.xs"
+	buffer_sv = newSV(size+1);
+	buffer = SvGROW(buffer_sv, size+1);
+        result = i_io_peekn(ig, buffer, size);
+        if (result >= 0) {
+	  SvCUR_set(buffer_sv, result);
+	  *SvEND(buffer_sv) = '\0';
+	  SvPOK_only(buffer_sv);
+	  EXTEND(SP, 1);
+	  PUSHs(sv_2mortal(buffer_sv));
+	}
+	else {
+          /* discard it */
+	  SvREFCNT_dec(buffer_sv);
+        }
+#line 3509 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__IO_read); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_read)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "ig, buffer_sv, size");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__IO	ig;
+	SV *	buffer_sv = ST(1)
+;
+	IV	size = (IV)SvIV(ST(2))
+;
+#line 1838 "Imager.xs"
+        void *buffer;
+	ssize_t result;
+#line 3533 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::read",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1841 "Imager.xs"
+        if (size <= 0)
+	  croak("size negative in call to i_io_read()");
+        if (size >= SSize_t_MAX)
+          croak("size too large in call to i_io_read()");
+        /* prevent an undefined value warning if they supplied an 
+          undef buffer.
+           Orginally conditional on !SvOK(), but this will prevent the
+          downgrade from croaking */
+       sv_setpvn(buffer_sv, "", 0);
+#ifdef SvUTF8
+       if (SvUTF8(buffer_sv))
+          sv_utf8_downgrade(buffer_sv, FALSE);
+#endif
+	buffer = SvGROW(buffer_sv, (STRLEN)size+1);
+        result = i_io_read(ig, buffer, size);
+        if (result >= 0) {
+	  SvCUR_set(buffer_sv, result);
+	  *SvEND(buffer_sv) = '\0';
+	  SvPOK_only(buffer_sv);
+	  EXTEND(SP, 1);
+	  PUSHs(sv_2mortal(newSViv(result)));
+	}
+	ST(1) = buffer_sv;
+	SvSETMAGIC(ST(1));
+#line 3573 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__IO_read2); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_read2)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, size");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__IO	ig;
+	STRLEN	size = (STRLEN)SvUV(ST(1))
+;
+#line 1871 "Imager.xs"
+	SV *buffer_sv;
+        void *buffer;
+	ssize_t result;
+#line 3596 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::read2",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1875 "Imager.xs"
+        if (size == 0)
+	  croak("size zero in call to read2()");
+	buffer_sv = newSV(size);
+	buffer = SvGROW(buffer_sv, size+1);
+        result = i_io_read(ig, buffer, size);
+        if (result > 0) {
+	  SvCUR_set(buffer_sv, result);
+	  *SvEND(buffer_sv) = '\0';
+	  SvPOK_only(buffer_sv);
+	  EXTEND(SP, 1);
+	  PUSHs(sv_2mortal(buffer_sv));
+	}
+	else {
+          /* discard it */
+	  SvREFCNT_dec(buffer_sv);
+        }
+#line 3628 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__IO_gets); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_gets)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 3)
+       croak_xs_usage(cv,  "ig, size = 8192, eol = NEWLINE");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__IO	ig;
+	STRLEN	size;
+	int	eol;
+#line 1898 "Imager.xs"
+	SV *buffer_sv;
+        void *buffer;
+	ssize_t result;
+#line 3651 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::gets",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 2)
+	    size = 8192;
+	else {
+	    size = (STRLEN)SvUV(ST(1))
+;
+	}
+
+	if (items < 3)
+	    eol = NEWLINE;
+	else {
+	    eol = (int)SvIV(ST(2))
+;
+	}
+#line 1902 "Imager.xs"
+        if (size < 2)
+	  croak("size too small in call to gets()");
+	buffer_sv = sv_2mortal(newSV(size+1));
+	buffer = SvPVX(buffer_sv);
+        result = i_io_gets(ig, buffer, size+1, eol);
+        if (result > 0) {
+	  SvCUR_set(buffer_sv, result);
+	  *SvEND(buffer_sv) = '\0';
+	  SvPOK_only(buffer_sv);
+	  EXTEND(SP, 1);
+	  PUSHs(buffer_sv);
+	}
+#line 3693 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager__IO_write); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_write)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, data_sv");
+    {
+	Imager__IO	ig;
+	SV *	data_sv = ST(1)
+;
+#line 1920 "Imager.xs"
+        void *data;
+	STRLEN size;
+#line 3713 "Imager.c"
+	IV	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::write",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 1923 "Imager.xs"
+	data = SvPVbyte(data_sv, size);
+        RETVAL = i_io_write(ig, data, size);
+#line 3733 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_dump); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_dump)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "ig, flags = I_IO_DUMP_DEFAULT");
+    {
+	Imager__IO	ig;
+	int	flags;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::dump",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 2)
+	    flags = I_IO_DUMP_DEFAULT;
+	else {
+	    flags = (int)SvIV(ST(1))
+;
+	}
+
+	i_io_dump(ig, flags);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__IO_set_buffered); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_set_buffered)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "ig, flag = 1");
+    {
+	Imager__IO	ig;
+	int	flag;
+	bool	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::set_buffered",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 2)
+	    flag = 1;
+	else {
+	    flag = (int)SvIV(ST(1))
+;
+	}
+
+	RETVAL = i_io_set_buffered(ig, flag);
+	ST(0) = boolSV(RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_is_buffered); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_is_buffered)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+	bool	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::is_buffered",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_is_buffered(ig);
+	ST(0) = boolSV(RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_eof); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_eof)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+	bool	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::eof",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_eof(ig);
+	ST(0) = boolSV(RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__IO_error); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__IO_error)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ig");
+    {
+	Imager__IO	ig;
+	bool	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::IO::error",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_io_error(ig);
+	ST(0) = boolSV(RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_list_formats); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_list_formats)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 1957 "Imager.xs"
+	      char*    item;
+	       int     i;
+#line 3922 "Imager.c"
+#line 1960 "Imager.xs"
+	       i=0;
+	       while( (item=i_format_list[i++]) != NULL ) {
+		      EXTEND(SP, 1);
+		      PUSHs(sv_2mortal(newSVpv(item,0)));
+	       }
+#line 3929 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_sametype); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_sametype)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, x, y");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_sametype(im, x, y);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_sametype_chans); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_sametype_chans)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, x, y, channels");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	int	channels = (int)SvIV(ST(3))
+;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_sametype_chans(im, x, y, channels);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_init_log); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_init_log)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "name_sv, level");
+    {
+	SV*	name_sv = ST(0)
+;
+	int	level = (int)SvIV(ST(1))
+;
+#line 1984 "Imager.xs"
+	  const char *name = SvOK(name_sv) ? SvPV_nolen(name_sv) : NULL;
+#line 4081 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+#line 1986 "Imager.xs"
+	  RETVAL = i_init_log(name, level);
+#line 4086 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_log_entry); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_log_entry)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "string, level");
+    {
+	char*	string = (char *)SvPV_nolen(ST(0))
+;
+	int	level = (int)SvIV(ST(1))
+;
+
+	i_log_entry(string, level);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_log_enabled); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_log_enabled)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    {
+	int	RETVAL;
+	dXSTARG;
+
+	RETVAL = i_log_enabled();
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_info); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_info)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+#line 2002 "Imager.xs"
+	       i_img_dim     info[4];
+#line 4142 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 2004 "Imager.xs"
+   	       i_img_info(im,info);
+               EXTEND(SP, 4);
+               PUSHs(sv_2mortal(newSViv(info[0])));
+               PUSHs(sv_2mortal(newSViv(info[1])));
+               PUSHs(sv_2mortal(newSViv(info[2])));
+               PUSHs(sv_2mortal(newSViv(info[3])));
+#line 4169 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_img_setmask); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_setmask)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, ch_mask");
+    {
+	Imager__ImgRaw	im;
+	int	ch_mask = (int)SvIV(ST(1))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_img_setmask(im, ch_mask);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_img_getmask); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_getmask)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_getmask(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_getchannels); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_getchannels)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_getchannels(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_getdata); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_getdata)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 2031 "Imager.xs"
+	       EXTEND(SP, 1);
+               PUSHs(im->idata ? 
+	             sv_2mortal(newSVpv((char *)im->idata, im->bytes)) 
+		     : &PL_sv_undef);
+#line 4322 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_img_get_width); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_get_width)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	IV	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_get_width(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_get_height); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_get_height)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	IV	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_get_height(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_color_model); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_color_model)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_color_model(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_color_channels); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_color_channels)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_color_channels(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_alpha_channel); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_alpha_channel)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 2056 "Imager.xs"
+    if (!i_img_alpha_channel(im, &RETVAL))
+      XSRETURN(0);
+#line 4513 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_is_monochrome); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_is_monochrome)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+#line 2065 "Imager.xs"
+	int zero_is_white;
+	int result;
+#line 4534 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 2068 "Imager.xs"
+	result = i_img_is_monochrome(im, &zero_is_white);
+	if (result) {
+	  if (GIMME_V == G_ARRAY) {
+	    EXTEND(SP, 2);
+	    PUSHs(&PL_sv_yes);
+	    PUSHs(sv_2mortal(newSViv(zero_is_white)));
+ 	  }
+	  else {
+	    EXTEND(SP, 1);
+	    PUSHs(&PL_sv_yes);
+	  }
+	}
+#line 4567 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_line); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_line)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "im, x1, y1, x2, y2, val, endp");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x1;
+	i_img_dim	y1;
+	i_img_dim	x2;
+	i_img_dim	y2;
+	Imager__Color	val;
+	int	endp = (int)SvIV(ST(6))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x1' shouldn't be a reference");
+	    }
+	    else {
+	    	x1 = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y1' shouldn't be a reference");
+	    }
+	    else {
+	    	y1 = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'x2' shouldn't be a reference");
+	    }
+	    else {
+	    	x2 = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'y2' shouldn't be a reference");
+	    }
+	    else {
+	    	y2 = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	if (SvROK(ST(5)) && sv_derived_from(ST(5), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(5)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(5)) ? "" : SvOK(ST(5)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_line",
+			"val", "Imager::Color",
+			refstr, ST(5)
+		);
+	}
+;
+
+	i_line(im, x1, y1, x2, y2, val, endp);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_line_aa); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_line_aa)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "im, x1, y1, x2, y2, val, endp");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x1;
+	i_img_dim	y1;
+	i_img_dim	x2;
+	i_img_dim	y2;
+	Imager__Color	val;
+	int	endp = (int)SvIV(ST(6))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x1' shouldn't be a reference");
+	    }
+	    else {
+	    	x1 = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y1' shouldn't be a reference");
+	    }
+	    else {
+	    	y1 = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'x2' shouldn't be a reference");
+	    }
+	    else {
+	    	x2 = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'y2' shouldn't be a reference");
+	    }
+	    else {
+	    	y2 = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	if (SvROK(ST(5)) && sv_derived_from(ST(5), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(5)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(5)) ? "" : SvOK(ST(5)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_line_aa",
+			"val", "Imager::Color",
+			refstr, ST(5)
+		);
+	}
+;
+
+	i_line_aa(im, x1, y1, x2, y2, val, endp);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_box); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_box)
+{
+    dVAR; dXSARGS;
+    if (items != 6)
+       croak_xs_usage(cv,  "im, x1, y1, x2, y2, val");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x1;
+	i_img_dim	y1;
+	i_img_dim	x2;
+	i_img_dim	y2;
+	Imager__Color	val;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x1' shouldn't be a reference");
+	    }
+	    else {
+	    	x1 = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y1' shouldn't be a reference");
+	    }
+	    else {
+	    	y1 = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'x2' shouldn't be a reference");
+	    }
+	    else {
+	    	x2 = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'y2' shouldn't be a reference");
+	    }
+	    else {
+	    	y2 = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	if (SvROK(ST(5)) && sv_derived_from(ST(5), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(5)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(5)) ? "" : SvOK(ST(5)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_box",
+			"val", "Imager::Color",
+			refstr, ST(5)
+		);
+	}
+;
+
+	i_box(im, x1, y1, x2, y2, val);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_box_filled); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_box_filled)
+{
+    dVAR; dXSARGS;
+    if (items != 6)
+       croak_xs_usage(cv,  "im, x1, y1, x2, y2, val");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x1;
+	i_img_dim	y1;
+	i_img_dim	x2;
+	i_img_dim	y2;
+	Imager__Color	val;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x1' shouldn't be a reference");
+	    }
+	    else {
+	    	x1 = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y1' shouldn't be a reference");
+	    }
+	    else {
+	    	y1 = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'x2' shouldn't be a reference");
+	    }
+	    else {
+	    	x2 = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'y2' shouldn't be a reference");
+	    }
+	    else {
+	    	y2 = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	if (SvROK(ST(5)) && sv_derived_from(ST(5), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(5)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(5)) ? "" : SvOK(ST(5)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_box_filled",
+			"val", "Imager::Color",
+			refstr, ST(5)
+		);
+	}
+;
+
+	i_box_filled(im, x1, y1, x2, y2, val);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_box_filledf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_box_filledf)
+{
+    dVAR; dXSARGS;
+    if (items != 6)
+       croak_xs_usage(cv,  "im, x1, y1, x2, y2, val");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x1;
+	i_img_dim	y1;
+	i_img_dim	x2;
+	i_img_dim	y2;
+	Imager__Color__Float	val;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x1' shouldn't be a reference");
+	    }
+	    else {
+	    	x1 = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y1' shouldn't be a reference");
+	    }
+	    else {
+	    	y1 = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'x2' shouldn't be a reference");
+	    }
+	    else {
+	    	x2 = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'y2' shouldn't be a reference");
+	    }
+	    else {
+	    	y2 = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	if (SvROK(ST(5)) && sv_derived_from(ST(5), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(5)));
+	    val = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(5)) ? "" : SvOK(ST(5)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_box_filledf",
+			"val", "Imager::Color::Float",
+			refstr, ST(5)
+		);
+	}
+;
+
+	RETVAL = i_box_filledf(im, x1, y1, x2, y2, val);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_box_cfill); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_box_cfill)
+{
+    dVAR; dXSARGS;
+    if (items != 6)
+       croak_xs_usage(cv,  "im, x1, y1, x2, y2, fill");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x1;
+	i_img_dim	y1;
+	i_img_dim	x2;
+	i_img_dim	y2;
+	Imager__FillHandle	fill;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x1' shouldn't be a reference");
+	    }
+	    else {
+	    	x1 = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y1' shouldn't be a reference");
+	    }
+	    else {
+	    	y1 = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'x2' shouldn't be a reference");
+	    }
+	    else {
+	    	x2 = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'y2' shouldn't be a reference");
+	    }
+	    else {
+	    	y2 = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	if (SvROK(ST(5)) && sv_derived_from(ST(5), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(5)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(5)) ? "" : SvOK(ST(5)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_box_cfill",
+			"fill", "Imager::FillHandle",
+			refstr, ST(5)
+		);
+	}
+;
+
+	i_box_cfill(im, x1, y1, x2, y2, fill);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_arc); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_arc)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "im, x, y, rad, d1, d2, val");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	im_double	rad;
+	im_double	d1;
+	im_double	d2;
+	Imager__Color	val;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'd1' shouldn't be a reference");
+	    }
+	    else {
+	    	d1 = (im_double)SvNV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'd2' shouldn't be a reference");
+	    }
+	    else {
+	    	d2 = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	if (SvROK(ST(6)) && sv_derived_from(ST(6), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(6)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(6)) ? "" : SvOK(ST(6)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_arc",
+			"val", "Imager::Color",
+			refstr, ST(6)
+		);
+	}
+;
+
+	i_arc(im, x, y, rad, d1, d2, val);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_arc_aa); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_arc_aa)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "im, x, y, rad, d1, d2, val");
+    {
+	Imager__ImgRaw	im;
+	im_double	x;
+	im_double	y;
+	im_double	rad;
+	im_double	d1;
+	im_double	d2;
+	Imager__Color	val;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'd1' shouldn't be a reference");
+	    }
+	    else {
+	    	d1 = (im_double)SvNV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'd2' shouldn't be a reference");
+	    }
+	    else {
+	    	d2 = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	if (SvROK(ST(6)) && sv_derived_from(ST(6), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(6)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(6)) ? "" : SvOK(ST(6)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_arc_aa",
+			"val", "Imager::Color",
+			refstr, ST(6)
+		);
+	}
+;
+
+	i_arc_aa(im, x, y, rad, d1, d2, val);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_arc_cfill); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_arc_cfill)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "im, x, y, rad, d1, d2, fill");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	im_double	rad;
+	im_double	d1;
+	im_double	d2;
+	Imager__FillHandle	fill;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'd1' shouldn't be a reference");
+	    }
+	    else {
+	    	d1 = (im_double)SvNV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'd2' shouldn't be a reference");
+	    }
+	    else {
+	    	d2 = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	if (SvROK(ST(6)) && sv_derived_from(ST(6), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(6)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(6)) ? "" : SvOK(ST(6)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_arc_cfill",
+			"fill", "Imager::FillHandle",
+			refstr, ST(6)
+		);
+	}
+;
+
+	i_arc_cfill(im, x, y, rad, d1, d2, fill);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_arc_aa_cfill); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_arc_aa_cfill)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "im, x, y, rad, d1, d2, fill");
+    {
+	Imager__ImgRaw	im;
+	im_double	x;
+	im_double	y;
+	im_double	rad;
+	im_double	d1;
+	im_double	d2;
+	Imager__FillHandle	fill;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'd1' shouldn't be a reference");
+	    }
+	    else {
+	    	d1 = (im_double)SvNV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'd2' shouldn't be a reference");
+	    }
+	    else {
+	    	d2 = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	if (SvROK(ST(6)) && sv_derived_from(ST(6), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(6)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(6)) ? "" : SvOK(ST(6)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_arc_aa_cfill",
+			"fill", "Imager::FillHandle",
+			refstr, ST(6)
+		);
+	}
+;
+
+	i_arc_aa_cfill(im, x, y, rad, d1, d2, fill);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_circle_aa); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_circle_aa)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, x, y, rad, val");
+    {
+	Imager__ImgRaw	im;
+	im_double	x;
+	im_double	y;
+	im_double	rad;
+	Imager__Color	val;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_circle_aa",
+			"val", "Imager::Color",
+			refstr, ST(4)
+		);
+	}
+;
+
+	i_circle_aa(im, x, y, rad, val);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_circle_aa_fill); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_circle_aa_fill)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, x, y, rad, fill");
+    {
+	Imager__ImgRaw	im;
+	im_double	x;
+	im_double	y;
+	im_double	rad;
+	Imager__FillHandle	fill;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_circle_aa_fill",
+			"fill", "Imager::FillHandle",
+			refstr, ST(4)
+		);
+	}
+;
+
+	i_circle_aa_fill(im, x, y, rad, fill);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_circle_out); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_circle_out)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, x, y, rad, val");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	i_img_dim	rad;
+	Imager__Color	val;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_circle_out",
+			"val", "Imager::Color",
+			refstr, ST(4)
+		);
+	}
+;
+
+	RETVAL = i_circle_out(im, x, y, rad, val);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_circle_out_aa); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_circle_out_aa)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, x, y, rad, val");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	i_img_dim	rad;
+	Imager__Color	val;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_circle_out_aa",
+			"val", "Imager::Color",
+			refstr, ST(4)
+		);
+	}
+;
+
+	RETVAL = i_circle_out_aa(im, x, y, rad, val);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_arc_out); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_arc_out)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "im, x, y, rad, d1, d2, val");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	i_img_dim	rad;
+	im_double	d1;
+	im_double	d2;
+	Imager__Color	val;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'd1' shouldn't be a reference");
+	    }
+	    else {
+	    	d1 = (im_double)SvNV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'd2' shouldn't be a reference");
+	    }
+	    else {
+	    	d2 = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	if (SvROK(ST(6)) && sv_derived_from(ST(6), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(6)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(6)) ? "" : SvOK(ST(6)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_arc_out",
+			"val", "Imager::Color",
+			refstr, ST(6)
+		);
+	}
+;
+
+	RETVAL = i_arc_out(im, x, y, rad, d1, d2, val);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_arc_out_aa); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_arc_out_aa)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "im, x, y, rad, d1, d2, val");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	i_img_dim	rad;
+	im_double	d1;
+	im_double	d2;
+	Imager__Color	val;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'rad' shouldn't be a reference");
+	    }
+	    else {
+	    	rad = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'd1' shouldn't be a reference");
+	    }
+	    else {
+	    	d1 = (im_double)SvNV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'd2' shouldn't be a reference");
+	    }
+	    else {
+	    	d2 = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	if (SvROK(ST(6)) && sv_derived_from(ST(6), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(6)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(6)) ? "" : SvOK(ST(6)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_arc_out_aa",
+			"val", "Imager::Color",
+			refstr, ST(6)
+		);
+	}
+;
+
+	RETVAL = i_arc_out_aa(im, x, y, rad, d1, d2, val);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_bezier_multi); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_bezier_multi)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, x, y, val");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	double *	x;
+	double *	y;
+	Imager__Color	val;
+#line 2238 "Imager.xs"
+    STRLEN size_x;
+    STRLEN size_y;
+#line 6190 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_x = av_len(xsub_tmp_av) + 1;
+		    x = doublePtr(size_x);
+		    for (xsub_index = 0; xsub_index < size_x; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  x[xsub_index] = SvDouble(*sv, "Imager::i_bezier_multi");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_bezier_multi",
+				"x");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(2);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_y = av_len(xsub_tmp_av) + 1;
+		    y = doublePtr(size_y);
+		    for (xsub_index = 0; xsub_index < size_y; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  y[xsub_index] = SvDouble(*sv, "Imager::i_bezier_multi");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_bezier_multi",
+				"y");
+		}
+	} STMT_END
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_bezier_multi",
+			"val", "Imager::Color",
+			refstr, ST(3)
+		);
+	}
+;
+#line 2241 "Imager.xs"
+    if (size_x != size_y)
+      croak("Imager: x and y arrays to i_bezier_multi must be equal length\n");
+    i_bezier_multi(im,size_x,x,y,val);
+#line 6274 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_poly_aa_m); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_poly_aa_m)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, x, y, mode, val");
+    {
+	Imager__ImgRaw	im;
+	double *	x;
+	double *	y;
+	i_poly_fill_mode_t	mode = S_get_poly_fill_mode(aTHX_ ST(3))
+;
+	Imager__Color	val;
+#line 2253 "Imager.xs"
+    STRLEN   size_x;
+    STRLEN   size_y;
+#line 6297 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_x = av_len(xsub_tmp_av) + 1;
+		    x = doublePtr(size_x);
+		    for (xsub_index = 0; xsub_index < size_x; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  x[xsub_index] = SvDouble(*sv, "Imager::i_poly_aa_m");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_poly_aa_m",
+				"x");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(2);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_y = av_len(xsub_tmp_av) + 1;
+		    y = doublePtr(size_y);
+		    for (xsub_index = 0; xsub_index < size_y; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  y[xsub_index] = SvDouble(*sv, "Imager::i_poly_aa_m");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_poly_aa_m",
+				"y");
+		}
+	} STMT_END
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    val = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_poly_aa_m",
+			"val", "Imager::Color",
+			refstr, ST(4)
+		);
+	}
+;
+#line 2256 "Imager.xs"
+    if (size_x != size_y)
+      croak("Imager: x and y arrays to i_poly_aa must be equal length\n");
+    RETVAL = i_poly_aa_m(im, size_x, x, y, mode, val);
+#line 6383 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_poly_aa_cfill_m); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_poly_aa_cfill_m)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, x, y, mode, fill");
+    {
+	Imager__ImgRaw	im;
+	double *	x;
+	double *	y;
+	i_poly_fill_mode_t	mode = S_get_poly_fill_mode(aTHX_ ST(3))
+;
+	Imager__FillHandle	fill;
+#line 2270 "Imager.xs"
+    STRLEN size_x;
+    STRLEN size_y;
+#line 6407 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_x = av_len(xsub_tmp_av) + 1;
+		    x = doublePtr(size_x);
+		    for (xsub_index = 0; xsub_index < size_x; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  x[xsub_index] = SvDouble(*sv, "Imager::i_poly_aa_cfill_m");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_poly_aa_cfill_m",
+				"x");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(2);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_y = av_len(xsub_tmp_av) + 1;
+		    y = doublePtr(size_y);
+		    for (xsub_index = 0; xsub_index < size_y; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  y[xsub_index] = SvDouble(*sv, "Imager::i_poly_aa_cfill_m");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_poly_aa_cfill_m",
+				"y");
+		}
+	} STMT_END
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_poly_aa_cfill_m",
+			"fill", "Imager::FillHandle",
+			refstr, ST(4)
+		);
+	}
+;
+#line 2273 "Imager.xs"
+    if (size_x != size_y)
+      croak("Imager: x and y arrays to i_poly_aa_cfill must be equal length\n");
+    RETVAL = i_poly_aa_cfill_m(im, size_x, x, y, mode, fill);
+#line 6493 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_poly_poly_aa); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_poly_poly_aa)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, polys, mode, color");
+    {
+	Imager__ImgRaw	im;
+	i_polygon_list	polys;
+	i_poly_fill_mode_t	mode = S_get_poly_fill_mode(aTHX_ ST(2))
+;
+	Imager__Color	color;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        S_get_polygon_list(aTHX_ &polys, ST(1))
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    color = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_poly_poly_aa",
+			"color", "Imager::Color",
+			refstr, ST(3)
+		);
+	}
+;
+#line 2286 "Imager.xs"
+        RETVAL = i_poly_poly_aa(im, polys.count, polys.polygons, mode, color);
+#line 6553 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_poly_poly_aa_cfill); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_poly_poly_aa_cfill)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, polys, mode, fill");
+    {
+	Imager__ImgRaw	im;
+	i_polygon_list	polys;
+	i_poly_fill_mode_t	mode = S_get_poly_fill_mode(aTHX_ ST(2))
+;
+	Imager__FillHandle	fill;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        S_get_polygon_list(aTHX_ &polys, ST(1))
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_poly_poly_aa_cfill",
+			"fill", "Imager::FillHandle",
+			refstr, ST(3)
+		);
+	}
+;
+#line 2297 "Imager.xs"
+        RETVAL = i_poly_poly_aa_cfill(im, polys.count, polys.polygons, mode, fill);
+#line 6613 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_flood_fill); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_flood_fill)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, seedx, seedy, dcol");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	seedx;
+	i_img_dim	seedy;
+	Imager__Color	dcol;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'seedx' shouldn't be a reference");
+	    }
+	    else {
+	    	seedx = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'seedy' shouldn't be a reference");
+	    }
+	    else {
+	    	seedy = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    dcol = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_flood_fill",
+			"dcol", "Imager::Color",
+			refstr, ST(3)
+		);
+	}
+;
+
+	RETVAL = i_flood_fill(im, seedx, seedy, dcol);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_flood_cfill); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_flood_cfill)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, seedx, seedy, fill");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	seedx;
+	i_img_dim	seedy;
+	Imager__FillHandle	fill;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'seedx' shouldn't be a reference");
+	    }
+	    else {
+	    	seedx = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'seedy' shouldn't be a reference");
+	    }
+	    else {
+	    	seedy = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_flood_cfill",
+			"fill", "Imager::FillHandle",
+			refstr, ST(3)
+		);
+	}
+;
+
+	RETVAL = i_flood_cfill(im, seedx, seedy, fill);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_flood_fill_border); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_flood_fill_border)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, seedx, seedy, dcol, border");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	seedx;
+	i_img_dim	seedy;
+	Imager__Color	dcol;
+	Imager__Color	border;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'seedx' shouldn't be a reference");
+	    }
+	    else {
+	    	seedx = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'seedy' shouldn't be a reference");
+	    }
+	    else {
+	    	seedy = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    dcol = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_flood_fill_border",
+			"dcol", "Imager::Color",
+			refstr, ST(3)
+		);
+	}
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    border = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_flood_fill_border",
+			"border", "Imager::Color",
+			refstr, ST(4)
+		);
+	}
+;
+
+	RETVAL = i_flood_fill_border(im, seedx, seedy, dcol, border);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_flood_cfill_border); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_flood_cfill_border)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, seedx, seedy, fill, border");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	seedx;
+	i_img_dim	seedy;
+	Imager__FillHandle	fill;
+	Imager__Color	border;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'seedx' shouldn't be a reference");
+	    }
+	    else {
+	    	seedx = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'seedy' shouldn't be a reference");
+	    }
+	    else {
+	    	seedy = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_flood_cfill_border",
+			"fill", "Imager::FillHandle",
+			refstr, ST(3)
+		);
+	}
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    border = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_flood_cfill_border",
+			"border", "Imager::Color",
+			refstr, ST(4)
+		);
+	}
+;
+
+	RETVAL = i_flood_cfill_border(im, seedx, seedy, fill, border);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_copyto); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_copyto)
+{
+    dVAR; dXSARGS;
+    if (items != 8)
+       croak_xs_usage(cv,  "im, src, x1, y1, x2, y2, tx, ty");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	src;
+	i_img_dim	x1;
+	i_img_dim	y1;
+	i_img_dim	x2;
+	i_img_dim	y2;
+	i_img_dim	tx;
+	i_img_dim	ty;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'x1' shouldn't be a reference");
+	    }
+	    else {
+	    	x1 = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y1' shouldn't be a reference");
+	    }
+	    else {
+	    	y1 = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'x2' shouldn't be a reference");
+	    }
+	    else {
+	    	x2 = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'y2' shouldn't be a reference");
+	    }
+	    else {
+	    	y2 = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'tx' shouldn't be a reference");
+	    }
+	    else {
+	    	tx = (i_img_dim)SvIV(ST(6));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(7));
+	    if (SvROK(ST(7)) && !SvAMAGIC(ST(7))) {
+	        croak("Numeric argument 'ty' shouldn't be a reference");
+	    }
+	    else {
+	    	ty = (i_img_dim)SvIV(ST(7));
+	    }
+	}
+;
+
+	i_copyto(im, src, x1, y1, x2, y2, tx, ty);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_copyto_trans); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_copyto_trans)
+{
+    dVAR; dXSARGS;
+    if (items != 9)
+       croak_xs_usage(cv,  "im, src, x1, y1, x2, y2, tx, ty, trans");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	src;
+	i_img_dim	x1;
+	i_img_dim	y1;
+	i_img_dim	x2;
+	i_img_dim	y2;
+	i_img_dim	tx;
+	i_img_dim	ty;
+	Imager__Color	trans;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'x1' shouldn't be a reference");
+	    }
+	    else {
+	    	x1 = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y1' shouldn't be a reference");
+	    }
+	    else {
+	    	y1 = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'x2' shouldn't be a reference");
+	    }
+	    else {
+	    	x2 = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'y2' shouldn't be a reference");
+	    }
+	    else {
+	    	y2 = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'tx' shouldn't be a reference");
+	    }
+	    else {
+	    	tx = (i_img_dim)SvIV(ST(6));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(7));
+	    if (SvROK(ST(7)) && !SvAMAGIC(ST(7))) {
+	        croak("Numeric argument 'ty' shouldn't be a reference");
+	    }
+	    else {
+	    	ty = (i_img_dim)SvIV(ST(7));
+	    }
+	}
+;
+
+	if (SvROK(ST(8)) && sv_derived_from(ST(8), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(8)));
+	    trans = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(8)) ? "" : SvOK(ST(8)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_copyto_trans",
+			"trans", "Imager::Color",
+			refstr, ST(8)
+		);
+	}
+;
+
+	i_copyto_trans(im, src, x1, y1, x2, y2, tx, ty, trans);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_copy); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_copy)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "src");
+    {
+	Imager__ImgRaw	src;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_copy(src);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_rubthru); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_rubthru)
+{
+    dVAR; dXSARGS;
+    if (items != 8)
+       croak_xs_usage(cv,  "im, src, tx, ty, src_minx, src_miny, src_maxx, src_maxy");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	src;
+	i_img_dim	tx;
+	i_img_dim	ty;
+	i_img_dim	src_minx;
+	i_img_dim	src_miny;
+	i_img_dim	src_maxx;
+	i_img_dim	src_maxy;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'tx' shouldn't be a reference");
+	    }
+	    else {
+	    	tx = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'ty' shouldn't be a reference");
+	    }
+	    else {
+	    	ty = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'src_minx' shouldn't be a reference");
+	    }
+	    else {
+	    	src_minx = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'src_miny' shouldn't be a reference");
+	    }
+	    else {
+	    	src_miny = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'src_maxx' shouldn't be a reference");
+	    }
+	    else {
+	    	src_maxx = (i_img_dim)SvIV(ST(6));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(7));
+	    if (SvROK(ST(7)) && !SvAMAGIC(ST(7))) {
+	        croak("Numeric argument 'src_maxy' shouldn't be a reference");
+	    }
+	    else {
+	    	src_maxy = (i_img_dim)SvIV(ST(7));
+	    }
+	}
+;
+
+	RETVAL = i_rubthru(im, src, tx, ty, src_minx, src_miny, src_maxx, src_maxy);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_compose); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_compose)
+{
+    dVAR; dXSARGS;
+    if (items < 8 || items > 10)
+       croak_xs_usage(cv,  "out, src, out_left, out_top, src_left, src_top, width, height, combine = ic_normal, opacity = 0.0");
+    {
+	Imager__ImgRaw	out;
+	Imager__ImgRaw	src;
+	i_img_dim	out_left;
+	i_img_dim	out_top;
+	i_img_dim	src_left;
+	i_img_dim	src_top;
+	i_img_dim	width;
+	i_img_dim	height;
+	int	combine;
+	im_double	opacity;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            out = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                out = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "out is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "out is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'out_left' shouldn't be a reference");
+	    }
+	    else {
+	    	out_left = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'out_top' shouldn't be a reference");
+	    }
+	    else {
+	    	out_top = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'src_left' shouldn't be a reference");
+	    }
+	    else {
+	    	src_left = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'src_top' shouldn't be a reference");
+	    }
+	    else {
+	    	src_top = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'width' shouldn't be a reference");
+	    }
+	    else {
+	    	width = (i_img_dim)SvIV(ST(6));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(7));
+	    if (SvROK(ST(7)) && !SvAMAGIC(ST(7))) {
+	        croak("Numeric argument 'height' shouldn't be a reference");
+	    }
+	    else {
+	    	height = (i_img_dim)SvIV(ST(7));
+	    }
+	}
+;
+
+	if (items < 9)
+	    combine = ic_normal;
+	else {
+	    combine = (int)SvIV(ST(8))
+;
+	}
+
+	if (items < 10)
+	    opacity = 0.0;
+	else {
+	    {
+		SvGETMAGIC(ST(9));
+		if (SvROK(ST(9)) && !SvAMAGIC(ST(9))) {
+		    croak("Numeric argument 'opacity' shouldn't be a reference");
+		}
+		else {
+			    opacity = (im_double)SvNV(ST(9));
+		}
+	    }
+;
+	}
+
+	RETVAL = i_compose(out, src, out_left, out_top, src_left, src_top, width, height, combine, opacity);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_compose_mask); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_compose_mask)
+{
+    dVAR; dXSARGS;
+    if (items < 11 || items > 13)
+       croak_xs_usage(cv,  "out, src, mask, out_left, out_top, src_left, src_top, mask_left, mask_top, width, height, combine = ic_normal, opacity = 0.0");
+    {
+	Imager__ImgRaw	out;
+	Imager__ImgRaw	src;
+	Imager__ImgRaw	mask;
+	i_img_dim	out_left;
+	i_img_dim	out_top;
+	i_img_dim	src_left;
+	i_img_dim	src_top;
+	i_img_dim	mask_left;
+	i_img_dim	mask_top;
+	i_img_dim	width;
+	i_img_dim	height;
+	int	combine;
+	im_double	opacity;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            out = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                out = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "out is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "out is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(2), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(2)));
+            mask = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(2), "Imager") &&
+                 SvTYPE(SvRV(ST(2))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(2));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                mask = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "mask is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "mask is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'out_left' shouldn't be a reference");
+	    }
+	    else {
+	    	out_left = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'out_top' shouldn't be a reference");
+	    }
+	    else {
+	    	out_top = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'src_left' shouldn't be a reference");
+	    }
+	    else {
+	    	src_left = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'src_top' shouldn't be a reference");
+	    }
+	    else {
+	    	src_top = (i_img_dim)SvIV(ST(6));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(7));
+	    if (SvROK(ST(7)) && !SvAMAGIC(ST(7))) {
+	        croak("Numeric argument 'mask_left' shouldn't be a reference");
+	    }
+	    else {
+	    	mask_left = (i_img_dim)SvIV(ST(7));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(8));
+	    if (SvROK(ST(8)) && !SvAMAGIC(ST(8))) {
+	        croak("Numeric argument 'mask_top' shouldn't be a reference");
+	    }
+	    else {
+	    	mask_top = (i_img_dim)SvIV(ST(8));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(9));
+	    if (SvROK(ST(9)) && !SvAMAGIC(ST(9))) {
+	        croak("Numeric argument 'width' shouldn't be a reference");
+	    }
+	    else {
+	    	width = (i_img_dim)SvIV(ST(9));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(10));
+	    if (SvROK(ST(10)) && !SvAMAGIC(ST(10))) {
+	        croak("Numeric argument 'height' shouldn't be a reference");
+	    }
+	    else {
+	    	height = (i_img_dim)SvIV(ST(10));
+	    }
+	}
+;
+
+	if (items < 12)
+	    combine = ic_normal;
+	else {
+	    combine = (int)SvIV(ST(11))
+;
+	}
+
+	if (items < 13)
+	    opacity = 0.0;
+	else {
+	    {
+		SvGETMAGIC(ST(12));
+		if (SvROK(ST(12)) && !SvAMAGIC(ST(12))) {
+		    croak("Numeric argument 'opacity' shouldn't be a reference");
+		}
+		else {
+			    opacity = (im_double)SvNV(ST(12));
+		}
+	    }
+;
+	}
+
+	RETVAL = i_compose_mask(out, src, mask, out_left, out_top, src_left, src_top, mask_left, mask_top, width, height, combine, opacity);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_combine); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_combine)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "src_av, channels_av = NULL");
+    {
+	AV *	src_av;
+	AV *	channels_av;
+#line 2406 "Imager.xs"
+	i_img **imgs = NULL;
+	STRLEN in_count;
+	int *channels = NULL;
+	IV tmp;
+#line 7791 "Imager.c"
+	Imager__ImgRaw	RETVAL;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(0);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    src_av = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_combine",
+				"src_av");
+		}
+	} STMT_END
+;
+
+	if (items < 2)
+	    channels_av = NULL;
+	else {
+	    STMT_START {
+		    SV* const xsub_tmp_sv = ST(1);
+		    SvGETMAGIC(xsub_tmp_sv);
+		    if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+			channels_av = (AV*)SvRV(xsub_tmp_sv);
+		    }
+		    else{
+			Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				    "Imager::i_combine",
+				    "channels_av");
+		    }
+	    } STMT_END
+;
+	}
+#line 2411 "Imager.xs"
+	in_count = av_len(src_av) + 1;
+	if (in_count > 0) {
+          unsigned i;
+	  imgs = mymalloc(sizeof(i_img*) * in_count);
+	  channels = mymalloc(sizeof(int) * in_count);
+	  for (i = 0; i < in_count; ++i) {
+	    SV **psv = av_fetch(src_av, i, 0);
+	    if (!psv || !*psv || !sv_derived_from(*psv, "Imager::ImgRaw")) {
+	      myfree(imgs);
+	      myfree(channels);
+	      croak("imgs must contain only images");
+	    }
+	    tmp = SvIV((SV*)SvRV(*psv));
+	    imgs[i] = INT2PTR(i_img*, tmp);
+	    if (channels_av &&
+	        (psv = av_fetch(channels_av, i, 0)) != NULL &&
+		*psv) {
+	      channels[i] = SvIV(*psv);
+	    }
+	    else {
+	      channels[i] = 0;
+	    }
+	  }
+	}
+	RETVAL = i_combine(imgs, channels, in_count);
+	myfree(imgs);
+	myfree(channels);
+#line 7853 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_flipxy); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_flipxy)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, direction");
+    {
+	Imager__ImgRaw	im;
+	int	direction = (int)SvIV(ST(1))
+;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_flipxy(im, direction);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_rotate90); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_rotate90)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, degrees");
+    {
+	Imager__ImgRaw	im;
+	int	degrees = (int)SvIV(ST(1))
+;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_rotate90(im, degrees);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_rotate_exact); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_rotate_exact)
+{
+    dVAR; dXSARGS;
+    if (items < 2)
+       croak_xs_usage(cv,  "im, amount, ...");
+    {
+	Imager__ImgRaw	im;
+	im_double	amount;
+#line 2456 "Imager.xs"
+	i_color *backp = NULL;
+	i_fcolor *fbackp = NULL;
+	int i;
+	SV * sv1;
+#line 7966 "Imager.c"
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'amount' shouldn't be a reference");
+	    }
+	    else {
+	    	amount = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+#line 2461 "Imager.xs"
+	/* extract the bg colors if any */
+	/* yes, this is kind of strange */
+	for (i = 2; i < items; ++i) {
+          sv1 = ST(i);
+          if (sv_derived_from(sv1, "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(sv1));
+	    backp = INT2PTR(i_color *, tmp);
+	  }
+	  else if (sv_derived_from(sv1, "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(sv1));
+	    fbackp = INT2PTR(i_fcolor *, tmp);
+	  }
+	}
+	RETVAL = i_rotate_exact_bg(im, amount, backp, fbackp);
+#line 8013 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_matrix_transform); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_matrix_transform)
+{
+    dVAR; dXSARGS;
+    if (items < 4)
+       croak_xs_usage(cv,  "im, xsize, ysize, matrix_av, ...");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	xsize;
+	i_img_dim	ysize;
+	AV *	matrix_av;
+#line 2485 "Imager.xs"
+    double matrix[9];
+    STRLEN len;
+    SV *sv1;
+    int item_index;
+    unsigned coeff_index;
+    i_color *backp = NULL;
+    i_fcolor *fbackp = NULL;
+#line 8044 "Imager.c"
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'xsize' shouldn't be a reference");
+	    }
+	    else {
+	    	xsize = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'ysize' shouldn't be a reference");
+	    }
+	    else {
+	    	ysize = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(3);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    matrix_av = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_matrix_transform",
+				"matrix_av");
+		}
+	} STMT_END
+;
+#line 2493 "Imager.xs"
+    len=av_len(matrix_av)+1;
+    if (len > 9)
+      len = 9;
+    for (coeff_index = 0; coeff_index < len; ++coeff_index) {
+      sv1=(*(av_fetch(matrix_av, coeff_index, 0)));
+      matrix[coeff_index] = SvNV(sv1);
+    }
+    for (; coeff_index < 9; ++coeff_index)
+      matrix[coeff_index] = 0;
+    /* extract the bg colors if any */
+    /* yes, this is kind of strange */
+    for (item_index = 4; item_index < items; ++item_index) {
+      sv1 = ST(item_index);
+      if (sv_derived_from(sv1, "Imager::Color")) {
+        IV tmp = SvIV((SV*)SvRV(sv1));
+	backp = INT2PTR(i_color *, tmp);
+      }
+      else if (sv_derived_from(sv1, "Imager::Color::Float")) {
+        IV tmp = SvIV((SV*)SvRV(sv1));
+        fbackp = INT2PTR(i_fcolor *, tmp);
+      }
+    }
+    RETVAL = i_matrix_transform_bg(im, xsize, ysize, matrix, backp, fbackp);
+#line 8125 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_gaussian); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gaussian)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, stddev");
+    {
+	Imager__ImgRaw	im;
+	im_double	stddev;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'stddev' shouldn't be a reference");
+	    }
+	    else {
+	    	stddev = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_gaussian(im, stddev);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_gaussian2); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gaussian2)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, stddevX, stddevY");
+    {
+	Imager__ImgRaw	im;
+	im_double	stddevX;
+	im_double	stddevY;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'stddevX' shouldn't be a reference");
+	    }
+	    else {
+	    	stddevX = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'stddevY' shouldn't be a reference");
+	    }
+	    else {
+	    	stddevY = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_gaussian2(im, stddevX, stddevY);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_gaussian_box); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gaussian_box)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, stddevX, stddevY");
+    {
+	Imager__ImgRaw	im;
+	im_double	stddevX;
+	im_double	stddevY;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'stddevX' shouldn't be a reference");
+	    }
+	    else {
+	    	stddevX = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'stddevY' shouldn't be a reference");
+	    }
+	    else {
+	    	stddevY = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_gaussian_box(im, stddevX, stddevY);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_unsharp_mask); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_unsharp_mask)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, stdev, scale");
+    {
+	Imager__ImgRaw	im;
+	im_double	stdev;
+	im_double	scale;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'stdev' shouldn't be a reference");
+	    }
+	    else {
+	    	stdev = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'scale' shouldn't be a reference");
+	    }
+	    else {
+	    	scale = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	i_unsharp_mask(im, stdev, scale);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_conv); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_conv)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, coef");
+    {
+	Imager__ImgRaw	im;
+	AV *	coef;
+#line 2547 "Imager.xs"
+	double*    c_coef;
+	int     len;
+	SV* sv1;
+	int i;
+#line 8395 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    coef = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_conv",
+				"coef");
+		}
+	} STMT_END
+;
+#line 2552 "Imager.xs"
+	len = av_len(coef) + 1;
+	c_coef=mymalloc( len * sizeof(double) );
+	for(i = 0; i  < len; i++) {
+	  sv1 = (*(av_fetch(coef, i, 0)));
+	  c_coef[i] = (double)SvNV(sv1);
+	}
+	RETVAL = i_conv(im, c_coef, len);
+	myfree(c_coef);
+#line 8440 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_convert); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_convert)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "src, avmain");
+    {
+	Imager__ImgRaw	src;
+	AV *	avmain;
+#line 2568 "Imager.xs"
+    	  double *coeff;
+	  int outchan;
+	  int inchan;
+          SV **temp;
+          AV *avsub;
+	  int len;
+	  int i, j;
+#line 8465 "Imager.c"
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    avmain = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_convert",
+				"avmain");
+		}
+	} STMT_END
+;
+#line 2576 "Imager.xs"
+	  outchan = av_len(avmain)+1;
+          /* find the biggest */
+          inchan = 0;
+	  for (j=0; j < outchan; ++j) {
+	    temp = av_fetch(avmain, j, 0);
+	    if (temp && SvROK(*temp) && SvTYPE(SvRV(*temp)) == SVt_PVAV) {
+	      avsub = (AV*)SvRV(*temp);
+	      len = av_len(avsub)+1;
+	      if (len > inchan)
+		inchan = len;
+	    }
+	    else {
+	      i_push_errorf(0, "invalid matrix: element %d is not an array ref", j);
+	      XSRETURN(0);
+	    }
+          }
+          coeff = mymalloc(sizeof(double) * outchan * inchan);
+	  for (j = 0; j < outchan; ++j) {
+	    avsub = (AV*)SvRV(*av_fetch(avmain, j, 0));
+	    len = av_len(avsub)+1;
+	    for (i = 0; i < len; ++i) {
+	      temp = av_fetch(avsub, i, 0);
+	      if (temp)
+		coeff[i+j*inchan] = SvNV(*temp);
+	      else
+	 	coeff[i+j*inchan] = 0;
+	    }
+	    while (i < inchan)
+	      coeff[i++ + j*inchan] = 0;
+	  }
+	  RETVAL = i_convert(src, coeff, outchan, inchan);
+          myfree(coeff);
+#line 8533 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_map); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_map)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, pmaps_av");
+    {
+	Imager__ImgRaw	im;
+	AV *	pmaps_av;
+#line 2617 "Imager.xs"
+    unsigned int mask = 0;
+    AV *avsub;
+    SV **temp;
+    int len;
+    int i, j;
+    unsigned char (*maps)[256];
+#line 8561 "Imager.c"
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    pmaps_av = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_map",
+				"pmaps_av");
+		}
+	} STMT_END
+;
+#line 2624 "Imager.xs"
+    len = av_len(pmaps_av)+1;
+    if (im->channels < len)
+      len = im->channels;
+    maps = mymalloc( len * sizeof(unsigned char [256]) );
+    for (j=0; j<len ; j++) {
+      temp = av_fetch(pmaps_av, j, 0);
+      if (temp && SvROK(*temp) && (SvTYPE(SvRV(*temp)) == SVt_PVAV) ) {
+        avsub = (AV*)SvRV(*temp);
+        if(av_len(avsub) != 255)
+          continue;
+        mask |= 1<<j;
+        for (i=0; i<256 ; i++) {
+          int val;
+          temp = av_fetch(avsub, i, 0);
+          val = temp ? SvIV(*temp) : 0;
+          if (val<0) val = 0;
+          if (val>255) val = 255;
+          maps[j][i] = val;
+        }
+      }
+    }
+    i_map(im, maps, mask);
+    myfree(maps);
+    RETVAL = 1;
+#line 8621 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_diff); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_diff)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im1, im2");
+    {
+	Imager__ImgRaw	im1;
+	Imager__ImgRaw	im2;
+	float	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im1 = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im1 = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im1 is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im1 is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            im2 = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im2 = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_diff(im1, im2);
+	XSprePUSH;
+	PUSHn((double)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_diffd); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_diffd)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im1, im2");
+    {
+	Imager__ImgRaw	im1;
+	Imager__ImgRaw	im2;
+	double	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im1 = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im1 = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im1 is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im1 is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            im2 = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im2 = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_diffd(im1, im2);
+	XSprePUSH;
+	PUSHn((double)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_samef); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_samef)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "im1, im2, epsilon = i_img_epsilonf(), what=NULL");
+    {
+	Imager__ImgRaw	im1;
+	Imager__ImgRaw	im2;
+	im_double	epsilon;
+	const char *	what;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im1 = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im1 = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im1 is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im1 is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            im2 = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im2 = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw")
+;
+
+	if (items < 3)
+	    epsilon = i_img_epsilonf();
+	else {
+	    {
+		SvGETMAGIC(ST(2));
+		if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+		    croak("Numeric argument 'epsilon' shouldn't be a reference");
+		}
+		else {
+			    epsilon = (im_double)SvNV(ST(2));
+		}
+	    }
+;
+	}
+
+	if (items < 4)
+	    what = NULL;
+	else {
+	    what = (const char *)SvPV_nolen(ST(3))
+;
+	}
+
+	RETVAL = i_img_samef(im1, im2, epsilon, what);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_epsilonf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_epsilonf)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    {
+	double	RETVAL;
+	dXSTARG;
+
+	RETVAL = i_img_epsilonf();
+	XSprePUSH;
+	PUSHn((double)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__is_color_object); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__is_color_object)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "sv");
+    {
+	SV*	sv = ST(0)
+;
+	bool	RETVAL;
+#line 2675 "Imager.xs"
+        SvGETMAGIC(sv);
+        RETVAL = SvOK(sv) && SvROK(sv) &&
+	   (sv_derived_from(sv, "Imager::Color")
+          || sv_derived_from(sv, "Imager::Color::Float"));
+#line 8865 "Imager.c"
+	ST(0) = boolSV(RETVAL);
+    }
+    XSRETURN(1);
+}
+
+#ifdef HAVE_LIBTT
+#define XSubPPtmpAAAA 1
+
+
+XS_EUPXS(XS_Imager_i_tt_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tt_new)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "fontname");
+    {
+	char*	fontname = (char *)SvPV_nolen(ST(0))
+;
+	Imager__Font__TT	RETVAL;
+
+	RETVAL = i_tt_new(fontname);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Font::TT", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+#define TT_DESTROY(handle) i_tt_destroy(handle)
+
+XS_EUPXS(XS_Imager__Font__TT_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Font__TT_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "handle");
+    {
+	Imager__Font__TT	handle;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    handle = INT2PTR(Imager__Font__TT,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"Imager::Font::TT::DESTROY",
+			"handle")
+;
+
+	TT_DESTROY(handle);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__Font__TT_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Font__TT_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 2701 "Imager.xs"
+        (void)items; /* avoid unused warning */
+        RETVAL = 1;
+#line 8936 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tt_text); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tt_text)
+{
+    dVAR; dXSARGS;
+    if (items < 9 || items > 10)
+       croak_xs_usage(cv,  "handle, im, xb, yb, cl, points, str_sv, smooth, utf8, align=1");
+    {
+	Imager__Font__TT	handle;
+	Imager__ImgRaw	im;
+	i_img_dim	xb;
+	i_img_dim	yb;
+	Imager__Color	cl;
+	im_double	points;
+	SV *	str_sv = ST(6)
+;
+	int	smooth = (int)SvIV(ST(7))
+;
+	int	utf8 = (int)SvIV(ST(8))
+;
+	int	align;
+#line 2723 "Imager.xs"
+               char *str;
+               STRLEN len;
+#line 8967 "Imager.c"
+	undef_int	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Font::TT")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    handle = INT2PTR(Imager__Font__TT,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_tt_text",
+			"handle", "Imager::Font::TT",
+			refstr, ST(0)
+		);
+	}
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'xb' shouldn't be a reference");
+	    }
+	    else {
+	    	xb = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'yb' shouldn't be a reference");
+	    }
+	    else {
+	    	yb = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	if (SvROK(ST(4)) && sv_derived_from(ST(4), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(4)));
+	    cl = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(4)) ? "" : SvOK(ST(4)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_tt_text",
+			"cl", "Imager::Color",
+			refstr, ST(4)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'points' shouldn't be a reference");
+	    }
+	    else {
+	    	points = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	if (items < 10)
+	    align = 1;
+	else {
+	    align = (int)SvIV(ST(9))
+;
+	}
+#line 2726 "Imager.xs"
+               str = SvPV(str_sv, len);
+#ifdef SvUTF8
+               if (SvUTF8(str_sv))
+                 utf8 = 1;
+#endif
+               RETVAL = i_tt_text(handle, im, xb, yb, cl, points, str, 
+                                  len, smooth, utf8, align);
+#line 9064 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tt_cp); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tt_cp)
+{
+    dVAR; dXSARGS;
+    if (items < 9 || items > 10)
+       croak_xs_usage(cv,  "handle, im, xb, yb, channel, points, str_sv, smooth, utf8, align=1");
+    {
+	Imager__Font__TT	handle;
+	Imager__ImgRaw	im;
+	i_img_dim	xb;
+	i_img_dim	yb;
+	int	channel = (int)SvIV(ST(4))
+;
+	im_double	points;
+	SV *	str_sv = ST(6)
+;
+	int	smooth = (int)SvIV(ST(7))
+;
+	int	utf8 = (int)SvIV(ST(8))
+;
+	int	align;
+#line 2750 "Imager.xs"
+               char *str;
+               STRLEN len;
+#line 9101 "Imager.c"
+	undef_int	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Font::TT")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    handle = INT2PTR(Imager__Font__TT,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_tt_cp",
+			"handle", "Imager::Font::TT",
+			refstr, ST(0)
+		);
+	}
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'xb' shouldn't be a reference");
+	    }
+	    else {
+	    	xb = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'yb' shouldn't be a reference");
+	    }
+	    else {
+	    	yb = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'points' shouldn't be a reference");
+	    }
+	    else {
+	    	points = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	if (items < 10)
+	    align = 1;
+	else {
+	    align = (int)SvIV(ST(9))
+;
+	}
+#line 2753 "Imager.xs"
+               str = SvPV(str_sv, len);
+#ifdef SvUTF8
+               if (SvUTF8(str_sv))
+                 utf8 = 1;
+#endif
+               RETVAL = i_tt_cp(handle, im, xb, yb, channel, points, str, len,
+                                smooth, utf8, align);
+#line 9184 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tt_bbox); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tt_bbox)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "handle, point, str_sv, utf8");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__Font__TT	handle;
+	im_double	point;
+	SV*	str_sv = ST(2)
+;
+	int	utf8 = (int)SvIV(ST(3))
+;
+#line 2771 "Imager.xs"
+	       i_img_dim cords[BOUNDING_BOX_COUNT];
+	       int rc;
+               char *  str;
+               STRLEN len;
+               int i;
+#line 9218 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Font::TT")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    handle = INT2PTR(Imager__Font__TT,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_tt_bbox",
+			"handle", "Imager::Font::TT",
+			refstr, ST(0)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'point' shouldn't be a reference");
+	    }
+	    else {
+	    	point = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+#line 2777 "Imager.xs"
+               str = SvPV(str_sv, len);
+#ifdef SvUTF8
+               if (SvUTF8(ST(2)))
+                 utf8 = 1;
+#endif
+  	       if ((rc=i_tt_bbox(handle,point,str,len,cords, utf8))) {
+                 EXTEND(SP, rc);
+                 for (i = 0; i < rc; ++i) {
+                   PUSHs(sv_2mortal(newSViv(cords[i])));
+                 }
+               }
+#line 9256 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_tt_has_chars); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tt_has_chars)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "handle, text_sv, utf8");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__Font__TT	handle;
+	SV *	text_sv = ST(1)
+;
+	int	utf8 = (int)SvIV(ST(2))
+;
+#line 2795 "Imager.xs"
+        char const *text;
+        STRLEN len;
+        char *work;
+        size_t count;
+        size_t i;
+#line 9283 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Font::TT")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    handle = INT2PTR(Imager__Font__TT,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_tt_has_chars",
+			"handle", "Imager::Font::TT",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2801 "Imager.xs"
+        i_clear_error();
+        text = SvPV(text_sv, len);
+#ifdef SvUTF8
+        if (SvUTF8(text_sv))
+          utf8 = 1;
+#endif
+        work = mymalloc(len);
+        count = i_tt_has_chars(handle, text, len, utf8, work);
+        if (GIMME_V == G_ARRAY) {
+	  if (count) {
+            EXTEND(SP, count);
+            for (i = 0; i < count; ++i) {
+              PUSHs(boolSV(work[i]));
+            }
+	  }
+        }
+        else {
+          EXTEND(SP, 1);
+          PUSHs(sv_2mortal(newSVpv(work, count)));
+        }
+        myfree(work);
+#line 9320 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_tt_dump_names); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tt_dump_names)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "handle");
+    {
+	Imager__Font__TT	handle;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Font::TT")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    handle = INT2PTR(Imager__Font__TT,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_tt_dump_names",
+			"handle", "Imager::Font::TT",
+			refstr, ST(0)
+		);
+	}
+;
+
+	i_tt_dump_names(handle);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_tt_face_name); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tt_face_name)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "handle");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__Font__TT	handle;
+#line 2831 "Imager.xs"
+        char name[255];
+        size_t len;
+#line 9369 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Font::TT")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    handle = INT2PTR(Imager__Font__TT,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_tt_face_name",
+			"handle", "Imager::Font::TT",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2834 "Imager.xs"
+        len = i_tt_face_name(handle, name, sizeof(name));
+        if (len) {
+          EXTEND(SP, 1);
+          PUSHs(sv_2mortal(newSVpv(name, len-1)));
+        }
+#line 9390 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_tt_glyph_name); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tt_glyph_name)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "handle, text_sv, utf8 = 0");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__Font__TT	handle;
+	SV *	text_sv = ST(1)
+;
+	int	utf8;
+#line 2846 "Imager.xs"
+        char const *text;
+        STRLEN work_len;
+        size_t len;
+        size_t outsize;
+        char name[255];
+#line 9416 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Font::TT")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    handle = INT2PTR(Imager__Font__TT,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_tt_glyph_name",
+			"handle", "Imager::Font::TT",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 3)
+	    utf8 = 0;
+	else {
+	    utf8 = (int)SvIV(ST(2))
+;
+	}
+#line 2852 "Imager.xs"
+        i_clear_error();
+        text = SvPV(text_sv, work_len);
+#ifdef SvUTF8
+        if (SvUTF8(text_sv))
+          utf8 = 1;
+#endif
+        len = work_len;
+        while (len) {
+          unsigned long ch;
+          if (utf8) {
+            ch = i_utf8_advance(&text, &len);
+            if (ch == ~0UL) {
+              i_push_error(0, "invalid UTF8 character");
+              XSRETURN_EMPTY;
+            }
+          }
+          else {
+            ch = *text++;
+            --len;
+          }
+          EXTEND(SP, 1);
+          if ((outsize = i_tt_glyph_name(handle, ch, name, sizeof(name))) != 0) {
+	    PUSHs(sv_2mortal(newSVpv(name, 0)));
+          }
+          else {
+	    PUSHs(&PL_sv_undef);
+          }
+        }
+#line 9467 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+#endif 
+
+XS_EUPXS(XS_Imager_i_test_format_probe); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_test_format_probe)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, length");
+    {
+	Imager__IO	ig;
+	int	length = (int)SvIV(ST(1))
+;
+	const char *	RETVAL;
+	dXSTARG;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_test_format_probe",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_test_format_probe(ig, length);
+	sv_setpv(TARG, RETVAL);
+	XSprePUSH;
+	PUSHTARG;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_add_file_magic); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_add_file_magic)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "name, bits_sv, mask_sv");
+    {
+	const char *	name = (const char *)SvPV_nolen(ST(0))
+;
+	SV *	bits_sv = ST(1)
+;
+	SV *	mask_sv = ST(2)
+;
+#line 2894 "Imager.xs"
+        const unsigned char *bits;
+        const unsigned char *mask;
+	size_t bits_size;
+	size_t mask_size;
+#line 9529 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+#line 2899 "Imager.xs"
+	i_clear_error();
+        bits = (const unsigned char *)SvPV(bits_sv, bits_size);
+        mask = (const unsigned char *)SvPV(mask_sv, mask_size);
+        if (bits_size == 0) {
+	    i_push_error(0, "bits must be non-empty");
+	    XSRETURN_EMPTY;
+	}
+	if (mask_size == 0) {
+	    i_push_error(0, "mask must be non-empty");
+	    XSRETURN_EMPTY;
+	}
+	if (bits_size != mask_size) {
+	    i_push_error(0, "bits and mask must be the same length");
+	    XSRETURN_EMPTY;
+	}
+	if (!*name) {
+	    i_push_error(0, "name must be non-empty");
+	    XSRETURN_EMPTY;
+	}
+	RETVAL = i_add_file_magic(name, bits, mask, bits_size);
+#line 9553 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_readpnm_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_readpnm_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, allow_incomplete");
+    {
+	Imager__IO	ig;
+	int	allow_incomplete = (int)SvIV(ST(1))
+;
+	Imager__ImgRaw	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_readpnm_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_readpnm_wiol(ig, allow_incomplete);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_readpnm_lazy_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_readpnm_lazy_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "ig, allow_incomplete, cache_rows");
+    {
+	Imager__IO	ig;
+	int	allow_incomplete = (int)SvIV(ST(1))
+;
+	i_img_dim	cache_rows;
+	Imager__ImgRaw	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_readpnm_lazy_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'cache_rows' shouldn't be a reference");
+	    }
+	    else {
+	    	cache_rows = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_readpnm_lazy_wiol(ig, allow_incomplete, cache_rows);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_readpnm_multi_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_readpnm_multi_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, allow_incomplete");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__IO	ig;
+	int	allow_incomplete = (int)SvIV(ST(1))
+;
+#line 2939 "Imager.xs"
+        i_img **imgs;
+        int count=0;
+        int i;
+#line 9665 "Imager.c"
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_readpnm_multi_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+#line 2943 "Imager.xs"
+        imgs = i_readpnm_multi_wiol(ig, &count, allow_incomplete);
+        if (imgs) {
+          EXTEND(SP, count);
+          for (i = 0; i < count; ++i) {
+            SV *sv = sv_newmortal();
+            sv_setref_pv(sv, "Imager::ImgRaw", (void *)imgs[i]);
+            PUSHs(sv);
+          }
+          myfree(imgs);
+        }
+#line 9691 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_writeppm_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_writeppm_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, ig");
+    {
+	Imager__ImgRaw	im;
+	Imager__IO	ig;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_writeppm_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(1)
+		);
+	}
+;
+
+	RETVAL = i_writeppm_wiol(im, ig);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_readraw_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_readraw_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 6)
+       croak_xs_usage(cv,  "ig, x, y, datachannels, storechannels, intrl");
+    {
+	Imager__IO	ig;
+	i_img_dim	x;
+	i_img_dim	y;
+	int	datachannels = (int)SvIV(ST(3))
+;
+	int	storechannels = (int)SvIV(ST(4))
+;
+	int	intrl = (int)SvIV(ST(5))
+;
+	Imager__ImgRaw	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_readraw_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_readraw_wiol(ig, x, y, datachannels, storechannels, intrl);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_readraw_lazy_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_readraw_lazy_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "ig, x, y, datachannels, storechannels, intrl, cache_rows");
+    {
+	Imager__IO	ig;
+	i_img_dim	x;
+	i_img_dim	y;
+	int	datachannels = (int)SvIV(ST(3))
+;
+	int	storechannels = (int)SvIV(ST(4))
+;
+	int	intrl = (int)SvIV(ST(5))
+;
+	i_img_dim	cache_rows;
+	Imager__ImgRaw	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_readraw_lazy_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'cache_rows' shouldn't be a reference");
+	    }
+	    else {
+	    	cache_rows = (i_img_dim)SvIV(ST(6));
+	    }
+	}
+;
+
+	RETVAL = i_readraw_lazy_wiol(ig, x, y, datachannels, storechannels, intrl, cache_rows);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_writeraw_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_writeraw_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, ig");
+    {
+	Imager__ImgRaw	im;
+	Imager__IO	ig;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_writeraw_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(1)
+		);
+	}
+;
+
+	RETVAL = i_writeraw_wiol(im, ig);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_writebmp_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_writebmp_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, ig");
+    {
+	Imager__ImgRaw	im;
+	Imager__IO	ig;
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_writebmp_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(1)
+		);
+	}
+;
+
+	RETVAL = i_writebmp_wiol(im, ig);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_readbmp_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_readbmp_wiol)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "ig, allow_incomplete=0");
+    {
+	Imager__IO	ig;
+	int	allow_incomplete;
+	Imager__ImgRaw	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_readbmp_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (items < 2)
+	    allow_incomplete = 0;
+	else {
+	    allow_incomplete = (int)SvIV(ST(1))
+;
+	}
+
+	RETVAL = i_readbmp_wiol(ig, allow_incomplete);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_writetga_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_writetga_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, ig, wierdpack, compress, idstring");
+    {
+	Imager__ImgRaw	im;
+	Imager__IO	ig;
+	int	wierdpack = (int)SvIV(ST(2))
+;
+	int	compress = (int)SvIV(ST(3))
+;
+	char*	idstring = (char *)SvPV_nolen(ST(4))
+;
+#line 3006 "Imager.xs"
+                int idlen;
+#line 10074 "Imager.c"
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_writetga_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(1)
+		);
+	}
+;
+#line 3008 "Imager.xs"
+                idlen  = SvCUR(ST(4));
+                RETVAL = i_writetga_wiol(im, ig, wierdpack, compress, idstring, idlen);
+#line 10112 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_readtga_wiol); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_readtga_wiol)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "ig, length");
+    {
+	Imager__IO	ig;
+	int	length = (int)SvIV(ST(1))
+;
+	Imager__ImgRaw	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::IO")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ig = INT2PTR(Imager__IO,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_readtga_wiol",
+			"ig", "Imager::IO",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_readtga_wiol(ig, length);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_scaleaxis); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_scaleaxis)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, Value, Axis");
+    {
+	Imager__ImgRaw	im;
+	im_double	Value;
+	int	Axis = (int)SvIV(ST(2))
+;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'Value' shouldn't be a reference");
+	    }
+	    else {
+	    	Value = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_scaleaxis(im, Value, Axis);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_scaleaxis_kernel); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_scaleaxis_kernel)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, Value, Axis, kernel");
+    {
+	Imager__ImgRaw	im;
+	im_double	Value;
+	int	Axis = (int)SvIV(ST(2))
+;
+	const char *	kernel = (const char *)SvPV_nolen(ST(3))
+;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'Value' shouldn't be a reference");
+	    }
+	    else {
+	    	Value = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_scaleaxis_kernel(im, Value, Axis, kernel);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_scale_kernel); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_scale_kernel)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, x_scale, y_scale, kernel");
+    {
+	Imager__ImgRaw	im;
+	im_double	x_scale;
+	im_double	y_scale;
+	const char *	kernel = (const char *)SvPV_nolen(ST(3))
+;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x_scale' shouldn't be a reference");
+	    }
+	    else {
+	    	x_scale = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y_scale' shouldn't be a reference");
+	    }
+	    else {
+	    	y_scale = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_scale_kernel(im, x_scale, y_scale, kernel);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_scale_nn); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_scale_nn)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, scx, scy");
+    {
+	Imager__ImgRaw	im;
+	im_double	scx;
+	im_double	scy;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'scx' shouldn't be a reference");
+	    }
+	    else {
+	    	scx = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'scy' shouldn't be a reference");
+	    }
+	    else {
+	    	scy = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_scale_nn(im, scx, scy);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_scale_mixing); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_scale_mixing)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, width, height");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	width;
+	i_img_dim	height;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'width' shouldn't be a reference");
+	    }
+	    else {
+	    	width = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'height' shouldn't be a reference");
+	    }
+	    else {
+	    	height = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_scale_mixing(im, width, height);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_haar); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_haar)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_haar(im);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_count_colors); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_count_colors)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, maxc");
+    {
+	Imager__ImgRaw	im;
+	int	maxc = (int)SvIV(ST(1))
+;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_count_colors(im, maxc);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_get_anonymous_color_histo); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_get_anonymous_color_histo)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "im, maxc = 0x40000000");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	int	maxc;
+#line 3068 "Imager.xs"
+        int i;
+        unsigned int * col_usage = NULL;
+        int col_cnt;
+#line 10568 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	if (items < 2)
+	    maxc = 0x40000000;
+	else {
+	    maxc = (int)SvIV(ST(1))
+;
+	}
+#line 3072 "Imager.xs"
+	col_cnt = i_get_anonymous_color_histo(im, &col_usage, maxc);
+        if (col_cnt <= 0) {
+	    XSRETURN_EMPTY;
+	}
+        EXTEND(SP, col_cnt);
+        for (i = 0; i < col_cnt; i++)  {
+            PUSHs(sv_2mortal(newSViv( col_usage[i])));
+        }
+        myfree(col_usage);
+#line 10605 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_transform); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_transform)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, opx, opy, parm");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	int *	opx;
+	int *	opy;
+	double *	parm;
+#line 3090 "Imager.xs"
+	     STRLEN size_opx, size_opy, size_parm;
+	     i_img *result;
+#line 10628 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_opx = av_len(xsub_tmp_av) + 1;
+		    opx = intPtr(size_opx);
+		    for (xsub_index = 0; xsub_index < size_opx; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  opx[xsub_index] = SvInt(*sv, "Imager::i_transform");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_transform",
+				"opx");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(2);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_opy = av_len(xsub_tmp_av) + 1;
+		    opy = intPtr(size_opy);
+		    for (xsub_index = 0; xsub_index < size_opy; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  opy[xsub_index] = SvInt(*sv, "Imager::i_transform");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_transform",
+				"opy");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(3);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_parm = av_len(xsub_tmp_av) + 1;
+		    parm = doublePtr(size_parm);
+		    for (xsub_index = 0; xsub_index < size_parm; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  parm[xsub_index] = SvDouble(*sv, "Imager::i_transform");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_transform",
+				"parm");
+		}
+	} STMT_END
+;
+#line 3093 "Imager.xs"
+             result=i_transform(im,opx,size_opx,opy,size_opy,parm,size_parm);
+ 	     if (result) {
+	       SV *result_sv = sv_newmortal();
+	       EXTEND(SP, 1);
+	       sv_setref_pv(result_sv, "Imager::ImgRaw", (void*)result);
+	       PUSHs(result_sv);
+	     }
+#line 10725 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_transform2); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_transform2)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "sv_width, sv_height, channels, sv_ops, av_n_regs, av_c_regs, av_in_imgs");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	sv_width = ST(0)
+;
+	SV *	sv_height = ST(1)
+;
+	SV *	sv_ops = ST(3)
+;
+	AV *	av_n_regs;
+	AV *	av_c_regs;
+	AV *	av_in_imgs;
+	int	channels = (int)SvIV(ST(2))
+;
+#line 3111 "Imager.xs"
+             i_img_dim width;
+             i_img_dim height;
+	     struct rm_op *ops;
+	     STRLEN ops_len;
+	     int ops_count;
+             double *n_regs;
+             int n_regs_count;
+             i_color *c_regs;
+	     int c_regs_count;
+             int in_imgs_count;
+             i_img **in_imgs;
+             SV *sv1;
+             IV tmp;
+	     int i;
+	     i_img *result;
+#line 10768 "Imager.c"
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(4);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    av_n_regs = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_transform2",
+				"av_n_regs");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(5);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    av_c_regs = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_transform2",
+				"av_c_regs");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(6);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    av_in_imgs = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_transform2",
+				"av_in_imgs");
+		}
+	} STMT_END
+;
+#line 3128 "Imager.xs"
+             in_imgs_count = av_len(av_in_imgs)+1;
+	     for (i = 0; i < in_imgs_count; ++i) {
+	       sv1 = *av_fetch(av_in_imgs, i, 0);
+	       if (!sv_derived_from(sv1, "Imager::ImgRaw")) {
+		 croak("sv_in_img must contain only images");
+	       }
+	     }
+             if (in_imgs_count > 0) {
+               in_imgs = mymalloc(in_imgs_count*sizeof(i_img*));
+               for (i = 0; i < in_imgs_count; ++i) {              
+	         sv1 = *av_fetch(av_in_imgs,i,0);
+	         if (!sv_derived_from(sv1, "Imager::ImgRaw")) {
+		   croak("Parameter 5 must contain only images");
+	         }
+                 tmp = SvIV((SV*)SvRV(sv1));
+	         in_imgs[i] = INT2PTR(i_img*, tmp);
+	       }
+	     }
+             else {
+	       /* no input images */
+	       in_imgs = NULL;
+             }
+             /* default the output size from the first input if possible */
+             if (SvOK(sv_width))
+	       width = SvIV(sv_width);
+             else if (in_imgs_count)
+	       width = in_imgs[0]->xsize;
+             else
+	       croak("No output image width supplied");
+
+             if (SvOK(sv_height))
+	       height = SvIV(sv_height);
+             else if (in_imgs_count)
+	       height = in_imgs[0]->ysize;
+             else
+	       croak("No output image height supplied");
+
+	     ops = (struct rm_op *)SvPV(sv_ops, ops_len);
+             if (ops_len % sizeof(struct rm_op))
+	         croak("Imager: Parameter 3 must be a bitmap of regops\n");
+	     ops_count = ops_len / sizeof(struct rm_op);
+
+	     n_regs_count = av_len(av_n_regs)+1;
+             n_regs = mymalloc(n_regs_count * sizeof(double));
+	     for (i = 0; i < n_regs_count; ++i) {
+	       sv1 = *av_fetch(av_n_regs,i,0);
+	       if (SvOK(sv1))
+	         n_regs[i] = SvNV(sv1);
+	     }
+             c_regs_count = av_len(av_c_regs)+1;
+             c_regs = mymalloc(c_regs_count * sizeof(i_color));
+             /* I don't bother initializing the colou?r registers */
+
+	     result=i_transform2(width, height, channels, ops, ops_count, 
+				 n_regs, n_regs_count, 
+				 c_regs, c_regs_count, in_imgs, in_imgs_count);
+	     if (in_imgs)
+	         myfree(in_imgs);
+             myfree(n_regs);
+	     myfree(c_regs);
+ 	     if (result) {
+	       SV *result_sv = sv_newmortal();
+	       EXTEND(SP, 1);
+	       sv_setref_pv(result_sv, "Imager::ImgRaw", (void*)result);
+	       PUSHs(result_sv);
+	     }
+#line 10878 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_contrast); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_contrast)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, intensity");
+    {
+	Imager__ImgRaw	im;
+	im_float	intensity = (float)SvNV(ST(1))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_contrast(im, intensity);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_hardinvert); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_hardinvert)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_hardinvert(im);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_hardinvertall); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_hardinvertall)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_hardinvertall(im);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_noise); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_noise)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, amount, type");
+    {
+	Imager__ImgRaw	im;
+	im_float	amount = (float)SvNV(ST(1))
+;
+	unsigned char	type = (unsigned char)SvUV(ST(2))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_noise(im, amount, type);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_bumpmap); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_bumpmap)
+{
+    dVAR; dXSARGS;
+    if (items != 6)
+       croak_xs_usage(cv,  "im, bump, channel, light_x, light_y, strength");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	bump;
+	int	channel = (int)SvIV(ST(2))
+;
+	i_img_dim	light_x;
+	i_img_dim	light_y;
+	i_img_dim	strength;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            bump = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                bump = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "bump is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "bump is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'light_x' shouldn't be a reference");
+	    }
+	    else {
+	    	light_x = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'light_y' shouldn't be a reference");
+	    }
+	    else {
+	    	light_y = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'strength' shouldn't be a reference");
+	    }
+	    else {
+	    	strength = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+
+	i_bumpmap(im, bump, channel, light_x, light_y, strength);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_bumpmap_complex); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_bumpmap_complex)
+{
+    dVAR; dXSARGS;
+    if (items != 14)
+       croak_xs_usage(cv,  "im, bump, channel, tx, ty, Lx, Ly, Lz, cd, cs, n, Ia, Il, Is");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	bump;
+	int	channel = (int)SvIV(ST(2))
+;
+	i_img_dim	tx;
+	i_img_dim	ty;
+	im_double	Lx;
+	im_double	Ly;
+	im_double	Lz;
+	im_float	cd = (float)SvNV(ST(8))
+;
+	im_float	cs = (float)SvNV(ST(9))
+;
+	im_float	n = (float)SvNV(ST(10))
+;
+	Imager__Color	Ia;
+	Imager__Color	Il;
+	Imager__Color	Is;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            bump = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                bump = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "bump is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "bump is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'tx' shouldn't be a reference");
+	    }
+	    else {
+	    	tx = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'ty' shouldn't be a reference");
+	    }
+	    else {
+	    	ty = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'Lx' shouldn't be a reference");
+	    }
+	    else {
+	    	Lx = (im_double)SvNV(ST(5));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'Ly' shouldn't be a reference");
+	    }
+	    else {
+	    	Ly = (im_double)SvNV(ST(6));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(7));
+	    if (SvROK(ST(7)) && !SvAMAGIC(ST(7))) {
+	        croak("Numeric argument 'Lz' shouldn't be a reference");
+	    }
+	    else {
+	    	Lz = (im_double)SvNV(ST(7));
+	    }
+	}
+;
+
+	if (SvROK(ST(11)) && sv_derived_from(ST(11), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(11)));
+	    Ia = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(11)) ? "" : SvOK(ST(11)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_bumpmap_complex",
+			"Ia", "Imager::Color",
+			refstr, ST(11)
+		);
+	}
+;
+
+	if (SvROK(ST(12)) && sv_derived_from(ST(12), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(12)));
+	    Il = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(12)) ? "" : SvOK(ST(12)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_bumpmap_complex",
+			"Il", "Imager::Color",
+			refstr, ST(12)
+		);
+	}
+;
+
+	if (SvROK(ST(13)) && sv_derived_from(ST(13), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(13)));
+	    Is = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(13)) ? "" : SvOK(ST(13)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_bumpmap_complex",
+			"Is", "Imager::Color",
+			refstr, ST(13)
+		);
+	}
+;
+
+	i_bumpmap_complex(im, bump, channel, tx, ty, Lx, Ly, Lz, cd, cs, n, Ia, Il, Is);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_postlevels); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_postlevels)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, levels");
+    {
+	Imager__ImgRaw	im;
+	int	levels = (int)SvIV(ST(1))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_postlevels(im, levels);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_mosaic); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_mosaic)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, size");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	size;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'size' shouldn't be a reference");
+	    }
+	    else {
+	    	size = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	i_mosaic(im, size);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_watermark); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_watermark)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, wmark, tx, ty, pixdiff");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	wmark;
+	i_img_dim	tx;
+	i_img_dim	ty;
+	int	pixdiff = (int)SvIV(ST(4))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            wmark = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                wmark = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "wmark is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "wmark is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'tx' shouldn't be a reference");
+	    }
+	    else {
+	    	tx = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'ty' shouldn't be a reference");
+	    }
+	    else {
+	    	ty = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	i_watermark(im, wmark, tx, ty, pixdiff);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_autolevels); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_autolevels)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, lsat, usat, skew");
+    {
+	Imager__ImgRaw	im;
+	im_float	lsat = (float)SvNV(ST(1))
+;
+	im_float	usat = (float)SvNV(ST(2))
+;
+	im_float	skew = (float)SvNV(ST(3))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_autolevels(im, lsat, usat, skew);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_autolevels_mono); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_autolevels_mono)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, lsat, usat");
+    {
+	Imager__ImgRaw	im;
+	im_float	lsat = (float)SvNV(ST(1))
+;
+	im_float	usat = (float)SvNV(ST(2))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_autolevels_mono(im, lsat, usat);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_radnoise); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_radnoise)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, xo, yo, rscale, ascale");
+    {
+	Imager__ImgRaw	im;
+	im_float	xo = (float)SvNV(ST(1))
+;
+	im_float	yo = (float)SvNV(ST(2))
+;
+	im_float	rscale = (float)SvNV(ST(3))
+;
+	im_float	ascale = (float)SvNV(ST(4))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_radnoise(im, xo, yo, rscale, ascale);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_turbnoise); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_turbnoise)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, xo, yo, scale");
+    {
+	Imager__ImgRaw	im;
+	im_float	xo = (float)SvNV(ST(1))
+;
+	im_float	yo = (float)SvNV(ST(2))
+;
+	im_float	scale = (float)SvNV(ST(3))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	i_turbnoise(im, xo, yo, scale);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_gradgen); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gradgen)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, xo, yo, ac, dmeasure");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim *	xo;
+	i_img_dim *	yo;
+	i_color *	ac;
+	int	dmeasure = (int)SvIV(ST(4))
+;
+#line 3300 "Imager.xs"
+	STRLEN size_xo;
+	STRLEN size_yo;
+        STRLEN size_ac;
+#line 11625 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_xo = av_len(xsub_tmp_av) + 1;
+		    xo = i_img_dimPtr(size_xo);
+		    for (xsub_index = 0; xsub_index < size_xo; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  xo[xsub_index] = SvI_img_dim(*sv, "Imager::i_gradgen");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_gradgen",
+				"xo");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(2);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_yo = av_len(xsub_tmp_av) + 1;
+		    yo = i_img_dimPtr(size_yo);
+		    for (xsub_index = 0; xsub_index < size_yo; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  yo[xsub_index] = SvI_img_dim(*sv, "Imager::i_gradgen");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_gradgen",
+				"yo");
+		}
+	} STMT_END
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(3);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    AV *xsub_tmp_av = (AV*)SvRV(xsub_tmp_sv);
+		    STRLEN xsub_index;
+		    size_ac = av_len(xsub_tmp_av) + 1;
+		    ac = i_colorPtr(size_ac);
+		    for (xsub_index = 0; xsub_index < size_ac; ++xsub_index) {
+		        SV **sv = av_fetch(xsub_tmp_av, xsub_index, 0);
+			if (sv) {
+			  ac[xsub_index] = SvI_color(*sv, "Imager::i_gradgen");
+                        }
+		    }
+		}
+		else{
+		    Perl_croak(aTHX_ "%s: %s is not an ARRAY reference",
+				"Imager::i_gradgen",
+				"ac");
+		}
+	} STMT_END
+;
+#line 3304 "Imager.xs"
+        if (size_xo != size_yo || size_xo != size_ac)
+	  croak("i_gradgen: x, y and color arrays must be the same size");
+	if (size_xo < 2)
+          croak("Usage: i_gradgen array refs must have more than 1 entry each");
+        i_gradgen(im, size_xo, xo, yo, ac, dmeasure);
+#line 11720 "Imager.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_diff_image); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_diff_image)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "im, im2, mindist=0");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	im2;
+	im_double	mindist;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            im2 = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im2 = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw")
+;
+
+	if (items < 3)
+	    mindist = 0;
+	else {
+	    {
+		SvGETMAGIC(ST(2));
+		if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+		    croak("Numeric argument 'mindist' shouldn't be a reference");
+		}
+		else {
+			    mindist = (im_double)SvNV(ST(2));
+		}
+	    }
+;
+	}
+
+	RETVAL = i_diff_image(im, im2, mindist);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_rgbdiff_image); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_rgbdiff_image)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, im2");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	im2;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+        if (sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(1)));
+            im2 = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(1), "Imager") &&
+                 SvTYPE(SvRV(ST(1))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(1));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im2 = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im2 is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_rgbdiff_image(im, im2);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_fountain); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_fountain)
+{
+    dVAR; dXSARGS;
+    if (items != 11)
+       croak_xs_usage(cv,  "im, xa, ya, xb, yb, type, repeat, combine, super_sample, ssample_param, segs");
+    {
+	Imager__ImgRaw	im;
+	im_double	xa;
+	im_double	ya;
+	im_double	xb;
+	im_double	yb;
+	int	type = (int)SvIV(ST(5))
+;
+	int	repeat = (int)SvIV(ST(6))
+;
+	int	combine = (int)SvIV(ST(7))
+;
+	int	super_sample = (int)SvIV(ST(8))
+;
+	im_double	ssample_param;
+#line 3334 "Imager.xs"
+        AV *asegs;
+        int count;
+        i_fountain_seg *segs;
+#line 11889 "Imager.c"
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'xa' shouldn't be a reference");
+	    }
+	    else {
+	    	xa = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'ya' shouldn't be a reference");
+	    }
+	    else {
+	    	ya = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'xb' shouldn't be a reference");
+	    }
+	    else {
+	    	xb = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'yb' shouldn't be a reference");
+	    }
+	    else {
+	    	yb = (im_double)SvNV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(9));
+	    if (SvROK(ST(9)) && !SvAMAGIC(ST(9))) {
+	        croak("Numeric argument 'ssample_param' shouldn't be a reference");
+	    }
+	    else {
+	    	ssample_param = (im_double)SvNV(ST(9));
+	    }
+	}
+;
+#line 3338 "Imager.xs"
+	if (!SvROK(ST(10)) || ! SvTYPE(SvRV(ST(10))))
+	    croak("i_fountain: argument 11 must be an array ref");
+
+	asegs = (AV *)SvRV(ST(10));
+        segs = load_fount_segs(aTHX_ asegs, &count);
+        RETVAL = i_fountain(im, xa, ya, xb, yb, type, repeat, combine, 
+                            super_sample, ssample_param, count, segs);
+        myfree(segs);
+#line 11974 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_new_fill_fount); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_new_fill_fount)
+{
+    dVAR; dXSARGS;
+    if (items != 10)
+       croak_xs_usage(cv,  "xa, ya, xb, yb, type, repeat, combine, super_sample, ssample_param, segs");
+    {
+	im_double	xa;
+	im_double	ya;
+	im_double	xb;
+	im_double	yb;
+	int	type = (int)SvIV(ST(4))
+;
+	int	repeat = (int)SvIV(ST(5))
+;
+	int	combine = (int)SvIV(ST(6))
+;
+	int	super_sample = (int)SvIV(ST(7))
+;
+	im_double	ssample_param;
+#line 3361 "Imager.xs"
+        AV *asegs;
+        int count;
+        i_fountain_seg *segs;
+#line 12011 "Imager.c"
+	Imager__FillHandle	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'xa' shouldn't be a reference");
+	    }
+	    else {
+	    	xa = (im_double)SvNV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'ya' shouldn't be a reference");
+	    }
+	    else {
+	    	ya = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'xb' shouldn't be a reference");
+	    }
+	    else {
+	    	xb = (im_double)SvNV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'yb' shouldn't be a reference");
+	    }
+	    else {
+	    	yb = (im_double)SvNV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(8));
+	    if (SvROK(ST(8)) && !SvAMAGIC(ST(8))) {
+	        croak("Numeric argument 'ssample_param' shouldn't be a reference");
+	    }
+	    else {
+	    	ssample_param = (im_double)SvNV(ST(8));
+	    }
+	}
+;
+#line 3365 "Imager.xs"
+	if (!SvROK(ST(9)) || ! SvTYPE(SvRV(ST(9))))
+	    croak("i_fountain: argument 11 must be an array ref");
+
+	asegs = (AV *)SvRV(ST(9));
+        segs = load_fount_segs(aTHX_ asegs, &count);
+        RETVAL = i_new_fill_fount(xa, ya, xb, yb, type, repeat, combine, 
+                                  super_sample, ssample_param, count, segs);
+        myfree(segs);        
+#line 12077 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::FillHandle", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_new_fill_opacity); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_new_fill_opacity)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "other_fill, alpha_mult");
+    {
+	Imager__FillHandle	other_fill;
+	im_double	alpha_mult;
+	Imager__FillHandle	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::FillHandle")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    other_fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_new_fill_opacity",
+			"other_fill", "Imager::FillHandle",
+			refstr, ST(0)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'alpha_mult' shouldn't be a reference");
+	    }
+	    else {
+	    	alpha_mult = (im_double)SvNV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_new_fill_opacity(other_fill, alpha_mult);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::FillHandle", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_errors); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_errors)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 3384 "Imager.xs"
+        i_errmsg *errors;
+	int i;
+	AV *av;
+	SV *sv;
+#line 12151 "Imager.c"
+#line 3389 "Imager.xs"
+	errors = i_errors();
+	i = 0;
+	while (errors[i].msg) {
+	  av = newAV();
+	  sv = newSVpv(errors[i].msg, strlen(errors[i].msg));
+	  if (!av_store(av, 0, sv)) {
+	    SvREFCNT_dec(sv);
+	  }
+	  sv = newSViv(errors[i].code);
+	  if (!av_store(av, 1, sv)) {
+	    SvREFCNT_dec(sv);
+	  }
+	  XPUSHs(sv_2mortal(newRV_noinc((SV*)av)));
+	  ++i;
+	}
+#line 12168 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_clear_error); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_clear_error)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    {
+
+	i_clear_error();
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_push_error); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_push_error)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "code, msg");
+    {
+	int	code = (int)SvIV(ST(0))
+;
+	const char *	msg = (const char *)SvPV_nolen(ST(1))
+;
+
+	i_push_error(code, msg);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_i_nearest_color); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_nearest_color)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "im, ...");
+    {
+	Imager__ImgRaw	im;
+#line 3417 "Imager.xs"
+	int num;
+	i_img_dim *xo;
+	i_img_dim *yo;
+        i_color *ival;
+	int dmeasure;
+	int i;
+	SV *sv;
+	AV *axx;
+	AV *ayy;
+	AV *ac;
+#line 12226 "Imager.c"
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 3428 "Imager.xs"
+	if (items != 5)
+	    croak("Usage: i_nearest_color(im, xo, yo, ival, dmeasure)");
+	if (!SvROK(ST(1)) || ! SvTYPE(SvRV(ST(1))))
+	    croak("i_nearest_color: Second argument must be an array ref");
+	if (!SvROK(ST(2)) || ! SvTYPE(SvRV(ST(2))))
+	    croak("i_nearest_color: Third argument must be an array ref");
+	if (!SvROK(ST(3)) || ! SvTYPE(SvRV(ST(3))))
+	    croak("i_nearest_color: Fourth argument must be an array ref");
+	axx = (AV *)SvRV(ST(1));
+	ayy = (AV *)SvRV(ST(2));
+	ac  = (AV *)SvRV(ST(3));
+	dmeasure = (int)SvIV(ST(4));
+
+        num = av_len(axx) < av_len(ayy) ? av_len(axx) : av_len(ayy);
+	num = num <= av_len(ac) ? num : av_len(ac);
+	num++; 
+	if (num < 2) croak("Usage: i_nearest_color array refs must have more than 1 entry each");
+	xo = malloc_temp(aTHX_ sizeof(i_img_dim) * num );
+	yo = malloc_temp(aTHX_ sizeof(i_img_dim) * num );
+	ival = malloc_temp(aTHX_ sizeof(i_color) * num );
+	for(i = 0; i<num; i++) {
+	  xo[i]   = (i_img_dim)SvIV(* av_fetch(axx, i, 0));
+	  yo[i]   = (i_img_dim)SvIV(* av_fetch(ayy, i, 0));
+          sv = *av_fetch(ac, i, 0);
+	  if ( !sv_derived_from(sv, "Imager::Color") ) {
+	    free(axx); free(ayy); free(ac);
+            croak("i_nearest_color: Element of fourth argument is not derived from Imager::Color");
+	  }
+	  ival[i] = *INT2PTR(i_color *, SvIV((SV *)SvRV(sv)));
+	}
+        RETVAL = i_nearest_color(im, num, xo, yo, ival, dmeasure);
+#line 12279 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_malloc_state); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_malloc_state)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    {
+
+	malloc_state();
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager_DSO_open); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_DSO_open)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "filename");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	char*	filename = (char *)SvPV_nolen(ST(0))
+;
+#line 3469 "Imager.xs"
+	       void *rc;
+	       char *evstr;
+#line 12320 "Imager.c"
+#line 3472 "Imager.xs"
+	       rc=DSO_open(filename,&evstr);
+               if (rc!=NULL) {
+                 if (evstr!=NULL) {
+                   EXTEND(SP,2); 
+                   PUSHs(sv_2mortal(newSViv(PTR2IV(rc))));
+                   PUSHs(sv_2mortal(newSVpvn(evstr, strlen(evstr))));
+                 } else {
+                   EXTEND(SP,1);
+                   PUSHs(sv_2mortal(newSViv(PTR2IV(rc))));
+                 }
+               }
+#line 12333 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_DSO_close); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_DSO_close)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "dso_handle");
+    {
+	void*	dso_handle = INT2PTR(void *,SvIV(ST(0)))
+;
+	undef_int	RETVAL;
+
+	RETVAL = DSO_close(dso_handle);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_DSO_funclist); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_DSO_funclist)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "dso_handle_v");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	void*	dso_handle_v = INT2PTR(void *,SvIV(ST(0)))
+;
+#line 3493 "Imager.xs"
+	       int i;
+	       DSO_handle *dso_handle;
+	       func_ptr *functions;
+#line 12379 "Imager.c"
+#line 3497 "Imager.xs"
+	       dso_handle=(DSO_handle*)dso_handle_v;
+	       functions = DSO_funclist(dso_handle);
+	       i=0;
+	       while( functions[i].name != NULL) {
+	         EXTEND(SP,1);
+		 PUSHs(sv_2mortal(newSVpv(functions[i].name,0)));
+	         EXTEND(SP,1);
+		 PUSHs(sv_2mortal(newSVpv(functions[i++].pcode,0)));
+	       }
+#line 12390 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_DSO_call); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_DSO_call)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "handle, func_index, hv");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	void*	handle = INT2PTR(void *,SvIV(ST(0)))
+;
+	int	func_index = (int)SvIV(ST(1))
+;
+	HV *	hv;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(2);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVHV){
+		    hv = (HV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not a HASH reference",
+				"Imager::DSO_call",
+				"hv");
+		}
+	} STMT_END
+;
+#line 3513 "Imager.xs"
+	       DSO_call( (DSO_handle *)handle,func_index,hv);
+#line 12427 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_get_pixel); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_get_pixel)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, x, y");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	Imager__Color	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+#line 3521 "Imager.xs"
+	RETVAL = (i_color *)mymalloc(sizeof(i_color));
+	memset(RETVAL, 0, sizeof(*RETVAL));
+	if (i_gpix(im, x, y, RETVAL) != 0) {
+          myfree(RETVAL);
+	  XSRETURN_UNDEF;
+        }
+#line 12493 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Color", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_ppix); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_ppix)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, x, y, cl");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	Imager__Color	cl;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    cl = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_ppix",
+			"cl", "Imager::Color",
+			refstr, ST(3)
+		);
+	}
+;
+
+	RETVAL = i_ppix(im, x, y, cl);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_pal_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_pal_new)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "x, y, channels, maxpal");
+    {
+	i_img_dim	x;
+	i_img_dim	y;
+	int	channels = (int)SvIV(ST(2))
+;
+	int	maxpal = (int)SvIV(ST(3))
+;
+	Imager__ImgRaw	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_img_pal_new(x, y, channels, maxpal);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_to_pal); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_to_pal)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "src, quant_hv");
+    {
+	Imager__ImgRaw	src;
+	HV *	quant_hv;
+#line 3550 "Imager.xs"
+        i_quantize quant;
+#line 12642 "Imager.c"
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(1);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVHV){
+		    quant_hv = (HV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not a HASH reference",
+				"Imager::i_img_to_pal",
+				"quant_hv");
+		}
+	} STMT_END
+;
+#line 3552 "Imager.xs"
+        memset(&quant, 0, sizeof(quant));
+	quant.version = 1;
+        quant.mc_size = 256;
+	i_clear_error();
+	if (!ip_handle_quant_opts2(aTHX_ &quant, quant_hv)) {
+	   XSRETURN_EMPTY;
+	}
+        RETVAL = i_img_to_pal(src, &quant);
+        if (RETVAL) {
+          ip_copy_colors_back(aTHX_ quant_hv, &quant);
+        }
+	ip_cleanup_quant_opts(aTHX_ &quant);
+#line 12690 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_to_rgb); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_to_rgb)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "src");
+    {
+	Imager__ImgRaw	src;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_to_rgb(src);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_make_palette); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_make_palette)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "quant_hv, ...");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 3574 "Imager.xs"
+        ssize_t count = items - 1;
+	i_quantize quant;
+	i_img **imgs = NULL;
+	ssize_t color_index;
+#line 12757 "Imager.c"
+	HV *	quant_hv;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(0);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVHV){
+		    quant_hv = (HV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not a HASH reference",
+				"Imager::i_img_make_palette",
+				"quant_hv");
+		}
+	} STMT_END
+;
+#line 3579 "Imager.xs"
+        if (count <= 0)
+	  croak("Please supply at least one image (%zd)", count);
+	imgs = malloc_temp(aTHX_ count * sizeof(i_img *));
+	for (color_index = 0; color_index < count; ++color_index) {
+	  SV *img_sv = ST(color_index + 1);
+	  if (SvROK(img_sv) && sv_derived_from(img_sv, "Imager::ImgRaw")) {
+	    imgs[color_index] = INT2PTR(i_img *, SvIV((SV*)SvRV(img_sv)));
+	  }
+	  else {
+	    croak("Image %zd is not an image object", color_index+1);
+          }
+	}
+        memset(&quant, 0, sizeof(quant));
+	quant.version = 1;
+	quant.mc_size = 256;
+        if (!ip_handle_quant_opts2(aTHX_ &quant, quant_hv)) {
+	  XSRETURN_EMPTY;
+	}
+	i_quant_makemap(&quant, imgs, count);
+	EXTEND(SP, quant.mc_count);
+	for (color_index = 0; color_index < quant.mc_count; ++color_index) {
+	  SV *sv_c = make_i_color_sv_mortal(aTHX_ quant.mc_colors + color_index);
+	  PUSHs(sv_c);
+	}
+ 	ip_cleanup_quant_opts(aTHX_ &quant);
+#line 12799 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_gpal); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gpal)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, l, r, y");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	r;
+	i_img_dim	y;
+#line 3613 "Imager.xs"
+        i_palidx *work;
+        int count, i;
+#line 12822 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'r' shouldn't be a reference");
+	    }
+	    else {
+	    	r = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+#line 3616 "Imager.xs"
+        if (l < r) {
+          work = mymalloc((r-l) * sizeof(i_palidx));
+          count = i_gpal(im, l, r, y, work);
+          if (GIMME_V == G_ARRAY) {
+            EXTEND(SP, count);
+            for (i = 0; i < count; ++i) {
+              PUSHs(sv_2mortal(newSViv(work[i])));
+            }
+          }
+          else {
+            EXTEND(SP, 1);
+            PUSHs(sv_2mortal(newSVpv((char *)work, count * sizeof(i_palidx))));
+          }
+          myfree(work);
+        }
+        else {
+          if (GIMME_V != G_ARRAY) {
+            EXTEND(SP, 1);
+            PUSHs(&PL_sv_undef);
+          }
+        }
+#line 12897 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_ppal); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_ppal)
+{
+    dVAR; dXSARGS;
+    if (items < 3)
+       croak_xs_usage(cv,  "im, l, y, ...");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	y;
+#line 3644 "Imager.xs"
+        i_palidx *work;
+        i_img_dim i;
+#line 12917 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+#line 3647 "Imager.xs"
+        if (items > 3) {
+          work = malloc_temp(aTHX_ sizeof(i_palidx) * (items-3));
+          for (i=0; i < items-3; ++i) {
+            work[i] = SvIV(ST(i+3));
+          }
+          validate_i_ppal(im, work, items - 3);
+          RETVAL = i_ppal(im, l, l+items-3, y, work);
+        }
+        else {
+          RETVAL = 0;
+        }
+#line 12973 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_ppal_p); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_ppal_p)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, l, y, data");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	y;
+	SV *	data = ST(3)
+;
+#line 3668 "Imager.xs"
+        i_palidx const *work;
+        STRLEN len;
+#line 12996 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+#line 3671 "Imager.xs"
+        work = (i_palidx const *)SvPV(data, len);
+        len /= sizeof(i_palidx);
+        if (len > 0) {
+          validate_i_ppal(im, work, len);
+          RETVAL = i_ppal(im, l, l+len, y, work);
+        }
+        else {
+          RETVAL = 0;
+        }
+#line 13050 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_addcolors); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_addcolors)
+{
+    dVAR; dXSARGS;
+    if (items < 1)
+       croak_xs_usage(cv,  "im, ...");
+    {
+	Imager__ImgRaw	im;
+#line 3687 "Imager.xs"
+        i_color *colors;
+        int i;
+#line 13069 "Imager.c"
+	SysRet	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 3690 "Imager.xs"
+        if (items < 2)
+          croak("i_addcolors: no colors to add");
+        colors = mymalloc((items-1) * sizeof(i_color));
+        for (i=0; i < items-1; ++i) {
+          if (sv_isobject(ST(i+1)) 
+              && sv_derived_from(ST(i+1), "Imager::Color")) {
+            IV tmp = SvIV((SV *)SvRV(ST(i+1)));
+            colors[i] = *INT2PTR(i_color *, tmp);
+          }
+          else {
+            myfree(colors);
+            croak("i_addcolor: pixels must be Imager::Color objects");
+          }
+        }
+        RETVAL = i_addcolors(im, colors, items-1);
+        myfree(colors);
+#line 13107 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL != -1) {
+		if (RETVAL == 0)
+		    sv_setpvn(RETVALSV, "0 but true", 10);
+		else
+		    sv_setiv(RETVALSV, (IV)RETVAL);
+	    }
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_setcolors); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_setcolors)
+{
+    dVAR; dXSARGS;
+    if (items < 2)
+       croak_xs_usage(cv,  "im, index, ...");
+    {
+	Imager__ImgRaw	im;
+	int	index = (int)SvIV(ST(1))
+;
+#line 3714 "Imager.xs"
+        i_color *colors;
+        int i;
+#line 13137 "Imager.c"
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 3717 "Imager.xs"
+        if (items < 3)
+          croak("i_setcolors: no colors to add");
+        colors = mymalloc((items-2) * sizeof(i_color));
+        for (i=0; i < items-2; ++i) {
+          if (sv_isobject(ST(i+2)) 
+              && sv_derived_from(ST(i+2), "Imager::Color")) {
+            IV tmp = SvIV((SV *)SvRV(ST(i+2)));
+            colors[i] = *INT2PTR(i_color *, tmp);
+          }
+          else {
+            myfree(colors);
+            croak("i_setcolors: pixels must be Imager::Color objects");
+          }
+        }
+        RETVAL = i_setcolors(im, index, colors, items-2);
+        myfree(colors);
+#line 13175 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_getcolors); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_getcolors)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "im, index, count=1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	int	index = (int)SvIV(ST(1))
+;
+	int	count;
+#line 3742 "Imager.xs"
+        i_color *colors;
+        int i;
+#line 13204 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	if (items < 3)
+	    count = 1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 3745 "Imager.xs"
+        if (count < 1)
+          croak("i_getcolors: count must be positive");
+        colors = malloc_temp(aTHX_ sizeof(i_color) * count);
+        if (i_getcolors(im, index, colors, count)) {
+	  EXTEND(SP, count);
+          for (i = 0; i < count; ++i) {
+            SV *sv = make_i_color_sv_mortal(aTHX_ colors+i);
+            PUSHs(sv);
+          }
+        }
+#line 13242 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_colorcount); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_colorcount)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	undef_neg_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_colorcount(im);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL < 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_maxcolors); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_maxcolors)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	undef_neg_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_maxcolors(im);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL < 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_findcolor); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_findcolor)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, color");
+    {
+	Imager__ImgRaw	im;
+	Imager__Color	color;
+	i_palidx	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    color = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_findcolor",
+			"color", "Imager::Color",
+			refstr, ST(1)
+		);
+	}
+;
+#line 3769 "Imager.xs"
+        if (!i_findcolor(im, color, &RETVAL)) {
+	  XSRETURN_UNDEF;
+        }
+#line 13381 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_bits); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_bits)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_bits(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_type); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_type)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_type(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_virtual); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_virtual)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_virtual(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_is_tiled); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_is_tiled)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_is_tiled(im);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_gsamp); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gsamp)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, l, r, y, channels");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	r;
+	i_img_dim	y;
+	i_channel_list	channels;
+#line 3799 "Imager.xs"
+        i_sample_t *data;
+        i_img_dim count, i;
+#line 13558 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'r' shouldn't be a reference");
+	    }
+	    else {
+	    	r = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+        SvGETMAGIC(ST(4));
+	if (SvOK(ST(4))) {
+	  AV *channels_av;
+	  int i;
+	  if (!SvROK(ST(4)) || SvTYPE(SvRV(ST(4))) != SVt_PVAV) {
+	    croak("channels is not an array ref");
+	  }
+	  channels_av = (AV *)SvRV(ST(4));
+ 	  channels.count = av_len(channels_av) + 1;
+	  if (channels.count < 1) {
+	    croak("Imager::i_gsamp: no channels provided");
+	  }
+	  channels.channels = malloc_temp(aTHX_ sizeof(int) * channels.count);
+ 	  for (i = 0; i < channels.count; ++i) {
+	    SV **entry = av_fetch(channels_av, i, 0);
+	    channels.channels[i] = entry ? SvIV(*entry) : 0;
+	  }
+        }
+	else {
+	  /* assumes we have an image */
+	  channels.count = im->channels;
+	  channels.channels = NULL;
+	}
+;
+#line 3802 "Imager.xs"
+        if (l < r) {
+          data = mymalloc(sizeof(i_sample_t) * (r-l) * channels.count);
+          count = i_gsamp(im, l, r, y, data, channels.channels, channels.count);
+          if (GIMME_V == G_ARRAY) {
+            EXTEND(SP, count);
+            for (i = 0; i < count; ++i)
+              PUSHs(sv_2mortal(newSViv(data[i])));
+          }
+          else {
+            EXTEND(SP, 1);
+            PUSHs(sv_2mortal(newSVpv((char *)data, count * sizeof(i_sample_t))));
+          }
+	  myfree(data);
+        }
+        else {
+          if (GIMME_V != G_ARRAY) {
+	    XSRETURN_UNDEF;
+          }
+        }
+#line 13656 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_gsamp_bits); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gsamp_bits)
+{
+    dVAR; dXSARGS;
+    if (items != 8)
+       croak_xs_usage(cv,  "im, l, r, y, bits, target, offset, channels");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	r;
+	i_img_dim	y;
+	int	bits = (int)SvIV(ST(4))
+;
+	AV *	target;
+	STRLEN	offset = (STRLEN)SvUV(ST(6))
+;
+	i_channel_list	channels;
+#line 3833 "Imager.xs"
+        unsigned *data;
+        i_img_dim count, i;
+#line 13683 "Imager.c"
+	undef_neg_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'r' shouldn't be a reference");
+	    }
+	    else {
+	    	r = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(5);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    target = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_gsamp_bits",
+				"target");
+		}
+	} STMT_END
+;
+
+        SvGETMAGIC(ST(7));
+	if (SvOK(ST(7))) {
+	  AV *channels_av;
+	  int i;
+	  if (!SvROK(ST(7)) || SvTYPE(SvRV(ST(7))) != SVt_PVAV) {
+	    croak("channels is not an array ref");
+	  }
+	  channels_av = (AV *)SvRV(ST(7));
+ 	  channels.count = av_len(channels_av) + 1;
+	  if (channels.count < 1) {
+	    croak("Imager::i_gsamp_bits: no channels provided");
+	  }
+	  channels.channels = malloc_temp(aTHX_ sizeof(int) * channels.count);
+ 	  for (i = 0; i < channels.count; ++i) {
+	    SV **entry = av_fetch(channels_av, i, 0);
+	    channels.channels[i] = entry ? SvIV(*entry) : 0;
+	  }
+        }
+	else {
+	  /* assumes we have an image */
+	  channels.count = im->channels;
+	  channels.channels = NULL;
+	}
+;
+#line 3836 "Imager.xs"
+	i_clear_error();
+        if (items < 8)
+          croak("No channel numbers supplied to g_samp()");
+        if (l < r) {
+          data = mymalloc(sizeof(unsigned) * (r-l) * channels.count);
+          count = i_gsamp_bits(im, l, r, y, data, channels.channels, channels.count, bits);
+	  for (i = 0; i < count; ++i) {
+	    av_store(target, i+offset, newSVuv(data[i]));
+	  }
+	  myfree(data);
+	  RETVAL = count;
+        }
+        else {
+	  RETVAL = 0;
+        }
+#line 13792 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL < 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_psamp_bits); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_psamp_bits)
+{
+    dVAR; dXSARGS;
+    if (items < 6 || items > 8)
+       croak_xs_usage(cv,  "im, l, y, bits, channels, data_av, data_offset = 0, pixel_count = -1");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	y;
+	int	bits = (int)SvIV(ST(3))
+;
+	i_channel_list	channels;
+	AV *	data_av;
+	i_img_dim	data_offset;
+	i_img_dim	pixel_count;
+#line 3865 "Imager.xs"
+	STRLEN data_count;
+	size_t data_used;
+	unsigned *data;
+	size_t data_index;
+#line 13826 "Imager.c"
+	undef_neg_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+        SvGETMAGIC(ST(4));
+	if (SvOK(ST(4))) {
+	  AV *channels_av;
+	  int i;
+	  if (!SvROK(ST(4)) || SvTYPE(SvRV(ST(4))) != SVt_PVAV) {
+	    croak("channels is not an array ref");
+	  }
+	  channels_av = (AV *)SvRV(ST(4));
+ 	  channels.count = av_len(channels_av) + 1;
+	  if (channels.count < 1) {
+	    croak("Imager::i_psamp_bits: no channels provided");
+	  }
+	  channels.channels = malloc_temp(aTHX_ sizeof(int) * channels.count);
+ 	  for (i = 0; i < channels.count; ++i) {
+	    SV **entry = av_fetch(channels_av, i, 0);
+	    channels.channels[i] = entry ? SvIV(*entry) : 0;
+	  }
+        }
+	else {
+	  /* assumes we have an image */
+	  channels.count = im->channels;
+	  channels.channels = NULL;
+	}
+;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(5);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVAV){
+		    data_av = (AV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not an ARRAY reference",
+				"Imager::i_psamp_bits",
+				"data_av");
+		}
+	} STMT_END
+;
+
+	if (items < 7)
+	    data_offset = 0;
+	else {
+	    {
+		SvGETMAGIC(ST(6));
+		if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+		    croak("Numeric argument 'data_offset' shouldn't be a reference");
+		}
+		else {
+			    data_offset = (i_img_dim)SvIV(ST(6));
+		}
+	    }
+;
+	}
+
+	if (items < 8)
+	    pixel_count = -1;
+	else {
+	    {
+		SvGETMAGIC(ST(7));
+		if (SvROK(ST(7)) && !SvAMAGIC(ST(7))) {
+		    croak("Numeric argument 'pixel_count' shouldn't be a reference");
+		}
+		else {
+			    pixel_count = (i_img_dim)SvIV(ST(7));
+		}
+	    }
+;
+	}
+#line 3870 "Imager.xs"
+	i_clear_error();
+
+	data_count = av_len(data_av) + 1;
+	if (data_offset < 0) {
+	  croak("data_offset must be non-negative");
+	}
+	if ((size_t)data_offset > data_count) {
+	  croak("data_offset greater than number of samples supplied");
+        }
+	if (pixel_count == -1 || 
+	    (size_t)data_offset + pixel_count * channels.count > data_count) {
+	  pixel_count = (data_count - data_offset) / channels.count;
+	}
+
+	data_used = pixel_count * channels.count;
+	data = mymalloc(sizeof(unsigned) * data_count);
+	for (data_index = 0; data_index < data_used; ++data_index) {
+	  data[data_index] =
+              SvUV(*av_fetch(data_av, data_offset + data_index, 0));
+        }
+
+	RETVAL = i_psamp_bits(im, l, l + pixel_count, y, data, channels.channels, 
+	                      channels.count, bits);
+
+	if (data)
+	  myfree(data);
+#line 13965 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL < 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_psamp); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_psamp)
+{
+    dVAR; dXSARGS;
+    if (items < 5 || items > 7)
+       croak_xs_usage(cv,  "im, x, y, channels, data, offset = 0, width = -1");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	i_channel_list	channels;
+	i_sample_list	data;
+	i_img_dim	offset;
+	i_img_dim	width;
+#line 3909 "Imager.xs"
+	i_img_dim r;
+#line 13994 "Imager.c"
+	undef_neg_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+        SvGETMAGIC(ST(3));
+	if (SvOK(ST(3))) {
+	  AV *channels_av;
+	  int i;
+	  if (!SvROK(ST(3)) || SvTYPE(SvRV(ST(3))) != SVt_PVAV) {
+	    croak("channels is not an array ref");
+	  }
+	  channels_av = (AV *)SvRV(ST(3));
+ 	  channels.count = av_len(channels_av) + 1;
+	  if (channels.count < 1) {
+	    croak("Imager::i_psamp: no channels provided");
+	  }
+	  channels.channels = malloc_temp(aTHX_ sizeof(int) * channels.count);
+ 	  for (i = 0; i < channels.count; ++i) {
+	    SV **entry = av_fetch(channels_av, i, 0);
+	    channels.channels[i] = entry ? SvIV(*entry) : 0;
+	  }
+        }
+	else {
+	  /* assumes we have an image */
+	  channels.count = im->channels;
+	  channels.channels = NULL;
+	}
+;
+
+	SvGETMAGIC(ST(4));
+	if (!SvOK(ST(4)))
+	  croak("data must be a scalar or an arrayref");
+	if (SvROK(ST(4))) {
+	  size_t i;
+	  AV *av;
+	  i_sample_t *s;
+	  if (SvTYPE(SvRV(ST(4))) != SVt_PVAV)
+	    croak("data must be a scalar or an arrayref");
+	  av = (AV *)SvRV(ST(4));
+          data.count = av_len(av) + 1;
+          if (data.count < 1)
+	    croak("Imager::i_psamp: no samples provided in data");
+	  s = malloc_temp(aTHX_ sizeof(i_sample_t) * data.count);
+ 	  for (i = 0; i < data.count; ++i) {
+	    SV **entry = av_fetch(av, i, 0);
+ 	    s[i] = entry ? SvIV(*entry) : 0;
+	  }
+          data.samples = s;
+	}
+	else {
+	  /* non-magic would be preferable here */
+	  data.samples = (const i_sample_t *)SvPVbyte(ST(4), data.count);
+	  if (data.count == 0)
+	    croak("Imager::i_psamp: no samples provided in data");
+	}
+;
+
+	if (items < 6)
+	    offset = 0;
+	else {
+	    {
+		SvGETMAGIC(ST(5));
+		if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+		    croak("Numeric argument 'offset' shouldn't be a reference");
+		}
+		else {
+			    offset = (i_img_dim)SvIV(ST(5));
+		}
+	    }
+;
+	}
+
+	if (items < 7)
+	    width = -1;
+	else {
+	    {
+		SvGETMAGIC(ST(6));
+		if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+		    croak("Numeric argument 'width' shouldn't be a reference");
+		}
+		else {
+			    width = (i_img_dim)SvIV(ST(6));
+		}
+	    }
+;
+	}
+#line 3911 "Imager.xs"
+	i_clear_error();
+	if (offset < 0) {
+	  i_push_error(0, "offset must be non-negative");
+	  XSRETURN_UNDEF;
+	}
+	if (offset > 0) {
+	  if ((size_t)offset > data.count) {
+	    i_push_error(0, "offset greater than number of samples supplied");
+	    XSRETURN_UNDEF;
+	  }
+	  data.samples += offset;
+	  data.count -= offset;
+	}
+	if (width == -1 ||
+	    (size_t)width * channels.count > data.count) {
+	  width = data.count / channels.count;
+        }
+        if (x >= im->xsize) {
+          i_push_error(0, "Image position outside of image");
+          XSRETURN_UNDEF;
+        }
+        if (width <= 0) {
+          i_push_errorf(0, "i_psamp: width %zd negative or zero", width);
+          XSRETURN_UNDEF;
+        }
+	r = x + width;
+	RETVAL = i_psamp(im, x, r, y, data.samples, channels.channels, channels.count);
+#line 14148 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL < 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_psampf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_psampf)
+{
+    dVAR; dXSARGS;
+    if (items < 5 || items > 7)
+       croak_xs_usage(cv,  "im, x, y, channels, data, offset = 0, width = -1");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	i_channel_list	channels;
+	i_fsample_list	data;
+	i_img_dim	offset;
+	i_img_dim	width;
+#line 3951 "Imager.xs"
+	i_img_dim r;
+#line 14177 "Imager.c"
+	undef_neg_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+        SvGETMAGIC(ST(3));
+	if (SvOK(ST(3))) {
+	  AV *channels_av;
+	  int i;
+	  if (!SvROK(ST(3)) || SvTYPE(SvRV(ST(3))) != SVt_PVAV) {
+	    croak("channels is not an array ref");
+	  }
+	  channels_av = (AV *)SvRV(ST(3));
+ 	  channels.count = av_len(channels_av) + 1;
+	  if (channels.count < 1) {
+	    croak("Imager::i_psampf: no channels provided");
+	  }
+	  channels.channels = malloc_temp(aTHX_ sizeof(int) * channels.count);
+ 	  for (i = 0; i < channels.count; ++i) {
+	    SV **entry = av_fetch(channels_av, i, 0);
+	    channels.channels[i] = entry ? SvIV(*entry) : 0;
+	  }
+        }
+	else {
+	  /* assumes we have an image */
+	  channels.count = im->channels;
+	  channels.channels = NULL;
+	}
+;
+
+	SvGETMAGIC(ST(4));
+	if (!SvOK(ST(4)))
+	  croak("data must be a scalar or an arrayref");
+	if (SvROK(ST(4))) {
+	  size_t i;
+	  AV *av;
+	  i_fsample_t *s;
+	  if (SvTYPE(SvRV(ST(4))) != SVt_PVAV)
+	    croak("data must be a scalar or an arrayref");
+	  av = (AV *)SvRV(ST(4));
+          data.count = av_len(av) + 1;
+          if (data.count < 1)
+	    croak("Imager::i_psampf: no samples provided in data");
+	  s = malloc_temp(aTHX_ sizeof(i_fsample_t) * data.count);
+ 	  for (i = 0; i < data.count; ++i) {
+	    SV **entry = av_fetch(av, i, 0);
+ 	    s[i] = entry ? SvNV(*entry) : 0;
+	  }
+          data.samples = s;
+	}
+	else {
+	  /* non-magic would be preferable here */
+	  data.samples = (const i_fsample_t *)SvPVbyte(ST(4), data.count);
+	  if (data.count % sizeof(double))
+	    croak("Imager::i_psampf: data doesn't not contain a integer number of samples");
+          data.count /= sizeof(double);
+	  if (data.count == 0)
+	    croak("Imager::i_psampf: no samples provided in data");
+	}
+;
+
+	if (items < 6)
+	    offset = 0;
+	else {
+	    {
+		SvGETMAGIC(ST(5));
+		if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+		    croak("Numeric argument 'offset' shouldn't be a reference");
+		}
+		else {
+			    offset = (i_img_dim)SvIV(ST(5));
+		}
+	    }
+;
+	}
+
+	if (items < 7)
+	    width = -1;
+	else {
+	    {
+		SvGETMAGIC(ST(6));
+		if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+		    croak("Numeric argument 'width' shouldn't be a reference");
+		}
+		else {
+			    width = (i_img_dim)SvIV(ST(6));
+		}
+	    }
+;
+	}
+#line 3953 "Imager.xs"
+	i_clear_error();
+	if (offset < 0) {
+	  i_push_error(0, "offset must be non-negative");
+	  XSRETURN_UNDEF;
+	}
+	if (offset > 0) {
+	  if ((size_t)offset > data.count) {
+	    i_push_error(0, "offset greater than number of samples supplied");
+	    XSRETURN_UNDEF;
+	  }
+	  data.samples += offset;
+	  data.count -= offset;
+	}
+	if (width == -1 ||
+	    (size_t)width * channels.count > data.count) {
+	  width = data.count / channels.count;
+        }
+	r = x + width;
+	RETVAL = i_psampf(im, x, r, y, data.samples, channels.channels, channels.count);
+#line 14326 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL < 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_masked_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_masked_new)
+{
+    dVAR; dXSARGS;
+    if (items != 6)
+       croak_xs_usage(cv,  "targ, mask, x, y, w, h");
+    {
+	Imager__ImgRaw	targ;
+	i_img_dim	x;
+	i_img_dim	y;
+	i_img_dim	w;
+	i_img_dim	h;
+#line 3983 "Imager.xs"
+        i_img *mask;
+#line 14353 "Imager.c"
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            targ = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                targ = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "targ is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "targ is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(4));
+	    if (SvROK(ST(4)) && !SvAMAGIC(ST(4))) {
+	        croak("Numeric argument 'w' shouldn't be a reference");
+	    }
+	    else {
+	    	w = (i_img_dim)SvIV(ST(4));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'h' shouldn't be a reference");
+	    }
+	    else {
+	    	h = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+#line 3985 "Imager.xs"
+        if (SvOK(ST(1))) {
+          if (!sv_isobject(ST(1)) 
+              || !sv_derived_from(ST(1), "Imager::ImgRaw")) {
+            croak("i_img_masked_new: parameter 2 must undef or an image");
+          }
+          mask = INT2PTR(i_img *, SvIV((SV *)SvRV(ST(1))));
+        }
+        else
+          mask = NULL;
+        RETVAL = i_img_masked_new(targ, mask, x, y, w, h);
+#line 14429 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_plin); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_plin)
+{
+    dVAR; dXSARGS;
+    if (items < 3)
+       croak_xs_usage(cv,  "im, l, y, ...");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	y;
+#line 4004 "Imager.xs"
+        i_color *work;
+        STRLEN len;
+        size_t count;
+#line 14455 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+#line 4008 "Imager.xs"
+        if (items > 3) {
+          if (items == 4 && SvOK(ST(3)) && !SvROK(ST(3))) {
+	    /* supplied as a byte string */
+            work = (i_color *)SvPV(ST(3), len);
+            count = len / sizeof(i_color);
+	    if (count * sizeof(i_color) != len) {
+              croak("i_plin: length of scalar argument must be multiple of sizeof i_color");
+            }
+            RETVAL = i_plin(im, l, l+count, y, work);
+          }
+	  else {
+            I32 item_index;
+            work = mymalloc(sizeof(i_color) * (items-3));
+            for (item_index = 0; item_index < items-3; ++item_index) {
+              if (sv_isobject(ST(item_index+3))
+                  && sv_derived_from(ST(item_index+3), "Imager::Color")) {
+                IV tmp = SvIV((SV *)SvRV(ST(item_index+3)));
+                work[item_index] = *INT2PTR(i_color *, tmp);
+              }
+              else {
+                myfree(work);
+                croak("i_plin: pixels must be Imager::Color objects");
+              }
+            }
+            RETVAL = i_plin(im, l, l+items-3, y, work);
+            myfree(work);
+          }
+        }
+        else {
+          RETVAL = 0;
+        }
+#line 14531 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_ppixf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_ppixf)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, x, y, cl");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	Imager__Color__Float	cl;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	if (SvROK(ST(3)) && sv_derived_from(ST(3), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(3)));
+	    cl = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(3)) ? "" : SvOK(ST(3)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_ppixf",
+			"cl", "Imager::Color::Float",
+			refstr, ST(3)
+		);
+	}
+;
+
+	RETVAL = i_ppixf(im, x, y, cl);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_gsampf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gsampf)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, l, r, y, channels");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	r;
+	i_img_dim	y;
+	i_channel_list	channels;
+#line 4057 "Imager.xs"
+        i_fsample_t *data;
+        i_img_dim count, i;
+#line 14633 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'r' shouldn't be a reference");
+	    }
+	    else {
+	    	r = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+        SvGETMAGIC(ST(4));
+	if (SvOK(ST(4))) {
+	  AV *channels_av;
+	  int i;
+	  if (!SvROK(ST(4)) || SvTYPE(SvRV(ST(4))) != SVt_PVAV) {
+	    croak("channels is not an array ref");
+	  }
+	  channels_av = (AV *)SvRV(ST(4));
+ 	  channels.count = av_len(channels_av) + 1;
+	  if (channels.count < 1) {
+	    croak("Imager::i_gsampf: no channels provided");
+	  }
+	  channels.channels = malloc_temp(aTHX_ sizeof(int) * channels.count);
+ 	  for (i = 0; i < channels.count; ++i) {
+	    SV **entry = av_fetch(channels_av, i, 0);
+	    channels.channels[i] = entry ? SvIV(*entry) : 0;
+	  }
+        }
+	else {
+	  /* assumes we have an image */
+	  channels.count = im->channels;
+	  channels.channels = NULL;
+	}
+;
+#line 4060 "Imager.xs"
+        if (l < r) {
+          data = mymalloc(sizeof(i_fsample_t) * (r-l) * channels.count);
+          count = i_gsampf(im, l, r, y, data, channels.channels, channels.count);
+          if (GIMME_V == G_ARRAY) {
+            EXTEND(SP, count);
+            for (i = 0; i < count; ++i)
+              PUSHs(sv_2mortal(newSVnv(data[i])));
+          }
+          else {
+            EXTEND(SP, 1);
+            PUSHs(sv_2mortal(newSVpv((void *)data, count * sizeof(i_fsample_t))));
+          }
+          myfree(data);
+        }
+        else {
+          if (GIMME_V != G_ARRAY) {
+	    XSRETURN_UNDEF;
+          }
+        }
+#line 14731 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_plinf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_plinf)
+{
+    dVAR; dXSARGS;
+    if (items < 3)
+       croak_xs_usage(cv,  "im, l, y, ...");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	y;
+#line 4086 "Imager.xs"
+        i_fcolor *work;
+        i_img_dim i;
+        STRLEN len;
+        size_t count;
+#line 14753 "Imager.c"
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+#line 4091 "Imager.xs"
+        if (items > 3) {
+          if (items == 4 && SvOK(ST(3)) && !SvROK(ST(3))) {
+	    /* supplied as a byte string */
+            work = (i_fcolor *)SvPV(ST(3), len);
+            count = len / sizeof(i_fcolor);
+	    if (count * sizeof(i_fcolor) != len) {
+              croak("i_plin: length of scalar argument must be multiple of sizeof i_fcolor");
+            }
+            RETVAL = i_plinf(im, l, l+count, y, work);
+          }
+	  else {
+            work = mymalloc(sizeof(i_fcolor) * (items-3));
+            for (i=0; i < items-3; ++i) {
+              if (sv_isobject(ST(i+3)) 
+                  && sv_derived_from(ST(i+3), "Imager::Color::Float")) {
+                IV tmp = SvIV((SV *)SvRV(ST(i+3)));
+                work[i] = *INT2PTR(i_fcolor *, tmp);
+              }
+              else {
+                myfree(work);
+                croak("i_plinf: pixels must be Imager::Color::Float objects");
+              }
+            }
+            /**(char *)0 = 1;*/
+            RETVAL = i_plinf(im, l, l+items-3, y, work);
+            myfree(work);
+          }
+        }
+        else {
+          RETVAL = 0;
+        }
+#line 14829 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_gpixf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_gpixf)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, x, y");
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	x;
+	i_img_dim	y;
+	Imager__Color__Float	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'x' shouldn't be a reference");
+	    }
+	    else {
+	    	x = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+#line 4131 "Imager.xs"
+	RETVAL = (i_fcolor *)mymalloc(sizeof(i_fcolor));
+	memset(RETVAL, 0, sizeof(*RETVAL));
+	if (i_gpixf(im, x, y, RETVAL) != 0) {
+          myfree(RETVAL);
+          XSRETURN_UNDEF;
+        }
+#line 14896 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Color::Float", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_glin); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_glin)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, l, r, y");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	r;
+	i_img_dim	y;
+#line 4147 "Imager.xs"
+        i_color *vals;
+        i_img_dim count, i;
+#line 14924 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'r' shouldn't be a reference");
+	    }
+	    else {
+	    	r = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+#line 4150 "Imager.xs"
+        if (l < r) {
+          vals = mymalloc((r-l) * sizeof(i_color));
+          memset(vals, 0, (r-l) * sizeof(i_color));
+          count = i_glin(im, l, r, y, vals);
+	  if (GIMME_V == G_ARRAY) {
+            EXTEND(SP, count);
+            for (i = 0; i < count; ++i) {
+              SV *sv = make_i_color_sv_mortal(aTHX_ vals+i);
+              PUSHs(sv);
+            }
+          }
+          else if (count) {
+	    EXTEND(SP, 1);
+	    PUSHs(sv_2mortal(newSVpv((void *)vals, count * sizeof(i_color))));
+          }
+          myfree(vals);
+        }
+#line 14995 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_glinf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_glinf)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, l, r, y");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	i_img_dim	l;
+	i_img_dim	r;
+	i_img_dim	y;
+#line 4175 "Imager.xs"
+        i_fcolor *vals;
+        i_img_dim count, i;
+        i_fcolor zero;
+#line 15019 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'l' shouldn't be a reference");
+	    }
+	    else {
+	    	l = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'r' shouldn't be a reference");
+	    }
+	    else {
+	    	r = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+#line 4179 "Imager.xs"
+	for (i = 0; i < MAXCHANNELS; ++i)
+	  zero.channel[i] = 0;
+        if (l < r) {
+          vals = mymalloc((r-l) * sizeof(i_fcolor));
+          for (i = 0; i < r-l; ++i)
+	    vals[i] = zero;
+          count = i_glinf(im, l, r, y, vals);
+          if (GIMME_V == G_ARRAY) {
+            EXTEND(SP, count);
+            for (i = 0; i < count; ++i) {
+              SV *sv = make_i_fcolor_sv_mortal(aTHX_ vals+i);
+              PUSHs(sv);
+            }
+          }
+          else if (count) {
+            EXTEND(SP, 1);
+            PUSHs(sv_2mortal(newSVpv((void *)vals, count * sizeof(i_fcolor))));
+          }
+          myfree(vals);
+        }
+#line 15093 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_img_8_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_8_new)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "xsize, ysize, channels");
+    {
+	i_img_dim	xsize;
+	i_img_dim	ysize;
+	int	channels = (int)SvIV(ST(2))
+;
+	Imager__ImgRaw	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'xsize' shouldn't be a reference");
+	    }
+	    else {
+	    	xsize = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'ysize' shouldn't be a reference");
+	    }
+	    else {
+	    	ysize = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_img_8_new(xsize, ysize, channels);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_16_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_16_new)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "xsize, ysize, channels");
+    {
+	i_img_dim	xsize;
+	i_img_dim	ysize;
+	int	channels = (int)SvIV(ST(2))
+;
+	Imager__ImgRaw	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'xsize' shouldn't be a reference");
+	    }
+	    else {
+	    	xsize = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'ysize' shouldn't be a reference");
+	    }
+	    else {
+	    	ysize = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_img_16_new(xsize, ysize, channels);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_to_rgb16); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_to_rgb16)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_to_rgb16(im);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_double_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_double_new)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "xsize, ysize, channels");
+    {
+	i_img_dim	xsize;
+	i_img_dim	ysize;
+	int	channels = (int)SvIV(ST(2))
+;
+	Imager__ImgRaw	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'xsize' shouldn't be a reference");
+	    }
+	    else {
+	    	xsize = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'ysize' shouldn't be a reference");
+	    }
+	    else {
+	    	ysize = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_img_double_new(xsize, ysize, channels);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_tiled_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_tiled_new)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "xsize, ysize, channels");
+    {
+	i_img_dim	xsize;
+	i_img_dim	ysize;
+	int	channels = (int)SvIV(ST(2))
+;
+	Imager__ImgRaw	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'xsize' shouldn't be a reference");
+	    }
+	    else {
+	    	xsize = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'ysize' shouldn't be a reference");
+	    }
+	    else {
+	    	ysize = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	RETVAL = i_img_tiled_new(xsize, ysize, channels);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_img_to_drgb); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_img_to_drgb)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	Imager__ImgRaw	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_img_to_drgb(im);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::ImgRaw", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_addn); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_addn)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "im, name_sv, code, idata");
+    {
+	Imager__ImgRaw	im;
+	SV *	name_sv = ST(1)
+;
+	int	code = (int)SvIV(ST(2))
+;
+	int	idata = (int)SvIV(ST(3))
+;
+#line 4239 "Imager.xs"
+        char *name;
+        STRLEN len;
+#line 15387 "Imager.c"
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4242 "Imager.xs"
+        SvGETMAGIC(name_sv);
+        if (SvOK(name_sv))
+          name = SvPV_nomg(name_sv, len);
+        else
+          name = NULL;
+        RETVAL = i_tags_addn(&im->tags, name, code, idata);
+#line 15415 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_add); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_add)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "im, name_sv, code, data_sv, idata");
+    {
+	Imager__ImgRaw	im;
+	SV *	name_sv = ST(1)
+;
+	int	code = (int)SvIV(ST(2))
+;
+	SV *	data_sv = ST(3)
+;
+	int	idata = (int)SvIV(ST(4))
+;
+#line 4259 "Imager.xs"
+        char *name;
+        char *data;
+        STRLEN len;
+#line 15448 "Imager.c"
+	undef_int	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4263 "Imager.xs"
+        SvGETMAGIC(name_sv);
+        if (SvOK(name_sv))
+          name = SvPV_nomg(name_sv, len);
+        else
+          name = NULL;
+	SvGETMAGIC(data_sv);
+        if (SvOK(data_sv))
+          data = SvPV(data_sv, len);
+        else {
+          data = NULL;
+          len = 0;
+        }
+        RETVAL = i_tags_add(&im->tags, name, code, data, len, idata);
+#line 15483 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL == 0) RETVALSV=&PL_sv_undef;
+	    else sv_setiv(RETVALSV, (IV)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_find); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_find)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, name, start");
+    {
+	Imager__ImgRaw	im;
+	char *	name = (char *)SvPV_nolen(ST(1))
+;
+	int	start = (int)SvIV(ST(2))
+;
+#line 4285 "Imager.xs"
+        int entry;
+#line 15510 "Imager.c"
+	SysRet	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4287 "Imager.xs"
+        if (i_tags_find(&im->tags, name, start, &entry)) {
+	  RETVAL = entry;
+        } else {
+          XSRETURN_UNDEF;
+        }
+#line 15537 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL != -1) {
+		if (RETVAL == 0)
+		    sv_setpvn(RETVALSV, "0 but true", 10);
+		else
+		    sv_setiv(RETVALSV, (IV)RETVAL);
+	    }
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_findn); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_findn)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "im, code, start");
+    {
+	Imager__ImgRaw	im;
+	int	code = (int)SvIV(ST(1))
+;
+	int	start = (int)SvIV(ST(2))
+;
+#line 4301 "Imager.xs"
+        int entry;
+#line 15568 "Imager.c"
+	SysRet	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4303 "Imager.xs"
+        if (i_tags_findn(&im->tags, code, start, &entry)) {
+          RETVAL = entry;
+        }
+        else {
+          XSRETURN_UNDEF;
+        }
+#line 15596 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    if (RETVAL != -1) {
+		if (RETVAL == 0)
+		    sv_setpvn(RETVALSV, "0 but true", 10);
+		else
+		    sv_setiv(RETVALSV, (IV)RETVAL);
+	    }
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_delete); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_delete)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, entry");
+    {
+	Imager__ImgRaw	im;
+	int	entry = (int)SvIV(ST(1))
+;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4317 "Imager.xs"
+        RETVAL = i_tags_delete(&im->tags, entry);
+#line 15646 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_delbyname); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_delbyname)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, name");
+    {
+	Imager__ImgRaw	im;
+	char *	name = (char *)SvPV_nolen(ST(1))
+;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4326 "Imager.xs"
+        RETVAL = i_tags_delbyname(&im->tags, name);
+#line 15687 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_delbycode); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_delbycode)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, code");
+    {
+	Imager__ImgRaw	im;
+	int	code = (int)SvIV(ST(1))
+;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4335 "Imager.xs"
+        RETVAL = i_tags_delbycode(&im->tags, code);
+#line 15728 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_get); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_get)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, index");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	int	index = (int)SvIV(ST(1))
+;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4344 "Imager.xs"
+        if (index >= 0 && index < im->tags.count) {
+          i_img_tag *entry = im->tags.tags + index;
+          EXTEND(SP, 5);
+
+          if (entry->name) {
+            PUSHs(sv_2mortal(newSVpv(entry->name, 0)));
+          }
+          else {
+            PUSHs(sv_2mortal(newSViv(entry->code)));
+          }
+          if (entry->data) {
+            PUSHs(sv_2mortal(newSVpvn(entry->data, entry->size)));
+          }
+          else {
+            PUSHs(sv_2mortal(newSViv(entry->idata)));
+          }
+        }
+#line 15785 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_get_string); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_get_string)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "im, what_sv");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	Imager__ImgRaw	im;
+	SV *	what_sv = ST(1)
+;
+#line 4367 "Imager.xs"
+        char const *name = NULL;
+        int code;
+        char buffer[200];
+#line 15808 "Imager.c"
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4371 "Imager.xs"
+        if (SvIOK(what_sv)) {
+          code = SvIV(what_sv);
+          name = NULL;
+        }
+        else {
+          name = SvPV_nolen(what_sv);
+          code = 0;
+        }
+        if (i_tags_get_string(&im->tags, name, code, buffer, sizeof(buffer))) {
+          EXTEND(SP, 1);
+          PUSHs(sv_2mortal(newSVpv(buffer, 0)));
+        }
+#line 15841 "Imager.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Imager_i_tags_count); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_tags_count)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	int	RETVAL;
+	dXSTARG;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+#line 4388 "Imager.xs"
+        RETVAL = im->tags.count;
+#line 15879 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__FillHandle_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__FillHandle_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "fill");
+    {
+	Imager__FillHandle	fill;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    fill = INT2PTR(Imager__FillHandle,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"Imager::FillHandle::DESTROY",
+			"fill")
+;
+
+	IFILL_DESTROY(fill);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__FillHandle_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__FillHandle_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+	int	RETVAL;
+	dXSTARG;
+#line 4403 "Imager.xs"
+        (void)items; /* avoid unused warning for XS variable */
+        RETVAL = 1;
+#line 15924 "Imager.c"
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_new_fill_solid); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_new_fill_solid)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "cl, combine");
+    {
+	Imager__Color	cl;
+	int	combine = (int)SvIV(ST(1))
+;
+	Imager__FillHandle	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_new_fill_solid",
+			"cl", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_new_fill_solid(cl, combine);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::FillHandle", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_new_fill_solidf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_new_fill_solidf)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "cl, combine");
+    {
+	Imager__Color__Float	cl;
+	int	combine = (int)SvIV(ST(1))
+;
+	Imager__FillHandle	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    cl = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_new_fill_solidf",
+			"cl", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_new_fill_solidf(cl, combine);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::FillHandle", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_new_fill_hatch); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_new_fill_hatch)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "fg, bg, combine, hatch, cust_hatch_sv, dx, dy");
+    {
+	Imager__Color	fg;
+	Imager__Color	bg;
+	int	combine = (int)SvIV(ST(2))
+;
+	int	hatch = (int)SvIV(ST(3))
+;
+	SV *	cust_hatch_sv = ST(4)
+;
+	i_img_dim	dx;
+	i_img_dim	dy;
+#line 4430 "Imager.xs"
+        unsigned char *cust_hatch;
+        STRLEN len;
+#line 16028 "Imager.c"
+	Imager__FillHandle	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    fg = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_new_fill_hatch",
+			"fg", "Imager::Color",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    bg = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_new_fill_hatch",
+			"bg", "Imager::Color",
+			refstr, ST(1)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'dx' shouldn't be a reference");
+	    }
+	    else {
+	    	dx = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'dy' shouldn't be a reference");
+	    }
+	    else {
+	    	dy = (i_img_dim)SvIV(ST(6));
+	    }
+	}
+;
+#line 4433 "Imager.xs"
+        SvGETMAGIC(cust_hatch_sv);
+        if (SvOK(cust_hatch_sv)) {
+          cust_hatch = (unsigned char *)SvPV_nomg(cust_hatch_sv, len);
+        }
+        else
+          cust_hatch = NULL;
+        RETVAL = i_new_fill_hatch(fg, bg, combine, hatch, cust_hatch, dx, dy);
+#line 16088 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::FillHandle", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_new_fill_hatchf); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_new_fill_hatchf)
+{
+    dVAR; dXSARGS;
+    if (items != 7)
+       croak_xs_usage(cv,  "fg, bg, combine, hatch, cust_hatch_sv, dx, dy");
+    {
+	Imager__Color__Float	fg;
+	Imager__Color__Float	bg;
+	int	combine = (int)SvIV(ST(2))
+;
+	int	hatch = (int)SvIV(ST(3))
+;
+	SV *	cust_hatch_sv = ST(4)
+;
+	i_img_dim	dx;
+	i_img_dim	dy;
+#line 4453 "Imager.xs"
+        unsigned char *cust_hatch;
+        STRLEN len;
+#line 16120 "Imager.c"
+	Imager__FillHandle	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    fg = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_new_fill_hatchf",
+			"fg", "Imager::Color::Float",
+			refstr, ST(0)
+		);
+	}
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    bg = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::i_new_fill_hatchf",
+			"bg", "Imager::Color::Float",
+			refstr, ST(1)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(5));
+	    if (SvROK(ST(5)) && !SvAMAGIC(ST(5))) {
+	        croak("Numeric argument 'dx' shouldn't be a reference");
+	    }
+	    else {
+	    	dx = (i_img_dim)SvIV(ST(5));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(6));
+	    if (SvROK(ST(6)) && !SvAMAGIC(ST(6))) {
+	        croak("Numeric argument 'dy' shouldn't be a reference");
+	    }
+	    else {
+	    	dy = (i_img_dim)SvIV(ST(6));
+	    }
+	}
+;
+#line 4456 "Imager.xs"
+        SvGETMAGIC(cust_hatch_sv);
+        if (SvOK(cust_hatch_sv)) {
+          cust_hatch = (unsigned char *)SvPV(cust_hatch_sv, len);
+        }
+        else
+          cust_hatch = NULL;
+        RETVAL = i_new_fill_hatchf(fg, bg, combine, hatch, cust_hatch, dx, dy);
+#line 16180 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::FillHandle", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager_i_new_fill_image); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager_i_new_fill_image)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "src, matrix_sv, xoff, yoff, combine");
+    {
+	Imager__ImgRaw	src;
+	SV *	matrix_sv = ST(1)
+;
+	i_img_dim	xoff;
+	i_img_dim	yoff;
+	int	combine = (int)SvIV(ST(4))
+;
+#line 4474 "Imager.xs"
+        double matrix[9];
+        double *matrixp;
+        AV *av;
+        IV len;
+        SV *sv1;
+        int i;
+#line 16213 "Imager.c"
+	Imager__FillHandle	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            src = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                src = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "src is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "src is not of type Imager::ImgRaw")
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'xoff' shouldn't be a reference");
+	    }
+	    else {
+	    	xoff = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'yoff' shouldn't be a reference");
+	    }
+	    else {
+	    	yoff = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+#line 4481 "Imager.xs"
+        SvGETMAGIC(matrix_sv);
+        if (!SvOK(matrix_sv)) {
+          matrixp = NULL;
+        }
+        else {
+          if (!SvROK(matrix_sv) || SvTYPE(SvRV(matrix_sv)) != SVt_PVAV)
+            croak("i_new_fill_image: matrix parameter must be an arrayref or undef");
+	  av=(AV*)SvRV(matrix_sv);
+	  len=av_len(av)+1;
+          if (len > 9)
+            len = 9;
+          for (i = 0; i < len; ++i) {
+	    sv1=(*(av_fetch(av,i,0)));
+	    matrix[i] = SvNV(sv1);
+          }
+          for (; i < 9; ++i)
+            matrix[i] = 0;
+          matrixp = matrix;
+        }
+        RETVAL = i_new_fill_image(src, matrixp, xoff, yoff, combine);
+#line 16277 "Imager.c"
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::FillHandle", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Internal__Hlines_testing); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Internal__Hlines_testing)
+{
+    dVAR; dXSARGS;
+    if (items != 0)
+       croak_xs_usage(cv,  "");
+    {
+	int	RETVAL;
+	dXSTARG;
+
+	RETVAL = i_int_hlines_testing();
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+#if i_int_hlines_testing()
+#define XSubPPtmpAAAB 1
+
+
+XS_EUPXS(XS_Imager__Internal__Hlines_new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Internal__Hlines_new)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "start_y, count_y, start_x, count_x");
+    {
+	i_img_dim	start_y;
+	int	count_y = (int)SvIV(ST(1))
+;
+	i_img_dim	start_x;
+	int	count_x = (int)SvIV(ST(3))
+;
+	Imager__Internal__Hlines	RETVAL;
+
+	{
+	    SvGETMAGIC(ST(0));
+	    if (SvROK(ST(0)) && !SvAMAGIC(ST(0))) {
+	        croak("Numeric argument 'start_y' shouldn't be a reference");
+	    }
+	    else {
+	    	start_y = (i_img_dim)SvIV(ST(0));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'start_x' shouldn't be a reference");
+	    }
+	    else {
+	    	start_x = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	RETVAL = i_int_hlines_new(start_y, count_y, start_x, count_x);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Internal::Hlines", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Internal__Hlines_new_img); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Internal__Hlines_new_img)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "im");
+    {
+	Imager__ImgRaw	im;
+	Imager__Internal__Hlines	RETVAL;
+
+        if (sv_derived_from(ST(0), "Imager::ImgRaw")) {
+            IV tmp = SvIV((SV*)SvRV(ST(0)));
+            im = INT2PTR(Imager__ImgRaw,tmp);
+        }
+        else if (sv_derived_from(ST(0), "Imager") &&
+                 SvTYPE(SvRV(ST(0))) == SVt_PVHV) {
+            HV *hv = (HV *)SvRV(ST(0));
+            SV **sv = hv_fetch(hv, "IMG", 3, 0);
+            if (sv && *sv && sv_derived_from(*sv, "Imager::ImgRaw")) {
+                IV tmp = SvIV((SV*)SvRV(*sv));
+                im = INT2PTR(Imager__ImgRaw,tmp);
+            }
+            else
+                Perl_croak(aTHX_ "im is not of type Imager::ImgRaw");
+        }
+        else
+            Perl_croak(aTHX_ "im is not of type Imager::ImgRaw")
+;
+
+	RETVAL = i_int_hlines_new_img(im);
+	{
+	    SV * RETVALSV;
+	    RETVALSV = sv_newmortal();
+	    sv_setref_pv(RETVALSV, "Imager::Internal::Hlines", (void*)RETVAL);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Internal__Hlines_add); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Internal__Hlines_add)
+{
+    dVAR; dXSARGS;
+    if (items != 4)
+       croak_xs_usage(cv,  "hlines, y, minx, width");
+    {
+	Imager__Internal__Hlines	hlines;
+	i_img_dim	y;
+	i_img_dim	minx;
+	i_img_dim	width;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Internal::Hlines")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    hlines = INT2PTR(Imager__Internal__Hlines,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Internal::Hlines::add",
+			"hlines", "Imager::Internal::Hlines",
+			refstr, ST(0)
+		);
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(1));
+	    if (SvROK(ST(1)) && !SvAMAGIC(ST(1))) {
+	        croak("Numeric argument 'y' shouldn't be a reference");
+	    }
+	    else {
+	    	y = (i_img_dim)SvIV(ST(1));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(2));
+	    if (SvROK(ST(2)) && !SvAMAGIC(ST(2))) {
+	        croak("Numeric argument 'minx' shouldn't be a reference");
+	    }
+	    else {
+	    	minx = (i_img_dim)SvIV(ST(2));
+	    }
+	}
+;
+
+	{
+	    SvGETMAGIC(ST(3));
+	    if (SvROK(ST(3)) && !SvAMAGIC(ST(3))) {
+	        croak("Numeric argument 'width' shouldn't be a reference");
+	    }
+	    else {
+	    	width = (i_img_dim)SvIV(ST(3));
+	    }
+	}
+;
+
+	i_int_hlines_add(hlines, y, minx, width);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__Internal__Hlines_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Internal__Hlines_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "hlines");
+    {
+	Imager__Internal__Hlines	hlines;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    hlines = INT2PTR(Imager__Internal__Hlines,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"Imager::Internal::Hlines::DESTROY",
+			"hlines")
+;
+
+	i_int_hlines_DESTROY(hlines);
+    }
+    XSRETURN_EMPTY;
+}
+
+
+XS_EUPXS(XS_Imager__Internal__Hlines_dump); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Internal__Hlines_dump)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "hlines");
+    {
+	Imager__Internal__Hlines	hlines;
+	SV *	RETVAL;
+
+	if (SvROK(ST(0)) && sv_derived_from(ST(0), "Imager::Internal::Hlines")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    hlines = INT2PTR(Imager__Internal__Hlines,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(0)) ? "" : SvOK(ST(0)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::Internal::Hlines::dump",
+			"hlines", "Imager::Internal::Hlines",
+			refstr, ST(0)
+		);
+	}
+;
+
+	RETVAL = i_int_hlines_dump(hlines);
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Internal__Hlines_CLONE_SKIP); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Internal__Hlines_CLONE_SKIP)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "cls");
+    {
+	int	RETVAL;
+	dXSTARG;
+
+	RETVAL = i_int_hlines_CLONE_SKIP(cls);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+#endif
+
+XS_EUPXS(XS_Imager__TrimColorList__new); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__TrimColorList__new)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "cls");
+    {
+	Imager__TrimColorList	RETVAL;
+
+	RETVAL = trim_color_list__new();
+	{
+	    SV * RETVALSV;
+	    RETVALSV = RETVAL.rsv;
+	    RETVALSV = sv_2mortal(RETVALSV);
+	    ST(0) = RETVALSV;
+	}
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__TrimColorList_add_color); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__TrimColorList_add_color)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "t, c1, c2");
+    {
+	int	RETVAL;
+	dXSTARG;
+	Imager__TrimColorList	t;
+	Imager__Color	c1;
+	Imager__Color	c2;
+
+        if (!S_get_trim_color_list(aTHX_ ST(0), &t)) {
+	    Perl_croak(aTHX_ "%s: " "t" " is not a valid Imager::TrimColorList",
+	               "Imager::TrimColorList::add_color");
+	}
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    c1 = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::TrimColorList::add_color",
+			"c1", "Imager::Color",
+			refstr, ST(1)
+		);
+	}
+;
+
+	if (SvROK(ST(2)) && sv_derived_from(ST(2), "Imager::Color")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(2)));
+	    c2 = INT2PTR(Imager__Color,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(2)) ? "" : SvOK(ST(2)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::TrimColorList::add_color",
+			"c2", "Imager::Color",
+			refstr, ST(2)
+		);
+	}
+;
+
+	RETVAL = trim_color_list_add_color(t, c1, c2);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__TrimColorList_add_fcolor); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__TrimColorList_add_fcolor)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "t, c1, c2");
+    {
+	int	RETVAL;
+	dXSTARG;
+	Imager__TrimColorList	t;
+	Imager__Color__Float	c1;
+	Imager__Color__Float	c2;
+
+        if (!S_get_trim_color_list(aTHX_ ST(0), &t)) {
+	    Perl_croak(aTHX_ "%s: " "t" " is not a valid Imager::TrimColorList",
+	               "Imager::TrimColorList::add_fcolor");
+	}
+;
+
+	if (SvROK(ST(1)) && sv_derived_from(ST(1), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(1)));
+	    c1 = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(1)) ? "" : SvOK(ST(1)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::TrimColorList::add_fcolor",
+			"c1", "Imager::Color::Float",
+			refstr, ST(1)
+		);
+	}
+;
+
+	if (SvROK(ST(2)) && sv_derived_from(ST(2), "Imager::Color::Float")) {
+	    IV tmp = SvIV((SV*)SvRV(ST(2)));
+	    c2 = INT2PTR(Imager__Color__Float,tmp);
+	}
+	else {
+		const char* refstr = SvROK(ST(2)) ? "" : SvOK(ST(2)) ? "scalar " : "undef";
+	    Perl_croak_nocontext("%s: Expected %s to be of type %s; got %s%" SVf " instead",
+			"Imager::TrimColorList::add_fcolor",
+			"c2", "Imager::Color::Float",
+			refstr, ST(2)
+		);
+	}
+;
+
+	RETVAL = trim_color_list_add_fcolor(t, c1, c2);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__TrimColorList_get); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__TrimColorList_get)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "t, i");
+    {
+	SV *	RETVAL;
+	Imager__TrimColorList	t;
+	IV	i = (IV)SvIV(ST(1))
+;
+
+        if (!S_get_trim_color_list(aTHX_ ST(0), &t)) {
+	    Perl_croak(aTHX_ "%s: " "t" " is not a valid Imager::TrimColorList",
+	               "Imager::TrimColorList::get");
+	}
+;
+
+	RETVAL = trim_color_list_get(t, i);
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__TrimColorList_count); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__TrimColorList_count)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "t");
+    {
+	IV	RETVAL;
+	dXSTARG;
+	Imager__TrimColorList	t;
+
+        if (!S_get_trim_color_list(aTHX_ ST(0), &t)) {
+	    Perl_croak(aTHX_ "%s: " "t" " is not a valid Imager::TrimColorList",
+	               "Imager::TrimColorList::count");
+	}
+;
+
+	RETVAL = trim_color_list_count(t);
+	XSprePUSH;
+	PUSHi((IV)RETVAL);
+    }
+    XSRETURN(1);
+}
+
+
+XS_EUPXS(XS_Imager__Context_DESTROY); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Context_DESTROY)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "ctx");
+    {
+	Imager__Context	ctx;
+
+	if (SvROK(ST(0))) {
+	    IV tmp = SvIV((SV*)SvRV(ST(0)));
+	    ctx = INT2PTR(Imager__Context,tmp);
+	}
+	else
+	    Perl_croak_nocontext("%s: %s is not a reference",
+			"Imager::Context::DESTROY",
+			"ctx")
+;
+
+	im_context_DESTROY(ctx);
+    }
+    XSRETURN_EMPTY;
+}
+
+#ifdef PERL_IMPLICIT_CONTEXT
+#define XSubPPtmpAAAC 1
+
+
+XS_EUPXS(XS_Imager__Context_CLONE); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Imager__Context_CLONE)
+{
+    dVAR; dXSARGS;
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+    {
+#line 4573 "Imager.xs"
+      MY_CXT_CLONE;
+      (void)items;
+      /* the following sv_setref_pv() will free this inc */
+      im_context_refinc(MY_CXT.ctx, "CLONE");
+      MY_CXT.ctx = im_context_clone(MY_CXT.ctx, "CLONE");
+      if (MY_CXT.ctx == NULL) {
+        croak("Failed to clone Imager context");
+      }
+      sv_setref_pv(get_sv("Imager::_context", GV_ADD), "Imager::Context", MY_CXT.ctx);
+#line 16768 "Imager.c"
+    }
+    XSRETURN_EMPTY;
+}
+
+#endif
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_Imager); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_Imager)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("Imager::Color::new_internal", XS_Imager__Color_new_internal);
+        newXS_deffile("Imager::Color::DESTROY", XS_Imager__Color_DESTROY);
+        newXS_deffile("Imager::Color::set_internal", XS_Imager__Color_set_internal);
+        newXS_deffile("Imager::Color::info", XS_Imager__Color_info);
+        newXS_deffile("Imager::Color::rgba", XS_Imager__Color_rgba);
+        newXS_deffile("Imager::Color::i_hsv_to_rgb", XS_Imager__Color_i_hsv_to_rgb);
+        newXS_deffile("Imager::Color::i_rgb_to_hsv", XS_Imager__Color_i_rgb_to_hsv);
+        newXS_deffile("Imager::Color::red", XS_Imager__Color_red);
+        newXS_deffile("Imager::Color::green", XS_Imager__Color_green);
+        newXS_deffile("Imager::Color::blue", XS_Imager__Color_blue);
+        newXS_deffile("Imager::Color::alpha", XS_Imager__Color_alpha);
+        newXS_deffile("Imager::Color::Float::new_internal", XS_Imager__Color__Float_new_internal);
+        newXS_deffile("Imager::Color::Float::DESTROY", XS_Imager__Color__Float_DESTROY);
+        newXS_deffile("Imager::Color::Float::rgba", XS_Imager__Color__Float_rgba);
+        newXS_deffile("Imager::Color::Float::set_internal", XS_Imager__Color__Float_set_internal);
+        newXS_deffile("Imager::Color::Float::i_hsv_to_rgb", XS_Imager__Color__Float_i_hsv_to_rgb);
+        newXS_deffile("Imager::Color::Float::i_rgb_to_hsv", XS_Imager__Color__Float_i_rgb_to_hsv);
+        newXS_deffile("Imager::Color::Float::red", XS_Imager__Color__Float_red);
+        newXS_deffile("Imager::Color::Float::green", XS_Imager__Color__Float_green);
+        newXS_deffile("Imager::Color::Float::blue", XS_Imager__Color__Float_blue);
+        newXS_deffile("Imager::Color::Float::alpha", XS_Imager__Color__Float_alpha);
+        newXS_deffile("Imager::ImgRaw::new", XS_Imager__ImgRaw_new);
+        newXS_deffile("Imager::ImgRaw::DESTROY", XS_Imager__ImgRaw_DESTROY);
+        (void)newXSproto_portable("Imager::io_new_fd", XS_Imager_io_new_fd, file, "$");
+        (void)newXSproto_portable("Imager::io_new_mmap", XS_Imager_io_new_mmap, file, "$");
+        (void)newXSproto_portable("Imager::io_new_bufchain", XS_Imager_io_new_bufchain, file, "");
+        (void)newXSproto_portable("Imager::io_new_buffer", XS_Imager_io_new_buffer, file, "$");
+        (void)newXSproto_portable("Imager::io_new_cb", XS_Imager_io_new_cb, file, "$$$$;$");
+        (void)newXSproto_portable("Imager::io_slurp", XS_Imager_io_slurp, file, "$");
+        (void)newXSproto_portable("Imager::i_set_image_file_limits", XS_Imager_i_set_image_file_limits, file, "$$$");
+        (void)newXSproto_portable("Imager::i_get_image_file_limits", XS_Imager_i_get_image_file_limits, file, "");
+        (void)newXSproto_portable("Imager::i_set_threads", XS_Imager_i_set_threads, file, "$");
+        (void)newXSproto_portable("Imager::i_get_threads", XS_Imager_i_get_threads, file, "");
+        newXS_deffile("Imager::i_int_check_image_file_limits", XS_Imager_i_int_check_image_file_limits);
+        (void)newXSproto_portable("Imager::i_trim_rect", XS_Imager_i_trim_rect, file, "$$$");
+        (void)newXSproto_portable("Imager::IO::new_fd", XS_Imager__IO_new_fd, file, "$$");
+        (void)newXSproto_portable("Imager::IO::new_mmap", XS_Imager__IO_new_mmap, file, "$$");
+        (void)newXSproto_portable("Imager::IO::new_buffer", XS_Imager__IO_new_buffer, file, "$$");
+        (void)newXSproto_portable("Imager::IO::new_cb", XS_Imager__IO_new_cb, file, "$$$$$");
+        (void)newXSproto_portable("Imager::IO::new_bufchain", XS_Imager__IO_new_bufchain, file, "$");
+        (void)newXSproto_portable("Imager::IO::_new_perlio", XS_Imager__IO__new_perlio, file, "$$");
+        (void)newXSproto_portable("Imager::IO::slurp", XS_Imager__IO_slurp, file, "$$");
+        (void)newXSproto_portable("Imager::IO::raw_write", XS_Imager__IO_raw_write, file, "$$");
+        (void)newXSproto_portable("Imager::IO::raw_read", XS_Imager__IO_raw_read, file, "$$$");
+        (void)newXSproto_portable("Imager::IO::raw_read2", XS_Imager__IO_raw_read2, file, "$$");
+        (void)newXSproto_portable("Imager::IO::raw_seek", XS_Imager__IO_raw_seek, file, "$$$");
+        (void)newXSproto_portable("Imager::IO::raw_close", XS_Imager__IO_raw_close, file, "$");
+        (void)newXSproto_portable("Imager::IO::DESTROY", XS_Imager__IO_DESTROY, file, "$");
+        (void)newXSproto_portable("Imager::IO::CLONE_SKIP", XS_Imager__IO_CLONE_SKIP, file, ";@");
+        (void)newXSproto_portable("Imager::IO::getc", XS_Imager__IO_getc, file, "$");
+        (void)newXSproto_portable("Imager::IO::nextc", XS_Imager__IO_nextc, file, "$");
+        (void)newXSproto_portable("Imager::IO::putc", XS_Imager__IO_putc, file, "$$");
+        (void)newXSproto_portable("Imager::IO::close", XS_Imager__IO_close, file, "$");
+        (void)newXSproto_portable("Imager::IO::flush", XS_Imager__IO_flush, file, "$");
+        (void)newXSproto_portable("Imager::IO::peekc", XS_Imager__IO_peekc, file, "$");
+        (void)newXSproto_portable("Imager::IO::seek", XS_Imager__IO_seek, file, "$$$");
+        (void)newXSproto_portable("Imager::IO::peekn", XS_Imager__IO_peekn, file, "$$");
+        (void)newXSproto_portable("Imager::IO::read", XS_Imager__IO_read, file, "$$$");
+        (void)newXSproto_portable("Imager::IO::read2", XS_Imager__IO_read2, file, "$$");
+        (void)newXSproto_portable("Imager::IO::gets", XS_Imager__IO_gets, file, "$;$$");
+        (void)newXSproto_portable("Imager::IO::write", XS_Imager__IO_write, file, "$$");
+        (void)newXSproto_portable("Imager::IO::dump", XS_Imager__IO_dump, file, "$;$");
+        (void)newXSproto_portable("Imager::IO::set_buffered", XS_Imager__IO_set_buffered, file, "$;$");
+        (void)newXSproto_portable("Imager::IO::is_buffered", XS_Imager__IO_is_buffered, file, "$");
+        (void)newXSproto_portable("Imager::IO::eof", XS_Imager__IO_eof, file, "$");
+        (void)newXSproto_portable("Imager::IO::error", XS_Imager__IO_error, file, "$");
+        (void)newXSproto_portable("Imager::i_list_formats", XS_Imager_i_list_formats, file, "");
+        (void)newXSproto_portable("Imager::i_sametype", XS_Imager_i_sametype, file, "$$$");
+        (void)newXSproto_portable("Imager::i_sametype_chans", XS_Imager_i_sametype_chans, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_init_log", XS_Imager_i_init_log, file, "$$");
+        (void)newXSproto_portable("Imager::i_log_entry", XS_Imager_i_log_entry, file, "$$");
+        (void)newXSproto_portable("Imager::i_log_enabled", XS_Imager_i_log_enabled, file, "");
+        (void)newXSproto_portable("Imager::i_img_info", XS_Imager_i_img_info, file, "$");
+        (void)newXSproto_portable("Imager::i_img_setmask", XS_Imager_i_img_setmask, file, "$$");
+        (void)newXSproto_portable("Imager::i_img_getmask", XS_Imager_i_img_getmask, file, "$");
+        (void)newXSproto_portable("Imager::i_img_getchannels", XS_Imager_i_img_getchannels, file, "$");
+        (void)newXSproto_portable("Imager::i_img_getdata", XS_Imager_i_img_getdata, file, "$");
+        (void)newXSproto_portable("Imager::i_img_get_width", XS_Imager_i_img_get_width, file, "$");
+        (void)newXSproto_portable("Imager::i_img_get_height", XS_Imager_i_img_get_height, file, "$");
+        (void)newXSproto_portable("Imager::i_img_color_model", XS_Imager_i_img_color_model, file, "$");
+        (void)newXSproto_portable("Imager::i_img_color_channels", XS_Imager_i_img_color_channels, file, "$");
+        (void)newXSproto_portable("Imager::i_img_alpha_channel", XS_Imager_i_img_alpha_channel, file, "$");
+        (void)newXSproto_portable("Imager::i_img_is_monochrome", XS_Imager_i_img_is_monochrome, file, "$");
+        (void)newXSproto_portable("Imager::i_line", XS_Imager_i_line, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_line_aa", XS_Imager_i_line_aa, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_box", XS_Imager_i_box, file, "$$$$$$");
+        (void)newXSproto_portable("Imager::i_box_filled", XS_Imager_i_box_filled, file, "$$$$$$");
+        (void)newXSproto_portable("Imager::i_box_filledf", XS_Imager_i_box_filledf, file, "$$$$$$");
+        (void)newXSproto_portable("Imager::i_box_cfill", XS_Imager_i_box_cfill, file, "$$$$$$");
+        (void)newXSproto_portable("Imager::i_arc", XS_Imager_i_arc, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_arc_aa", XS_Imager_i_arc_aa, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_arc_cfill", XS_Imager_i_arc_cfill, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_arc_aa_cfill", XS_Imager_i_arc_aa_cfill, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_circle_aa", XS_Imager_i_circle_aa, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_circle_aa_fill", XS_Imager_i_circle_aa_fill, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_circle_out", XS_Imager_i_circle_out, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_circle_out_aa", XS_Imager_i_circle_out_aa, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_arc_out", XS_Imager_i_arc_out, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_arc_out_aa", XS_Imager_i_arc_out_aa, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_bezier_multi", XS_Imager_i_bezier_multi, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_poly_aa_m", XS_Imager_i_poly_aa_m, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_poly_aa_cfill_m", XS_Imager_i_poly_aa_cfill_m, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_poly_poly_aa", XS_Imager_i_poly_poly_aa, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_poly_poly_aa_cfill", XS_Imager_i_poly_poly_aa_cfill, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_flood_fill", XS_Imager_i_flood_fill, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_flood_cfill", XS_Imager_i_flood_cfill, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_flood_fill_border", XS_Imager_i_flood_fill_border, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_flood_cfill_border", XS_Imager_i_flood_cfill_border, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_copyto", XS_Imager_i_copyto, file, "$$$$$$$$");
+        (void)newXSproto_portable("Imager::i_copyto_trans", XS_Imager_i_copyto_trans, file, "$$$$$$$$$");
+        (void)newXSproto_portable("Imager::i_copy", XS_Imager_i_copy, file, "$");
+        (void)newXSproto_portable("Imager::i_rubthru", XS_Imager_i_rubthru, file, "$$$$$$$$");
+        (void)newXSproto_portable("Imager::i_compose", XS_Imager_i_compose, file, "$$$$$$$$;$$");
+        (void)newXSproto_portable("Imager::i_compose_mask", XS_Imager_i_compose_mask, file, "$$$$$$$$$$$;$$");
+        (void)newXSproto_portable("Imager::i_combine", XS_Imager_i_combine, file, "$;$");
+        (void)newXSproto_portable("Imager::i_flipxy", XS_Imager_i_flipxy, file, "$$");
+        (void)newXSproto_portable("Imager::i_rotate90", XS_Imager_i_rotate90, file, "$$");
+        (void)newXSproto_portable("Imager::i_rotate_exact", XS_Imager_i_rotate_exact, file, "$$;@");
+        (void)newXSproto_portable("Imager::i_matrix_transform", XS_Imager_i_matrix_transform, file, "$$$$;@");
+        (void)newXSproto_portable("Imager::i_gaussian", XS_Imager_i_gaussian, file, "$$");
+        (void)newXSproto_portable("Imager::i_gaussian2", XS_Imager_i_gaussian2, file, "$$$");
+        (void)newXSproto_portable("Imager::i_gaussian_box", XS_Imager_i_gaussian_box, file, "$$$");
+        (void)newXSproto_portable("Imager::i_unsharp_mask", XS_Imager_i_unsharp_mask, file, "$$$");
+        (void)newXSproto_portable("Imager::i_conv", XS_Imager_i_conv, file, "$$");
+        (void)newXSproto_portable("Imager::i_convert", XS_Imager_i_convert, file, "$$");
+        (void)newXSproto_portable("Imager::i_map", XS_Imager_i_map, file, "$$");
+        (void)newXSproto_portable("Imager::i_img_diff", XS_Imager_i_img_diff, file, "$$");
+        (void)newXSproto_portable("Imager::i_img_diffd", XS_Imager_i_img_diffd, file, "$$");
+        (void)newXSproto_portable("Imager::i_img_samef", XS_Imager_i_img_samef, file, "$$;$$");
+        (void)newXSproto_portable("Imager::i_img_epsilonf", XS_Imager_i_img_epsilonf, file, "");
+        (void)newXSproto_portable("Imager::_is_color_object", XS_Imager__is_color_object, file, "$");
+#if XSubPPtmpAAAA
+        (void)newXSproto_portable("Imager::i_tt_new", XS_Imager_i_tt_new, file, "$");
+        (void)newXSproto_portable("Imager::Font::TT::DESTROY", XS_Imager__Font__TT_DESTROY, file, "$");
+        (void)newXSproto_portable("Imager::Font::TT::CLONE_SKIP", XS_Imager__Font__TT_CLONE_SKIP, file, ";@");
+        (void)newXSproto_portable("Imager::i_tt_text", XS_Imager_i_tt_text, file, "$$$$$$$$$;$");
+        (void)newXSproto_portable("Imager::i_tt_cp", XS_Imager_i_tt_cp, file, "$$$$$$$$$;$");
+        (void)newXSproto_portable("Imager::i_tt_bbox", XS_Imager_i_tt_bbox, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_tt_has_chars", XS_Imager_i_tt_has_chars, file, "$$$");
+        (void)newXSproto_portable("Imager::i_tt_dump_names", XS_Imager_i_tt_dump_names, file, "$");
+        (void)newXSproto_portable("Imager::i_tt_face_name", XS_Imager_i_tt_face_name, file, "$");
+        (void)newXSproto_portable("Imager::i_tt_glyph_name", XS_Imager_i_tt_glyph_name, file, "$$;$");
+#endif
+        (void)newXSproto_portable("Imager::i_test_format_probe", XS_Imager_i_test_format_probe, file, "$$");
+        (void)newXSproto_portable("Imager::i_add_file_magic", XS_Imager_i_add_file_magic, file, "$$$");
+        (void)newXSproto_portable("Imager::i_readpnm_wiol", XS_Imager_i_readpnm_wiol, file, "$$");
+        (void)newXSproto_portable("Imager::i_readpnm_lazy_wiol", XS_Imager_i_readpnm_lazy_wiol, file, "$$$");
+        (void)newXSproto_portable("Imager::i_readpnm_multi_wiol", XS_Imager_i_readpnm_multi_wiol, file, "$$");
+        (void)newXSproto_portable("Imager::i_writeppm_wiol", XS_Imager_i_writeppm_wiol, file, "$$");
+        (void)newXSproto_portable("Imager::i_readraw_wiol", XS_Imager_i_readraw_wiol, file, "$$$$$$");
+        (void)newXSproto_portable("Imager::i_readraw_lazy_wiol", XS_Imager_i_readraw_lazy_wiol, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_writeraw_wiol", XS_Imager_i_writeraw_wiol, file, "$$");
+        (void)newXSproto_portable("Imager::i_writebmp_wiol", XS_Imager_i_writebmp_wiol, file, "$$");
+        (void)newXSproto_portable("Imager::i_readbmp_wiol", XS_Imager_i_readbmp_wiol, file, "$;$");
+        (void)newXSproto_portable("Imager::i_writetga_wiol", XS_Imager_i_writetga_wiol, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_readtga_wiol", XS_Imager_i_readtga_wiol, file, "$$");
+        (void)newXSproto_portable("Imager::i_scaleaxis", XS_Imager_i_scaleaxis, file, "$$$");
+        (void)newXSproto_portable("Imager::i_scaleaxis_kernel", XS_Imager_i_scaleaxis_kernel, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_scale_kernel", XS_Imager_i_scale_kernel, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_scale_nn", XS_Imager_i_scale_nn, file, "$$$");
+        (void)newXSproto_portable("Imager::i_scale_mixing", XS_Imager_i_scale_mixing, file, "$$$");
+        (void)newXSproto_portable("Imager::i_haar", XS_Imager_i_haar, file, "$");
+        (void)newXSproto_portable("Imager::i_count_colors", XS_Imager_i_count_colors, file, "$$");
+        (void)newXSproto_portable("Imager::i_get_anonymous_color_histo", XS_Imager_i_get_anonymous_color_histo, file, "$;$");
+        (void)newXSproto_portable("Imager::i_transform", XS_Imager_i_transform, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_transform2", XS_Imager_i_transform2, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_contrast", XS_Imager_i_contrast, file, "$$");
+        (void)newXSproto_portable("Imager::i_hardinvert", XS_Imager_i_hardinvert, file, "$");
+        (void)newXSproto_portable("Imager::i_hardinvertall", XS_Imager_i_hardinvertall, file, "$");
+        (void)newXSproto_portable("Imager::i_noise", XS_Imager_i_noise, file, "$$$");
+        (void)newXSproto_portable("Imager::i_bumpmap", XS_Imager_i_bumpmap, file, "$$$$$$");
+        (void)newXSproto_portable("Imager::i_bumpmap_complex", XS_Imager_i_bumpmap_complex, file, "$$$$$$$$$$$$$$");
+        (void)newXSproto_portable("Imager::i_postlevels", XS_Imager_i_postlevels, file, "$$");
+        (void)newXSproto_portable("Imager::i_mosaic", XS_Imager_i_mosaic, file, "$$");
+        (void)newXSproto_portable("Imager::i_watermark", XS_Imager_i_watermark, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_autolevels", XS_Imager_i_autolevels, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_autolevels_mono", XS_Imager_i_autolevels_mono, file, "$$$");
+        (void)newXSproto_portable("Imager::i_radnoise", XS_Imager_i_radnoise, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_turbnoise", XS_Imager_i_turbnoise, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_gradgen", XS_Imager_i_gradgen, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_diff_image", XS_Imager_i_diff_image, file, "$$;$");
+        (void)newXSproto_portable("Imager::i_rgbdiff_image", XS_Imager_i_rgbdiff_image, file, "$$");
+        (void)newXSproto_portable("Imager::i_fountain", XS_Imager_i_fountain, file, "$$$$$$$$$$$");
+        (void)newXSproto_portable("Imager::i_new_fill_fount", XS_Imager_i_new_fill_fount, file, "$$$$$$$$$$");
+        (void)newXSproto_portable("Imager::i_new_fill_opacity", XS_Imager_i_new_fill_opacity, file, "$$");
+        (void)newXSproto_portable("Imager::i_errors", XS_Imager_i_errors, file, "");
+        (void)newXSproto_portable("Imager::i_clear_error", XS_Imager_i_clear_error, file, "");
+        (void)newXSproto_portable("Imager::i_push_error", XS_Imager_i_push_error, file, "$$");
+        (void)newXSproto_portable("Imager::i_nearest_color", XS_Imager_i_nearest_color, file, "$;@");
+        (void)newXSproto_portable("Imager::malloc_state", XS_Imager_malloc_state, file, "");
+        (void)newXSproto_portable("Imager::DSO_open", XS_Imager_DSO_open, file, "$");
+        (void)newXSproto_portable("Imager::DSO_close", XS_Imager_DSO_close, file, "$");
+        (void)newXSproto_portable("Imager::DSO_funclist", XS_Imager_DSO_funclist, file, "$");
+        (void)newXSproto_portable("Imager::DSO_call", XS_Imager_DSO_call, file, "$$$");
+        (void)newXSproto_portable("Imager::i_get_pixel", XS_Imager_i_get_pixel, file, "$$$");
+        (void)newXSproto_portable("Imager::i_ppix", XS_Imager_i_ppix, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_img_pal_new", XS_Imager_i_img_pal_new, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_img_to_pal", XS_Imager_i_img_to_pal, file, "$$");
+        (void)newXSproto_portable("Imager::i_img_to_rgb", XS_Imager_i_img_to_rgb, file, "$");
+        (void)newXSproto_portable("Imager::i_img_make_palette", XS_Imager_i_img_make_palette, file, "$;@");
+        (void)newXSproto_portable("Imager::i_gpal", XS_Imager_i_gpal, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_ppal", XS_Imager_i_ppal, file, "$$$;@");
+        (void)newXSproto_portable("Imager::i_ppal_p", XS_Imager_i_ppal_p, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_addcolors", XS_Imager_i_addcolors, file, "$;@");
+        (void)newXSproto_portable("Imager::i_setcolors", XS_Imager_i_setcolors, file, "$$;@");
+        (void)newXSproto_portable("Imager::i_getcolors", XS_Imager_i_getcolors, file, "$$;$");
+        (void)newXSproto_portable("Imager::i_colorcount", XS_Imager_i_colorcount, file, "$");
+        (void)newXSproto_portable("Imager::i_maxcolors", XS_Imager_i_maxcolors, file, "$");
+        (void)newXSproto_portable("Imager::i_findcolor", XS_Imager_i_findcolor, file, "$$");
+        (void)newXSproto_portable("Imager::i_img_bits", XS_Imager_i_img_bits, file, "$");
+        (void)newXSproto_portable("Imager::i_img_type", XS_Imager_i_img_type, file, "$");
+        (void)newXSproto_portable("Imager::i_img_virtual", XS_Imager_i_img_virtual, file, "$");
+        (void)newXSproto_portable("Imager::i_img_is_tiled", XS_Imager_i_img_is_tiled, file, "$");
+        (void)newXSproto_portable("Imager::i_gsamp", XS_Imager_i_gsamp, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_gsamp_bits", XS_Imager_i_gsamp_bits, file, "$$$$$$$$");
+        (void)newXSproto_portable("Imager::i_psamp_bits", XS_Imager_i_psamp_bits, file, "$$$$$$;$$");
+        (void)newXSproto_portable("Imager::i_psamp", XS_Imager_i_psamp, file, "$$$$$;$$");
+        (void)newXSproto_portable("Imager::i_psampf", XS_Imager_i_psampf, file, "$$$$$;$$");
+        (void)newXSproto_portable("Imager::i_img_masked_new", XS_Imager_i_img_masked_new, file, "$$$$$$");
+        (void)newXSproto_portable("Imager::i_plin", XS_Imager_i_plin, file, "$$$;@");
+        (void)newXSproto_portable("Imager::i_ppixf", XS_Imager_i_ppixf, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_gsampf", XS_Imager_i_gsampf, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_plinf", XS_Imager_i_plinf, file, "$$$;@");
+        (void)newXSproto_portable("Imager::i_gpixf", XS_Imager_i_gpixf, file, "$$$");
+        (void)newXSproto_portable("Imager::i_glin", XS_Imager_i_glin, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_glinf", XS_Imager_i_glinf, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_img_8_new", XS_Imager_i_img_8_new, file, "$$$");
+        (void)newXSproto_portable("Imager::i_img_16_new", XS_Imager_i_img_16_new, file, "$$$");
+        (void)newXSproto_portable("Imager::i_img_to_rgb16", XS_Imager_i_img_to_rgb16, file, "$");
+        (void)newXSproto_portable("Imager::i_img_double_new", XS_Imager_i_img_double_new, file, "$$$");
+        (void)newXSproto_portable("Imager::i_img_tiled_new", XS_Imager_i_img_tiled_new, file, "$$$");
+        (void)newXSproto_portable("Imager::i_img_to_drgb", XS_Imager_i_img_to_drgb, file, "$");
+        (void)newXSproto_portable("Imager::i_tags_addn", XS_Imager_i_tags_addn, file, "$$$$");
+        (void)newXSproto_portable("Imager::i_tags_add", XS_Imager_i_tags_add, file, "$$$$$");
+        (void)newXSproto_portable("Imager::i_tags_find", XS_Imager_i_tags_find, file, "$$$");
+        (void)newXSproto_portable("Imager::i_tags_findn", XS_Imager_i_tags_findn, file, "$$$");
+        (void)newXSproto_portable("Imager::i_tags_delete", XS_Imager_i_tags_delete, file, "$$");
+        (void)newXSproto_portable("Imager::i_tags_delbyname", XS_Imager_i_tags_delbyname, file, "$$");
+        (void)newXSproto_portable("Imager::i_tags_delbycode", XS_Imager_i_tags_delbycode, file, "$$");
+        (void)newXSproto_portable("Imager::i_tags_get", XS_Imager_i_tags_get, file, "$$");
+        (void)newXSproto_portable("Imager::i_tags_get_string", XS_Imager_i_tags_get_string, file, "$$");
+        (void)newXSproto_portable("Imager::i_tags_count", XS_Imager_i_tags_count, file, "$");
+        (void)newXSproto_portable("Imager::FillHandle::DESTROY", XS_Imager__FillHandle_DESTROY, file, "$");
+        (void)newXSproto_portable("Imager::FillHandle::CLONE_SKIP", XS_Imager__FillHandle_CLONE_SKIP, file, ";@");
+        (void)newXSproto_portable("Imager::i_new_fill_solid", XS_Imager_i_new_fill_solid, file, "$$");
+        (void)newXSproto_portable("Imager::i_new_fill_solidf", XS_Imager_i_new_fill_solidf, file, "$$");
+        (void)newXSproto_portable("Imager::i_new_fill_hatch", XS_Imager_i_new_fill_hatch, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_new_fill_hatchf", XS_Imager_i_new_fill_hatchf, file, "$$$$$$$");
+        (void)newXSproto_portable("Imager::i_new_fill_image", XS_Imager_i_new_fill_image, file, "$$$$$");
+        (void)newXSproto_portable("Imager::Internal::Hlines::testing", XS_Imager__Internal__Hlines_testing, file, "");
+#if XSubPPtmpAAAB
+        (void)newXSproto_portable("Imager::Internal::Hlines::new", XS_Imager__Internal__Hlines_new, file, "$$$$");
+        (void)newXSproto_portable("Imager::Internal::Hlines::new_img", XS_Imager__Internal__Hlines_new_img, file, "$");
+        (void)newXSproto_portable("Imager::Internal::Hlines::add", XS_Imager__Internal__Hlines_add, file, "$$$$");
+        (void)newXSproto_portable("Imager::Internal::Hlines::DESTROY", XS_Imager__Internal__Hlines_DESTROY, file, "$");
+        (void)newXSproto_portable("Imager::Internal::Hlines::dump", XS_Imager__Internal__Hlines_dump, file, "$");
+        (void)newXSproto_portable("Imager::Internal::Hlines::CLONE_SKIP", XS_Imager__Internal__Hlines_CLONE_SKIP, file, "$");
+#endif
+        (void)newXSproto_portable("Imager::TrimColorList::_new", XS_Imager__TrimColorList__new, file, "$");
+        (void)newXSproto_portable("Imager::TrimColorList::add_color", XS_Imager__TrimColorList_add_color, file, "$$$");
+        (void)newXSproto_portable("Imager::TrimColorList::add_fcolor", XS_Imager__TrimColorList_add_fcolor, file, "$$$");
+        (void)newXSproto_portable("Imager::TrimColorList::get", XS_Imager__TrimColorList_get, file, "$$");
+        (void)newXSproto_portable("Imager::TrimColorList::count", XS_Imager__TrimColorList_count, file, "$");
+        (void)newXSproto_portable("Imager::Context::DESTROY", XS_Imager__Context_DESTROY, file, "$");
+#if XSubPPtmpAAAC
+        (void)newXSproto_portable("Imager::Context::CLONE", XS_Imager__Context_CLONE, file, ";@");
+#endif
+
+    /* Initialisation Section */
+
+#if XSubPPtmpAAAA
+#endif
+#if XSubPPtmpAAAB
+#endif
+#if XSubPPtmpAAAC
+#endif
+#line 4586 "Imager.xs"
+        PERL_SET_GLOBAL_CALLBACKS;
+	PERL_PL_SET_GLOBAL_CALLBACKS;
+#ifdef PERL_IMPLICIT_CONTEXT
+	{
+          MY_CXT_INIT;
+	  (void)MY_CXT;
+	}
+#endif
+	start_context(aTHX);
+	im_get_context = perl_get_context;
+#ifdef HAVE_LIBTT
+        i_tt_start();
+#endif
+
+#line 17093 "Imager.c"
+
+    /* End of Initialisation Section */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
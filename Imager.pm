@@ -150,7 +150,7 @@ BEGIN {
   if ($ex_version < 5.57) {
     our @ISA = qw(Exporter);
   }
-  $VERSION = '1.034';
+  $VERSION = '1.035';
   require XSLoader;
   XSLoader::load(Imager => $VERSION);
 }
@@ -291,13 +291,19 @@ BEGIN {
     };
   $filters{gaussian} = {
                         callseq => [ 'image', 'stddev' ],
-                        defaults => { },
-                        callsub => sub { my %hsh = @_; i_gaussian($hsh{image}, $hsh{stddev}); },
+                        defaults => { method => 'exact' },
+                        callsub => sub {
+                          my %hsh = @_;
+                          _gaussian_method($hsh{method})->($hsh{image}, $hsh{stddev}, $hsh{stddev});
+                        },
                        };
   $filters{gaussian2} = {
                         callseq => [ 'image', 'stddevX', 'stddevY' ],
-                        defaults => { },
-                        callsub => sub { my %hsh = @_; i_gaussian2($hsh{image}, $hsh{stddevX}, $hsh{stddevY}); },
+                        defaults => { method => 'exact' },
+                        callsub => sub {
+                          my %hsh = @_;
+                          _gaussian_method($hsh{method})->($hsh{image}, $hsh{stddevX}, $hsh{stddevY});
+                        },
                        };
   $filters{mosaic} =
     {
@@ -1047,7 +1053,20 @@ sub img_set {
     }
   }
 
-  if ($hsh{type} eq 'paletted' || $hsh{type} eq 'pseudo') {
+  my $layout = $hsh{layout} || "rows";
+  if ($layout ne "rows" && $layout ne "tiled") {
+    $self->_set_error("new: unknown value for layout '$layout'");
+    return;
+  }
+
+  if ($layout eq "tiled") {
+    unless ($hsh{type} eq 'direct' && $hsh{bits} eq '8') {
+      $self->_set_error("new: the tiled layout is only available for 8-bit direct color images");
+      return;
+    }
+    $self->{IMG} = i_img_tiled_new($hsh{xsize}, $hsh{ysize}, $hsh{channels});
+  }
+  elsif ($hsh{type} eq 'paletted' || $hsh{type} eq 'pseudo') {
     $self->{IMG} = i_img_pal_new($hsh{xsize}, $hsh{ysize}, $hsh{channels},
                                  $hsh{maxcolors} || 256);
   }
@@ -1362,6 +1381,15 @@ sub virtual {
   return i_img_virtual($self->{IMG});
 }
 
+sub layout {
+  my $self = shift;
+
+  $self->_valid_image("layout")
+    or return;
+
+  return i_img_is_tiled($self->{IMG}) ? "tiled" : "rows";
+}
+
 sub is_bilevel {
   my ($self) = @_;
 
@@ -1531,13 +1559,24 @@ sub _get_reader_io {
     return $input->{io}, undef;
   }
   elsif ($input->{fd}) {
-    return io_new_fd($input->{fd});
+    return _reader_fd_io($input->{fd}, $input->{mmap});
   }
   elsif ($input->{fh}) {
     unless (Scalar::Util::openhandle($input->{fh})) {
       $self->_set_error("Handle in fh option not opened");
       return;
     }
+    if ($input->{lazy} && $self->_lazy_input_ok($input)
+        && !tied(*{$input->{fh}})) {
+      # a lazy image can't keep the perl handle, but it can keep a
+      # duplicate of the descriptor, so read the descriptor directly,
+      # the seek discards anything perl buffered
+      my $fd = fileno($input->{fh});
+      if (defined $fd && $fd >= 0
+          && seek($input->{fh}, tell($input->{fh}), 0)) {
+        return io_new_fd($fd);
+      }
+    }
     return Imager::IO->new_fh($input->{fh});
   }
   elsif ($input->{file}) {
@@ -1547,7 +1586,7 @@ sub _get_reader_io {
       return;
     }
     binmode $file;
-    return (io_new_fd(fileno($file)), $file);
+    return (_reader_fd_io(fileno($file), $input->{mmap}), $file);
   }
   elsif ($input->{data}) {
     return io_new_buffer($input->{data});
@@ -1574,6 +1613,19 @@ sub _get_reader_io {
   }
 }
 
+# mapping the file is only an optimization, so quietly fall back to
+# reading through the descriptor if it fails, eg. for a pipe
+sub _reader_fd_io {
+  my ($fd, $mmap) = @_;
+
+  if ($mmap) {
+    my $io = io_new_mmap($fd);
+    $io and return $io;
+  }
+
+  return io_new_fd($fd);
+}
+
 sub _get_writer_io {
   my ($self, $input) = @_;
 
@@ -1660,6 +1712,7 @@ sub read {
     #i_img_destroy($self->{IMG});
     undef($self->{IMG});
   }
+  delete $self->{DEPENDS};
 
   my ($IO, $fh) = $self->_get_reader_io(\%input) or return;
 
@@ -1682,8 +1735,19 @@ sub read {
 
   _reader_autoload($type);
 
+  my $region;
+  if (defined $input{region}) {
+    $region = $self->_read_region($input{region})
+      or return;
+    $input{region} = $region;
+  }
+
   if ($readers{$type} && $readers{$type}{single}) {
-    return $readers{$type}{single}->($self, $IO, %input);
+    my $result = $readers{$type}{single}->($self, $IO, %input)
+      or return;
+    $region && !$readers{$type}{region}
+      and return $self->_crop_to_region($region);
+    return $result;
   }
 
   unless ($formats_low{$type}) {
@@ -1695,13 +1759,24 @@ sub read {
   my $allow_incomplete = $input{allow_incomplete};
   defined $allow_incomplete or $allow_incomplete = 0;
 
+  # lazy images read from $IO as rows are needed, so it needs to be
+  # seekable, the image keeps its own reference to it
+  my $lazy = $input{lazy} && $self->_lazy_input_ok(\%input);
+  my $cache_rows = defined $input{lazy_cache} ? $input{lazy_cache} : 256;
+
   if ( $type eq 'pnm' ) {
-    $self->{IMG}=i_readpnm_wiol( $IO, $allow_incomplete );
+    if ($lazy) {
+      $self->{IMG} = i_readpnm_lazy_wiol( $IO, $allow_incomplete, $cache_rows );
+    }
+    else {
+      $self->{IMG}=i_readpnm_wiol( $IO, $allow_incomplete );
+    }
     if ( !defined($self->{IMG}) ) {
       $self->{ERRSTR}='unable to read pnm image: '._error_as_msg(); 
       return undef;
     }
     $self->{DEBUG} && print "loading a pnm file\n";
+    $region and return $self->_crop_to_region($region);
     return $self;
   }
 
@@ -1738,12 +1813,23 @@ sub read {
     my $data_ch = _first($input{raw_datachannels}, $input{datachannels}, 3);
     my $store_ch = _first($input{raw_storechannels}, $input{storechannels}, 3);
 
-    $self->{IMG} = i_readraw_wiol( $IO,
-				   $input{xsize},
-				   $input{ysize},
-				   $data_ch,
-				   $store_ch,
-				   $interleave);
+    if ($lazy) {
+      $self->{IMG} = i_readraw_lazy_wiol( $IO,
+					  $input{xsize},
+					  $input{ysize},
+					  $data_ch,
+					  $store_ch,
+					  $interleave,
+					  $cache_rows);
+    }
+    else {
+      $self->{IMG} = i_readraw_wiol( $IO,
+				     $input{xsize},
+				     $input{ysize},
+				     $data_ch,
+				     $store_ch,
+				     $interleave);
+    }
     if ( !defined($self->{IMG}) ) {
       $self->{ERRSTR}=$self->_error_as_msg();
       return undef;
@@ -1751,6 +1837,68 @@ sub read {
     $self->{DEBUG} && print "loading a raw file\n";
   }
 
+  $region and return $self->_crop_to_region($region);
+
+  return $self;
+}
+
+# can the source for read() be re-read for a lazy image, pipes and
+# sockets can't be
+sub _lazy_input_ok {
+  my ($self, $input) = @_;
+
+  $input->{io} || $input->{file} || $input->{data}
+    and return 1;
+  $input->{fh} && -f $input->{fh}
+    and return 1;
+
+  return 0;
+}
+
+# validate the region parameter to read()
+sub _read_region {
+  my ($self, $region) = @_;
+
+  unless (ref $region && Scalar::Util::reftype($region) eq "ARRAY"
+	  && @$region == 4
+	  && !grep { !defined || !/^\s*[+-]?\d+\s*$/ } @$region) {
+    $self->_set_error("region must be an array reference of 4 integers: left, top, right, bottom");
+    return;
+  }
+  my ($l, $t, $r, $b) = map 0+$_, @$region;
+  if ($r <= $l || $b <= $t) {
+    $self->_set_error("region must have right > left and bottom > top");
+    return;
+  }
+
+  return [ $l, $t, $r, $b ];
+}
+
+# for readers that can't read just a region themselves, crop the
+# image read, keeping its tags
+sub _crop_to_region {
+  my ($self, $region) = @_;
+
+  my ($l, $t, $r, $b) = @$region;
+  $l < 0 and $l = 0;
+  $t < 0 and $t = 0;
+  $r > $self->getwidth and $r = $self->getwidth;
+  $b > $self->getheight and $b = $self->getheight;
+  if ($l >= $r || $t >= $b) {
+    $self->_set_error("region is outside the image");
+    undef $self->{IMG};
+    return;
+  }
+  $l == 0 && $t == 0 && $r == $self->getwidth && $b == $self->getheight
+    and return $self;
+
+  my $crop = $self->crop(left => $l, top => $t, right => $r, bottom => $b)
+    or return;
+  for my $tag ($self->tags) {
+    $crop->addtag(name => $tag->[0], value => $tag->[1]);
+  }
+  $self->{IMG} = $crop->{IMG};
+
   return $self;
 }
 
@@ -1772,6 +1920,10 @@ sub register_reader {
   if ($opts{multiple}) {
     $readers{$type}{multiple} = $opts{multiple};
   }
+  if ($opts{iter}) {
+    $readers{$type}{iter} = $opts{iter};
+  }
+  $readers{$type}{region} = $opts{region};
 
   return 1;
 }
@@ -1794,6 +1946,9 @@ sub register_writer {
   if ($opts{multiple}) {
     $writers{$type}{multiple} = $opts{multiple};
   }
+  if ($opts{stream}) {
+    $writers{$type}{stream} = $opts{stream};
+  }
 
   return 1;
 }
@@ -2103,6 +2258,62 @@ sub write {
   return $self;
 }
 
+sub write_stream {
+  my ($class, %opts) = @_;
+
+  my $type = $opts{type};
+  if (!$type && $opts{file}) {
+    $type = $FORMATGUESS->($opts{file});
+  }
+  unless ($type) {
+    $class->_set_error('type parameter missing and not possible to guess from extension');
+    return;
+  }
+
+  my $channels = defined $opts{channels} ? $opts{channels} : 3;
+  for my $name (qw(xsize ysize)) {
+    unless (defined $opts{$name} && $opts{$name} =~ /^[1-9][0-9]*$/) {
+      $class->_set_error("write_stream: $name must be a positive integer");
+      return;
+    }
+  }
+  unless ($channels =~ /^[1-4]$/) {
+    $class->_set_error("write_stream: channels must be from 1 to 4");
+    return;
+  }
+
+  _writer_autoload($type);
+
+  unless ($writers{$type} && $writers{$type}{stream}) {
+    $class->_set_error("format '$type' doesn't support write_stream()");
+    return;
+  }
+
+  # carries the tags for the file
+  my $tags = Imager->new(xsize => 1, ysize => 1, channels => $channels);
+  $tags->_set_opts(\%opts, "i_", $tags)
+    or return;
+
+  my ($IO, $fh) = $class->_get_writer_io(\%opts)
+    or return;
+
+  my $writer = $writers{$type}{stream}->($tags, $IO, %opts,
+					 type => $type, channels => $channels)
+    or return;
+
+  return bless
+    {
+     WRITER => $writer,
+     IO => $IO,
+     FH => $fh,
+     DATA => $opts{data},
+     XSIZE => $opts{xsize},
+     YSIZE => $opts{ysize},
+     CHANNELS => $channels,
+     ROWS => 0,
+    }, "Imager::WriteStream";
+}
+
 sub write_multi {
   my ($class, $opts, @images) = @_;
 
@@ -2179,31 +2390,42 @@ sub write_multi {
 }
 
 # read multiple images from a file
-sub read_multi {
-  my ($class, %opts) = @_;
+# find the io object and file type for read_multi() and read_multi_iter()
+sub _multi_reader_type {
+  my ($class, $opts) = @_;
 
-  my ($IO, $file) = $class->_get_reader_io(\%opts, $opts{'type'})
+  my ($IO, $file) = $class->_get_reader_io($opts, $opts->{'type'})
     or return;
 
-  my $type = $opts{'type'};
+  my $type = $opts->{'type'};
   unless ($type) {
     $type = _test_format($IO);
   }
 
-  if ($opts{file} && !$type) {
+  if ($opts->{file} && !$type) {
     # guess the type 
-    $type = $FORMATGUESS->($opts{file});
+    $type = $FORMATGUESS->($opts->{file});
   }
 
   unless ($type) {
     my $msg = "type parameter missing and it couldn't be determined from the file contents";
-    $opts{file} and $msg .= " or file name";
+    $opts->{file} and $msg .= " or file name";
     Imager->_set_error($msg);
     return;
   }
 
   _reader_autoload($type);
 
+  # $file keeps any file handle we opened alive
+  return ($IO, $type, $file);
+}
+
+sub read_multi {
+  my ($class, %opts) = @_;
+
+  my ($IO, $type, $file) = $class->_multi_reader_type(\%opts)
+    or return;
+
   if ($readers{$type} && $readers{$type}{multiple}) {
     return $readers{$type}{multiple}->($IO, %opts);
   }
@@ -2236,6 +2458,27 @@ sub read_multi {
       } @imgs;
 }
 
+sub read_multi_iter {
+  my ($class, %opts) = @_;
+
+  my ($IO, $type, $file) = $class->_multi_reader_type(\%opts)
+    or return;
+
+  if ($readers{$type} && $readers{$type}{iter}) {
+    my $iter = $readers{$type}{iter}->($IO, %opts)
+      or return;
+
+    # the file we opened has to stay open until the reader is done
+    return bless { ITER => $iter, FILE => $file }, "Imager::ReadIter";
+  }
+
+  # no streaming reader, read them all and hand them out one at a time
+  my @imgs = $class->read_multi(%opts, io => $IO, type => $type)
+    or return;
+
+  return bless { IMAGES => \@imgs }, "Imager::ReadIter";
+}
+
 # Destroy an Imager object
 
 sub DESTROY {
@@ -2314,6 +2557,26 @@ sub filter {
   return $self;
 }
 
+my %gaussian_methods =
+  (
+   exact => \&i_gaussian2,
+   box => sub {
+     my ($im, $stddevX, $stddevY) = @_;
+     i_gaussian_box($im, $stddevX, $stddevY)
+       or die Imager->_error_as_msg() . "\n";
+   },
+  );
+
+# select the implementation for the gaussian filters
+sub _gaussian_method {
+  my ($method) = @_;
+
+  my $code = $gaussian_methods{$method}
+    or die "gaussian: unknown method '$method'\n";
+
+  return $code;
+}
+
 sub register_filter {
   my $class = shift;
   my %hsh = ( defaults => {}, @_ );
@@ -2429,7 +2692,6 @@ sub scale {
   my $self=shift;
   my %opts = (qtype=>'normal' ,@_);
   my $img = Imager->new();
-  my $tmp = Imager->new();
 
   unless (defined wantarray) {
     my @caller = caller;
@@ -2445,12 +2707,8 @@ sub scale {
       or return;
 
   if ($opts{qtype} eq 'normal') {
-    $tmp->{IMG} = i_scaleaxis($self->{IMG}, $x_scale, 0);
-    if ( !defined($tmp->{IMG}) ) { 
-      $self->{ERRSTR} = 'unable to scale image: ' . $self->_error_as_msg;
-      return undef;
-    }
-    $img->{IMG}=i_scaleaxis($tmp->{IMG}, $y_scale, 1);
+    $img->{IMG} = i_scale_kernel($self->{IMG}, $x_scale, $y_scale,
+				 $opts{kernel} || "default");
     if ( !defined($img->{IMG}) ) { 
       $self->{ERRSTR}='unable to scale image: ' . $self->_error_as_msg; 
       return undef;
@@ -2508,10 +2766,11 @@ sub scaleX {
     return undef;
   }
 
-  $img->{IMG} = i_scaleaxis($self->{IMG}, $scalefactor, 0);
+  $img->{IMG} = i_scaleaxis_kernel($self->{IMG}, $scalefactor, 0,
+				   $opts{kernel} || "default");
 
   if ( !defined($img->{IMG}) ) { 
-    $self->{ERRSTR} = 'unable to scale image'; 
+    $self->{ERRSTR} = 'unable to scale image: ' . $self->_error_as_msg;
     return undef;
   }
 
@@ -2545,10 +2804,11 @@ sub scaleY {
     $self->{ERRSTR} = 'empty input image'; 
     return undef;
   }
-  $img->{IMG}=i_scaleaxis($self->{IMG}, $scalefactor, 1);
+  $img->{IMG}=i_scaleaxis_kernel($self->{IMG}, $scalefactor, 1,
+				 $opts{kernel} || "default");
 
   if ( !defined($img->{IMG}) ) {
-    $self->{ERRSTR} = 'unable to scale image';
+    $self->{ERRSTR} = 'unable to scale image: ' . $self->_error_as_msg;
     return undef;
   }
 
@@ -4342,6 +4602,21 @@ sub get_file_limits {
   i_get_image_file_limits();
 }
 
+sub set_threads {
+  my ($class, $threads) = @_;
+
+  unless (i_set_threads($threads)) {
+    Imager->_set_error(Imager->_error_as_msg);
+    return;
+  }
+
+  return 1;
+}
+
+sub get_threads {
+  i_get_threads();
+}
+
 my @check_args = qw(width height channels sample_size);
 
 sub check_file_limits {
@@ -4616,6 +4891,101 @@ sub new_fh {
   }
 }
 
+# returned by read_multi_iter(), either wraps the iterator from the
+# format's iter reader or hands out the images read by read_multi()
+package Imager::ReadIter;
+
+sub next {
+  my ($self) = @_;
+
+  $self->{ITER}
+    and return $self->{ITER}->next;
+
+  Imager->_set_error(undef);
+
+  @{$self->{IMAGES}}
+    or return;
+
+  return shift @{$self->{IMAGES}};
+}
+
+# returned by write_stream()
+package Imager::WriteStream;
+
+sub write_rows {
+  my ($self, $img) = @_;
+
+  unless ($img && $img->_valid_image("write_rows")) {
+    Imager->_set_error("write_rows: no image supplied");
+    return;
+  }
+  unless ($img->getwidth == $self->{XSIZE}
+	  && $img->getchannels == $self->{CHANNELS}) {
+    Imager->_set_error("write_rows: image must be $self->{XSIZE} pixels wide with $self->{CHANNELS} channels");
+    return;
+  }
+
+  # pass the rows to the writer in batches
+  my $height = $img->getheight;
+  my $y = 0;
+  while ($y < $height) {
+    my $end = $y + 64;
+    $end > $height and $end = $height;
+    my $data = "";
+    for my $row ($y .. $end - 1) {
+      $data .= Imager::i_gsamp($img->{IMG}, 0, $self->{XSIZE}, $row, undef);
+    }
+    $self->write_samples($data)
+      or return;
+    $y = $end;
+  }
+
+  return 1;
+}
+
+sub write_samples {
+  my ($self, $data) = @_;
+
+  unless ($self->{WRITER}->write($data)) {
+    Imager->_set_error(Imager->_error_as_msg);
+    return;
+  }
+  $self->{ROWS} += length($data) / ($self->{XSIZE} * $self->{CHANNELS});
+
+  return 1;
+}
+
+sub rows_written {
+  $_[0]{ROWS};
+}
+
+sub DESTROY {
+  my ($self) = @_;
+
+  # an unclosed writer finishes the file as it's destroyed, so release
+  # it before the I/O layer and handle it writes to
+  delete $self->{WRITER};
+}
+
+sub close {
+  my ($self) = @_;
+
+  unless ($self->{WRITER}->close) {
+    Imager->_set_error(Imager->_error_as_msg);
+    return;
+  }
+  if ($self->{DATA}) {
+    my $data = Imager::io_slurp($self->{IO});
+    unless ($data) {
+      Imager->_set_error("Could not slurp from buffer");
+      return;
+    }
+    ${$self->{DATA}} = $data;
+  }
+
+  return 1;
+}
+
 # backward compatibility for %formats
 package Imager::FORMATS;
 use strict;
@@ -5035,6 +5405,8 @@ getcolorusagehash() - L<Imager::ImageTypes/getcolorusagehash()>
 
 get_file_limits() - L<Imager::Files/get_file_limits()>
 
+get_threads() - L<Imager::Threads/get_threads()>
+
 getheight() - L<Imager::ImageTypes/getheight()> - height of the image in
 pixels
 
@@ -5064,6 +5436,9 @@ and white, no gray levels) format
 is_logging() - L<Imager::ImageTypes/is_logging()> - test if the debug
 log is active.
 
+layout() - L<Imager::ImageTypes/layout()> - whether the image is
+stored as rows or tiles.
+
 line() - L<Imager::Draw/line()> - draw an interval
 
 load_plugin() - L<Imager::Filters/load_plugin()>
@@ -5122,6 +5497,9 @@ read() - L<Imager::Files/read()> - read a single image from an image file
 read_multi() - L<Imager::Files/read_multi()> - read multiple images from an image
 file
 
+read_multi_iter() - L<Imager::Files/read_multi_iter()> - read images
+from an image file one at a time
+
 read_types() - L<Imager::Files/read_types()> - list image types Imager
 can read.
 
@@ -5152,6 +5530,9 @@ in a paletted image
 
 set_file_limits() - L<Imager::Files/set_file_limits()>
 
+set_threads() - L<Imager::Threads/set_threads()> - set the number of
+worker threads used by filters and transformations
+
 setmask() - L<Imager::ImageTypes/setmask()>
 
 setpixel() - L<Imager::Draw/setpixel()>
@@ -5197,6 +5578,9 @@ write() - L<Imager::Files/write()> - write an image to a file
 write_multi() - L<Imager::Files/write_multi()> - write multiple image to an image
 file.
 
+write_stream() - L<Imager::Files/write_stream()> - write an image to a
+file a band of rows at a time
+
 write_types() - L<Imager::Files/read_types()> - list image types Imager
 can write.
 
@@ -5349,7 +5733,7 @@ size, text - L<Imager::Font/bounding_box()>
 tags, image metadata - L<Imager::ImageTypes/"Tags">
 
 text, drawing - L<Imager::Draw/string()>, L<Imager::Draw/align_string()>,
-L<Imager::Font::Wrap>
+L<Imager::Font::Wrap>, L<Imager::Font/draw_many()>
 
 text, wrapping text in an area - L<Imager::Font::Wrap>
 
@@ -633,6 +633,8 @@ static struct value_name translate_names[] =
   { "closest", pt_closest, },
   { "perturb", pt_perturb, },
   { "errdiff", pt_errdiff, },
+  { "ordered", pt_ordered, },
+  { "bluenoise", pt_bluenoise, },
 };
 
 static struct value_name errdiff_names[] =
@@ -1502,6 +1504,17 @@ Imager::IO
 io_new_fd(fd)
                          int     fd
 
+Imager::IO
+io_new_mmap(fd)
+	int fd
+      CODE:
+	i_clear_error();
+	RETVAL = io_new_mmap(fd);
+	if (!RETVAL)
+	  XSRETURN(0);
+      OUTPUT:
+        RETVAL
+
 Imager::IO
 io_new_bufchain()
 
@@ -1562,6 +1575,13 @@ i_get_image_file_limits()
           PUSHs(sv_2mortal(newSVuv(bytes)));
         }
 
+undef_int
+i_set_threads(threads)
+	int threads
+
+int
+i_get_threads()
+
 bool
 i_int_check_image_file_limits(width, height, channels, sample_size)
 	i_img_dim width
@@ -1593,6 +1613,17 @@ io_new_fd(class, fd)
     OUTPUT:
 	RETVAL
 
+Imager::IO
+io_new_mmap(class, fd)
+	int fd
+    CODE:
+	i_clear_error();
+	RETVAL = io_new_mmap(fd);
+	if (!RETVAL)
+	  XSRETURN(0);
+    OUTPUT:
+	RETVAL
+
 Imager::IO
 io_new_buffer(class, data_sv)
 	SV *data_sv
@@ -2496,6 +2527,12 @@ i_gaussian2(im,stddevX,stddevY)
 	    im_double     stddevX
 	    im_double     stddevY
 
+undef_int
+i_gaussian_box(im,stddevX,stddevY)
+    Imager::ImgRaw     im
+	    im_double     stddevX
+	    im_double     stddevY
+
 void
 i_unsharp_mask(im,stdev,scale)
     Imager::ImgRaw     im
@@ -2887,6 +2924,12 @@ i_readpnm_wiol(ig, allow_incomplete)
         Imager::IO     ig
 	       int     allow_incomplete
 
+Imager::ImgRaw
+i_readpnm_lazy_wiol(ig, allow_incomplete, cache_rows)
+        Imager::IO     ig
+	       int     allow_incomplete
+	 i_img_dim     cache_rows
+
 
 void
 i_readpnm_multi_wiol(ig, allow_incomplete)
@@ -2926,6 +2969,16 @@ i_readraw_wiol(ig,x,y,datachannels,storechannels,intrl)
 	       int     storechannels
 	       int     intrl
 
+Imager::ImgRaw
+i_readraw_lazy_wiol(ig,x,y,datachannels,storechannels,intrl,cache_rows)
+        Imager::IO     ig
+	       i_img_dim     x
+	       i_img_dim     y
+	       int     datachannels
+	       int     storechannels
+	       int     intrl
+	 i_img_dim     cache_rows
+
 undef_int
 i_writeraw_wiol(im,ig)
     Imager::ImgRaw     im
@@ -2972,6 +3025,20 @@ i_scaleaxis(im,Value,Axis)
              im_double     Value
 	       int     Axis
 
+Imager::ImgRaw
+i_scaleaxis_kernel(im,Value,Axis,kernel)
+    Imager::ImgRaw     im
+             im_double     Value
+	       int     Axis
+        const char *   kernel
+
+Imager::ImgRaw
+i_scale_kernel(im,x_scale,y_scale,kernel)
+    Imager::ImgRaw     im
+             im_double     x_scale
+             im_double     y_scale
+        const char *   kernel
+
 Imager::ImgRaw
 i_scale_nn(im,scx,scy)
     Imager::ImgRaw     im
@@ -3717,6 +3784,10 @@ int
 i_img_virtual(im)
         Imager::ImgRaw  im
 
+int
+i_img_is_tiled(im)
+        Imager::ImgRaw  im
+
 void
 i_gsamp(im, l, r, y, channels)
         Imager::ImgRaw im
@@ -4148,6 +4219,12 @@ i_img_double_new(xsize, ysize, channels)
         i_img_dim ysize
         int channels
 
+Imager::ImgRaw
+i_img_tiled_new(xsize, ysize, channels)
+        i_img_dim xsize
+        i_img_dim ysize
+        int channels
+
 Imager::ImgRaw
 i_img_to_drgb(im)
        Imager::ImgRaw im
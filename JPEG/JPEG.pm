@@ -4,7 +4,7 @@ use strict;
 use Imager;
 
 BEGIN {
-  our $VERSION = "1.005";
+  our $VERSION = "1.006";
 
   require XSLoader;
   XSLoader::load('Imager::File::JPEG', $VERSION);
@@ -17,7 +17,35 @@ Imager->register_reader
    sub { 
      my ($im, $io, %hsh) = @_;
 
-     ($im->{IMG},$im->{IPTCRAW}) = i_readjpeg_wiol( $io );
+     my $scale_denom = 1;
+     if (defined $hsh{jpeg_scale}) {
+       my $scale = $hsh{jpeg_scale};
+       unless ($scale =~ /^\s*(?:\d+\.?\d*|\.\d+)(?:[eE][+-]?\d+)?\s*$/
+	       && $scale > 0 && $scale <= 1) {
+	 $im->_set_error("jpeg_scale must be a number greater than 0 and no more than 1");
+	 return;
+       }
+       # never decode smaller than requested
+       $scale_denom *= 2 while $scale_denom < 8 && 1 / ($scale_denom * 2) >= $scale;
+     }
+     my @max;
+     for my $name (qw(jpeg_max_width jpeg_max_height)) {
+       my $max = $hsh{$name};
+       if (defined $max) {
+	 unless ($max =~ /^\s*\d+\s*$/ && $max > 0) {
+	   $im->_set_error("$name must be a positive integer");
+	   return;
+	 }
+       }
+       push @max, $max || 0;
+     }
+     if (!defined $hsh{jpeg_scale} && ($max[0] || $max[1])) {
+       # limited only by the size hints
+       $scale_denom = 8;
+     }
+
+     ($im->{IMG},$im->{IPTCRAW}) =
+       i_readjpeg_wiol( $io, $scale_denom, @max, $hsh{region} ? @{$hsh{region}} : () );
 
      unless ($im->{IMG}) {
        $im->_set_error(Imager->_error_as_msg);
@@ -25,6 +53,7 @@ Imager->register_reader
      }
      return $im;
    },
+   region => 1,
   );
 
 Imager->register_writer
@@ -48,6 +77,24 @@ Imager->register_writer
 
      return $im;
    },
+   stream =>
+   sub {
+     my ($im, $io, %hsh) = @_;
+
+     $im->_set_opts(\%hsh, "jpeg_", $im);
+     $im->_set_opts(\%hsh, "exif_", $im);
+
+     my $quality = $hsh{jpegquality};
+     defined $quality or $quality = 75;
+
+     my $w = i_writejpeg_stream_new($io, $hsh{xsize}, $hsh{ysize},
+				    $im->getchannels, $im->{IMG}, $quality);
+     unless ($w) {
+       Imager->_set_error(Imager->_error_as_msg);
+       return;
+     }
+     return $w;
+   },
   );
 
 
@@ -27,18 +27,44 @@ i_writejpeg_wiol(im, ig, qfactor)
         Imager::IO     ig
 	       int     qfactor
 
+Imager::File::JPEG::Writer
+i_writejpeg_stream_new(ig, xsize, ysize, channels, im, qfactor)
+        Imager::IO     ig
+        i_img_dim      xsize
+        i_img_dim      ysize
+        int            channels
+        Imager::ImgRaw im
+        int            qfactor
+      C_ARGS:
+        ig, xsize, ysize, channels, &im->tags, qfactor
+
 
 void
-i_readjpeg_wiol(ig)
+i_readjpeg_wiol(ig, scale_denom = 1, max_width = 0, max_height = 0, left = 0, top = 0, right = 0, bottom = 0)
         Imager::IO     ig
+        int scale_denom
+        i_img_dim max_width
+        i_img_dim max_height
+        i_img_dim left
+        i_img_dim top
+        i_img_dim right
+        i_img_dim bottom
 	     PREINIT:
 	      char*    iptc_itext;
 	       int     tlength;
 	     i_img*    rimg;
                 SV*    r;
+          i_img_dim    region[4];
 	     PPCODE:
+              /* an empty region means the whole image */
+              region[0] = left;
+              region[1] = top;
+              region[2] = right;
+              region[3] = bottom;
  	      iptc_itext = NULL;
-	      rimg = i_readjpeg_wiol(ig,-1,&iptc_itext,&tlength);
+	      rimg = i_readjpeg_wiol_scaled(ig,-1,&iptc_itext,&tlength,scale_denom,
+                                            max_width,max_height,
+                                            right > left ? region : NULL);
 	      if (iptc_itext == NULL) {
 		    r = sv_newmortal();
 	            EXTEND(SP,1);
@@ -69,6 +95,38 @@ bool
 has_decode_arith_coding(cls)
   C_ARGS:
 
+MODULE = Imager::File::JPEG  PACKAGE = Imager::File::JPEG::Writer PREFIX=i_writejpeg_stream_
+
+#define i_writejpeg_stream_DESTROY(w) i_writejpeg_stream_destroy(w)
+
+undef_int
+i_writejpeg_stream_write(w, data)
+        Imager::File::JPEG::Writer w
+        SV *data
+      PREINIT:
+        const char *p;
+        STRLEN len;
+      CODE:
+        p = SvPVbyte(data, len);
+        RETVAL = i_writejpeg_stream_write(w, (const i_sample_t *)p, len);
+      OUTPUT:
+        RETVAL
+
+undef_int
+i_writejpeg_stream_close(w)
+        Imager::File::JPEG::Writer w
+
+void
+i_writejpeg_stream_DESTROY(w)
+        Imager::File::JPEG::Writer w
+
+int
+i_writejpeg_stream_CLONE_SKIP(...)
+    CODE:
+        (void)items;
+        RETVAL = 1;
+    OUTPUT:
+        RETVAL
 
 BOOT:
     PERL_INITIALIZE_IMAGER_CALLBACKS_NAME("Imager::File::JPEG");
@@ -10,6 +10,15 @@ jpeg.c - implement saving and loading JPEG images
     .. error ..
   }
   im = i_readjpeg_wiol(ig, length, iptc_text, itlength);
+  im = i_readjpeg_wiol_scaled(ig, length, iptc_text, itlength,
+                              scale_denom, max_width, max_height, region);
+
+  i_jpeg_writer *w = i_writejpeg_stream_new(ig, xsize, ysize, channels,
+                                            &tags, quality);
+  while (more rows)
+    i_writejpeg_stream_write(w, samples, sample_count);
+  i_writejpeg_stream_close(w);
+  i_writejpeg_stream_destroy(w);
 
 =head1 DESCRIPTION
 
@@ -51,6 +60,12 @@ static unsigned char fake_eoi[]={(JOCTET) 0xFF,(JOCTET) JPEG_EOI};
 #define IS_MOZJPEG
 #endif
 
+/* jpeg_crop_scanline() and jpeg_skip_scanlines() were added in
+   libjpeg-turbo 1.5 */
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && LIBJPEG_TURBO_VERSION_NUMBER >= 1005000
+#define IMJPEG_HAVE_CROP
+#endif
+
 /* Source and Destination managers */
 
 typedef struct {
@@ -400,10 +415,50 @@ has_decode_arith_coding(void) {
 /*
 =item i_readjpeg_wiol(data, length, iptc_itext, itlength)
 
+Read a JPEG image at full size.
+
 =cut
 */
 i_img*
 i_readjpeg_wiol(io_glue *data, int length, char** iptc_itext, int *itlength) {
+  return i_readjpeg_wiol_scaled(data, length, iptc_itext, itlength, 1, 0, 0,
+				NULL);
+}
+
+/*
+=item i_readjpeg_wiol_scaled(data, length, iptc_itext, itlength, scale_denom, max_width, max_height, region)
+
+Read a JPEG image, letting libjpeg scale it down by 1/2, 1/4 or 1/8
+while decoding, which is much cheaper than decoding the full image
+and scaling it afterwards.
+
+scale_denom is the largest reduction permitted, one of 1, 2, 4 or 8.
+
+If max_width or max_height is non-zero, the reduction is limited so
+that the decoded image is still large enough to be scaled to fit
+within max_width x max_height, so the caller only needs to do the
+final scaling step.
+
+The reduction used is stored in the C<jpeg_scale_denom> tag and the
+original image size in C<jpeg_original_width> and
+C<jpeg_original_height>.
+
+If region is non-NULL only the part of the image within region[0]
+(left), region[1] (top), region[2] (right), region[3] (bottom) is
+returned, clipped to the image.  The region is in the co-ordinates of
+the image in the file, and is scaled with the image, max_width and
+max_height then apply to the region.  With
+libjpeg-turbo the rows above the region are skipped and only the
+iMCU columns covering the region are decoded, otherwise rows and
+columns outside the region are decoded and discarded.  Decoding
+stops after the last row of the region either way.
+
+=cut
+*/
+i_img*
+i_readjpeg_wiol_scaled(io_glue *data, int length, char** iptc_itext,
+                       int *itlength, int scale_denom, i_img_dim max_width,
+                       i_img_dim max_height, const i_img_dim *region) {
   i_img * volatile im = NULL;
   int seen_exif;
   i_color * volatile line_buffer = NULL;
@@ -415,11 +470,27 @@ i_readjpeg_wiol(io_glue *data, int length, char** iptc_itext, int *itlength) {
   transfer_function_t transfer_f;
   int channels;
   volatile int src_set = 0;
+  volatile int denom;
+  i_img_dim left, top, right, bottom;
+  i_img_dim out_width, out_height;
+  i_img_dim skip;
+  JDIMENSION y;
 
-  mm_log((1,"i_readjpeg_wiol(data %p, length %d,iptc_itext %p)\n", data, length, iptc_itext));
+  mm_log((1,"i_readjpeg_wiol_scaled(data %p, length %d,iptc_itext %p, scale_denom %d, max " i_DFp ")\n", data, length, iptc_itext, scale_denom, i_DFcp(max_width, max_height)));
 
   i_clear_error();
 
+  if (scale_denom != 1 && scale_denom != 2 && scale_denom != 4
+      && scale_denom != 8) {
+    i_push_errorf(0, "scale_denom must be 1, 2, 4 or 8 (%d)", scale_denom);
+    return NULL;
+  }
+  if (max_width < 0 || max_height < 0) {
+    i_push_error(0, "max_width and max_height must not be negative");
+    return NULL;
+  }
+
+  denom = scale_denom;
   *iptc_itext = NULL;
   *itlength = 0;
 
@@ -447,8 +518,50 @@ i_readjpeg_wiol(io_glue *data, int length, char** iptc_itext, int *itlength) {
   src_set = 1;
 
   (void) jpeg_read_header(&cinfo, TRUE);
+
+  left = 0;
+  top = 0;
+  right = cinfo.image_width;
+  bottom = cinfo.image_height;
+  if (region) {
+    if (region[0] > left) left = region[0];
+    if (region[1] > top) top = region[1];
+    if (region[2] < right) right = region[2];
+    if (region[3] < bottom) bottom = region[3];
+    if (left >= right || top >= bottom) {
+      i_push_error(0, "region is outside the image");
+      wiol_term_source(&cinfo);
+      jpeg_destroy_decompress(&cinfo);
+      return NULL;
+    }
+  }
+
+  /* the decoded image (or region) needs to be at least the size of
+     it scaled to fit within max_width x max_height, that's satisfied
+     if either dimension is at least as large as its limit */
+  if (max_width || max_height) {
+    while (denom > 1
+	   && !(max_width && right - left >= max_width * denom)
+	   && !(max_height && bottom - top >= max_height * denom))
+      denom /= 2;
+  }
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = denom;
+
   (void) jpeg_start_decompress(&cinfo);
 
+  /* scale the region to the output image, rounding outwards */
+  left /= denom;
+  top /= denom;
+  right = (right + denom - 1) / denom;
+  bottom = (bottom + denom - 1) / denom;
+  if (right > (i_img_dim)cinfo.output_width)
+    right = cinfo.output_width;
+  if (bottom > (i_img_dim)cinfo.output_height)
+    bottom = cinfo.output_height;
+  out_width = right - left;
+  out_height = bottom - top;
+
   channels = cinfo.output_components;
   switch (cinfo.out_color_space) {
   case JCS_GRAYSCALE:
@@ -500,7 +613,7 @@ i_readjpeg_wiol(io_glue *data, int length, char** iptc_itext, int *itlength) {
     return NULL;
   }
 
-  if (!i_int_check_image_file_limits(cinfo.output_width, cinfo.output_height,
+  if (!i_int_check_image_file_limits(out_width, out_height,
 				     channels, sizeof(i_sample_t))) {
     mm_log((1, "i_readjpeg: image size exceeds limits\n"));
     wiol_term_source(&cinfo);
@@ -508,19 +621,42 @@ i_readjpeg_wiol(io_glue *data, int length, char** iptc_itext, int *itlength) {
     return NULL;
   }
 
-  im = i_img_8_new(cinfo.output_width, cinfo.output_height, channels);
+  im = i_img_8_new(out_width, out_height, channels);
   if (!im) {
     wiol_term_source(&cinfo);
     jpeg_destroy_decompress(&cinfo);
     return NULL;
   }
+
+  skip = left;
+#ifdef IMJPEG_HAVE_CROP
+  if (out_width < (i_img_dim)cinfo.output_width) {
+    /* Chroma is upsampled against edge replication at the edges of
+       the cropped columns, so decode an extra iMCU each side of the
+       region to give its edge columns their real neighbours.  This
+       may widen the decoded columns further to an iMCU boundary */
+    JDIMENSION imcu = cinfo.max_h_samp_factor * DCTSIZE / denom;
+    JDIMENSION xoffset = left > (i_img_dim)imcu ? left - imcu : 0;
+    JDIMENSION crop_width = right + imcu - xoffset;
+    if (crop_width > cinfo.output_width - xoffset)
+      crop_width = cinfo.output_width - xoffset;
+    jpeg_crop_scanline(&cinfo, &xoffset, &crop_width);
+    skip = left - xoffset;
+  }
+  if (top > 0)
+    (void) jpeg_skip_scanlines(&cinfo, top);
+#endif
+
   row_stride = cinfo.output_width * cinfo.output_components;
   buffer = (*cinfo.mem->alloc_sarray) ((j_common_ptr) &cinfo, JPOOL_IMAGE, row_stride, 1);
-  line_buffer = mymalloc(sizeof(i_color) * cinfo.output_width);
-  while (cinfo.output_scanline < cinfo.output_height) {
+  line_buffer = mymalloc(sizeof(i_color) * out_width);
+  while ((y = cinfo.output_scanline) < (JDIMENSION)bottom) {
     (void) jpeg_read_scanlines(&cinfo, buffer, 1);
-    transfer_f(line_buffer, buffer, cinfo.output_width);
-    i_plin(im, 0, cinfo.output_width, cinfo.output_scanline-1, line_buffer);
+    if (y >= (JDIMENSION)top) {
+      JSAMPROW row = buffer[0] + skip * cinfo.output_components;
+      transfer_f(line_buffer, &row, out_width);
+      i_plin(im, 0, out_width, y - top, line_buffer);
+    }
   }
   myfree(line_buffer);
   line_buffer = NULL;
@@ -577,10 +713,19 @@ i_readjpeg_wiol(io_glue *data, int length, char** iptc_itext, int *itlength) {
       yres *= 2.54;
       break;
     }
+    if (cinfo.density_unit) {
+      /* the physical size of the image hasn't changed */
+      xres = xres * cinfo.output_width / cinfo.image_width;
+      yres = yres * cinfo.output_height / cinfo.image_height;
+    }
     i_tags_set_float2(&im->tags, "i_xres", 0, xres, 6);
     i_tags_set_float2(&im->tags, "i_yres", 0, yres, 6);
   }
 
+  i_tags_setn(&im->tags, "jpeg_scale_denom", denom);
+  i_tags_setn(&im->tags, "jpeg_original_width", cinfo.image_width);
+  i_tags_setn(&im->tags, "jpeg_original_height", cinfo.image_height);
+
   /* I originally used jpeg_has_multiple_scans() here, but that can
    * return true for non-progressive files too.  The progressive_mode
    * member is available at least as far back as 6b and does the right
@@ -589,12 +734,19 @@ i_readjpeg_wiol(io_glue *data, int length, char** iptc_itext, int *itlength) {
   i_tags_setn(&im->tags, "jpeg_progressive", 
 	      cinfo.progressive_mode ? 1 : 0);
 
-  (void) jpeg_finish_decompress(&cinfo);
+  if (cinfo.output_scanline < cinfo.output_height) {
+    /* we stopped at the bottom of the region */
+    jpeg_abort_decompress(&cinfo);
+    wiol_term_source(&cinfo);
+  }
+  else {
+    (void) jpeg_finish_decompress(&cinfo);
+  }
   jpeg_destroy_decompress(&cinfo);
 
   i_tags_set(&im->tags, "i_format", "jpeg", 4);
 
-  mm_log((1,"i_readjpeg_wiol -> (%p)\n",im));
+  mm_log((1,"i_readjpeg_wiol_scaled -> (%p)\n",im));
   return im;
 }
 
@@ -644,156 +796,116 @@ static struct moz_option int_options[] = {
 const ssize_t
 int_option_count = sizeof(int_options) / sizeof(int_options[0]);
 
-/*
-=item i_writejpeg_wiol(im, ig, qfactor)
+/* apply the dimensions and the jpeg_*, i_xres/i_yres and
+   jpeg_comment tags to a compressor, and start compression.
 
-=cut
-*/
+   Returns 0 with an error pushed for invalid tags, libjpeg errors
+   longjmp() to the caller's handler as usual. */
 
-undef_int
-i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
-  JSAMPLE *image_buffer;
+static int
+jpeg_setup_compress(j_compress_ptr cinfo, i_img_tags *tags, i_img_dim xsize,
+		    i_img_dim ysize, int want_channels, int qfactor) {
   int got_xres, got_yres, aspect_only, resunit;
   double xres, yres;
   int comment_entry;
-  volatile int want_channels = im->channels;
   int progressive = 0;
   int optimize = 0;
   int arithmetic = 0;
   char profile_name[20] = "";
   int jfif;
 
-  struct jpeg_compress_struct cinfo;
-  struct my_error_mgr jerr;
-
-  JSAMPROW row_pointer[1];	/* pointer to JSAMPLE row[s] */
-  int row_stride;		/* physical row width in image buffer */
-  unsigned char * data = NULL;
-  i_color *line_buf = NULL;
-
-  mm_log((1,"i_writejpeg(im %p, ig %p, qfactor %d)\n", im, ig, qfactor));
-  
-  i_clear_error();
-
-  if (im->xsize > JPEG_DIM_MAX || im->ysize > JPEG_DIM_MAX) {
-    i_push_error(0, "image too large for JPEG");
-    return 0;
-  }
-
-  if (!(im->channels==1 || im->channels==3)) { 
-    want_channels = im->channels - 1;
-  }
-
-  cinfo.err = jpeg_std_error(&jerr.pub);
-  jerr.pub.error_exit = my_error_exit;
-  jerr.pub.output_message = my_output_message;
-  
-  jpeg_create_compress(&cinfo);
-
-  if (setjmp(jerr.setjmp_buffer)) {
-  fail:
-    jpeg_destroy_compress(&cinfo);
-    if (data)
-      myfree(data);
-    if (line_buf)
-      myfree(line_buf);
-    return 0;
-  }
-
-  jpeg_wiol_dest(&cinfo, ig);
-
-  cinfo.image_width  = im -> xsize; 	/* image width and height, in pixels */
-  cinfo.image_height = im -> ysize;
+  cinfo->image_width  = xsize; 	/* image width and height, in pixels */
+  cinfo->image_height = ysize;
 
   if (want_channels==3) {
-    cinfo.input_components = 3;		/* # of color components per pixel */
-    cinfo.in_color_space = JCS_RGB; 	/* colorspace of input image */
+    cinfo->input_components = 3;		/* # of color components per pixel */
+    cinfo->in_color_space = JCS_RGB; 	/* colorspace of input image */
   }
 
   if (want_channels==1) {
-    cinfo.input_components = 1;		/* # of color components per pixel */
-    cinfo.in_color_space = JCS_GRAYSCALE; 	/* colorspace of input image */
+    cinfo->input_components = 1;		/* # of color components per pixel */
+    cinfo->in_color_space = JCS_GRAYSCALE; 	/* colorspace of input image */
   }
 
-  if (i_tags_get_string(&im->tags, "jpeg_compress_profile", 0,
+  if (i_tags_get_string(tags, "jpeg_compress_profile", 0,
                         profile_name, sizeof(profile_name))) {
     if (strcmp(profile_name, "fastest") == 0) {
 #ifdef IS_MOZJPEG
-      jpeg_c_set_int_param(&cinfo, JINT_COMPRESS_PROFILE, JCP_FASTEST);
+      jpeg_c_set_int_param(cinfo, JINT_COMPRESS_PROFILE, JCP_FASTEST);
 #endif
       /* else default */
     }
     else if (strcmp(profile_name, "max") == 0) {
 #ifdef IS_MOZJPEG
-      jpeg_c_set_int_param(&cinfo, JINT_COMPRESS_PROFILE, JCP_MAX_COMPRESSION);
+      jpeg_c_set_int_param(cinfo, JINT_COMPRESS_PROFILE, JCP_MAX_COMPRESSION);
 #else
       i_push_error(0, "jpeg_compress_profile=max requires mozjpeg");
-      goto fail;
+      return 0;
 #endif
     }
     else {
       i_push_errorf(0, "jpeg_compress_profile=%s unknown", profile_name);
-      goto fail;
+      return 0;
     }
   }
 #ifdef IS_MOZJPEG
   else {
-    jpeg_c_set_int_param(&cinfo, JINT_COMPRESS_PROFILE, JCP_FASTEST);
+    jpeg_c_set_int_param(cinfo, JINT_COMPRESS_PROFILE, JCP_FASTEST);
   }
 #endif
 
-  jpeg_set_defaults(&cinfo);
+  jpeg_set_defaults(cinfo);
 
   {
     char tune_str[20];
-    if (i_tags_get_string(&im->tags, "jpeg_tune", 0, tune_str, sizeof(tune_str))) {
+    if (i_tags_get_string(tags, "jpeg_tune", 0, tune_str, sizeof(tune_str))) {
       if (strcmp(tune_str, "psnr") == 0) {
 #ifdef IS_MOZJPEG
-        jpeg_c_set_int_param(&cinfo, JINT_BASE_QUANT_TBL_IDX, 1);
-        jpeg_c_set_float_param(&cinfo, JFLOAT_LAMBDA_LOG_SCALE1, 9.0);
-        jpeg_c_set_float_param(&cinfo, JFLOAT_LAMBDA_LOG_SCALE2, 0.0);
-        jpeg_c_set_bool_param(&cinfo, JBOOLEAN_USE_LAMBDA_WEIGHT_TBL, FALSE);
+        jpeg_c_set_int_param(cinfo, JINT_BASE_QUANT_TBL_IDX, 1);
+        jpeg_c_set_float_param(cinfo, JFLOAT_LAMBDA_LOG_SCALE1, 9.0);
+        jpeg_c_set_float_param(cinfo, JFLOAT_LAMBDA_LOG_SCALE2, 0.0);
+        jpeg_c_set_bool_param(cinfo, JBOOLEAN_USE_LAMBDA_WEIGHT_TBL, FALSE);
 #endif
       }
       else if (strcmp(tune_str, "ssim") == 0) {
 #ifdef IS_MOZJPEG
-        jpeg_c_set_int_param(&cinfo, JINT_BASE_QUANT_TBL_IDX, 1);
-        jpeg_c_set_float_param(&cinfo, JFLOAT_LAMBDA_LOG_SCALE1, 11.5);
-        jpeg_c_set_float_param(&cinfo, JFLOAT_LAMBDA_LOG_SCALE2, 12.75);
-        jpeg_c_set_bool_param(&cinfo, JBOOLEAN_USE_LAMBDA_WEIGHT_TBL, FALSE);
+        jpeg_c_set_int_param(cinfo, JINT_BASE_QUANT_TBL_IDX, 1);
+        jpeg_c_set_float_param(cinfo, JFLOAT_LAMBDA_LOG_SCALE1, 11.5);
+        jpeg_c_set_float_param(cinfo, JFLOAT_LAMBDA_LOG_SCALE2, 12.75);
+        jpeg_c_set_bool_param(cinfo, JBOOLEAN_USE_LAMBDA_WEIGHT_TBL, FALSE);
 #endif
       }
       else if (strcmp(tune_str, "ms-ssim") == 0) {
 #ifdef IS_MOZJPEG
-        jpeg_c_set_int_param(&cinfo, JINT_BASE_QUANT_TBL_IDX, 3);
-        jpeg_c_set_float_param(&cinfo, JFLOAT_LAMBDA_LOG_SCALE1, 12.0);
-        jpeg_c_set_float_param(&cinfo, JFLOAT_LAMBDA_LOG_SCALE2, 13.0);
-        jpeg_c_set_bool_param(&cinfo, JBOOLEAN_USE_LAMBDA_WEIGHT_TBL, TRUE);
+        jpeg_c_set_int_param(cinfo, JINT_BASE_QUANT_TBL_IDX, 3);
+        jpeg_c_set_float_param(cinfo, JFLOAT_LAMBDA_LOG_SCALE1, 12.0);
+        jpeg_c_set_float_param(cinfo, JFLOAT_LAMBDA_LOG_SCALE2, 13.0);
+        jpeg_c_set_bool_param(cinfo, JBOOLEAN_USE_LAMBDA_WEIGHT_TBL, TRUE);
 #endif
       }
       else if (strcmp(tune_str, "hvs-psnr") == 0) {
 #ifdef IS_MOZJPEG
-        jpeg_c_set_int_param(&cinfo, JINT_BASE_QUANT_TBL_IDX, 3);
-        jpeg_c_set_float_param(&cinfo, JFLOAT_LAMBDA_LOG_SCALE1, 14.75);
-        jpeg_c_set_float_param(&cinfo, JFLOAT_LAMBDA_LOG_SCALE2, 16.5);
-        jpeg_c_set_bool_param(&cinfo, JBOOLEAN_USE_LAMBDA_WEIGHT_TBL, TRUE);
+        jpeg_c_set_int_param(cinfo, JINT_BASE_QUANT_TBL_IDX, 3);
+        jpeg_c_set_float_param(cinfo, JFLOAT_LAMBDA_LOG_SCALE1, 14.75);
+        jpeg_c_set_float_param(cinfo, JFLOAT_LAMBDA_LOG_SCALE2, 16.5);
+        jpeg_c_set_bool_param(cinfo, JBOOLEAN_USE_LAMBDA_WEIGHT_TBL, TRUE);
 #endif
       }
       else {
         i_push_errorf(0, "unknown value '%s' for jpeg_tune", tune_str);
-        goto fail;
+        return 0;
       }
 #ifndef IS_MOZJPEG
       i_push_error(0, "jpeg_tune requires Imager::File::JPEG be built with mozjpeg");
-      goto fail;
+      return 0;
 #endif
     }
   }
 
-  jpeg_set_quality(&cinfo, qfactor, TRUE);  /* limit to baseline-JPEG values */
+  jpeg_set_quality(cinfo, qfactor, TRUE);  /* limit to baseline-JPEG values */
 
-  if (i_tags_get_int(&im->tags, "jpeg_jfif", 0, &jfif) && !jfif) {
-    cinfo.write_JFIF_header = 0;
+  if (i_tags_get_int(tags, "jpeg_jfif", 0, &jfif) && !jfif) {
+    cinfo->write_JFIF_header = 0;
   }
 
   {
@@ -801,13 +913,13 @@ i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
     for (i = 0; i < boolean_option_count; ++i) {
       int val;
       const struct moz_option *opt = boolean_options + i;
-      if (i_tags_get_int(&im->tags, opt->name, 0, &val)) {
+      if (i_tags_get_int(tags, opt->name, 0, &val)) {
 #ifdef IS_MOZJPEG
-	jpeg_c_set_bool_param(&cinfo, opt->tag, !!val);
+	jpeg_c_set_bool_param(cinfo, opt->tag, !!val);
 #else
 	i_push_errorf(0, "option %s requires Imager::File::JPEG be built with mozjpeg",
 		      opt->name);
-	goto fail;
+	return 0;
 #endif
       }
     }
@@ -818,19 +930,19 @@ i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
     for (i = 0; i < float_option_count; ++i) {
       double val;
       const struct moz_option *opt = float_options + i;
-      if (i_tags_get_float(&im->tags, opt->name, 0, &val)) {
+      if (i_tags_get_float(tags, opt->name, 0, &val)) {
 #ifdef IS_MOZJPEG
 	float f = val;
 	float g;
-	jpeg_c_set_float_param(&cinfo, opt->tag, f);
-	g = jpeg_c_get_float_param(&cinfo, opt->tag);
+	jpeg_c_set_float_param(cinfo, opt->tag, f);
+	g = jpeg_c_get_float_param(cinfo, opt->tag);
 	if (fabs(g-f) > 0.0001) {
 	  i_push_errorf(0, "invalid value %g for tag %s", val, opt->name);
 	}
 #else
 	i_push_errorf(0, "option %s requires Imager::File::JPEG be built with mozjpeg",
 		      opt->name);
-	goto fail;
+	return 0;
 #endif
       }
     }
@@ -841,38 +953,38 @@ i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
     for (i = 0; i < int_option_count; ++i) {
       int val;
       const struct moz_option *opt = int_options + i;
-      if (i_tags_get_int(&im->tags, opt->name, 0, &val)) {
+      if (i_tags_get_int(tags, opt->name, 0, &val)) {
 #ifdef IS_MOZJPEG
-	jpeg_c_set_int_param(&cinfo, opt->tag, val);
-	if (jpeg_c_get_int_param(&cinfo, opt->tag) != val) {
+	jpeg_c_set_int_param(cinfo, opt->tag, val);
+	if (jpeg_c_get_int_param(cinfo, opt->tag) != val) {
 	  i_push_errorf(0, "invalid value %d for tag %s", val, opt->name);
 	}
 #else
 	i_push_errorf(0, "option %s requires Imager::File::JPEG be built with mozjpeg",
 		      opt->name);
-	goto fail;
+	return 0;
 #endif
       }
     }
   }
 
-  if (!i_tags_get_int(&im->tags, "jpeg_progressive", 0, &progressive))
+  if (!i_tags_get_int(tags, "jpeg_progressive", 0, &progressive))
     progressive = 0;
   if (progressive) {
-    jpeg_simple_progression(&cinfo);
+    jpeg_simple_progression(cinfo);
   }
-  if (!i_tags_get_int(&im->tags, "jpeg_optimize", 0, &optimize))
+  if (!i_tags_get_int(tags, "jpeg_optimize", 0, &optimize))
     optimize = 0;
-  cinfo.optimize_coding = optimize;
-  if (i_tags_get_int(&im->tags, "jpeg_arithmetic", 0, &arithmetic)) {
-    cinfo.arith_code = arithmetic != 0;
+  cinfo->optimize_coding = optimize;
+  if (i_tags_get_int(tags, "jpeg_arithmetic", 0, &arithmetic)) {
+    cinfo->arith_code = arithmetic != 0;
   }
 
-  got_xres = i_tags_get_float(&im->tags, "i_xres", 0, &xres);
-  got_yres = i_tags_get_float(&im->tags, "i_yres", 0, &yres);
-  if (!i_tags_get_int(&im->tags, "i_aspect_only", 0,&aspect_only))
+  got_xres = i_tags_get_float(tags, "i_xres", 0, &xres);
+  got_yres = i_tags_get_float(tags, "i_yres", 0, &yres);
+  if (!i_tags_get_int(tags, "i_aspect_only", 0,&aspect_only))
     aspect_only = 0;
-  if (!i_tags_get_int(&im->tags, "jpeg_density_unit", 0, &resunit))
+  if (!i_tags_get_int(tags, "jpeg_density_unit", 0, &resunit))
     resunit = 1; /* per inch */
   if (resunit < 0 || resunit > 2) /* default to inch if invalid */
     resunit = 1;
@@ -888,40 +1000,40 @@ i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
       xres /= 2.54;
       yres /= 2.54;
     }
-    cinfo.density_unit = resunit;
-    cinfo.X_density = (int)(xres + 0.5);
-    cinfo.Y_density = (int)(yres + 0.5);
+    cinfo->density_unit = resunit;
+    cinfo->X_density = (int)(xres + 0.5);
+    cinfo->Y_density = (int)(yres + 0.5);
   }
 
   {
     int smooth;
-    if (i_tags_get_int(&im->tags, "jpeg_smooth", 0, &smooth)) {
+    if (i_tags_get_int(tags, "jpeg_smooth", 0, &smooth)) {
       if (smooth < 0 || smooth > 100) {
         i_push_error(0, "jpeg_smooth must be an integer from 0 to 100");
-        goto fail;
+        return 0;
       }
-      cinfo.smoothing_factor = smooth;
+      cinfo->smoothing_factor = smooth;
     }
   }
 
   {
     char restart_str[20];
-    if (i_tags_get_string(&im->tags, "jpeg_restart", 0, restart_str, sizeof(restart_str))) {
+    if (i_tags_get_string(tags, "jpeg_restart", 0, restart_str, sizeof(restart_str))) {
       long restart_count;
       char block_flag = '\0';
       if (sscanf(restart_str, "%ld%c", &restart_count, &block_flag) > 0
           && restart_count >= 0 && restart_count <= 65535
           && (block_flag == '\0' || block_flag == 'b' || block_flag == 'B')) {
         if (block_flag) {
-          cinfo.restart_interval = (unsigned)restart_count;
+          cinfo->restart_interval = (unsigned)restart_count;
         }
         else {
-          cinfo.restart_in_rows = (int)restart_count;
+          cinfo->restart_in_rows = (int)restart_count;
         }
       }
       else {
         i_push_error(0, "jpeg_restart must be an integer from 0 to 65535 followed by an optional b");
-        goto fail;
+        return 0;
       }
     }
   }
@@ -929,7 +1041,7 @@ i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
   {
     char sample_str[80];
 
-    if (i_tags_get_string(&im->tags, "jpeg_sample", 0, sample_str, sizeof(sample_str))) {
+    if (i_tags_get_string(tags, "jpeg_sample", 0, sample_str, sizeof(sample_str))) {
       int x, y, n;
       char sep;
       char *p = sample_str;
@@ -939,14 +1051,14 @@ i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
             x >= 1 && x <= 4 && y >= 1 && y <= 4 &&
             (sep == 'x' || sep == 'X') &&
             index < MAX_COMPONENTS) {
-          cinfo.comp_info[index].h_samp_factor = x;
-          cinfo.comp_info[index].v_samp_factor = y;
+          cinfo->comp_info[index].h_samp_factor = x;
+          cinfo->comp_info[index].v_samp_factor = y;
           ++index;
         }
         else {
         failsample:
           i_push_error(0, "jpeg_sample: must match /^[1-4]x[1-4](,[1-4]x[1-4]){0,9}$/aai");
-          goto fail;
+          return 0;
         }
         p += n;
         if (p[0] == ',') {
@@ -960,20 +1072,77 @@ i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
       }
       /* fill the rest with 1x1 like cjpeg does */
       for ( ; index < MAX_COMPONENTS; ++index) {
-        cinfo.comp_info[index].h_samp_factor = x;
-        cinfo.comp_info[index].v_samp_factor = y;
+        cinfo->comp_info[index].h_samp_factor = x;
+        cinfo->comp_info[index].v_samp_factor = y;
       }
     }
   }
 
-  jpeg_start_compress(&cinfo, TRUE);
+  jpeg_start_compress(cinfo, TRUE);
 
-  if (i_tags_find(&im->tags, "jpeg_comment", 0, &comment_entry)) {
-    jpeg_write_marker(&cinfo, JPEG_COM, 
-                      (const JOCTET *)im->tags.tags[comment_entry].data,
-		      im->tags.tags[comment_entry].size);
+  if (i_tags_find(tags, "jpeg_comment", 0, &comment_entry)) {
+    jpeg_write_marker(cinfo, JPEG_COM, 
+                      (const JOCTET *)tags->tags[comment_entry].data,
+		      tags->tags[comment_entry].size);
   }
 
+  return 1;
+}
+
+/*
+=item i_writejpeg_wiol(im, ig, qfactor)
+
+=cut
+*/
+
+undef_int
+i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
+  JSAMPLE *image_buffer;
+  volatile int want_channels = im->channels;
+
+  struct jpeg_compress_struct cinfo;
+  struct my_error_mgr jerr;
+
+  JSAMPROW row_pointer[1];	/* pointer to JSAMPLE row[s] */
+  int row_stride;		/* physical row width in image buffer */
+  unsigned char * data = NULL;
+  i_color *line_buf = NULL;
+
+  mm_log((1,"i_writejpeg(im %p, ig %p, qfactor %d)\n", im, ig, qfactor));
+  
+  i_clear_error();
+
+  if (im->xsize > JPEG_DIM_MAX || im->ysize > JPEG_DIM_MAX) {
+    i_push_error(0, "image too large for JPEG");
+    return 0;
+  }
+
+  if (!(im->channels==1 || im->channels==3)) { 
+    want_channels = im->channels - 1;
+  }
+
+  cinfo.err = jpeg_std_error(&jerr.pub);
+  jerr.pub.error_exit = my_error_exit;
+  jerr.pub.output_message = my_output_message;
+  
+  jpeg_create_compress(&cinfo);
+
+  if (setjmp(jerr.setjmp_buffer)) {
+  fail:
+    jpeg_destroy_compress(&cinfo);
+    if (data)
+      myfree(data);
+    if (line_buf)
+      myfree(line_buf);
+    return 0;
+  }
+
+  jpeg_wiol_dest(&cinfo, ig);
+
+  if (!jpeg_setup_compress(&cinfo, &im->tags, im->xsize, im->ysize,
+			   want_channels, qfactor))
+    goto fail;
+
   row_stride = im->xsize * im->channels;	/* JSAMPLEs per row in image_buffer */
 
   if (!i_img_virtual(im) && im->type == i_direct_type && im->bits == i_8_bits
@@ -1026,6 +1195,229 @@ i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor) {
   return(1);
 }
 
+struct i_jpeg_writer_tag {
+  struct jpeg_compress_struct cinfo;
+  struct my_error_mgr jerr;
+  io_glue *ig;
+  i_img_dim xsize, ysize;
+  int channels;
+  int want_channels;
+  /* for images with alpha, a row image to composite against the
+     background with i_gsamp_bg() */
+  i_img *work;
+  JSAMPLE *row;
+  i_color bg;
+  int failed;
+  int closed;
+};
+
+/*
+=item i_writejpeg_stream_new(ig, xsize, ysize, channels, tags, qfactor)
+
+Start writing an 8-bit JPEG image of the given size to C<ig>, the
+rows are supplied with i_writejpeg_stream_write().
+
+C<tags> are used as the image tags would be by i_writejpeg_wiol(),
+eg. C<jpeg_optimize>, C<i_background>.
+
+Returns NULL on failure.
+
+=cut
+*/
+
+i_jpeg_writer *
+i_writejpeg_stream_new(io_glue *ig, i_img_dim xsize, i_img_dim ysize,
+		       int channels, i_img_tags *tags, int qfactor) {
+  i_jpeg_writer *w;
+
+  mm_log((1, "i_writejpeg_stream_new(ig %p, xsize %" i_DF ", ysize %" i_DF
+	  ", channels %d, tags %p, qfactor %d)\n", ig, i_DFc(xsize),
+	  i_DFc(ysize), channels, tags, qfactor));
+
+  i_clear_error();
+
+  if (xsize < 1 || ysize < 1) {
+    i_push_error(0, "image size must be positive");
+    return NULL;
+  }
+  if (xsize > JPEG_DIM_MAX || ysize > JPEG_DIM_MAX) {
+    i_push_error(0, "image too large for JPEG");
+    return NULL;
+  }
+  if (channels < 1 || channels > 4) {
+    i_push_error(0, "channels must be between 1 and 4");
+    return NULL;
+  }
+
+  w = mymalloc(sizeof(i_jpeg_writer));
+  w->ig = ig;
+  w->xsize = xsize;
+  w->ysize = ysize;
+  w->channels = channels;
+  w->want_channels = channels == 1 || channels == 3 ? channels : channels - 1;
+  w->work = NULL;
+  w->row = NULL;
+  w->failed = 0;
+  w->closed = 0;
+  if (w->want_channels != channels) {
+    w->work = i_img_8_new(xsize, 1, channels);
+    /* i_gsamp_bg() fetches all channels before compositing */
+    w->row = mymalloc(xsize * channels);
+    if (!i_tags_get_color(tags, "i_background", 0, &w->bg)) {
+      /* black default, as for i_get_file_background() */
+      w->bg.channel[0] = w->bg.channel[1] = w->bg.channel[2] = 0;
+    }
+    w->bg.channel[3] = 255;
+  }
+
+  w->cinfo.err = jpeg_std_error(&w->jerr.pub);
+  w->jerr.pub.error_exit = my_error_exit;
+  w->jerr.pub.output_message = my_output_message;
+
+  jpeg_create_compress(&w->cinfo);
+
+  if (setjmp(w->jerr.setjmp_buffer)) {
+    i_writejpeg_stream_destroy(w);
+    return NULL;
+  }
+
+  jpeg_wiol_dest(&w->cinfo, ig);
+
+  if (!jpeg_setup_compress(&w->cinfo, tags, xsize, ysize, w->want_channels,
+			   qfactor)) {
+    i_writejpeg_stream_destroy(w);
+    return NULL;
+  }
+
+  return w;
+}
+
+static int
+stream_check(i_jpeg_writer *w) {
+  if (w->failed) {
+    i_push_error(0, "an earlier write to this JPEG stream failed");
+    return 0;
+  }
+  if (w->closed) {
+    i_push_error(0, "JPEG stream is closed");
+    return 0;
+  }
+
+  return 1;
+}
+
+/*
+=item i_writejpeg_stream_write(w, samples, count)
+
+Write C<count> samples to the JPEG stream, which must be a whole
+number of rows of C<xsize * channels> samples, as for i_psamp().
+
+Returns non-zero on success.
+
+=cut
+*/
+
+int
+i_writejpeg_stream_write(i_jpeg_writer *w, const i_sample_t *samples,
+			 size_t count) {
+  size_t row_size = (size_t)w->xsize * w->channels;
+  size_t rows = count / row_size;
+  size_t i;
+  JSAMPROW row_pointer[1];
+
+  i_clear_error();
+
+  if (!stream_check(w))
+    return 0;
+  if (count % row_size) {
+    i_push_error(0, "sample count must be a multiple of the row size");
+    return 0;
+  }
+  if (rows > (size_t)(w->ysize - w->cinfo.next_scanline)) {
+    i_push_errorf(0, "too many rows, %d of %" i_DF " already written",
+		  (int)w->cinfo.next_scanline, i_DFc(w->ysize));
+    return 0;
+  }
+
+  if (setjmp(w->jerr.setjmp_buffer)) {
+    w->failed = 1;
+    return 0;
+  }
+
+  for (i = 0; i < rows; ++i) {
+    const i_sample_t *p = samples + i * row_size;
+    if (w->work) {
+      i_psamp(w->work, 0, w->xsize, 0, p, NULL, w->channels);
+      i_gsamp_bg(w->work, 0, w->xsize, 0, w->row, w->want_channels, &w->bg);
+      row_pointer[0] = w->row;
+    }
+    else {
+      row_pointer[0] = (JSAMPROW)p;
+    }
+    (void) jpeg_write_scanlines(&w->cinfo, row_pointer, 1);
+  }
+
+  return 1;
+}
+
+/*
+=item i_writejpeg_stream_close(w)
+
+Finish writing the JPEG image and close the I/O layer object.  Fails
+if fewer rows than the image height have been written.
+
+The stream must still be released with i_writejpeg_stream_destroy().
+
+Returns non-zero on success.
+
+=cut
+*/
+
+int
+i_writejpeg_stream_close(i_jpeg_writer *w) {
+  i_clear_error();
+
+  if (!stream_check(w))
+    return 0;
+  if (w->cinfo.next_scanline != w->ysize) {
+    i_push_errorf(0, "only %d of %" i_DF " rows written",
+		  (int)w->cinfo.next_scanline, i_DFc(w->ysize));
+    return 0;
+  }
+
+  if (setjmp(w->jerr.setjmp_buffer)) {
+    w->failed = 1;
+    return 0;
+  }
+
+  jpeg_finish_compress(&w->cinfo);
+  w->closed = 1;
+
+  if (i_io_close(w->ig))
+    return 0;
+
+  return 1;
+}
+
+/*
+=item i_writejpeg_stream_destroy(w)
+
+Release the JPEG stream.  If the stream wasn't closed the output is
+incomplete.
+
+=cut
+*/
+
+void
+i_writejpeg_stream_destroy(i_jpeg_writer *w) {
+  jpeg_destroy_compress(&w->cinfo);
+  if (w->work)
+    i_img_destroy(w->work);
+  if (w->row)
+    myfree(w->row);
+  myfree(w);
+}
+
 /*
 =back
 
@@ -6,9 +6,28 @@
 i_img*
 i_readjpeg_wiol(io_glue *data, int length, char** iptc_itext, int *itlength);
 
+i_img*
+i_readjpeg_wiol_scaled(io_glue *data, int length, char** iptc_itext,
+		       int *itlength, int scale_denom, i_img_dim max_width,
+		       i_img_dim max_height, const i_img_dim *region);
+
 undef_int
 i_writejpeg_wiol(i_img *im, io_glue *ig, int qfactor);
 
+typedef struct i_jpeg_writer_tag i_jpeg_writer;
+typedef i_jpeg_writer *Imager__File__JPEG__Writer;
+
+extern i_jpeg_writer *
+i_writejpeg_stream_new(io_glue *ig, i_img_dim xsize, i_img_dim ysize,
+		       int channels, i_img_tags *tags, int qfactor);
+extern int
+i_writejpeg_stream_write(i_jpeg_writer *w, const i_sample_t *samples,
+			 size_t count);
+extern int
+i_writejpeg_stream_close(i_jpeg_writer *w);
+extern void
+i_writejpeg_stream_destroy(i_jpeg_writer *w);
+
 extern const char *
 i_libjpeg_version(void);
 
@@ -735,6 +735,120 @@ SKIP:
   }
 }
 
+{ # scaling while decoding
+  # blurred so the differences from scaling methods are small
+  my $im = test_image()->scale(xpixels => 320, ypixels => 200, type => "nonprop");
+  $im->filter(type => "gaussian", stddev => 4);
+  $im->settag(name => "i_xres", value => 100);
+  $im->settag(name => "i_yres", value => 100);
+  my $data;
+  ok($im->write(data => \$data, type => "jpeg", jpegquality => 100),
+     "write an image to test scaled reads");
+  my $full = Imager->new(data => $data, filetype => "jpeg");
+  ok($full, "read it at full size");
+  is($full->tags(name => "jpeg_scale_denom"), 1, "check scale tag");
+  is($full->tags(name => "jpeg_original_width"), 320, "check original width tag");
+  is($full->tags(name => "jpeg_original_height"), 200, "check original height tag");
+  for my $test ([ 1, 1, 320, 200 ],
+		[ 0.5, 2, 160, 100 ],
+		[ 0.3, 2, 160, 100 ],
+		[ 0.25, 4, 80, 50 ],
+		[ 1/8, 8, 40, 25 ],
+		[ 0.01, 8, 40, 25 ]) {
+    my ($scale, $denom, $width, $height) = @$test;
+    my $sim = Imager->new(data => $data, filetype => "jpeg",
+			  jpeg_scale => $scale);
+    ok($sim, "read with jpeg_scale $scale")
+      or do { diag(Imager->errstr); next; };
+    is($sim->getwidth, $width, "check width");
+    is($sim->getheight, $height, "check height");
+    is($sim->tags(name => "jpeg_scale_denom"), $denom, "check scale tag");
+    is($sim->tags(name => "jpeg_original_width"), 320, "check original width tag");
+    is($sim->tags(name => "i_xres"), 100 / $denom, "check x resolution scaled");
+    my $expect = $full->scale(xpixels => $width, ypixels => $height,
+			      type => "nonprop", qtype => "mixing");
+    my $diff = Imager::i_img_diff($sim->{IMG}, $expect->{IMG}) / ($width * $height * 3);
+    cmp_ok($diff, "<", 4, "check it's close to scaling after decoding");
+  }
+  for my $test ([ { jpeg_max_width => 100 }, 2 ],
+		[ { jpeg_max_width => 80 }, 4 ],
+		[ { jpeg_max_height => 25 }, 8 ],
+		[ { jpeg_max_height => 26 }, 4 ],
+		[ { jpeg_max_width => 80, jpeg_max_height => 26 }, 4 ],
+		[ { jpeg_max_width => 40, jpeg_max_height => 80 }, 8 ],
+		[ { jpeg_max_width => 300, jpeg_max_height => 50 }, 4 ],
+		[ { jpeg_max_width => 1000 }, 1 ],
+		[ { jpeg_max_width => 10, jpeg_scale => 0.5 }, 2 ]) {
+    my ($opts, $denom) = @$test;
+    my $desc = join ", ", map "$_ => $opts->{$_}", sort keys %$opts;
+    my $sim = Imager->new(data => $data, filetype => "jpeg", %$opts);
+    ok($sim, "read with $desc")
+      or do { diag(Imager->errstr); next; };
+    is($sim->tags(name => "jpeg_scale_denom"), $denom, "check scale tag");
+  }
+  for my $test ([ jpeg_scale => 0, qr/jpeg_scale must be/ ],
+		[ jpeg_scale => 2, qr/jpeg_scale must be/ ],
+		[ jpeg_scale => "abc", qr/jpeg_scale must be/ ],
+		[ jpeg_max_width => 0, qr/jpeg_max_width must be/ ],
+		[ jpeg_max_height => -1, qr/jpeg_max_height must be/ ]) {
+    my ($name, $value, $re) = @$test;
+    my $bad = Imager->new;
+    ok(!$bad->read(data => $data, type => "jpeg", $name => $value),
+       "fail to read with $name => $value");
+    like($bad->errstr, $re, "check message");
+  }
+}
+
+{ # reading a region
+  my $im = test_image()->scale(xpixels => 317, ypixels => 203, type => "nonprop");
+  for my $test ([ "rgb", $im, {} ],
+		[ "rgb 4:4:4", $im, { jpeg_sample => "1x1" } ],
+		[ "rgb progressive", $im, { jpeg_progressive => 1 } ],
+		[ "gray", $im->convert(preset => "gray"), {} ]) {
+    my ($name, $src, $opts) = @$test;
+    my $data;
+    ok($src->write(data => \$data, type => "jpeg", %$opts),
+       "$name: write an image to test region reads")
+      or next;
+    my $full = Imager->new(data => $data, filetype => "jpeg");
+    for my $region ([ 0, 0, 317, 203 ], [ 50, 37, 173, 101 ],
+		    [ 1, 1, 2, 2 ], [ 200, 150, 317, 203 ], [ 0, 100, 317, 101 ],
+		    [ 17, 33, 150, 140 ], [ 48, 25, 267, 137 ]) {
+      my $desc = "$name: region @$region";
+      my $rim = Imager->new(data => $data, filetype => "jpeg",
+			    region => $region);
+      ok($rim, "$desc: read")
+	or do { diag(Imager->errstr); next; };
+      my $expect = $full->crop(left => $region->[0], top => $region->[1],
+			       right => $region->[2], bottom => $region->[3]);
+      is_image($rim, $expect, "$desc: matches crop of full image");
+    }
+    {
+      my $rim = Imager->new(data => $data, filetype => "jpeg",
+			    region => [ 100, 80, 300, 200 ], jpeg_scale => 0.25);
+      ok($rim, "$name: read region at 1/4 scale")
+	or diag(Imager->errstr);
+      my $small = Imager->new(data => $data, filetype => "jpeg",
+			      jpeg_scale => 0.25);
+      my $expect = $small->crop(left => 25, top => 20, right => 75, bottom => 50);
+      is_image($rim, $expect, "$name: scaled region matches");
+    }
+  }
+  {
+    my $data;
+    $im->write(data => \$data, type => "jpeg");
+    my $rim = Imager->new(data => $data, filetype => "jpeg",
+			  region => [ 0, 0, 100, 50 ], jpeg_max_width => 25);
+    ok($rim, "region with jpeg_max_width");
+    is($rim->tags(name => "jpeg_scale_denom"), 4, "hints apply to the region");
+    is($rim->getwidth, 25, "check width");
+    my $bad = Imager->new;
+    ok(!$bad->read(data => $data, type => "jpeg", region => [ 317, 0, 400, 10 ]),
+       "fail to read region outside the image");
+    is($bad->errstr, "region is outside the image", "check message");
+  }
+}
+
 { # check close failures are handled correctly
   my $im = test_image();
   my $fail_close = sub {
@@ -748,4 +862,45 @@ SKIP:
 	 "check error message");
 }
 
+{ # streaming writes
+  my $src = test_image()->scale(xpixels => 150, ypixels => 130,
+				type => "nonprop");
+  for my $channels (1 .. 4) {
+    my $im = $src;
+    $channels < 3 and $im = $im->convert(preset => "gray");
+    $channels % 2 or $im = $im->convert(preset => "addalpha");
+    my $data;
+    my $out = Imager->write_stream(data => \$data, type => "jpeg",
+				   xsize => 150, ysize => 130,
+				   channels => $channels, jpegquality => 90,
+				   i_background => "#FF0000")
+      or diag(Imager->errstr);
+    ok($out, "$channels channels: start stream");
+    my $ok = 1;
+    for (my $y = 0; $y < 130; $y += 50) {
+      $out->write_rows($im->crop(top => $y, height => 50))
+	or $ok = 0;
+    }
+    ok($ok, "$channels channels: write bands");
+    ok($out->close, "$channels channels: close");
+    my $expect;
+    ok($im->write(data => \$expect, type => "jpeg", jpegquality => 90,
+		  i_background => "#FF0000"),
+       "$channels channels: write() for comparison");
+    is($data, $expect, "$channels channels: same as write()");
+  }
+  {
+    my $data;
+    my $out = Imager->write_stream(data => \$data, type => "jpeg",
+				   xsize => 10, ysize => 10);
+    ok($out->write_samples("\0" x 90), "write 3 rows of samples");
+    ok(!$out->close, "fail to close early");
+    is(Imager->errstr, "only 3 of 10 rows written", "check message");
+    ok(!$out->write_samples("\0" x 240), "fail to write too many rows");
+    ok($out->write_samples("\0" x 210), "write the rest");
+    ok($out->close, "close");
+    ok(Imager->new(data => $data), "read it back");
+  }
+}
+
 done_testing();
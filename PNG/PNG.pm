@@ -4,7 +4,7 @@ use strict;
 use Imager;
 
 BEGIN {
-  our $VERSION = "1.004";
+  our $VERSION = "1.005";
 
   require XSLoader;
   XSLoader::load('Imager::File::PNG', $VERSION);
@@ -16,7 +16,12 @@ sub read {
   my $flags = 0;
   $hsh{png_ignore_benign_errors}
     and $flags |= IMPNG_READ_IGNORE_BENIGN_ERRORS;
-  $im->{IMG} = i_readpng_wiol($io, $flags);
+  if ($hsh{region}) {
+    $im->{IMG} = i_readpng_wiol_region($io, $flags, @{$hsh{region}});
+  }
+  else {
+    $im->{IMG} = i_readpng_wiol($io, $flags);
+  }
 
   unless ($im->{IMG}) {
     $im->_set_error(Imager->_error_as_msg);
@@ -33,6 +38,7 @@ Imager->register_reader
      my ($im, $io, %hsh) = @_;
      __PACKAGE__->read($im, $io, %hsh);
    },
+   region => 1,
   );
 
 sub write {
@@ -56,6 +62,20 @@ Imager->register_writer
      my ($im, $io, %hsh) = @_;
      return __PACKAGE__->write($im, $io, %hsh);
    },
+   stream =>
+   sub {
+     my ($im, $io, %hsh) = @_;
+
+     $im->_set_opts(\%hsh, "png_", $im);
+
+     my $w = i_writepng_stream_new($io, $hsh{xsize}, $hsh{ysize},
+				   $im->getchannels, $im->{IMG});
+     unless ($w) {
+       Imager->_set_error(Imager->_error_as_msg);
+       return;
+     }
+     return $w;
+   },
   );
 
 __END__
@@ -18,6 +18,25 @@ i_readpng_wiol(ig, flags=0)
         Imager::IO     ig
 	int 	       flags
 
+Imager::ImgRaw
+i_readpng_wiol_region(ig, flags, left, top, right, bottom)
+        Imager::IO     ig
+	int 	       flags
+	i_img_dim      left
+	i_img_dim      top
+	i_img_dim      right
+	i_img_dim      bottom
+      PREINIT:
+	i_img_dim region[4];
+      CODE:
+	region[0] = left;
+	region[1] = top;
+	region[2] = right;
+	region[3] = bottom;
+	RETVAL = i_readpng_wiol_region(ig, flags, region);
+      OUTPUT:
+	RETVAL
+
 undef_int
 i_writepng_wiol(im, ig)
     Imager::ImgRaw     im
@@ -26,6 +45,49 @@ i_writepng_wiol(im, ig)
 unsigned
 i_png_lib_version()
 
+Imager::File::PNG::Writer
+i_writepng_stream_new(ig, xsize, ysize, channels, im)
+        Imager::IO     ig
+        i_img_dim      xsize
+        i_img_dim      ysize
+        int            channels
+        Imager::ImgRaw im
+      C_ARGS:
+        ig, xsize, ysize, channels, &im->tags
+
+MODULE = Imager::File::PNG  PACKAGE = Imager::File::PNG::Writer PREFIX=i_writepng_stream_
+
+#define i_writepng_stream_DESTROY(w) i_writepng_stream_destroy(w)
+
+undef_int
+i_writepng_stream_write(w, data)
+        Imager::File::PNG::Writer w
+        SV *data
+      PREINIT:
+        const char *p;
+        STRLEN len;
+      CODE:
+        p = SvPVbyte(data, len);
+        RETVAL = i_writepng_stream_write(w, (const i_sample_t *)p, len);
+      OUTPUT:
+        RETVAL
+
+undef_int
+i_writepng_stream_close(w)
+        Imager::File::PNG::Writer w
+
+void
+i_writepng_stream_DESTROY(w)
+        Imager::File::PNG::Writer w
+
+int
+i_writepng_stream_CLONE_SKIP(...)
+    CODE:
+        (void)items;
+        RETVAL = 1;
+    OUTPUT:
+        RETVAL
+
 MODULE = Imager::File::PNG  PACKAGE = Imager::File::PNG PREFIX=i_png_
 
 void
@@ -12,16 +12,16 @@ static int CC2C[PNG_COLOR_MASK_PALETTE|PNG_COLOR_MASK_COLOR|PNG_COLOR_MASK_ALPHA
 #define PNG_BYTES_TO_CHECK 4
 
 static i_img *
-read_direct8(png_structp png_ptr, png_infop info_ptr, int channels, i_img_dim width, i_img_dim height);
+read_direct8(png_structp png_ptr, png_infop info_ptr, int channels, i_img_dim width, i_img_dim height, const i_img_dim *region);
 
 static i_img *
-read_direct16(png_structp png_ptr, png_infop info_ptr, int channels, i_img_dim width, i_img_dim height);
+read_direct16(png_structp png_ptr, png_infop info_ptr, int channels, i_img_dim width, i_img_dim height, const i_img_dim *region);
 
 static i_img *
-read_paletted(png_structp png_ptr, png_infop info_ptr, int channels, i_img_dim width, i_img_dim height);
+read_paletted(png_structp png_ptr, png_infop info_ptr, int channels, i_img_dim width, i_img_dim height, const i_img_dim *region);
 
 static i_img *
-read_bilevel(png_structp png_ptr, png_infop info_ptr, i_img_dim width, i_img_dim height);
+read_bilevel(png_structp png_ptr, png_infop info_ptr, i_img_dim width, i_img_dim height, const i_img_dim *region);
 
 static int
 write_direct8(png_structp png_ptr, png_infop info_ptr, i_img *im);
@@ -39,7 +39,7 @@ static void
 get_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr, int bit_depth, int color_type);
 
 static int
-set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr);
+set_png_tags(i_img_tags *tags, png_structp png_ptr, png_infop info_ptr);
 
 static const char *
 get_string2(i_img_tags *tags, const char *name, char *buf, size_t *size);
@@ -257,7 +257,7 @@ i_writepng_wiol(i_img *im, io_glue *ig) {
   png_set_IHDR(png_ptr, info_ptr, width, height, bits, cspace,
 	       PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
 
-  if (!set_png_tags(im, png_ptr, info_ptr)) {
+  if (!set_png_tags(&im->tags, png_ptr, info_ptr)) {
     png_destroy_write_struct(&png_ptr, &info_ptr);
     return 0;
   }
@@ -297,6 +297,195 @@ i_writepng_wiol(i_img *im, io_glue *ig) {
   return(1);
 }
 
+/* state for writing a PNG file a band of rows at a time */
+struct i_png_writer_tag {
+  png_structp png_ptr;
+  png_infop info_ptr;
+  io_glue *ig;
+  i_img_dim xsize, ysize;
+  int channels;
+  i_img_dim y; /* rows written so far */
+  int failed;
+  int closed;
+};
+
+/* Start writing an 8-bit direct color PNG image of the given size to
+   ig, the rows are supplied with i_writepng_stream_write().
+
+   tags are used as the image tags would be by i_writepng_wiol(), eg.
+   png_compression_level, i_xres.
+
+   Returns NULL on failure. */
+i_png_writer *
+i_writepng_stream_new(io_glue *ig, i_img_dim xsize, i_img_dim ysize,
+		      int channels, i_img_tags *tags) {
+  i_png_writer *w;
+  int cspace;
+
+  mm_log((1, "i_writepng_stream_new(ig %p, xsize %" i_DF ", ysize %" i_DF
+	  ", channels %d, tags %p)\n", ig, i_DFc(xsize), i_DFc(ysize),
+	  channels, tags));
+
+  i_clear_error();
+
+  if (xsize < 1 || ysize < 1) {
+    i_push_error(0, "image size must be positive");
+    return NULL;
+  }
+  if (xsize > PNG_DIM_MAX || ysize > PNG_DIM_MAX) {
+    i_push_error(0, "image too large for PNG");
+    return NULL;
+  }
+  switch (channels) {
+  case 1:
+    cspace = PNG_COLOR_TYPE_GRAY;
+    break;
+  case 2:
+    cspace = PNG_COLOR_TYPE_GRAY_ALPHA;
+    break;
+  case 3:
+    cspace = PNG_COLOR_TYPE_RGB;
+    break;
+  case 4:
+    cspace = PNG_COLOR_TYPE_RGB_ALPHA;
+    break;
+  default:
+    i_push_error(0, "channels must be between 1 and 4");
+    return NULL;
+  }
+
+  w = mymalloc(sizeof(i_png_writer));
+  w->ig = ig;
+  w->xsize = xsize;
+  w->ysize = ysize;
+  w->channels = channels;
+  w->y = 0;
+  w->failed = 0;
+  w->closed = 0;
+  w->info_ptr = NULL;
+  w->png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, 
+				       error_handler, write_warn_handler);
+  if (w->png_ptr)
+    w->info_ptr = png_create_info_struct(w->png_ptr);
+  if (!w->info_ptr) {
+    i_push_error(0, "cannot create PNG write structures");
+    i_writepng_stream_destroy(w);
+    return NULL;
+  }
+
+  if (setjmp(png_jmpbuf(w->png_ptr))) {
+    i_writepng_stream_destroy(w);
+    return NULL;
+  }
+
+  png_set_write_fn(w->png_ptr, (png_voidp) (ig), wiol_write_data, wiol_flush_data);
+  png_set_user_limits(w->png_ptr, xsize, ysize);
+  png_set_IHDR(w->png_ptr, w->info_ptr, xsize, ysize, 8, cspace,
+	       PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+
+  if (!set_png_tags(tags, w->png_ptr, w->info_ptr)) {
+    i_writepng_stream_destroy(w);
+    return NULL;
+  }
+
+  png_write_info(w->png_ptr, w->info_ptr);
+
+  return w;
+}
+
+static int
+stream_check(i_png_writer *w) {
+  if (w->failed) {
+    i_push_error(0, "an earlier write to this PNG stream failed");
+    return 0;
+  }
+  if (w->closed) {
+    i_push_error(0, "PNG stream is closed");
+    return 0;
+  }
+
+  return 1;
+}
+
+/* Write count samples to the PNG stream, which must be a whole number
+   of rows of xsize * channels samples, as for i_psamp().
+
+   Returns non-zero on success. */
+int
+i_writepng_stream_write(i_png_writer *w, const i_sample_t *samples,
+			size_t count) {
+  size_t row_size = (size_t)w->xsize * w->channels;
+  size_t rows = count / row_size;
+  size_t i;
+
+  i_clear_error();
+
+  if (!stream_check(w))
+    return 0;
+  if (count % row_size) {
+    i_push_error(0, "sample count must be a multiple of the row size");
+    return 0;
+  }
+  if (rows > (size_t)(w->ysize - w->y)) {
+    i_push_errorf(0, "too many rows, %" i_DF " of %" i_DF " already written",
+		  i_DFc(w->y), i_DFc(w->ysize));
+    return 0;
+  }
+
+  if (setjmp(png_jmpbuf(w->png_ptr))) {
+    w->failed = 1;
+    return 0;
+  }
+
+  for (i = 0; i < rows; ++i) {
+    png_write_row(w->png_ptr, (png_bytep)(samples + i * row_size));
+    ++w->y;
+  }
+
+  return 1;
+}
+
+/* Finish writing the PNG image and close the I/O layer object.  Fails if
+   fewer rows than the image height have been written.
+
+   The stream must still be released with i_writepng_stream_destroy().
+
+   Returns non-zero on success. */
+int
+i_writepng_stream_close(i_png_writer *w) {
+  i_clear_error();
+
+  if (!stream_check(w))
+    return 0;
+  if (w->y != w->ysize) {
+    i_push_errorf(0, "only %" i_DF " of %" i_DF " rows written",
+		  i_DFc(w->y), i_DFc(w->ysize));
+    return 0;
+  }
+
+  if (setjmp(png_jmpbuf(w->png_ptr))) {
+    w->failed = 1;
+    return 0;
+  }
+
+  png_write_end(w->png_ptr, w->info_ptr);
+  w->closed = 1;
+
+  if (i_io_close(w->ig))
+    return 0;
+
+  return 1;
+}
+
+/* Release the PNG stream.  If the stream wasn't closed the output is
+   incomplete. */
+void
+i_writepng_stream_destroy(i_png_writer *w) {
+  if (w->png_ptr)
+    png_destroy_write_struct(&w->png_ptr, &w->info_ptr);
+  myfree(w);
+}
+
 typedef struct {
   char *warnings;
 } i_png_read_state, *i_png_read_statep;
@@ -309,6 +498,14 @@ cleanup_read_state(i_png_read_statep);
 
 i_img*
 i_readpng_wiol(io_glue *ig, int flags) {
+  return i_readpng_wiol_region(ig, flags, NULL);
+}
+
+/* read only the part of the image within region, left, top, right,
+   bottom, rows outside the region are still decoded, but aren't
+   stored, and the columns outside it are discarded */
+i_img*
+i_readpng_wiol_region(io_glue *ig, int flags, const i_img_dim *region) {
   i_img *im = NULL;
   png_structp png_ptr;
   png_infop info_ptr;
@@ -317,11 +514,12 @@ i_readpng_wiol(io_glue *ig, int flags) {
   int channels;
   unsigned int sig_read;
   i_png_read_state rs;
+  i_img_dim clip[4];
 
   rs.warnings = NULL;
   sig_read  = 0;
 
-  mm_log((1,"i_readpng_wiol(ig %p)\n", ig));
+  mm_log((1,"i_readpng_wiol_region(ig %p, flags %d, region %p)\n", ig, flags, region));
   i_clear_error();
 
   png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, &rs, 
@@ -382,25 +580,43 @@ i_readpng_wiol(io_glue *ig, int flags) {
 
   mm_log((1,"i_readpng_wiol: channels %d\n",channels));
 
-  if (!i_int_check_image_file_limits(width, height, channels, sizeof(i_sample_t))) {
+  clip[0] = 0;
+  clip[1] = 0;
+  clip[2] = width;
+  clip[3] = height;
+  if (region) {
+    if (region[0] > clip[0]) clip[0] = region[0];
+    if (region[1] > clip[1]) clip[1] = region[1];
+    if (region[2] < clip[2]) clip[2] = region[2];
+    if (region[3] < clip[3]) clip[3] = region[3];
+    if (clip[0] >= clip[2] || clip[1] >= clip[3]) {
+      i_push_error(0, "region is outside the image");
+      png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
+      cleanup_read_state(&rs);
+      return NULL;
+    }
+  }
+
+  if (!i_int_check_image_file_limits(clip[2] - clip[0], clip[3] - clip[1],
+				     channels, sizeof(i_sample_t))) {
     mm_log((1, "i_readpnm: image size exceeds limits\n"));
     png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
     return NULL;
   }
 
   if (color_type == PNG_COLOR_TYPE_PALETTE) {
-    im = read_paletted(png_ptr, info_ptr, channels, width, height);
+    im = read_paletted(png_ptr, info_ptr, channels, width, height, clip);
   }
   else if (color_type == PNG_COLOR_TYPE_GRAY
 	   && bit_depth == 1
 	   && !png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS)) {
-    im = read_bilevel(png_ptr, info_ptr, width, height);
+    im = read_bilevel(png_ptr, info_ptr, width, height, clip);
   }
   else if (bit_depth == 16) {
-    im = read_direct16(png_ptr, info_ptr, channels, width, height);
+    im = read_direct16(png_ptr, info_ptr, channels, width, height, clip);
   }
   else {
-    im = read_direct8(png_ptr, info_ptr, channels, width, height);
+    im = read_direct8(png_ptr, info_ptr, channels, width, height, clip);
   }
 
   if (im)
@@ -422,16 +638,18 @@ i_readpng_wiol(io_glue *ig, int flags) {
 
 static i_img *
 read_direct8(png_structp png_ptr, png_infop info_ptr, int ochannels,
-	     i_img_dim width, i_img_dim height) {
+	     i_img_dim width, i_img_dim height, const i_img_dim *region) {
   i_img * volatile vim = NULL;
   int color_type = png_get_color_type(png_ptr, info_ptr);
   int bit_depth = png_get_bit_depth(png_ptr, info_ptr);
   i_img_dim y;
   int number_passes, pass;
   i_img *im;
-  unsigned char *line;
+  unsigned char *line, *out_line;
   unsigned char * volatile vline = NULL;
   volatile int vchannels = ochannels;
+  i_img_dim out_width = region[2] - region[0];
+  i_img_dim out_height = region[3] - region[1];
 
   if (setjmp(png_jmpbuf(png_ptr))) {
     if (vim) i_img_destroy(vim);
@@ -457,19 +675,24 @@ read_direct8(png_structp png_ptr, png_infop info_ptr, int ochannels,
   
   png_read_update_info(png_ptr, info_ptr);
   
-  im = vim = i_img_8_new(width,height,vchannels);
+  im = vim = i_img_8_new(out_width, out_height, vchannels);
   if (!im) {
     png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
     return NULL;
   }
   
   line = vline = mymalloc(vchannels * width);
+  out_line = line + region[0] * vchannels;
   for (pass = 0; pass < number_passes; pass++) {
     for (y = 0; y < height; y++) {
+      if (y < region[1] || y >= region[3]) {
+	png_read_row(png_ptr, NULL, NULL);
+	continue;
+      }
       if (pass > 0)
-	i_gsamp(im, 0, width, y, line, NULL, vchannels);
+	i_gsamp(im, 0, out_width, y - region[1], out_line, NULL, vchannels);
       png_read_row(png_ptr,(png_bytep)line, NULL);
-      i_psamp(im, 0, width, y, line, NULL, vchannels);
+      i_psamp(im, 0, out_width, y - region[1], out_line, NULL, vchannels);
     }
   }
   myfree(line);
@@ -482,17 +705,20 @@ read_direct8(png_structp png_ptr, png_infop info_ptr, int ochannels,
 
 static i_img *
 read_direct16(png_structp png_ptr, png_infop info_ptr, int ochannels,
-	     i_img_dim width, i_img_dim height) {
+	     i_img_dim width, i_img_dim height, const i_img_dim *region) {
   i_img * volatile vim = NULL;
   i_img_dim x, y;
   int number_passes, pass;
   i_img *im;
-  unsigned char *line;
+  unsigned char *line, *out_line;
   unsigned char * volatile vline = NULL;
   unsigned *bits_line;
   unsigned * volatile vbits_line = NULL;
   size_t row_bytes;
   volatile int vchannels = ochannels;
+  i_img_dim out_width = region[2] - region[0];
+  i_img_dim out_height = region[3] - region[1];
+  i_img_dim out_samples;
 
   if (setjmp(png_jmpbuf(png_ptr))) {
     if (vim) i_img_destroy(vim);
@@ -513,7 +739,7 @@ read_direct16(png_structp png_ptr, png_infop info_ptr, int ochannels,
   
   png_read_update_info(png_ptr, info_ptr);
   
-  im = vim = i_img_16_new(width,height,vchannels);
+  im = vim = i_img_16_new(out_width, out_height, vchannels);
   if (!im) {
     png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
     return NULL;
@@ -522,20 +748,26 @@ read_direct16(png_structp png_ptr, png_infop info_ptr, int ochannels,
   row_bytes = png_get_rowbytes(png_ptr, info_ptr);
   line = vline = mymalloc(row_bytes);
   memset(line, 0, row_bytes);
-  bits_line = vbits_line = mymalloc(sizeof(unsigned) * width * vchannels);
+  out_line = line + region[0] * vchannels * 2;
+  out_samples = out_width * vchannels;
+  bits_line = vbits_line = mymalloc(sizeof(unsigned) * out_samples);
   for (pass = 0; pass < number_passes; pass++) {
     for (y = 0; y < height; y++) {
+      if (y < region[1] || y >= region[3]) {
+	png_read_row(png_ptr, NULL, NULL);
+	continue;
+      }
       if (pass > 0) {
-	i_gsamp_bits(im, 0, width, y, bits_line, NULL, vchannels, 16);
-	for (x = 0; x < width * vchannels; ++x) {
-	  line[x*2] = bits_line[x] >> 8;
-	  line[x*2+1] = bits_line[x] & 0xff;
+	i_gsamp_bits(im, 0, out_width, y - region[1], bits_line, NULL, vchannels, 16);
+	for (x = 0; x < out_samples; ++x) {
+	  out_line[x*2] = bits_line[x] >> 8;
+	  out_line[x*2+1] = bits_line[x] & 0xff;
 	}
       }
       png_read_row(png_ptr,(png_bytep)line, NULL);
-      for (x = 0; x < width * vchannels; ++x)
-	bits_line[x] = (line[x*2] << 8) + line[x*2+1];
-      i_psamp_bits(im, 0, width, y, bits_line, NULL, vchannels, 16);
+      for (x = 0; x < out_samples; ++x)
+	bits_line[x] = (out_line[x*2] << 8) + out_line[x*2+1];
+      i_psamp_bits(im, 0, out_width, y - region[1], bits_line, NULL, vchannels, 16);
     }
   }
   myfree(line);
@@ -550,14 +782,16 @@ read_direct16(png_structp png_ptr, png_infop info_ptr, int ochannels,
 
 static i_img *
 read_bilevel(png_structp png_ptr, png_infop info_ptr,
-	     i_img_dim width, i_img_dim height) {
+	     i_img_dim width, i_img_dim height, const i_img_dim *region) {
   i_img * volatile vim = NULL;
   i_img_dim x, y;
   int number_passes, pass;
   i_img *im;
-  unsigned char *line;
+  unsigned char *line, *out_line;
   unsigned char * volatile vline = NULL;
   i_color palette[2];
+  i_img_dim out_width = region[2] - region[0];
+  i_img_dim out_height = region[3] - region[1];
 
   if (setjmp(png_jmpbuf(png_ptr))) {
     if (vim) i_img_destroy(vim);
@@ -575,7 +809,7 @@ read_bilevel(png_structp png_ptr, png_infop info_ptr,
   
   png_read_update_info(png_ptr, info_ptr);
   
-  im = vim = i_img_pal_new(width, height, 1, 256);
+  im = vim = i_img_pal_new(out_width, out_height, 1, 256);
   if (!im) {
     png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
     return NULL;
@@ -589,20 +823,25 @@ read_bilevel(png_structp png_ptr, png_infop info_ptr,
   
   line = vline = mymalloc(width);
   memset(line, 0, width);
+  out_line = line + region[0];
   for (pass = 0; pass < number_passes; pass++) {
     for (y = 0; y < height; y++) {
+      if (y < region[1] || y >= region[3]) {
+	png_read_row(png_ptr, NULL, NULL);
+	continue;
+      }
       if (pass > 0) {
-	i_gpal(im, 0, width, y, line);
+	i_gpal(im, 0, out_width, y - region[1], out_line);
 	/* expand indexes back to 0/255 */
-	for (x = 0; x < width; ++x)
-	  line[x] = line[x] ? 255 : 0;
+	for (x = 0; x < out_width; ++x)
+	  out_line[x] = out_line[x] ? 255 : 0;
       }
       png_read_row(png_ptr,(png_bytep)line, NULL);
 
       /* back to palette indexes */
-      for (x = 0; x < width; ++x)
-	line[x] = line[x] ? 1 : 0;
-      i_ppal(im, 0, width, y, line);
+      for (x = 0; x < out_width; ++x)
+	out_line[x] = out_line[x] ? 1 : 0;
+      i_ppal(im, 0, out_width, y - region[1], out_line);
     }
   }
   myfree(line);
@@ -617,15 +856,17 @@ read_bilevel(png_structp png_ptr, png_infop info_ptr,
    supplied alphas? */
 static i_img *
 read_paletted(png_structp png_ptr, png_infop info_ptr, int ochannels,
-	      i_img_dim width, i_img_dim height) {
+	      i_img_dim width, i_img_dim height, const i_img_dim *region) {
   i_img * volatile vim = NULL;
   int color_type = png_get_color_type(png_ptr, info_ptr);
   int bit_depth = png_get_bit_depth(png_ptr, info_ptr);
   i_img_dim y;
   int number_passes, pass;
   i_img *im;
-  unsigned char *line;
+  unsigned char *line, *out_line;
   unsigned char * volatile vline = NULL;
+  i_img_dim out_width = region[2] - region[0];
+  i_img_dim out_height = region[3] - region[1];
   int num_palette, i;
   png_colorp png_palette;
   png_bytep png_pal_trans;
@@ -664,7 +905,7 @@ read_paletted(png_structp png_ptr, png_infop info_ptr, int ochannels,
   
   png_read_update_info(png_ptr, info_ptr);
   
-  im = vim = i_img_pal_new(width, height, vchannels, 256);
+  im = vim = i_img_pal_new(out_width, out_height, vchannels, 256);
   if (!im) {
     png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
     return NULL;
@@ -684,12 +925,17 @@ read_paletted(png_structp png_ptr, png_infop info_ptr, int ochannels,
   }
 
   line = vline = mymalloc(width);
+  out_line = line + region[0];
   for (pass = 0; pass < number_passes; pass++) {
     for (y = 0; y < height; y++) {
+      if (y < region[1] || y >= region[3]) {
+	png_read_row(png_ptr, NULL, NULL);
+	continue;
+      }
       if (pass > 0)
-	i_gpal(im, 0, width, y, line);
+	i_gpal(im, 0, out_width, y - region[1], out_line);
       png_read_row(png_ptr,(png_bytep)line, NULL);
-      i_ppal(im, 0, width, y, line);
+      i_ppal(im, 0, out_width, y - region[1], out_line);
     }
   }
   myfree(line);
@@ -926,25 +1172,25 @@ get_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr,
 #define GET_STR_BUF_SIZE 40
 
 static int
-set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
+set_png_tags(i_img_tags *tags, png_structp png_ptr, png_infop info_ptr) {
   double xres, yres;
   int aspect_only, have_res = 1;
 
-  if (i_tags_get_float(&im->tags, "i_xres", 0, &xres)) {
-    if (i_tags_get_float(&im->tags, "i_yres", 0, &yres))
+  if (i_tags_get_float(tags, "i_xres", 0, &xres)) {
+    if (i_tags_get_float(tags, "i_yres", 0, &yres))
       ; /* nothing to do */
     else
       yres = xres;
   }
   else {
-    if (i_tags_get_float(&im->tags, "i_yres", 0, &yres))
+    if (i_tags_get_float(tags, "i_yres", 0, &yres))
       xres = yres;
     else
       have_res = 0;
   }
   if (have_res) {
     aspect_only = 0;
-    i_tags_get_int(&im->tags, "i_aspect_only", 0, &aspect_only);
+    i_tags_get_int(tags, "i_aspect_only", 0, &aspect_only);
     xres /= 0.0254;
     yres /= 0.0254;
     png_set_pHYs(png_ptr, info_ptr, xres + 0.5, yres + 0.5, 
@@ -953,7 +1199,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
 
   {
     int intent;
-    if (i_tags_get_int(&im->tags, "png_srgb_intent", 0, &intent)) {
+    if (i_tags_get_int(tags, "png_srgb_intent", 0, &intent)) {
       if (intent < 0 || intent >= PNG_sRGB_INTENT_LAST) {
 	i_push_error(0, "tag png_srgb_intent out of range");
 	return 0;
@@ -966,7 +1212,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
       int found_chroma_count = 0;
 
       for (i = 0; i < chroma_tag_count; ++i) {
-	if (i_tags_get_float(&im->tags, chroma_tags[i], 0, chroma+i))
+	if (i_tags_get_float(tags, chroma_tags[i], 0, chroma+i))
 	  ++found_chroma_count;
       }
 
@@ -980,7 +1226,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
 		     chroma[3], chroma[4], chroma[5], chroma[6], chroma[7]);
       }
 
-      if (i_tags_get_float(&im->tags, "png_gamma", 0, &gamma)) {
+      if (i_tags_get_float(tags, "png_gamma", 0, &gamma)) {
 	png_set_gAMA(png_ptr, info_ptr, gamma);
       }
     }
@@ -1002,7 +1248,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
       size_t size;
       const char *data;
       
-      data = get_string2(&im->tags, text_tags[i].tagname, buf, &size);
+      data = get_string2(tags, text_tags[i].tagname, buf, &size);
       if (data) {
 	png_text text;
 	int compression = size > 1000;
@@ -1014,7 +1260,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
 	}
       
 	sprintf(compress_tag, "%s_compressed", text_tags[i].tagname);
-	i_tags_get_int(&im->tags, compress_tag, 0, &compression);
+	i_tags_get_int(tags, compress_tag, 0, &compression);
 	
 	text.compression = compression ? PNG_TEXT_COMPRESSION_zTXt
 	  : PNG_TEXT_COMPRESSION_NONE;
@@ -1041,7 +1287,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
       size_t key_size, value_size;
 
       sprintf(tag_name, "png_text%d_key", i);
-      key = get_string2(&im->tags, tag_name, key_buf, &key_size);
+      key = get_string2(tags, tag_name, key_buf, &key_size);
       
       if (key) {
 	size_t k;
@@ -1069,7 +1315,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
       }
 
       sprintf(tag_name, "png_text%d_text", i);
-      value = get_string2(&im->tags, tag_name, value_buf, &value_size);
+      value = get_string2(tags, tag_name, value_buf, &value_size);
 
       if (value) {
 	if (memchr(value, '\0', value_size)) {
@@ -1083,7 +1329,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
 	int compression = value_size > 1000;
 
 	sprintf(tag_name, "png_text%d_compressed", i);
-	i_tags_get_int(&im->tags, tag_name, 0, &compression);
+	i_tags_get_int(tags, tag_name, 0, &compression);
 
 	text.compression = compression ? PNG_TEXT_COMPRESSION_zTXt
 	  : PNG_TEXT_COMPRESSION_NONE;
@@ -1116,7 +1362,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
   {
     char buf[GET_STR_BUF_SIZE];
     size_t time_size;
-    const char *timestr = get_string2(&im->tags, "png_time", buf, &time_size);
+    const char *timestr = get_string2(tags, "png_time", buf, &time_size);
 
     if (timestr) {
       int year, month, day, hour, minute, second;
@@ -1150,7 +1396,7 @@ set_png_tags(i_img *im, png_structp png_ptr, png_infop info_ptr) {
 
   {
     int level;
-    if (i_tags_get_int(&im->tags, "png_compression_level", 0, &level)) {
+    if (i_tags_get_int(tags, "png_compression_level", 0, &level)) {
       if (level >= Z_NO_COMPRESSION && level <= Z_BEST_COMPRESSION) 
 	png_set_compression_level(png_ptr, level);
       else {
@@ -4,10 +4,21 @@
 #include "imext.h"
 
 i_img    *i_readpng_wiol(io_glue *ig, int flags);
+i_img    *i_readpng_wiol_region(io_glue *ig, int flags, const i_img_dim *region);
 
 #define IMPNG_READ_IGNORE_BENIGN_ERRORS 1
 
 undef_int i_writepng_wiol(i_img *im, io_glue *ig);
+
+typedef struct i_png_writer_tag i_png_writer;
+typedef i_png_writer *Imager__File__PNG__Writer;
+i_png_writer *i_writepng_stream_new(io_glue *ig, i_img_dim xsize,
+				    i_img_dim ysize, int channels,
+				    i_img_tags *tags);
+int i_writepng_stream_write(i_png_writer *w, const i_sample_t *samples,
+			    size_t count);
+int i_writepng_stream_close(i_png_writer *w);
+void i_writepng_stream_destroy(i_png_writer *w);
 unsigned i_png_lib_version(void);
 
 extern const char * const *
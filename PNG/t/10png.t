@@ -843,6 +843,95 @@ SKIP:
     is_image($im, $ex, "test trns 16-bit rgb parsed properly");
 }
 
+{ # reading a region
+  for my $file (qw(cover.png coveri.png cover16.png cover16i.png
+		   coverpal.png coverpali.png bilevel.png gray.png
+		   rgb8trns.png)) {
+    my $full = Imager->new(file => "testimg/$file", filetype => "png");
+    ok($full, "$file: read full image")
+      or do { diag(Imager->errstr); next; };
+    my ($w, $h) = ($full->getwidth, $full->getheight);
+    my @region = (int($w / 3), int($h / 4), int($w * 3 / 4), $h - 1);
+    my $im = Imager->new(file => "testimg/$file", filetype => "png",
+			 region => \@region);
+    ok($im, "$file: read region")
+      or do { diag(Imager->errstr); next; };
+    my $expect = $full->crop(left => $region[0], top => $region[1],
+			     right => $region[2], bottom => $region[3]);
+    is_image($im, $expect, "$file: matches crop of full image");
+    is($im->type, $full->type, "$file: same image type");
+    is($im->bits, $full->bits, "$file: same sample size");
+    is($im->tags(name => "i_format"), "png", "$file: tags are set");
+  }
+  {
+    my $im = Imager->new(file => "testimg/cover.png", filetype => "png",
+			 region => [ -10, -10, 5, 1000 ]);
+    ok($im, "read region partly outside the image");
+    is($im->getwidth, 5, "check width");
+    is($im->getheight, Imager->new(file => "testimg/cover.png")->getheight,
+       "check height");
+  }
+  {
+    my $im = Imager->new;
+    ok(!$im->read(file => "testimg/cover.png", region => [ 1000, 0, 1010, 10 ]),
+       "fail to read region outside the image");
+    is($im->errstr, "region is outside the image", "check message");
+  }
+}
+
+{ # streaming writes
+  my $src = test_image()->scale(xpixels => 150, ypixels => 130,
+				type => "nonprop");
+  for my $channels (1 .. 4) {
+    my $im = $src;
+    $channels < 3 and $im = $im->convert(preset => "gray");
+    $channels % 2 or $im = $im->convert(preset => "addalpha");
+    my $data;
+    my $out = Imager->write_stream(data => \$data, type => "png",
+				   xsize => 150, ysize => 130,
+				   channels => $channels, i_xres => 300)
+      or diag(Imager->errstr);
+    ok($out, "$channels channels: start stream");
+    my $ok = 1;
+    for (my $y = 0; $y < 130; $y += 50) {
+      $out->write_rows($im->crop(top => $y, height => 50))
+	or $ok = 0;
+    }
+    ok($ok, "$channels channels: write bands");
+    ok($out->close, "$channels channels: close");
+    my $expect;
+    ok($im->write(data => \$expect, type => "png", i_xres => 300),
+       "$channels channels: write() for comparison");
+    is($data, $expect, "$channels channels: same as write()");
+  }
+  {
+    my $data;
+    my $out = Imager->write_stream(data => \$data, type => "png",
+				   xsize => 10, ysize => 10);
+    ok($out->write_samples("\0" x 90), "write 3 rows of samples");
+    is($out->rows_written, 3, "check rows written");
+    ok(!$out->write_samples("\0" x 29), "fail to write a partial row");
+    is(Imager->errstr, "sample count must be a multiple of the row size",
+       "check message");
+    ok(!$out->write_samples("\0" x 240), "fail to write too many rows");
+    is(Imager->errstr, "too many rows, 3 of 10 already written",
+       "check message");
+    ok(!$out->close, "fail to close early");
+    is(Imager->errstr, "only 3 of 10 rows written", "check message");
+    ok($out->write_samples("\0" x 210), "write the rest");
+    ok($out->close, "close");
+    ok(!$out->close, "fail to close again");
+    is(Imager->errstr, "PNG stream is closed", "check message");
+    my $im = Imager->new(data => $data);
+    ok($im, "read it back");
+    is($im->getheight, 10, "check height");
+  }
+  ok(!Imager->write_stream(data => \my $data, type => "png", xsize => 10,
+			   ysize => 10, png_compression_level => 10),
+     "fail to stream with a bad option");
+  like(Imager->errstr, qr/png_compression_level must be/, "check message");
+}
+
 done_testing();
 
 sub limited_write {
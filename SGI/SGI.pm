@@ -4,7 +4,7 @@ use strict;
 use Imager;
 
 BEGIN {
-  our $VERSION = "0.07";
+  our $VERSION = "0.08";
   
   require XSLoader;
   XSLoader::load('Imager::File::SGI', $VERSION);
@@ -374,8 +374,16 @@ read_rgb_8_verbatim(i_img *img, io_glue *ig, rgb_header const *header) {
     i_img_setmask(img, 1<<c);
     for(y = 0; y < height; y++) {
       int x;
-      
-      if (i_io_read(ig, databuf, width) != width) {
+      const unsigned char *row;
+
+      /* use the row in place if it's all buffered */
+      if (i_io_peek_ptr(ig, &row, width, width) == width) {
+	i_io_consume(ig, width);
+      }
+      else if (i_io_read(ig, databuf, width) == width) {
+	row = databuf;
+      }
+      else {
 	i_push_error(0, "SGI image: cannot read image data");
 	i_img_destroy(img);
 	myfree(linebuf);
@@ -385,11 +393,11 @@ read_rgb_8_verbatim(i_img *img, io_glue *ig, rgb_header const *header) {
 
       if (pixmin == 0 && pixmax == 255) {
 	for(x = 0; x < img->xsize; x++)
-	  linebuf[x].channel[c] = databuf[x];
+	  linebuf[x].channel[c] = row[x];
       }
       else {
 	for(x = 0; x < img->xsize; x++) {
-	  int sample = databuf[x];
+	  int sample = row[x];
 	  if (sample < pixmin)
 	    sample = 0;
 	  else if (sample > pixmax)
@@ -655,8 +663,16 @@ read_rgb_16_verbatim(i_img *img, io_glue *ig, rgb_header const *header) {
     i_img_setmask(img, 1<<c);
     for(y = 0; y < height; y++) {
       int x;
-      
-      if (i_io_read(ig, databuf, width*2) != width*2) {
+      const unsigned char *row;
+
+      /* use the row in place if it's all buffered */
+      if (i_io_peek_ptr(ig, &row, width*2, width*2) == width*2) {
+	i_io_consume(ig, width*2);
+      }
+      else if (i_io_read(ig, databuf, width*2) == width*2) {
+	row = databuf;
+      }
+      else {
 	i_push_error(0, "SGI image: cannot read image data");
 	i_img_destroy(img);
 	myfree(linebuf);
@@ -666,11 +682,11 @@ read_rgb_16_verbatim(i_img *img, io_glue *ig, rgb_header const *header) {
 
       if (pixmin == 0 && pixmax == 65535) {
 	for(x = 0; x < img->xsize; x++)
-	  linebuf[x].channel[c] = (databuf[x*2] * 256 + databuf[x*2+1]) / 65535.0;
+	  linebuf[x].channel[c] = (row[x*2] * 256 + row[x*2+1]) / 65535.0;
       }
       else {
 	for(x = 0; x < img->xsize; x++) {
-	  int sample = databuf[x*2] * 256 + databuf[x*2+1];
+	  int sample = row[x*2] * 256 + row[x*2+1];
 	  if (sample < pixmin)
 	    sample = 0;
 	  else if (sample > pixmax)
@@ -4,7 +4,7 @@ use strict;
 use Imager;
 
 BEGIN {
-  our $VERSION = "1.006";
+  our $VERSION = "1.007";
 
   require XSLoader;
   XSLoader::load('Imager::File::TIFF', $VERSION);
@@ -22,7 +22,13 @@ Imager->register_reader
 
      my $page = $hsh{page};
      defined $page or $page = 0;
-     $im->{IMG} = i_readtiff_wiol($io, $allow_incomplete, $page);
+     if ($hsh{region}) {
+       $im->{IMG} = i_readtiff_wiol_region($io, $allow_incomplete, $page,
+					   @{$hsh{region}});
+     }
+     else {
+       $im->{IMG} = i_readtiff_wiol($io, $allow_incomplete, $page);
+     }
 
      unless ($im->{IMG}) {
        $im->_set_error(Imager->_error_as_msg);
@@ -43,6 +49,7 @@ Imager->register_reader
 
      return map bless({ IMG => $_, ERRSTR => undef }, "Imager"), @imgs;
    },
+   region => 1,
   );
 
 Imager->register_writer
@@ -99,6 +106,21 @@ Imager->register_writer
 
      return 1;
    },
+   stream =>
+   sub {
+     my ($im, $io, %hsh) = @_;
+
+     $im->_set_opts(\%hsh, "tiff_", $im);
+     $im->_set_opts(\%hsh, "exif_", $im);
+
+     my $w = i_writetiff_stream_new($io, $hsh{xsize}, $hsh{ysize},
+				    $im->getchannels, $im->{IMG});
+     unless ($w) {
+       Imager->_set_error(Imager->_error_as_msg);
+       return;
+     }
+     return $w;
+   },
   );
 
 __END__
@@ -25,6 +25,26 @@ i_readtiff_wiol(ig, allow_incomplete=0, page=0)
 	       int     allow_incomplete
                int     page
 
+Imager::ImgRaw
+i_readtiff_wiol_region(ig, allow_incomplete, page, left, top, right, bottom)
+        Imager::IO     ig
+	       int     allow_incomplete
+               int     page
+         i_img_dim     left
+         i_img_dim     top
+         i_img_dim     right
+         i_img_dim     bottom
+      PREINIT:
+        i_img_dim region[4];
+      CODE:
+        region[0] = left;
+        region[1] = top;
+        region[2] = right;
+        region[3] = bottom;
+        RETVAL = i_readtiff_wiol_region(ig, allow_incomplete, page, region);
+      OUTPUT:
+        RETVAL
+
 void
 i_readtiff_multi_wiol(ig)
         Imager::IO     ig
@@ -50,6 +70,16 @@ i_writetiff_wiol(im, ig)
     Imager::ImgRaw     im
         Imager::IO     ig
 
+Imager::File::TIFF::Writer
+i_writetiff_stream_new(ig, xsize, ysize, channels, im)
+        Imager::IO     ig
+        i_img_dim      xsize
+        i_img_dim      ysize
+        int            channels
+        Imager::ImgRaw im
+      C_ARGS:
+        ig, xsize, ysize, channels, &im->tags
+
 undef_int
 i_writetiff_multi_wiol(ig, ...)
         Imager::IO     ig
@@ -186,6 +216,39 @@ i_tiff_codecs(class)
       }
       myfree(codecs);
 
+MODULE = Imager::File::TIFF  PACKAGE = Imager::File::TIFF::Writer PREFIX=i_writetiff_stream_
+
+#define i_writetiff_stream_DESTROY(w) i_writetiff_stream_destroy(w)
+
+undef_int
+i_writetiff_stream_write(w, data)
+        Imager::File::TIFF::Writer w
+        SV *data
+      PREINIT:
+        const char *p;
+        STRLEN len;
+      CODE:
+        p = SvPVbyte(data, len);
+        RETVAL = i_writetiff_stream_write(w, (const i_sample_t *)p, len);
+      OUTPUT:
+        RETVAL
+
+undef_int
+i_writetiff_stream_close(w)
+        Imager::File::TIFF::Writer w
+
+void
+i_writetiff_stream_DESTROY(w)
+        Imager::File::TIFF::Writer w
+
+int
+i_writetiff_stream_CLONE_SKIP(...)
+    CODE:
+        (void)items;
+        RETVAL = 1;
+    OUTPUT:
+        RETVAL
+
 BOOT:
         PERL_INITIALIZE_IMAGER_CALLBACKS_NAME("Imager::File::TIFF");
 	i_tiff_init();
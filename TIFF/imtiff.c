@@ -64,8 +64,8 @@ struct tag_name {
   tf_uint32 tag;
 };
 
-static i_img *read_one_rgb_tiled(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incomplete);
-static i_img *read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incomplete);
+static i_img *read_one_rgb_tiled(TIFF *tif, i_img_dim width, i_img_dim height, const i_img_dim *region, int allow_incomplete);
+static i_img *read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, const i_img_dim *region, int allow_incomplete);
 
 static const struct tag_name
 text_tag_names[] =
@@ -139,7 +139,8 @@ typedef int (*read_setup_t)(read_state_t *state);
    image, x, y, width, height describe the target area of the image,
    extras is the extra number of pixels stored for each scanline in
    the raster buffer, (for tiles against the right side of the
-   image) */
+   image).  x and y are in the co-ordinates of the image in the file,
+   the putter only stores the part within the region being read. */
 
 typedef int (*read_putter_t)(read_state_t *state, i_img_dim x, i_img_dim y,
 			     i_img_dim width, i_img_dim height, int extras);
@@ -179,10 +180,17 @@ struct read_state_tag {
   int sample_signed;
 
   int sample_format;
+
+  /* the region of the file image being read, the image is
+     (right-left) x (bottom-top) */
+  i_img_dim left, top, right, bottom;
 };
 
 static int tile_contig_getter(read_state_t *state, read_putter_t putter);
 static int strip_contig_getter(read_state_t *state, read_putter_t putter);
+static int region_row(read_state_t *state, i_img_dim x, i_img_dim y,
+		      i_img_dim width, i_img_dim *out_x, i_img_dim *out_y,
+		      i_img_dim *skip, i_img_dim *count);
 
 static int setup_paletted(read_state_t *state);
 static int paletted_putter8(read_state_t *, i_img_dim, i_img_dim, i_img_dim, i_img_dim, int);
@@ -406,6 +414,36 @@ typedef struct {
 #endif
 } tiff_state;
 
+/* Without per-handle error handlers the global handlers are set while
+   a TIFF object is in use, under the mutex.  These are only called
+   separately from do_tiff_open()/do_tiff_close() when a TIFF object is
+   kept open between calls from perl, as with the write stream. */
+
+static void
+do_tiff_acquire(tiff_state *state) {
+#ifndef USE_TIFFOPEN_OPTIONS
+  i_mutex_lock(mutex);
+
+  state->old_error = TIFFSetErrorHandler(error_handler);
+  state->old_warn = TIFFSetWarningHandler(NULL);
+  state->old_warn_ext = TIFFSetWarningHandlerExt(warn_handler_ex);
+#else
+  (void)state;
+#endif
+}
+
+static void
+do_tiff_release(tiff_state *state) {
+#ifndef USE_TIFFOPEN_OPTIONS
+  TIFFSetErrorHandler(state->old_error);
+  TIFFSetWarningHandler(state->old_warn);
+  TIFFSetWarningHandlerExt(state->old_warn_ext);
+  i_mutex_unlock(mutex);
+#else
+  (void)state;
+#endif
+}
+
 static TIFF *
 do_tiff_open(tiff_state *state, io_glue *ig, const char *mode) {
   memset(state, 0, sizeof(*state));
@@ -430,11 +468,7 @@ do_tiff_open(tiff_state *state, io_glue *ig, const char *mode) {
                        options);
   TIFFOpenOptionsFree(options);
 #else
-  i_mutex_lock(mutex);
-
-  state->old_error = TIFFSetErrorHandler(error_handler);
-  state->old_warn = TIFFSetWarningHandler(NULL);
-  state->old_warn_ext = TIFFSetWarningHandlerExt(warn_handler_ex);
+  do_tiff_acquire(state);
 
   TIFF *tif = TIFFClientOpen("(Iolayer)", 
 		       mode, 
@@ -446,12 +480,8 @@ do_tiff_open(tiff_state *state, io_glue *ig, const char *mode) {
 		       sizeproc,
 		       comp_mmap,
 		       comp_munmap);
-  if (!tif) {
-    TIFFSetErrorHandler(state->old_error);
-    TIFFSetWarningHandler(state->old_warn);
-    TIFFSetWarningHandlerExt(state->old_warn_ext);
-    i_mutex_unlock(mutex);
-  }
+  if (!tif)
+    do_tiff_release(state);
 #endif
   if (!tif) {
     tiffio_context_final(&state->ctx);
@@ -464,12 +494,7 @@ do_tiff_open(tiff_state *state, io_glue *ig, const char *mode) {
 static void
 do_tiff_close(tiff_state *state) {
   TIFFClose(state->tif);
-#ifndef USE_TIFFOPEN_OPTIONS
-  TIFFSetErrorHandler(state->old_error);
-  TIFFSetWarningHandler(state->old_warn);
-  TIFFSetWarningHandlerExt(state->old_warn_ext);
-  i_mutex_unlock(mutex);
-#endif
+  do_tiff_release(state);
   tiffio_context_final(&state->ctx);
 }
 
@@ -480,13 +505,14 @@ i_tiff_init(void) {
 #endif
 }
 
-static int save_tiff_tags(TIFF *tif, i_img *im);
+static int save_tiff_tags(TIFF *tif, i_img_tags *tags);
 
 static void 
 pack_4bit_to(unsigned char *dest, const unsigned char *src, i_img_dim count);
 
 
-static i_img *read_one_tiff(TIFF *tif, int allow_incomplete) {
+static i_img *read_one_tiff(TIFF *tif, int allow_incomplete,
+			    const i_img_dim *region) {
   i_img *im;
   tf_uint32 width, height;
   tf_uint16 samples_per_pixel;
@@ -509,6 +535,7 @@ static i_img *read_one_tiff(TIFF *tif, int allow_incomplete) {
   size_t sample_size = ~0; /* force failure if some code doesn't set it */
   i_img_dim total_pixels;
   int samples_integral;
+  i_img_dim clip[4];
 
   TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &width);
   TIFFGetField(tif, TIFFTAG_IMAGELENGTH, &height);
@@ -530,7 +557,22 @@ static i_img *read_one_tiff(TIFF *tif, int allow_incomplete) {
   mm_log((1, "i_readtiff_wiol: %stiled\n", tiled?"":"not "));
   mm_log((1, "i_readtiff_wiol: %sbyte swapped\n", TIFFIsByteSwapped(tif)?"":"not "));
 
-  total_pixels = (i_img_dim)width * height;
+  clip[0] = 0;
+  clip[1] = 0;
+  clip[2] = width;
+  clip[3] = height;
+  if (region) {
+    if (region[0] > clip[0]) clip[0] = region[0];
+    if (region[1] > clip[1]) clip[1] = region[1];
+    if (region[2] < clip[2]) clip[2] = region[2];
+    if (region[3] < clip[3]) clip[3] = region[3];
+    if (clip[0] >= clip[2] || clip[1] >= clip[3]) {
+      i_push_error(0, "region is outside the image");
+      return NULL;
+    }
+  }
+
+  total_pixels = (clip[2] - clip[0]) * (clip[3] - clip[1]);
   memset(&state, 0, sizeof(state));
   state.tif = tif;
   state.allow_incomplete = allow_incomplete;
@@ -541,6 +583,10 @@ static i_img *read_one_tiff(TIFF *tif, int allow_incomplete) {
   state.photometric = photometric;
   state.sample_signed = sample_format == SAMPLEFORMAT_INT;
   state.sample_format = sample_format;
+  state.left = clip[0];
+  state.top = clip[1];
+  state.right = clip[2];
+  state.bottom = clip[3];
 
   samples_integral = sample_format == SAMPLEFORMAT_UINT
     || sample_format == SAMPLEFORMAT_INT 
@@ -643,7 +689,8 @@ static i_img *read_one_tiff(TIFF *tif, int allow_incomplete) {
     sample_size = 1;
   }
 
-  if (!i_int_check_image_file_limits(width, height, channels, sample_size)) {
+  if (!i_int_check_image_file_limits(clip[2] - clip[0], clip[3] - clip[1],
+				     channels, sample_size)) {
     return NULL;
   }
 
@@ -673,7 +720,7 @@ static i_img *read_one_tiff(TIFF *tif, int allow_incomplete) {
     if (allow_incomplete && state.pixels_read < total_pixels) {
       i_tags_setn(&(state.img->tags), "i_incomplete", 1);
       i_tags_setn(&(state.img->tags), "i_lines_read", 
-		  state.pixels_read / width);
+		  state.pixels_read / (clip[2] - clip[0]));
     }
     im = state.img;
     
@@ -684,10 +731,10 @@ static i_img *read_one_tiff(TIFF *tif, int allow_incomplete) {
   }
   else {
     if (tiled) {
-      im = read_one_rgb_tiled(tif, width, height, allow_incomplete);
+      im = read_one_rgb_tiled(tif, width, height, clip, allow_incomplete);
     }
     else {
-      im = read_one_rgb_lines(tif, width, height, allow_incomplete);
+      im = read_one_rgb_lines(tif, width, height, clip, allow_incomplete);
     }
   }
 
@@ -787,6 +834,24 @@ static i_img *read_one_tiff(TIFF *tif, int allow_incomplete) {
 */
 i_img*
 i_readtiff_wiol(io_glue *ig, int allow_incomplete, int page) {
+  return i_readtiff_wiol_region(ig, allow_incomplete, page, NULL);
+}
+
+/*
+=item i_readtiff_wiol_region(ig, allow_incomplete, page, region)
+
+Read the part of a page from a TIFF file within region[0] (left),
+region[1] (top), region[2] (right), region[3] (bottom), clipped to
+the image.  Only the strips or tiles that intersect the region are
+read and decompressed.
+
+If region is NULL the whole image is read.
+
+=cut
+*/
+i_img*
+i_readtiff_wiol_region(io_glue *ig, int allow_incomplete, int page,
+		       const i_img_dim *region) {
   int current_page;
 
   i_clear_error();
@@ -813,7 +878,7 @@ i_readtiff_wiol(io_glue *ig, int allow_incomplete, int page) {
     }
   }
 
-  i_img *im = read_one_tiff(tif, allow_incomplete);
+  i_img *im = read_one_tiff(tif, allow_incomplete, region);
 
   if (TIFFLastDirectory(tif))
     mm_log((1, "Last directory of tiff file\n"));
@@ -857,7 +922,7 @@ i_readtiff_multi_wiol(io_glue *ig, int *count) {
 
   *count = 0;
   do {
-    i_img *im = read_one_tiff(tif, 0);
+    i_img *im = read_one_tiff(tif, 0, NULL);
     if (!im)
       break;
     if (++*count > result_alloc) {
@@ -959,7 +1024,7 @@ i_writetiff_low_faxable(TIFF *tif, i_img *im, int fine) {
     mm_log((1, "i_writetiff_wiol_faxable: TIFFSetField ResolutionUnit=%d\n", RESUNIT_INCH)); return 0; 
   }
 
-  if (!save_tiff_tags(tif, im)) {
+  if (!save_tiff_tags(tif, &im->tags)) {
     return 0;
   }
 
@@ -1011,13 +1076,13 @@ find_compression(char const *name, tf_uint16 *compress) {
 }
 
 static tf_uint16
-get_compression(i_img *im, tf_uint16 def_compress) {
+get_compression(i_img_tags *tags, tf_uint16 def_compress) {
   int entry;
   int value;
 
-  if (i_tags_find(&im->tags, "tiff_compression", 0, &entry)
-      && im->tags.tags[entry].data) {
-    const char *name = im->tags.tags[entry].data;
+  if (i_tags_find(tags, "tiff_compression", 0, &entry)
+      && tags->tags[entry].data) {
+    const char *name = tags->tags[entry].data;
     tf_uint16 compress;
     if (find_compression(name, &compress)
 	&& TIFFIsCODECConfigured(compress))
@@ -1033,7 +1098,7 @@ get_compression(i_img *im, tf_uint16 def_compress) {
     }
     _TIFFfree(codecs);
   }
-  if (i_tags_get_int(&im->tags, "tiff_compression", 0, &value)) {
+  if (i_tags_get_int(tags, "tiff_compression", 0, &value)) {
     if ((tf_uint16)value == value
 	&& TIFFIsCODECConfigured((tf_uint16)value))
       return (tf_uint16)value;
@@ -1053,24 +1118,25 @@ i_tiff_has_compression(const char *name) {
 }
 
 static int
-set_base_tags(TIFF *tif, i_img *im, tf_uint16 compress, tf_uint16 photometric, 
+set_base_tags(TIFF *tif, i_img_tags *tags, i_img_dim xsize, i_img_dim ysize,
+	      tf_uint16 compress, tf_uint16 photometric,
 	      tf_uint16 bits_per_sample, tf_uint16 samples_per_pixel) {
   double xres, yres;
   int resunit;
   int got_xres, got_yres;
   int aspect_only;
 
-  if ((tf_uint32)im->xsize != (i_img_dim_u)im->xsize ||
-      (tf_uint32)im->ysize != (i_img_dim_u)im->ysize) {
+  if ((tf_uint32)xsize != (i_img_dim_u)xsize ||
+      (tf_uint32)ysize != (i_img_dim_u)ysize) {
     i_push_error(0, "image too large for TIFF");
     return 0;
   }
 
-  if (!TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, (tf_uint32)im->xsize)) {
+  if (!TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, (tf_uint32)xsize)) {
     i_push_error(0, "write TIFF: setting width tag");
     return 0;
   }
-  if (!TIFFSetField(tif, TIFFTAG_IMAGELENGTH, (tf_uint32)im->ysize)) {
+  if (!TIFFSetField(tif, TIFFTAG_IMAGELENGTH, (tf_uint32)ysize)) {
     i_push_error(0, "write TIFF: setting length tag");
     return 0;
   }
@@ -1099,11 +1165,11 @@ set_base_tags(TIFF *tif, i_img *im, tf_uint16 compress, tf_uint16 photometric,
     return 0;
   }
 
-  got_xres = i_tags_get_float(&im->tags, "i_xres", 0, &xres);
-  got_yres = i_tags_get_float(&im->tags, "i_yres", 0, &yres);
-  if (!i_tags_get_int(&im->tags, "i_aspect_only", 0,&aspect_only))
+  got_xres = i_tags_get_float(tags, "i_xres", 0, &xres);
+  got_yres = i_tags_get_float(tags, "i_yres", 0, &yres);
+  if (!i_tags_get_int(tags, "i_aspect_only", 0,&aspect_only))
     aspect_only = 0;
-  if (!i_tags_get_int(&im->tags, "tiff_resolutionunit", 0, &resunit))
+  if (!i_tags_get_int(tags, "tiff_resolutionunit", 0, &resunit))
     resunit = RESUNIT_INCH;
   if (got_xres || got_yres) {
     if (!got_xres)
@@ -1141,7 +1207,7 @@ set_base_tags(TIFF *tif, i_img *im, tf_uint16 compress, tf_uint16 photometric,
 
 static int 
 write_one_bilevel(TIFF *tif, i_img *im, int zero_is_white) {
-  tf_uint16 compress = get_compression(im, COMPRESSION_PACKBITS);
+  tf_uint16 compress = get_compression(&im->tags, COMPRESSION_PACKBITS);
   tf_uint16 photometric;
   unsigned char *in_row;
   unsigned char *out_row;
@@ -1170,7 +1236,8 @@ write_one_bilevel(TIFF *tif, i_img *im, int zero_is_white) {
     break;
   }
 
-  if (!set_base_tags(tif, im, compress, photometric, 1, 1))
+  if (!set_base_tags(tif, &im->tags, im->xsize, im->ysize, compress,
+		     photometric, 1, 1))
     return 0;
 
   if (!TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, TIFFDefaultStripSize(tif, -1))) {
@@ -1248,7 +1315,7 @@ set_palette(TIFF *tif, i_img *im, int size) {
 
 static int
 write_one_paletted8(TIFF *tif, i_img *im) {
-  tf_uint16 compress = get_compression(im, COMPRESSION_PACKBITS);
+  tf_uint16 compress = get_compression(&im->tags, COMPRESSION_PACKBITS);
   unsigned char *out_row;
   unsigned out_size;
   i_img_dim y;
@@ -1267,7 +1334,8 @@ write_one_paletted8(TIFF *tif, i_img *im) {
     return 0; 
   }
 
-  if (!set_base_tags(tif, im, compress, PHOTOMETRIC_PALETTE, 8, 1))
+  if (!set_base_tags(tif, &im->tags, im->xsize, im->ysize, compress,
+		     PHOTOMETRIC_PALETTE, 8, 1))
     return 0;
 
   if (!set_palette(tif, im, 256))
@@ -1292,7 +1360,7 @@ write_one_paletted8(TIFF *tif, i_img *im) {
 
 static int
 write_one_paletted4(TIFF *tif, i_img *im) {
-  tf_uint16 compress = get_compression(im, COMPRESSION_PACKBITS);
+  tf_uint16 compress = get_compression(&im->tags, COMPRESSION_PACKBITS);
   unsigned char *in_row;
   unsigned char *out_row;
   size_t out_size;
@@ -1307,7 +1375,8 @@ write_one_paletted4(TIFF *tif, i_img *im) {
       compress == COMPRESSION_CCITTFAX4)
     compress = COMPRESSION_PACKBITS;
 
-  if (!set_base_tags(tif, im, compress, PHOTOMETRIC_PALETTE, 4, 1))
+  if (!set_base_tags(tif, &im->tags, im->xsize, im->ysize, compress,
+		     PHOTOMETRIC_PALETTE, 4, 1))
     return 0;
 
   if (!set_palette(tif, im, 16))
@@ -1340,15 +1409,15 @@ write_one_paletted4(TIFF *tif, i_img *im) {
 }
 
 static int
-set_direct_tags(TIFF *tif, i_img *im, tf_uint16 compress, 
-		tf_uint16 bits_per_sample) {
+set_direct_tags(TIFF *tif, i_img_tags *tags, i_img_dim xsize, i_img_dim ysize,
+		int channels, tf_uint16 compress, tf_uint16 bits_per_sample) {
   tf_uint16 extras = EXTRASAMPLE_ASSOCALPHA;
-  tf_uint16 extra_count = im->channels == 2 || im->channels == 4;
-  tf_uint16 photometric = im->channels >= 3 ? 
+  tf_uint16 extra_count = channels == 2 || channels == 4;
+  tf_uint16 photometric = channels >= 3 ? 
     PHOTOMETRIC_RGB : PHOTOMETRIC_MINISBLACK;
 
-  if (!set_base_tags(tif, im, compress, photometric, bits_per_sample, 
-		     im->channels)) {
+  if (!set_base_tags(tif, tags, xsize, ysize, compress, photometric,
+		     bits_per_sample, channels)) {
     return 0;
   }
   
@@ -1361,7 +1430,7 @@ set_direct_tags(TIFF *tif, i_img *im, tf_uint16 compress,
 
   if (compress == COMPRESSION_JPEG) {
     int jpeg_quality;
-    if (i_tags_get_int(&im->tags, "tiff_jpegquality", 0, &jpeg_quality)
+    if (i_tags_get_int(tags, "tiff_jpegquality", 0, &jpeg_quality)
 	&& jpeg_quality >= 0 && jpeg_quality <= 100) {
       if (!TIFFSetField(tif, TIFFTAG_JPEGQUALITY, jpeg_quality)) {
 	i_push_error(0, "write TIFF: setting jpeg quality pseudo-tag");
@@ -1375,7 +1444,7 @@ set_direct_tags(TIFF *tif, i_img *im, tf_uint16 compress,
 
 static int 
 write_one_32(TIFF *tif, i_img *im) {
-  tf_uint16 compress = get_compression(im, COMPRESSION_PACKBITS);
+  tf_uint16 compress = get_compression(&im->tags, COMPRESSION_PACKBITS);
   unsigned *in_row;
   size_t out_size;
   tf_uint32 *out_row;
@@ -1389,7 +1458,8 @@ write_one_32(TIFF *tif, i_img *im) {
   if (compress == COMPRESSION_JPEG)
     compress = COMPRESSION_PACKBITS;
 
-  if (!set_direct_tags(tif, im, compress, 32))
+  if (!set_direct_tags(tif, &im->tags, im->xsize, im->ysize, im->channels,
+		       compress, 32))
     return 0;
 
   in_row = mymalloc(sample_count * sizeof(unsigned));
@@ -1419,7 +1489,7 @@ write_one_32(TIFF *tif, i_img *im) {
 
 static int 
 write_one_16(TIFF *tif, i_img *im) {
-  tf_uint16 compress = get_compression(im, COMPRESSION_PACKBITS);
+  tf_uint16 compress = get_compression(&im->tags, COMPRESSION_PACKBITS);
   unsigned *in_row;
   size_t out_size;
   tf_uint16 *out_row;
@@ -1433,7 +1503,8 @@ write_one_16(TIFF *tif, i_img *im) {
   if (compress == COMPRESSION_JPEG)
     compress = COMPRESSION_PACKBITS;
 
-  if (!set_direct_tags(tif, im, compress, 16))
+  if (!set_direct_tags(tif, &im->tags, im->xsize, im->ysize, im->channels,
+		       compress, 16))
     return 0;
 
   in_row = mymalloc(sample_count * sizeof(unsigned));
@@ -1463,7 +1534,7 @@ write_one_16(TIFF *tif, i_img *im) {
 
 static int 
 write_one_8(TIFF *tif, i_img *im) {
-  tf_uint16 compress = get_compression(im, COMPRESSION_PACKBITS);
+  tf_uint16 compress = get_compression(&im->tags, COMPRESSION_PACKBITS);
   size_t out_size;
   unsigned char *out_row;
   i_img_dim y;
@@ -1471,7 +1542,8 @@ write_one_8(TIFF *tif, i_img *im) {
     
   mm_log((1, "tiff - write_one_8(tif %p, im %p)\n", tif, im));
 
-  if (!set_direct_tags(tif, im, compress, 8))
+  if (!set_direct_tags(tif, &im->tags, im->xsize, im->ysize, im->channels,
+		       compress, 8))
     return 0;
 
   out_size = TIFFScanlineSize(tif);
@@ -1542,7 +1614,7 @@ i_writetiff_low(TIFF *tif, i_img *im) {
       return 0;
   }
 
-  if (!save_tiff_tags(tif, im))
+  if (!save_tiff_tags(tif, &im->tags))
     return 0;
 
   return 1;
@@ -1690,6 +1762,217 @@ i_writetiff_wiol(i_img *img, io_glue *ig) {
 
 
 
+struct i_tiff_writer_tag {
+  tiff_state ts;
+  io_glue *ig;
+  i_img_dim xsize, ysize;
+  int channels;
+  i_img_dim y; /* rows written so far */
+  /* TIFFWriteScanline() may modify the row it's given */
+  unsigned char *row;
+  int failed;
+  int closed;
+};
+
+/*
+=item i_writetiff_stream_new(ig, xsize, ysize, channels, tags)
+
+Start writing an 8-bit direct color TIFF image of the given size to
+C<ig>, the rows are supplied with i_writetiff_stream_write().
+
+C<tags> are used as the image tags would be by i_writetiff_wiol(), eg.
+C<tiff_compression>, C<tiff_documentname>.
+
+Returns NULL on failure.
+
+=cut
+*/
+
+i_tiff_writer *
+i_writetiff_stream_new(io_glue *ig, i_img_dim xsize, i_img_dim ysize,
+		       int channels, i_img_tags *tags) {
+  i_tiff_writer *w;
+  TIFF *tif;
+  tf_uint16 compress;
+  size_t out_size;
+
+  i_clear_error();
+  mm_log((1, "i_writetiff_stream_new(ig %p, xsize %" i_DF ", ysize %" i_DF
+	  ", channels %d, tags %p)\n", ig, i_DFc(xsize), i_DFc(ysize),
+	  channels, tags));
+
+  if (xsize < 1 || ysize < 1) {
+    i_push_error(0, "image size must be positive");
+    return NULL;
+  }
+  if (channels < 1 || channels > 4) {
+    i_push_error(0, "channels must be between 1 and 4");
+    return NULL;
+  }
+
+  w = mymalloc(sizeof(i_tiff_writer));
+  w->ig = ig;
+  w->xsize = xsize;
+  w->ysize = ysize;
+  w->channels = channels;
+  w->y = 0;
+  w->row = NULL;
+  w->failed = 0;
+  w->closed = 0;
+
+  tif = do_tiff_open(&w->ts, ig, "wm");
+  if (!tif) {
+    mm_log((1, "i_writetiff_stream_new: Unable to open tif file for writing\n"));
+    i_push_error(0, "Could not create TIFF object");
+    myfree(w);
+    return NULL;
+  }
+
+  compress = get_compression(tags, COMPRESSION_PACKBITS);
+  if (!set_direct_tags(tif, tags, xsize, ysize, channels, compress, 8)
+      || !save_tiff_tags(tif, tags)) {
+    do_tiff_close(&w->ts);
+    myfree(w);
+    return NULL;
+  }
+
+  out_size = TIFFScanlineSize(tif);
+  if (out_size < (size_t)xsize * channels)
+    out_size = (size_t)xsize * channels;
+  w->row = (unsigned char *)_TIFFmalloc(out_size);
+
+  do_tiff_release(&w->ts);
+
+  /* the writer flushes through ig as it's destroyed, keep it alive */
+  ++ig->refcount;
+
+  return w;
+}
+
+static int
+stream_check(i_tiff_writer *w) {
+  if (w->failed) {
+    i_push_error(0, "an earlier write to this TIFF stream failed");
+    return 0;
+  }
+  if (w->closed) {
+    i_push_error(0, "TIFF stream is closed");
+    return 0;
+  }
+
+  return 1;
+}
+
+/*
+=item i_writetiff_stream_write(w, samples, count)
+
+Write C<count> samples to the TIFF stream, which must be a whole
+number of rows of C<xsize * channels> samples, as for i_psamp().
+
+Returns non-zero on success.
+
+=cut
+*/
+
+int
+i_writetiff_stream_write(i_tiff_writer *w, const i_sample_t *samples,
+			 size_t count) {
+  size_t row_size = (size_t)w->xsize * w->channels;
+  size_t rows = count / row_size;
+  size_t i;
+
+  i_clear_error();
+
+  if (!stream_check(w))
+    return 0;
+  if (count % row_size) {
+    i_push_error(0, "sample count must be a multiple of the row size");
+    return 0;
+  }
+  if (rows > (size_t)(w->ysize - w->y)) {
+    i_push_errorf(0, "too many rows, %" i_DF " of %" i_DF " already written",
+		  i_DFc(w->y), i_DFc(w->ysize));
+    return 0;
+  }
+
+  do_tiff_acquire(&w->ts);
+  for (i = 0; i < rows; ++i) {
+    memcpy(w->row, samples + i * row_size, row_size);
+    if (TIFFWriteScanline(w->ts.tif, w->row, w->y, 0) < 0) {
+      i_push_error(0, "write TIFF: write scan line failed");
+      w->failed = 1;
+      do_tiff_release(&w->ts);
+      return 0;
+    }
+    ++w->y;
+  }
+  do_tiff_release(&w->ts);
+
+  return 1;
+}
+
+/*
+=item i_writetiff_stream_close(w)
+
+Finish writing the TIFF image and close the I/O layer object.  Fails
+if fewer rows than the image height have been written.
+
+The stream must still be released with i_writetiff_stream_destroy().
+
+Returns non-zero on success.
+
+=cut
+*/
+
+int
+i_writetiff_stream_close(i_tiff_writer *w) {
+  i_clear_error();
+
+  if (!stream_check(w))
+    return 0;
+  if (w->y != w->ysize) {
+    i_push_errorf(0, "only %" i_DF " of %" i_DF " rows written",
+		  i_DFc(w->y), i_DFc(w->ysize));
+    return 0;
+  }
+
+  do_tiff_acquire(&w->ts);
+  w->closed = 1;
+  if (!TIFFWriteDirectory(w->ts.tif)) {
+    i_push_error(0, "Cannot write TIFF directory");
+    w->failed = 1;
+    do_tiff_close(&w->ts);
+    return 0;
+  }
+  do_tiff_close(&w->ts);
+
+  if (i_io_close(w->ig))
+    return 0;
+
+  return 1;
+}
+
+/*
+=item i_writetiff_stream_destroy(w)
+
+Release the TIFF stream and its reference to the I/O layer object.  If
+the stream wasn't closed the output is incomplete.
+
+=cut
+*/
+
+void
+i_writetiff_stream_destroy(i_tiff_writer *w) {
+  if (!w->closed) {
+    do_tiff_acquire(&w->ts);
+    do_tiff_close(&w->ts);
+  }
+  if (w->row)
+    _TIFFfree(w->row);
+  io_glue_destroy(w->ig);
+  myfree(w);
+}
+
 /*
 =item i_writetiff_wiol_faxable(i_img *, io_glue *)
 
@@ -1732,14 +2015,14 @@ i_writetiff_wiol_faxable(i_img *im, io_glue *ig, int fine) {
   return 1;
 }
 
-static int save_tiff_tags(TIFF *tif, i_img *im) {
+static int save_tiff_tags(TIFF *tif, i_img_tags *tags) {
   int i;
  
   for (i = 0; i < text_tag_count; ++i) {
     int entry;
-    if (i_tags_find(&im->tags, text_tag_names[i].name, 0, &entry)) {
+    if (i_tags_find(tags, text_tag_names[i].name, 0, &entry)) {
       if (!TIFFSetField(tif, text_tag_names[i].tag, 
-                       im->tags.tags[entry].data)) {
+                       tags->tags[entry].data)) {
        i_push_errorf(0, "cannot save %s to TIFF", text_tag_names[i].name);
        return 0;
       }
@@ -1830,7 +2113,8 @@ make_rgb(TIFF *tif, i_img_dim width, i_img_dim height, int *alpha_chan) {
 }
 
 static i_img *
-read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incomplete) {
+read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height,
+		   const i_img_dim *region, int allow_incomplete) {
   i_img *im;
   tf_uint32* raster = NULL;
   tf_uint32 rowsperstrip;
@@ -1839,8 +2123,10 @@ read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
   int alpha_chan;
   int rc;
   i_img_dim_u uheight = height;
+  i_img_dim left = region[0], top = region[1];
+  i_img_dim right = region[2], bottom = region[3];
 
-  im = make_rgb(tif, width, height, &alpha_chan);
+  im = make_rgb(tif, right - left, bottom - top, &alpha_chan);
   if (!im)
     return NULL;
 
@@ -1848,7 +2134,7 @@ read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
   mm_log((1, "i_readtiff_wiol: rowsperstrip=%u rc = %d\n",
           (unsigned)rowsperstrip, rc));
   
-  if (rc != 1 || rowsperstrip == (tf_uint32)-1) {
+  if (rc != 1 || rowsperstrip == (tf_uint32)-1 || rowsperstrip == 0) {
     rowsperstrip = height;
   }
   
@@ -1859,14 +2145,17 @@ read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
     return NULL;
   }
 
-  line_buf = mymalloc(sizeof(i_color) * width);
+  line_buf = mymalloc(sizeof(i_color) * (right - left));
   
-  for( row = 0; row < uheight; row += rowsperstrip ) {
+  /* only the strips that intersect the region */
+  for( row = top - top % rowsperstrip; row < (i_img_dim_u)bottom;
+       row += rowsperstrip ) {
     tf_uint32 newrows, i_row;
     
     if (!TIFFReadRGBAStrip(tif, row, raster)) {
       if (allow_incomplete) {
-	i_tags_setn(&im->tags, "i_lines_read", row);
+	i_tags_setn(&im->tags, "i_lines_read",
+		    row > (i_img_dim_u)top ? row - top : 0);
 	i_tags_setn(&im->tags, "i_incomplete", 1);
 	break;
       }
@@ -1885,7 +2174,10 @@ read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
       tf_uint32 x;
       i_color *outp = line_buf;
 
-      for(x = 0; x < (i_img_dim_u)width; x++) {
+      if (row + i_row < (i_img_dim_u)top || row + i_row >= (i_img_dim_u)bottom)
+	continue;
+
+      for(x = left; x < (i_img_dim_u)right; x++) {
 	tf_uint32 temp = raster[x+width*(newrows-i_row-1)];
 	outp->rgba.r = TIFFGetR(temp);
 	outp->rgba.g = TIFFGetG(temp);
@@ -1905,7 +2197,7 @@ read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
 
 	outp++;
       }
-      i_plin(im, 0, width, i_row+row, line_buf);
+      i_plin(im, 0, right - left, i_row + row - top, line_buf);
     }
   }
 
@@ -1916,7 +2208,8 @@ read_one_rgb_lines(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
 }
 
 static i_img *
-read_one_rgb_tiled(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incomplete) {
+read_one_rgb_tiled(TIFF *tif, i_img_dim width, i_img_dim height,
+		   const i_img_dim *region, int allow_incomplete) {
   i_img *im;
   tf_uint32* raster = NULL;
   int ok = 1;
@@ -1927,8 +2220,10 @@ read_one_rgb_tiled(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
   int alpha_chan;
   i_img_dim_u uheight = height;
   i_img_dim_u uwidth = width;
+  i_img_dim left = region[0], top = region[1];
+  i_img_dim right = region[2], bottom = region[3];
   
-  im = make_rgb(tif, width, height, &alpha_chan);
+  im = make_rgb(tif, right - left, bottom - top, &alpha_chan);
   if (!im)
     return NULL;
   
@@ -1944,19 +2239,28 @@ read_one_rgb_tiled(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
   }
   line = mymalloc(tile_width * sizeof(i_color));
   
-  for( row = 0; row < (i_img_dim_u)height; row += tile_height ) {
-    for( col = 0; col < (i_img_dim_u)width; col += tile_width ) {
+  /* only the tiles that intersect the region */
+  for( row = top - top % tile_height; row < (i_img_dim_u)bottom;
+       row += tile_height ) {
+    for( col = left - left % tile_width; col < (i_img_dim_u)right;
+	 col += tile_width ) {
       
       /* Read the tile into an RGBA array */
       if (TIFFReadRGBATileExt(tif, col, row, raster, 1)) {
 	tf_uint32 i_row, x;
 	tf_uint32 newrows = (row+tile_height > uheight) ? height-row : tile_height;
 	tf_uint32 newcols = (col+tile_width  > uwidth ) ? width-col  : tile_width;
+	/* the columns of the tile within the region */
+	tf_uint32 start_x = col < (i_img_dim_u)left ? left - col : 0;
+	tf_uint32 end_x = col + newcols > (i_img_dim_u)right ? right - col : newcols;
 
 	mm_log((1, "i_readtiff_wiol: tile(%d, %d) newcols=%d newrows=%d\n", col, row, newcols, newrows));
 	for( i_row = 0; i_row < newrows; i_row++ ) {
 	  i_color *outp = line;
-	  for(x = 0; x < newcols; x++) {
+	  if (row + i_row < (i_img_dim_u)top
+	      || row + i_row >= (i_img_dim_u)bottom)
+	    continue;
+	  for(x = start_x; x < end_x; x++) {
 	    tf_uint32 temp = raster[x+tile_width*(tile_height-i_row-1)];
 	    outp->rgba.r = TIFFGetR(temp);
 	    outp->rgba.g = TIFFGetG(temp);
@@ -1978,9 +2282,10 @@ read_one_rgb_tiled(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
 
 	    ++outp;
 	  }
-	  i_plin(im, col, col+newcols, row+i_row, line);
+	  i_plin(im, col + start_x - left, col + end_x - left,
+		 row + i_row - top, line);
+	  pixels += end_x - start_x;
 	}
-	pixels += (unsigned long)newrows * newcols;
       }
       else {
 	if (allow_incomplete) {
@@ -2001,7 +2306,7 @@ read_one_rgb_tiled(TIFF *tif, i_img_dim width, i_img_dim height, int allow_incom
 
     /* incomplete image */
     i_tags_setn(&im->tags, "i_incomplete", 1);
-    i_tags_setn(&im->tags, "i_lines_read", pixels / width);
+    i_tags_setn(&im->tags, "i_lines_read", pixels / (right - left));
   }
 
   myfree(line);
@@ -2044,7 +2349,7 @@ setup_paletted(read_state_t *state) {
   int i, ch;
   int color_count = 1 << state->bits_per_sample;
 
-  state->img = i_img_pal_new(state->width, state->height, 3, 256);
+  state->img = i_img_pal_new(state->right - state->left, state->bottom - state->top, 3, 256);
   if (!state->img)
     return 0;
 
@@ -2071,6 +2376,7 @@ tile_contig_getter(read_state_t *state, read_putter_t putter) {
   tf_uint32 this_tile_height, this_tile_width;
   tf_uint32 rows_left, cols_left;
   tf_uint32 x, y;
+  tf_uint32 left, top;
 
   state->raster = _TIFFmalloc(TIFFTileSize(state->tif));
   if (!state->raster) {
@@ -2080,12 +2386,16 @@ tile_contig_getter(read_state_t *state, read_putter_t putter) {
 
   TIFFGetField(state->tif, TIFFTAG_TILEWIDTH, &tile_width);
   TIFFGetField(state->tif, TIFFTAG_TILELENGTH, &tile_height);
-  rows_left = state->height;
-  for (y = 0; y < state->height; y += this_tile_height) {
+
+  /* only the tiles that intersect the region */
+  left = state->left - state->left % tile_width;
+  top = state->top - state->top % tile_height;
+  rows_left = state->height - top;
+  for (y = top; y < (tf_uint32)state->bottom; y += this_tile_height) {
     this_tile_height = rows_left > tile_height ? tile_height : rows_left;
 
-    cols_left = state->width;
-    for (x = 0; x < state->width; x += this_tile_width) {
+    cols_left = state->width - left;
+    for (x = left; x < (tf_uint32)state->right; x += this_tile_width) {
       this_tile_width = cols_left > tile_width ? tile_width : cols_left;
 
       if (TIFFReadTile(state->tif,
@@ -2121,8 +2431,11 @@ strip_contig_getter(read_state_t *state, read_putter_t putter) {
   }
   
   TIFFGetFieldDefaulted(state->tif, TIFFTAG_ROWSPERSTRIP, &rows_per_strip);
-  rows_left = state->height;
-  for (y = 0; y < state->height; y += strip_rows) {
+
+  /* only the strips that intersect the region */
+  y = state->top - state->top % rows_per_strip;
+  rows_left = state->height - y;
+  for (; y < (tf_uint32)state->bottom; y += strip_rows) {
     strip_rows = rows_left > rows_per_strip ? rows_per_strip : rows_left;
     if (TIFFReadEncodedStrip(state->tif,
 			     TIFFComputeStrip(state->tif, y, 0),
@@ -2140,13 +2453,44 @@ strip_contig_getter(read_state_t *state, read_putter_t putter) {
   return 1;
 }
 
+/* clip a row of width pixels starting at (x, y) in the file to the
+   region being read.  Returns non-zero if some of the row is within
+   the region, setting *out_x, *out_y to where it's stored in the
+   image, *skip to the number of pixels to skip at the start of the
+   row and *count to the number of pixels to store. */
+static int
+region_row(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width,
+	   i_img_dim *out_x, i_img_dim *out_y, i_img_dim *skip,
+	   i_img_dim *count) {
+  i_img_dim start = x;
+  i_img_dim end = x + width;
+
+  if (y < state->top || y >= state->bottom)
+    return 0;
+  if (start < state->left)
+    start = state->left;
+  if (end > state->right)
+    end = state->right;
+  if (start >= end)
+    return 0;
+
+  *out_x = start - state->left;
+  *out_y = y - state->top;
+  *skip = start - x;
+  *count = end - start;
+  state->pixels_read += *count;
+
+  return 1;
+}
+
 static int 
 paletted_putter8(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_dim height, int extras) {
   unsigned char *p = state->raster;
+  i_img_dim out_x, out_y, skip, count;
 
-  state->pixels_read += width * height;
   while (height > 0) {
-    i_ppal(state->img, x, x + width, y, p);
+    if (region_row(state, x, y, width, &out_x, &out_y, &skip, &count))
+      i_ppal(state->img, out_x, out_x + count, out_y, p + skip);
     p += width + extras;
     --height;
     ++y;
@@ -2160,14 +2504,17 @@ paletted_putter4(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width,
   tf_uint32 img_line_size = (width + 1) / 2;
   tf_uint32 skip_line_size = (width + extras + 1) / 2;
   unsigned char *p = state->raster;
+  i_img_dim out_x, out_y, skip, count;
 
   if (!state->line_buf)
-    state->line_buf = mymalloc(state->width);
+    state->line_buf = mymalloc(state->width + 1);
 
-  state->pixels_read += width * height;
   while (height > 0) {
-    unpack_4bit_to(state->line_buf, p, img_line_size);
-    i_ppal(state->img, x, x + width, y, state->line_buf);
+    if (region_row(state, x, y, width, &out_x, &out_y, &skip, &count)) {
+      unsigned char *line = state->line_buf;
+      unpack_4bit_to(line, p, img_line_size);
+      i_ppal(state->img, out_x, out_x + count, out_y, line + skip);
+    }
     p += skip_line_size;
     --height;
     ++y;
@@ -2273,7 +2620,7 @@ setup_16_rgb(read_state_t *state) {
 
   rgb_channels(state, &out_channels);
 
-  state->img = i_img_16_new(state->width, state->height, out_channels);
+  state->img = i_img_16_new(state->right - state->left, state->bottom - state->top, out_channels);
   if (!state->img)
     return 0;
   state->line_buf = mymalloc(sizeof(unsigned) * state->width * out_channels);
@@ -2287,7 +2634,7 @@ setup_16_grey(read_state_t *state) {
 
   grey_channels(state, &out_channels);
 
-  state->img = i_img_16_new(state->width, state->height, out_channels);
+  state->img = i_img_16_new(state->right - state->left, state->bottom - state->top, out_channels);
   if (!state->img)
     return 0;
   state->line_buf = mymalloc(sizeof(unsigned) * state->width * out_channels);
@@ -2298,16 +2645,24 @@ setup_16_grey(read_state_t *state) {
 static int 
 putter_16(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_dim height, 
 	  int row_extras) {
+  i_img_dim out_x, out_y, skip, count;
   tf_uint16 *p = state->raster;
   int out_chan = state->img->channels;
 
-  state->pixels_read += width * height;
   while (height > 0) {
     i_img_dim i;
     int ch;
     unsigned *outp = state->line_buf;
 
-    for (i = 0; i < width; ++i) {
+    if (!region_row(state, x, y, width, &out_x, &out_y, &skip, &count)) {
+      p += (width + row_extras) * state->samples_per_pixel;
+      --height;
+      ++y;
+      continue;
+    }
+
+    p += skip * state->samples_per_pixel;
+    for (i = 0; i < count; ++i) {
       for (ch = 0; ch < out_chan; ++ch) {
 	outp[ch] = p[ch];
       }
@@ -2325,9 +2680,9 @@ putter_16(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_
       outp += out_chan;
     }
 
-    i_psamp_bits(state->img, x, x + width, y, state->line_buf, NULL, out_chan, 16);
+    i_psamp_bits(state->img, out_x, out_x + count, out_y, state->line_buf, NULL, out_chan, 16);
 
-    p += row_extras * state->samples_per_pixel;
+    p += (width - skip - count + row_extras) * state->samples_per_pixel;
     --height;
     ++y;
   }
@@ -2341,7 +2696,7 @@ setup_8_rgb(read_state_t *state) {
 
   rgb_channels(state, &out_channels);
 
-  state->img = i_img_8_new(state->width, state->height, out_channels);
+  state->img = i_img_8_new(state->right - state->left, state->bottom - state->top, out_channels);
   if (!state->img)
     return 0;
   state->line_buf = mymalloc(sizeof(unsigned) * state->width * out_channels);
@@ -2355,7 +2710,7 @@ setup_8_grey(read_state_t *state) {
 
   grey_channels(state, &out_channels);
 
-  state->img = i_img_8_new(state->width, state->height, out_channels);
+  state->img = i_img_8_new(state->right - state->left, state->bottom - state->top, out_channels);
   if (!state->img)
     return 0;
   state->line_buf = mymalloc(sizeof(i_color) * state->width * out_channels);
@@ -2366,16 +2721,24 @@ setup_8_grey(read_state_t *state) {
 static int 
 putter_8(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_dim height, 
 	  int row_extras) {
+  i_img_dim out_x, out_y, skip, count;
   unsigned char *p = state->raster;
   int out_chan = state->img->channels;
 
-  state->pixels_read += width * height;
   while (height > 0) {
     i_img_dim i;
     int ch;
     i_color *outp = state->line_buf;
 
-    for (i = 0; i < width; ++i) {
+    if (!region_row(state, x, y, width, &out_x, &out_y, &skip, &count)) {
+      p += (width + row_extras) * state->samples_per_pixel;
+      --height;
+      ++y;
+      continue;
+    }
+
+    p += skip * state->samples_per_pixel;
+    for (i = 0; i < count; ++i) {
       for (ch = 0; ch < out_chan; ++ch) {
 	outp->channel[ch] = p[ch];
       }
@@ -2395,9 +2758,9 @@ putter_8(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_d
       outp++;
     }
 
-    i_plin(state->img, x, x + width, y, state->line_buf);
+    i_plin(state->img, out_x, out_x + count, out_y, state->line_buf);
 
-    p += row_extras * state->samples_per_pixel;
+    p += (width - skip - count + row_extras) * state->samples_per_pixel;
     --height;
     ++y;
   }
@@ -2411,7 +2774,7 @@ setup_32_rgb(read_state_t *state) {
 
   rgb_channels(state, &out_channels);
 
-  state->img = i_img_double_new(state->width, state->height, out_channels);
+  state->img = i_img_double_new(state->right - state->left, state->bottom - state->top, out_channels);
   if (!state->img)
     return 0;
   state->line_buf = mymalloc(sizeof(i_fcolor) * state->width);
@@ -2425,7 +2788,7 @@ setup_32_grey(read_state_t *state) {
 
   grey_channels(state, &out_channels);
 
-  state->img = i_img_double_new(state->width, state->height, out_channels);
+  state->img = i_img_double_new(state->right - state->left, state->bottom - state->top, out_channels);
   if (!state->img)
     return 0;
   state->line_buf = mymalloc(sizeof(i_fcolor) * state->width);
@@ -2436,16 +2799,24 @@ setup_32_grey(read_state_t *state) {
 static int 
 putter_32(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_dim height, 
 	  int row_extras) {
+  i_img_dim out_x, out_y, skip, count;
   tf_uint32 *p = state->raster;
   int out_chan = state->img->channels;
 
-  state->pixels_read += width * height;
   while (height > 0) {
     i_img_dim i;
     int ch;
     i_fcolor *outp = state->line_buf;
 
-    for (i = 0; i < width; ++i) {
+    if (!region_row(state, x, y, width, &out_x, &out_y, &skip, &count)) {
+      p += (width + row_extras) * state->samples_per_pixel;
+      --height;
+      ++y;
+      continue;
+    }
+
+    p += skip * state->samples_per_pixel;
+    for (i = 0; i < count; ++i) {
 #ifdef IEEEFP_TYPES
       if (state->sample_format == SAMPLEFORMAT_IEEEFP) {
 	const float *pv = (const float *)p;
@@ -2473,9 +2844,9 @@ putter_32(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_
       outp++;
     }
 
-    i_plinf(state->img, x, x + width, y, state->line_buf);
+    i_plinf(state->img, out_x, out_x + count, out_y, state->line_buf);
 
-    p += row_extras * state->samples_per_pixel;
+    p += (width - skip - count + row_extras) * state->samples_per_pixel;
     --height;
     ++y;
   }
@@ -2486,7 +2857,7 @@ putter_32(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_
 static int
 setup_bilevel(read_state_t *state) {
   i_color black, white;
-  state->img = i_img_pal_new(state->width, state->height, 1, 256);
+  state->img = i_img_pal_new(state->right - state->left, state->bottom - state->top, 1, 256);
   if (!state->img)
     return 0;
   black.channel[0] = black.channel[1] = black.channel[2] = 
@@ -2511,17 +2882,26 @@ putter_bilevel(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i
 	       int row_extras) {
   unsigned char *line_in = state->raster;
   size_t line_size = (width + row_extras + 7) / 8;
+  i_img_dim out_x, out_y, skip, count;
   
   /* tifflib returns the bits in MSB2LSB order even when the file is
      in LSB2MSB, so we only need to handle MSB2LSB */
-  state->pixels_read += width * height;
   while (height > 0) {
     i_img_dim i;
     unsigned char *outp = state->line_buf;
-    unsigned char *inp = line_in;
-    unsigned mask = 0x80;
+    unsigned char *inp;
+    unsigned mask;
+
+    if (!region_row(state, x, y, width, &out_x, &out_y, &skip, &count)) {
+      line_in += line_size;
+      --height;
+      ++y;
+      continue;
+    }
 
-    for (i = 0; i < width; ++i) {
+    inp = line_in + skip / 8;
+    mask = 0x80 >> (skip % 8);
+    for (i = 0; i < count; ++i) {
       *outp++ = *inp & mask ? 1 : 0;
       mask >>= 1;
       if (!mask) {
@@ -2530,7 +2910,7 @@ putter_bilevel(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i
       }
     }
 
-    i_ppal(state->img, x, x + width, y, state->line_buf);
+    i_ppal(state->img, out_x, out_x + count, out_y, state->line_buf);
 
     line_in += line_size;
     --height;
@@ -2590,7 +2970,7 @@ setup_cmyk8(read_state_t *state) {
   int channels;
 
   cmyk_channels(state, &channels);
-  state->img = i_img_8_new(state->width, state->height, channels);
+  state->img = i_img_8_new(state->right - state->left, state->bottom - state->top, channels);
 
   state->line_buf = mymalloc(sizeof(i_color) * state->width);
 
@@ -2600,15 +2980,23 @@ setup_cmyk8(read_state_t *state) {
 static int 
 putter_cmyk8(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_dim height, 
 	       int row_extras) {
+  i_img_dim out_x, out_y, skip, count;
   unsigned char *p = state->raster;
 
-  state->pixels_read += width * height;
   while (height > 0) {
     i_img_dim i;
     int ch;
     i_color *outp = state->line_buf;
 
-    for (i = 0; i < width; ++i) {
+    if (!region_row(state, x, y, width, &out_x, &out_y, &skip, &count)) {
+      p += (width + row_extras) * state->samples_per_pixel;
+      --height;
+      ++y;
+      continue;
+    }
+
+    p += skip * state->samples_per_pixel;
+    for (i = 0; i < count; ++i) {
       unsigned char c, m, y, k;
       c = p[0];
       m = p[1];
@@ -2637,9 +3025,9 @@ putter_cmyk8(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_i
       outp++;
     }
 
-    i_plin(state->img, x, x + width, y, state->line_buf);
+    i_plin(state->img, out_x, out_x + count, out_y, state->line_buf);
 
-    p += row_extras * state->samples_per_pixel;
+    p += (width - skip - count + row_extras) * state->samples_per_pixel;
     --height;
     ++y;
   }
@@ -2652,7 +3040,7 @@ setup_cmyk16(read_state_t *state) {
   int channels;
 
   cmyk_channels(state, &channels);
-  state->img = i_img_16_new(state->width, state->height, channels);
+  state->img = i_img_16_new(state->right - state->left, state->bottom - state->top, channels);
 
   state->line_buf = mymalloc(sizeof(unsigned) * state->width * channels);
 
@@ -2662,6 +3050,7 @@ setup_cmyk16(read_state_t *state) {
 static int 
 putter_cmyk16(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_img_dim height, 
 	       int row_extras) {
+  i_img_dim out_x, out_y, skip, count;
   tf_uint16 *p = state->raster;
   int out_chan = state->img->channels;
 
@@ -2669,13 +3058,20 @@ putter_cmyk16(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_
 	  ", %" i_DF ", %d)\n", state, i_DFcp(x, y), i_DFcp(width, height),
 	  row_extras));
 
-  state->pixels_read += width * height;
   while (height > 0) {
     i_img_dim i;
     int ch;
     unsigned *outp = state->line_buf;
 
-    for (i = 0; i < width; ++i) {
+    if (!region_row(state, x, y, width, &out_x, &out_y, &skip, &count)) {
+      p += (width + row_extras) * state->samples_per_pixel;
+      --height;
+      ++y;
+      continue;
+    }
+
+    p += skip * state->samples_per_pixel;
+    for (i = 0; i < count; ++i) {
       unsigned c, m, y, k;
       c = p[0];
       m = p[1];
@@ -2704,9 +3100,9 @@ putter_cmyk16(read_state_t *state, i_img_dim x, i_img_dim y, i_img_dim width, i_
       outp += out_chan;
     }
 
-    i_psamp_bits(state->img, x, x + width, y, state->line_buf, NULL, out_chan, 16);
+    i_psamp_bits(state->img, out_x, out_x + count, out_y, state->line_buf, NULL, out_chan, 16);
 
-    p += row_extras * state->samples_per_pixel;
+    p += (width - skip - count + row_extras) * state->samples_per_pixel;
     --height;
     ++y;
   }
@@ -5,11 +5,24 @@
 
 void i_tiff_init(void);
 i_img   * i_readtiff_wiol(io_glue *ig, int allow_incomplete, int page);
+i_img   * i_readtiff_wiol_region(io_glue *ig, int allow_incomplete, int page,
+				 const i_img_dim *region);
 i_img  ** i_readtiff_multi_wiol(io_glue *ig, int *count);
 undef_int i_writetiff_wiol(i_img *im, io_glue *ig);
 undef_int i_writetiff_multi_wiol(io_glue *ig, i_img **imgs, int count);
 undef_int i_writetiff_wiol_faxable(i_img *im, io_glue *ig, int fine);
 undef_int i_writetiff_multi_wiol_faxable(io_glue *ig, i_img **imgs, int count, int fine);
+
+typedef struct i_tiff_writer_tag i_tiff_writer;
+typedef i_tiff_writer *Imager__File__TIFF__Writer;
+
+i_tiff_writer *i_writetiff_stream_new(io_glue *ig, i_img_dim xsize,
+				      i_img_dim ysize, int channels,
+				      i_img_tags *tags);
+int i_writetiff_stream_write(i_tiff_writer *w, const i_sample_t *samples,
+			     size_t count);
+int i_writetiff_stream_close(i_tiff_writer *w);
+void i_writetiff_stream_destroy(i_tiff_writer *w);
 char const * i_tiff_libversion(void);
 char const * i_tiff_builddate(void);
 char const * i_tiff_buildversion(void);
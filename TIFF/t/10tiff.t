@@ -907,4 +907,100 @@ SKIP:
      "got expected compression");
 }
 
+{ # reading a region
+  my $data;
+  ok(test_image()->write(data => \$data, type => "tiff"),
+     "write an image for region tests");
+  my @files =
+    (
+     [ "strips", data => $data ],
+     map [ $_, file => "testimg/$_" ],
+     qw(srgb.tif srgba16.tif srgba32.tif grey16.tif grey32.tif comp4.tif
+	comp8.tif imager.tif scmyk.tif scmyka16.tif pengtile.tif slab.tif)
+    );
+  for my $file (@files) {
+    my ($name, @src) = @$file;
+    my $full = Imager->new(@src, filetype => "tiff");
+    ok($full, "$name: read full image")
+      or do { diag(Imager->errstr); next; };
+    my ($w, $h) = ($full->getwidth, $full->getheight);
+    for my $region ([ int($w / 3), int($h / 4), int($w * 3 / 4), $h - 1 ],
+		    [ 1, 1, 2, 2 ], [ 0, 0, $w, $h ]) {
+      my $im = Imager->new(@src, filetype => "tiff", region => $region);
+      ok($im, "$name: read region @$region")
+	or do { diag(Imager->errstr); next; };
+      my $expect = $full->crop(left => $region->[0], top => $region->[1],
+			       right => $region->[2], bottom => $region->[3]);
+      is_image($im, $expect, "$name: matches crop of full image");
+      is($im->bits, $full->bits, "$name: same sample size");
+    }
+  }
+  {
+    my $im = Imager->new;
+    ok(!$im->read(data => $data, type => "tiff", region => [ 1000, 0, 1010, 10 ]),
+       "fail to read region outside the image");
+    is($im->errstr, "region is outside the image", "check message");
+  }
+}
+
+{ # streaming writes
+  my $src = test_image()->scale(xpixels => 150, ypixels => 130,
+				type => "nonprop");
+  for my $channels (1 .. 4) {
+    my $im = $src;
+    $channels < 3 and $im = $im->convert(preset => "gray");
+    $channels % 2 or $im = $im->convert(preset => "addalpha");
+    my $data;
+    my $out = Imager->write_stream(data => \$data, type => "tiff",
+				   xsize => 150, ysize => 130,
+				   channels => $channels,
+				   tiff_documentname => "stream")
+      or diag(Imager->errstr);
+    ok($out, "$channels channels: start stream");
+    my $ok = 1;
+    for (my $y = 0; $y < 130; $y += 50) {
+      $out->write_rows($im->crop(top => $y, height => 50))
+	or $ok = 0;
+    }
+    ok($ok, "$channels channels: write bands");
+    ok($out->close, "$channels channels: close")
+      or diag(Imager->errstr);
+    my $back = Imager->new(data => $data, filetype => "tiff");
+    ok($back, "$channels channels: read it back");
+    is_image($back, $im, "$channels channels: check image");
+    is($back->tags(name => "tiff_documentname"), "stream",
+       "$channels channels: check tag");
+  }
+  {
+    my $data;
+    my $out = Imager->write_stream(data => \$data, type => "tiff",
+				   xsize => 10, ysize => 10);
+    ok($out->write_samples("\0" x 90), "write 3 rows of samples");
+    ok(!$out->close, "fail to close early");
+    is(Imager->errstr, "only 3 of 10 rows written", "check message");
+    ok($out->write_samples("\0" x 210), "write the rest");
+    ok($out->close, "close");
+  }
+  { # abandoned without close, the writer finishes the file as it's
+    # destroyed, whatever order perl releases the I/O layer in
+    my $data;
+    my $out = Imager->write_stream(data => \$data, type => "tiff",
+				   xsize => 10, ysize => 10);
+    ok($out->write_samples("\0" x 90), "abandon: write 3 rows");
+    delete $out->{IO};
+    undef $out;
+    ok(1, "abandon: destroyed after the I/O layer");
+
+    open my $fh, ">", "testout/t106_abandon.tif"
+      or die "Cannot create testout/t106_abandon.tif: $!";
+    binmode $fh;
+    $out = Imager->write_stream(fh => $fh, type => "tiff",
+				xsize => 10, ysize => 10);
+    ok($out->write_samples("\0" x 90), "abandon: write 3 rows to a handle");
+    undef $fh;
+    undef $out;
+    ok(1, "abandon: destroyed with only the stream holding the handle");
+  }
+}
+
 done_testing();
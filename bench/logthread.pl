@@ -0,0 +1,36 @@
+#!perl -w
+use strict;
+use threads;
+use Imager;
+use Time::HiRes qw(time);
+
+# time logging from increasing numbers of threads, each thread has its
+# own context, but they all write to the same log file
+#
+#   perl -Mblib bench/logthread.pl [messages per thread]
+
+my $count = shift || 20000;
+
+Imager->open_log(log => "bench/logthread.log")
+  or die "Cannot open log: ", Imager->errstr;
+
+for my $threads (1, 2, 4, 8, 16, 32) {
+  my $start = time;
+  my @threads = map {
+    threads->create
+      (
+       sub {
+         my ($id) = @_;
+         Imager->log("thread $id message $_\n") for 1 .. $count;
+         1;
+       }, $_
+      );
+  } 1 .. $threads;
+  $_->join for @threads;
+  my $elapsed = time - $start;
+  printf "%2d threads: %.3fs, %.0f messages/s\n", $threads, $elapsed,
+    $threads * $count / $elapsed;
+}
+
+Imager->close_log;
+unlink "bench/logthread.log";
@@ -742,7 +742,7 @@ read_1bit_bmp(io_glue *ig, int xsize, int ysize, int clr_used,
   unsigned char *packed;
   int line_size = (xsize + 7)/8;
   int bit;
-  unsigned char *in;
+  const unsigned char *in;
   long base_offset;
   dIMCTXio(ig);
 
@@ -815,7 +815,7 @@ read_1bit_bmp(io_glue *ig, int xsize, int ysize, int clr_used,
   packed = mymalloc(line_size); /* checked 29jun05 tonyc */
   line = mymalloc(xsize+8); /* checked 29jun05 tonyc */
   while (y != lasty) {
-    if (i_io_read(ig, packed, line_size) != line_size) {
+    if (i_io_read_ptr(ig, &in, packed, line_size) != line_size) {
       myfree(packed);
       myfree(line);
       if (allow_incomplete) {
@@ -829,7 +829,6 @@ read_1bit_bmp(io_glue *ig, int xsize, int ysize, int clr_used,
         return NULL;
       }
     }
-    in = packed;
     bit = 0x80;
     p = line;
     for (x = 0; x < xsize; ++x) {
@@ -869,7 +868,6 @@ read_4bit_bmp(io_glue *ig, int xsize, int ysize, int clr_used,
   i_palidx *line, *p;
   unsigned char *packed;
   int line_size = (xsize + 1)/2;
-  unsigned char *in;
   int size, i;
   long base_offset;
   int starty;
@@ -937,7 +935,8 @@ read_4bit_bmp(io_glue *ig, int xsize, int ysize, int clr_used,
   if (compression == BI_RGB) {
     i_tags_add(&im->tags, "bmp_compression_name", 0, "BI_RGB", -1, 0);
     while (y != lasty) {
-      if (i_io_read(ig, packed, line_size) != line_size) {
+      const unsigned char *row;
+      if (i_io_read_ptr(ig, &row, packed, line_size) != line_size) {
 	myfree(packed);
 	myfree(line);
         if (allow_incomplete) {
@@ -951,12 +950,11 @@ read_4bit_bmp(io_glue *ig, int xsize, int ysize, int clr_used,
           return NULL;
         }
       }
-      in = packed;
       p = line;
       for (x = 0; x < xsize; x+=2) {
-	*p++ = *in >> 4;
-	*p++ = *in & 0x0F;
-	++in;
+	*p++ = *row >> 4;
+	*p++ = *row & 0x0F;
+	++row;
       }
       i_ppal(im, 0, xsize, y, line);
       y += yinc;
@@ -1164,7 +1162,8 @@ read_8bit_bmp(io_glue *ig, int xsize, int ysize, int clr_used,
   if (compression == BI_RGB) {
     i_tags_add(&im->tags, "bmp_compression_name", 0, "BI_RGB", -1, 0);
     while (y != lasty) {
-      if (i_io_read(ig, line, line_size) != line_size) {
+      const unsigned char *row;
+      if (i_io_read_ptr(ig, &row, line, line_size) != line_size) {
 	myfree(line);
         if (allow_incomplete) {
           i_tags_setn(&im->tags, "i_incomplete", 1);
@@ -1177,7 +1176,7 @@ read_8bit_bmp(io_glue *ig, int xsize, int ysize, int clr_used,
           return NULL;
         }
       }
-      i_ppal(im, 0, xsize, y, line);
+      i_ppal(im, 0, xsize, y, row);
       y += yinc;
     }
     myfree(line);
@@ -1342,8 +1341,9 @@ read_direct_bmp(io_glue *ig, int xsize, int ysize, int bit_count,
   i_color *line, *p;
   int pix_size = bit_count / 8;
   int line_size = xsize * pix_size;
+  int data_size = line_size;
+  unsigned char *packed;
   struct bm_masks masks;
-  char unpack_code[2] = "";
   int i;
   int extras;
   char junk[4];
@@ -1352,9 +1352,6 @@ read_direct_bmp(io_glue *ig, int xsize, int ysize, int bit_count,
   long base_offset = FILEHEAD_SIZE + INFOHEAD_SIZE;
   dIMCTXio(ig);
   
-  unpack_code[0] = "v3V"[pix_size-2];
-  unpack_code[1] = '\0';
-
   line_size = (line_size+3) / 4 * 4;
   extras = line_size - xsize * pix_size;
 
@@ -1458,23 +1455,35 @@ read_direct_bmp(io_glue *ig, int xsize, int ysize, int bit_count,
     return NULL;
   }
   line = mymalloc(bytes); /* checked 29jun05 tonyc */
+  packed = mymalloc(data_size);
   while (y != lasty) {
+    const unsigned char *in;
+    /* the padding is read separately, a missing pad at the end of the
+       file isn't an error */
+    if (i_io_read_ptr(ig, &in, packed, data_size) != data_size) {
+      myfree(line);
+      myfree(packed);
+      if (allow_incomplete) {
+        i_tags_setn(&im->tags, "i_incomplete", 1);
+        i_tags_setn(&im->tags, "i_lines_read", abs(starty - y));
+        return im;
+      }
+      else {
+        i_push_error(0, "failed reading image data");
+        i_img_destroy(im);
+        return NULL;
+      }
+    }
     p = line;
     for (x = 0; x < xsize; ++x) {
-      i_packed_t pixel;
-      if (!read_packed(ig, unpack_code, &pixel)) {
-        myfree(line);
-        if (allow_incomplete) {
-          i_tags_setn(&im->tags, "i_incomplete", 1);
-          i_tags_setn(&im->tags, "i_lines_read", abs(starty - y));
-          return im;
-        }
-        else {
-          i_push_error(0, "failed reading image data");
-          i_img_destroy(im);
-          return NULL;
-        }
-      }
+      /* little endian 16, 24 or 32-bit */
+      i_packed_t pixel = in[0] + ((i_packed_t)in[1] << 8);
+      if (pix_size > 2)
+        pixel += (i_packed_t)in[2] << 16;
+      if (pix_size > 3)
+        pixel += (i_packed_t)in[3] << 24;
+      in += pix_size;
+
       for (i = 0; i < 3; ++i) {
 	int sample = (pixel & masks.masks[i]) >> masks.shifts[i];
 	int bits = masks.bits[i];
@@ -1494,6 +1503,7 @@ read_direct_bmp(io_glue *ig, int xsize, int ysize, int bit_count,
     y += yinc;
   }
   myfree(line);
+  myfree(packed);
 
   return im;
 }
@@ -33,6 +33,8 @@ im_context_new(void) {
 #ifdef IMAGER_LOG
   ctx->log_level = 0;
   ctx->lg_file = NULL;
+  ctx->log_time = 0;
+  ctx->log_date[0] = '\0';
 #endif
   ctx->max_width = 0;
   ctx->max_height = 0;
@@ -47,6 +49,9 @@ im_context_new(void) {
 
   ctx->file_magic = NULL;
 
+  ctx->threads = 1;
+  ctx->work_pool = NULL;
+
   ctx->refcount = 1;
 
 #ifdef IMAGER_TRACE_CONTEXT
@@ -111,16 +116,24 @@ im_context_refdec(im_context_t ctx, const char *where) {
   if (ctx->refcount != 0)
     return;
 
-  /* lock here to avoid slot_destructors from being moved under us */
-  i_mutex_lock(slot_mutex);
   for (slot = 0; slot < ctx->slot_alloc; ++slot) {
-    if (ctx->slots[slot] && slot_destructors[slot])
-      slot_destructors[slot](ctx->slots[slot]);
+    if (ctx->slots[slot]) {
+      im_slot_destroy_t destructor;
+
+      /* lock here to avoid slot_destructors from being moved under
+         us, but don't hold the lock while the destructor runs */
+      i_mutex_lock(slot_mutex);
+      destructor = slot_destructors[slot];
+      i_mutex_unlock(slot_mutex);
+      if (destructor)
+        destructor(ctx->slots[slot]);
+    }
   }
-  i_mutex_unlock(slot_mutex);
 
   free(ctx->slots);
 
+  im_work_pool_destroy(ctx->work_pool);
+
   for (i = 0; i < IM_ERROR_COUNT; ++i) {
     if (ctx->error_stack[i].msg)
       myfree(ctx->error_stack[i].msg);
@@ -177,6 +190,8 @@ im_context_clone(im_context_t ctx, const char *where) {
   }
 #ifdef IMAGER_LOG
   nctx->log_level = ctx->log_level;
+  nctx->log_time = 0;
+  nctx->log_date[0] = '\0';
   if (ctx->lg_file) {
     if (ctx->own_log) {
       int newfd = dup(fileno(ctx->lg_file));
@@ -209,6 +224,10 @@ im_context_clone(im_context_t ctx, const char *where) {
   nctx->max_height = ctx->max_height;
   nctx->max_bytes = ctx->max_bytes;
 
+  /* the new context gets its own workers when it needs them */
+  nctx->threads = ctx->threads;
+  nctx->work_pool = NULL;
+
   nctx->refcount = 1;
 
   {
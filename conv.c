@@ -0,0 +1,364 @@
+#define IM_ROUND_8(x) ((int)((x)+0.5))
+#define IM_ROUND_double(x) (x)
+#define IM_LIMIT_8(x) ((x) < 0 ? 0 : (x) > 255 ? 255 : (x))
+#define IM_LIMIT_double(x) ((x) < 0.0 ? 0.0 : (x) > 1.0 ? 1.0 : (x))
+#line 1 "conv.im"
+#define IMAGER_NO_CONTEXT
+#include "imager.h"
+#include "imageri.h"
+
+typedef struct {
+  i_img *src;  /* rows are read from here */
+  i_img *dest; /* and written here, may be the same image */
+  const double *coeff;
+  int len;
+  double pc;
+} conv_state;
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 14 "conv.im"
+static void
+conv_band_8(void *p, i_img_dim start, i_img_dim end);
+static void
+conv_row_8(i_sample_t *out, i_sample_t const *in, double *res,
+                    size_t row_samples, int channels, const double *coeff,
+                    int len, double pc);
+static void
+conv_column_8(i_sample_t *out, i_sample_t const *rows, double *res,
+                       size_t row_samples, i_img_dim y, i_img_dim ysize,
+                       const double *coeff, int len, double pc);
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 14 "conv.im"
+static void
+conv_band_double(void *p, i_img_dim start, i_img_dim end);
+static void
+conv_row_double(i_fsample_t *out, i_fsample_t const *in, double *res,
+                    size_t row_samples, int channels, const double *coeff,
+                    int len, double pc);
+static void
+conv_column_double(i_fsample_t *out, i_fsample_t const *rows, double *res,
+                       size_t row_samples, i_img_dim y, i_img_dim ysize,
+                       const double *coeff, int len, double pc);
+#line 25 "conv.im"
+
+/*
+  General convolution for 2d decoupled filters
+  end effects are acounted for by increasing
+  scaling the result with the sum of used coefficients
+
+  coeff: (double array) coefficients for filter
+    len: length of filter.. number of coefficients
+           note that this has to be an odd number
+           (since the filter is even);
+
+  Rows are fetched with i_gsamp()/i_gsampf() into a buffer padded
+  with copies of the edge pixels, so the horizontal pass is a simple
+  multiply-accumulate over contiguous samples.  The horizontally
+  filtered rows are kept in a ring buffer of len rows, and the
+  vertical pass accumulates down that buffer a row at a time, so we
+  never need a full size work image.
+
+  The horizontal results are stored at the image's sample size, and
+  the accumulation order is the same as the old per-pixel code, so
+  results for 8-bit images are unchanged.
+
+  With worker threads each band of rows has its own ring buffer and
+  reads from a copy of the image, since the neighbouring bands
+  overwrite the rows just outside the band.
+*/
+
+int
+i_conv(i_img *im, const double *coeff,int len) {
+  int c;
+  double pc;
+  size_t row_samples;
+  conv_state state;
+  im_work_band_f band;
+  dIMCTXim(im);
+
+  im_log((aIMCTX,1,"i_conv(im %p, coeff %p, len %d)\n",im,coeff,len));
+  im_clear_error(aIMCTX);
+
+  if (len < 1) {
+    im_push_error(aIMCTX, 0, "there must be at least one coefficient");
+    return 0;
+  }
+
+  pc = 0;
+  for (c = 0; c < len; ++c)
+    pc += coeff[c];
+
+  if (pc == 0) {
+    i_push_error(0, "sum of coefficients is zero");
+    return 0;
+  }
+
+  row_samples = (size_t)im->xsize * im->channels;
+  if ((size_t)len > im_size_t_max / sizeof(double) / row_samples) {
+    im_push_error(aIMCTX, 0, "integer overflow calculating row buffer size");
+    return 0;
+  }
+
+  state.coeff = coeff;
+  state.len = len;
+  state.pc = pc;
+  state.dest = im;
+  band = im->bits <= 8 ? conv_band_8 : conv_band_double;
+  if (i_img_work_safe(im) && im_work_split(aIMCTX, im->ysize, len)) {
+    /* bands overwrite rows their neighbours need to read */
+    state.src = i_copy(im);
+    im_work_bands(aIMCTX, im->ysize, len, band, &state);
+    i_img_destroy(state.src);
+  }
+  else {
+    /* in place, we only write rows we've finished reading */
+    state.src = im;
+    band(&state, 0, im->ysize);
+  }
+
+  return 1;
+}
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 105 "conv.im"
+
+/* filter rows start to end-1 of the image */
+static void
+conv_band_8(void *p, i_img_dim start, i_img_dim end) {
+  conv_state *state = p;
+  i_img *src = state->src;
+  int len = state->len;
+  int center = (len - 1) / 2;
+  int channels = src->channels;
+  size_t row_samples = (size_t)src->xsize * channels;
+  size_t padded_samples = row_samples + (size_t)(len - 1) * channels;
+  double *res = im_work_malloc(sizeof(double) * row_samples);
+  i_sample_t *in_row = im_work_malloc(sizeof(i_sample_t) * padded_samples);
+  i_sample_t *rows = im_work_malloc(sizeof(i_sample_t) * row_samples * len);
+  i_sample_t *out_row = im_work_malloc(sizeof(i_sample_t) * row_samples);
+  i_sample_t *row_start = in_row + (size_t)center * channels;
+  i_img_dim y, next_row;
+
+  next_row = start > center ? start - center : 0;
+  for (y = start; y < end; ++y) {
+    /* make sure every row the vertical pass needs has been filtered
+       horizontally, when working in place this only reads rows we
+       haven't written yet */
+    while (next_row < src->ysize && next_row < y + len - center) {
+      size_t i;
+      i_sample_t *p;
+      i_gsamp(src, 0, src->xsize, next_row, row_start, NULL, channels);
+
+      /* clamp to the edge pixels */
+      p = in_row;
+      for (i = 0; i < (size_t)center; ++i) {
+        memcpy(p, row_start, sizeof(i_sample_t) * channels);
+        p += channels;
+      }
+      p = row_start + row_samples;
+      for (i = 0; i < (size_t)(len - 1 - center); ++i) {
+        memcpy(p, row_start + row_samples - channels,
+               sizeof(i_sample_t) * channels);
+        p += channels;
+      }
+
+      conv_row_8(rows + (size_t)(next_row % len) * row_samples,
+                          in_row, res, row_samples, channels,
+                          state->coeff, len, state->pc);
+      ++next_row;
+    }
+
+    conv_column_8(out_row, rows, res, row_samples, y - center,
+                           src->ysize, state->coeff, len, state->pc);
+    i_psamp(state->dest, 0, src->xsize, y, out_row, NULL, channels);
+  }
+
+  im_work_free(in_row);
+  im_work_free(rows);
+  im_work_free(out_row);
+  im_work_free(res);
+}
+
+/* convolve a row of samples, padded with center pixels on each side,
+   writing the scaled result to out. */
+static void
+conv_row_8(i_sample_t *out, i_sample_t const *in, double *res,
+                    size_t row_samples, int channels, const double *coeff,
+                    int len, double pc) {
+  size_t i;
+  int c;
+
+  for (i = 0; i < row_samples; ++i)
+    res[i] = 0;
+  for (c = 0; c < len; ++c) {
+    i_sample_t const *p = in + (size_t)c * channels;
+    double co = coeff[c];
+    for (i = 0; i < row_samples; ++i)
+      res[i] += p[i] * co;
+  }
+  for (i = 0; i < row_samples; ++i) {
+    double temp = res[i] / pc;
+    out[i] = temp < 0 ? 0 : temp > 255 ? 255 : (i_sample_t)temp;
+  }
+}
+
+/* convolve vertically over the ring buffer of horizontally filtered
+   rows, y is the row matching coeff[0] and may be outside the image */
+static void
+conv_column_8(i_sample_t *out, i_sample_t const *rows, double *res,
+                       size_t row_samples, i_img_dim y, i_img_dim ysize,
+                       const double *coeff, int len, double pc) {
+  size_t i;
+  int c;
+
+  for (i = 0; i < row_samples; ++i)
+    res[i] = 0;
+  for (c = 0; c < len; ++c) {
+    i_img_dim yi = y + c;
+    i_sample_t const *p;
+    double co = coeff[c];
+    if (yi < 0)
+      yi = 0;
+    else if (yi >= ysize)
+      yi = ysize - 1;
+    p = rows + (size_t)(yi % len) * row_samples;
+    for (i = 0; i < row_samples; ++i)
+      res[i] += p[i] * co;
+  }
+  for (i = 0; i < row_samples; ++i) {
+    double temp = res[i] / pc;
+    out[i] = temp < 0 ? 0 : temp > 255 ? 255 : (i_sample_t)temp;
+  }
+}
+
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 105 "conv.im"
+
+/* filter rows start to end-1 of the image */
+static void
+conv_band_double(void *p, i_img_dim start, i_img_dim end) {
+  conv_state *state = p;
+  i_img *src = state->src;
+  int len = state->len;
+  int center = (len - 1) / 2;
+  int channels = src->channels;
+  size_t row_samples = (size_t)src->xsize * channels;
+  size_t padded_samples = row_samples + (size_t)(len - 1) * channels;
+  double *res = im_work_malloc(sizeof(double) * row_samples);
+  i_fsample_t *in_row = im_work_malloc(sizeof(i_fsample_t) * padded_samples);
+  i_fsample_t *rows = im_work_malloc(sizeof(i_fsample_t) * row_samples * len);
+  i_fsample_t *out_row = im_work_malloc(sizeof(i_fsample_t) * row_samples);
+  i_fsample_t *row_start = in_row + (size_t)center * channels;
+  i_img_dim y, next_row;
+
+  next_row = start > center ? start - center : 0;
+  for (y = start; y < end; ++y) {
+    /* make sure every row the vertical pass needs has been filtered
+       horizontally, when working in place this only reads rows we
+       haven't written yet */
+    while (next_row < src->ysize && next_row < y + len - center) {
+      size_t i;
+      i_fsample_t *p;
+      i_gsampf(src, 0, src->xsize, next_row, row_start, NULL, channels);
+
+      /* clamp to the edge pixels */
+      p = in_row;
+      for (i = 0; i < (size_t)center; ++i) {
+        memcpy(p, row_start, sizeof(i_fsample_t) * channels);
+        p += channels;
+      }
+      p = row_start + row_samples;
+      for (i = 0; i < (size_t)(len - 1 - center); ++i) {
+        memcpy(p, row_start + row_samples - channels,
+               sizeof(i_fsample_t) * channels);
+        p += channels;
+      }
+
+      conv_row_double(rows + (size_t)(next_row % len) * row_samples,
+                          in_row, res, row_samples, channels,
+                          state->coeff, len, state->pc);
+      ++next_row;
+    }
+
+    conv_column_double(out_row, rows, res, row_samples, y - center,
+                           src->ysize, state->coeff, len, state->pc);
+    i_psampf(state->dest, 0, src->xsize, y, out_row, NULL, channels);
+  }
+
+  im_work_free(in_row);
+  im_work_free(rows);
+  im_work_free(out_row);
+  im_work_free(res);
+}
+
+/* convolve a row of samples, padded with center pixels on each side,
+   writing the scaled result to out. */
+static void
+conv_row_double(i_fsample_t *out, i_fsample_t const *in, double *res,
+                    size_t row_samples, int channels, const double *coeff,
+                    int len, double pc) {
+  size_t i;
+  int c;
+
+  for (i = 0; i < row_samples; ++i)
+    res[i] = 0;
+  for (c = 0; c < len; ++c) {
+    i_fsample_t const *p = in + (size_t)c * channels;
+    double co = coeff[c];
+    for (i = 0; i < row_samples; ++i)
+      res[i] += p[i] * co;
+  }
+  for (i = 0; i < row_samples; ++i) {
+    double temp = res[i] / pc;
+    out[i] = temp < 0 ? 0 : temp > 1.0 ? 1.0 : (i_fsample_t)temp;
+  }
+}
+
+/* convolve vertically over the ring buffer of horizontally filtered
+   rows, y is the row matching coeff[0] and may be outside the image */
+static void
+conv_column_double(i_fsample_t *out, i_fsample_t const *rows, double *res,
+                       size_t row_samples, i_img_dim y, i_img_dim ysize,
+                       const double *coeff, int len, double pc) {
+  size_t i;
+  int c;
+
+  for (i = 0; i < row_samples; ++i)
+    res[i] = 0;
+  for (c = 0; c < len; ++c) {
+    i_img_dim yi = y + c;
+    i_fsample_t const *p;
+    double co = coeff[c];
+    if (yi < 0)
+      yi = 0;
+    else if (yi >= ysize)
+      yi = ysize - 1;
+    p = rows + (size_t)(yi % len) * row_samples;
+    for (i = 0; i < row_samples; ++i)
+      res[i] += p[i] * co;
+  }
+  for (i = 0; i < row_samples; ++i) {
+    double temp = res[i] / pc;
+    out[i] = temp < 0 ? 0 : temp > 1.0 ? 1.0 : (i_fsample_t)temp;
+  }
+}
+
+#line 216 "conv.im"
@@ -0,0 +1,681 @@
+#define IM_ROUND_8(x) ((int)((x)+0.5))
+#define IM_ROUND_double(x) (x)
+#define IM_LIMIT_8(x) ((x) < 0 ? 0 : (x) > 255 ? 255 : (x))
+#define IM_LIMIT_double(x) ((x) < 0.0 ? 0.0 : (x) > 1.0 ? 1.0 : (x))
+#line 1 "gaussian.im"
+#define IMAGER_NO_CONTEXT
+#include "imager.h"
+#include "imageri.h"
+#include <math.h>
+
+static double
+gauss(int x, double std) {
+  return 1.0/(sqrt(2.0*PI)*std)*exp(-(double)(x)*(double)(x)/(2*std*std));
+}
+
+/* Counters are as follows
+ l:  lines
+ i:  columns
+ c:  filter coeffs
+ ch: channels
+ pc: coeff equalization
+*/
+
+
+
+int
+i_gaussian(i_img *im, double stddev) {
+  return i_gaussian2( im, stddev, stddev );
+}
+
+typedef struct s_gauss_coeff {
+    int diameter;
+    int radius;
+    double *coeff;
+} t_gauss_coeff;
+
+ 
+static t_gauss_coeff *build_coeff( i_img *im, double stddev ) {
+  double *coeff = NULL;
+  double pc;
+  int radius, diameter, i;
+  t_gauss_coeff *ret = mymalloc(sizeof(struct s_gauss_coeff));
+  ret->coeff = NULL;
+
+  if (im->bits <= 8)
+    radius = ceil(2 * stddev);
+  else
+    radius = ceil(3 * stddev);
+
+  diameter = 1 + radius * 2;
+
+  coeff = mymalloc(sizeof(double) * diameter);
+
+  for(i=0;i <= radius;i++) 
+    coeff[radius + i]=coeff[radius - i]=gauss(i, stddev);
+  pc=0.0;
+  for(i=0; i < diameter; i++)
+    pc+=coeff[i];
+  for(i=0;i < diameter;i++) {
+    coeff[i] /= pc;
+    // im_log((aIMCTX, 1, "i_gaussian2 Y i=%i coeff=%.2f\n", i, coeff[i] ));
+  }
+
+  ret->diameter = diameter;
+  ret->radius = radius;
+  ret->coeff = coeff;
+  return ret;
+}
+
+static void free_coeff(t_gauss_coeff *co ) {
+
+   if( co->coeff != NULL )
+     myfree( co->coeff );
+   myfree( co );
+}
+
+#define img_copy(dest, src) i_copyto( (dest), (src), 0,0, (src)->xsize,(src)->ysize, 0,0);
+
+typedef struct {
+  i_img *src;
+  i_img *dest;
+  const t_gauss_coeff *co;
+} t_gauss_pass;
+
+/* split a pass across the worker threads if both images allow it */
+static void
+gauss_bands(i_img *im, t_gauss_pass *pass, i_img_dim count,
+            im_work_band_f f) {
+  dIMCTXim(im);
+
+  if (i_img_work_safe(pass->src) && i_img_work_safe(pass->dest))
+    im_work_bands(aIMCTX, count, 4, f, pass);
+  else
+    f(pass, 0, count);
+}
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 93 "gaussian.im"
+
+/* blur rows start to end-1 horizontally */
+static void
+gauss_x_band_8(void *p, i_img_dim start, i_img_dim end) {
+  t_gauss_pass *pass = p;
+  i_img *im = pass->src;
+  const t_gauss_coeff *co = pass->co;
+  double res[MAXCHANNELS];
+  double pc;
+  int c, ch;
+  i_img_dim x, y;
+  i_color rcolor;
+
+  for(y = start; y < end; y++) {
+    for(x = 0; x < im->xsize; x++) {
+      pc=0.0;
+      for(ch=0;ch<im->channels;ch++)
+        res[ch]=0;
+      for(c = 0;c < co->diameter; c++)
+        if (i_gpix(im,x+c-co->radius,y,&rcolor)!=-1) {
+          for(ch=0;ch<im->channels;ch++)
+            res[ch]+= rcolor.channel[ch] * co->coeff[c];
+          pc+=co->coeff[c];
+        }
+      for(ch=0;ch<im->channels;ch++) {
+        double value = res[ch] / pc;
+        rcolor.channel[ch] = value > 255 ? 255 : IM_ROUND_8(value);
+      }
+      i_ppix(pass->dest, x, y, &rcolor);
+    }
+  }
+}
+
+/* blur columns start to end-1 vertically */
+static void
+gauss_y_band_8(void *p, i_img_dim start, i_img_dim end) {
+  t_gauss_pass *pass = p;
+  i_img *yin = pass->src;
+  const t_gauss_coeff *co = pass->co;
+  double res[MAXCHANNELS];
+  double pc;
+  int c, ch;
+  i_img_dim x, y;
+  i_color rcolor;
+
+  for(x = start;x < end; x++) {
+    for(y = 0; y < yin->ysize; y++) {
+      pc=0.0;
+      for(ch=0; ch<yin->channels; ch++)
+        res[ch]=0;
+      for(c=0; c < co->diameter; c++)
+        if (i_gpix(yin, x, y+c-co->radius, &rcolor)!=-1) {
+          for(ch=0;ch<yin->channels;ch++) 
+            res[ch]+= rcolor.channel[ch] * co->coeff[c];
+          pc+=co->coeff[c];
+        }
+      for(ch=0;ch<yin->channels;ch++) {
+        double value = res[ch]/pc;
+        rcolor.channel[ch] = value > 255 ? 255 : IM_ROUND_8(value);
+      }
+      i_ppix(pass->dest, x, y, &rcolor);
+    }
+  }
+}
+
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 93 "gaussian.im"
+
+/* blur rows start to end-1 horizontally */
+static void
+gauss_x_band_double(void *p, i_img_dim start, i_img_dim end) {
+  t_gauss_pass *pass = p;
+  i_img *im = pass->src;
+  const t_gauss_coeff *co = pass->co;
+  double res[MAXCHANNELS];
+  double pc;
+  int c, ch;
+  i_img_dim x, y;
+  i_fcolor rcolor;
+
+  for(y = start; y < end; y++) {
+    for(x = 0; x < im->xsize; x++) {
+      pc=0.0;
+      for(ch=0;ch<im->channels;ch++)
+        res[ch]=0;
+      for(c = 0;c < co->diameter; c++)
+        if (i_gpixf(im,x+c-co->radius,y,&rcolor)!=-1) {
+          for(ch=0;ch<im->channels;ch++)
+            res[ch]+= rcolor.channel[ch] * co->coeff[c];
+          pc+=co->coeff[c];
+        }
+      for(ch=0;ch<im->channels;ch++) {
+        double value = res[ch] / pc;
+        rcolor.channel[ch] = value > 1.0 ? 1.0 : IM_ROUND_double(value);
+      }
+      i_ppixf(pass->dest, x, y, &rcolor);
+    }
+  }
+}
+
+/* blur columns start to end-1 vertically */
+static void
+gauss_y_band_double(void *p, i_img_dim start, i_img_dim end) {
+  t_gauss_pass *pass = p;
+  i_img *yin = pass->src;
+  const t_gauss_coeff *co = pass->co;
+  double res[MAXCHANNELS];
+  double pc;
+  int c, ch;
+  i_img_dim x, y;
+  i_fcolor rcolor;
+
+  for(x = start;x < end; x++) {
+    for(y = 0; y < yin->ysize; y++) {
+      pc=0.0;
+      for(ch=0; ch<yin->channels; ch++)
+        res[ch]=0;
+      for(c=0; c < co->diameter; c++)
+        if (i_gpixf(yin, x, y+c-co->radius, &rcolor)!=-1) {
+          for(ch=0;ch<yin->channels;ch++) 
+            res[ch]+= rcolor.channel[ch] * co->coeff[c];
+          pc+=co->coeff[c];
+        }
+      for(ch=0;ch<yin->channels;ch++) {
+        double value = res[ch]/pc;
+        rcolor.channel[ch] = value > 1.0 ? 1.0 : IM_ROUND_double(value);
+      }
+      i_ppixf(pass->dest, x, y, &rcolor);
+    }
+  }
+}
+
+#line 159 "gaussian.im"
+
+int
+i_gaussian2(i_img *im, double stddevX, double stddevY) {
+  t_gauss_coeff *co = NULL;
+  t_gauss_pass pass;
+  i_img *timg;
+  i_img *yin;
+  i_img *yout;
+  dIMCTXim(im);
+
+  im_log((aIMCTX, 1,"i_gaussian2(im %p, stddev %.2f,%.2f)\n",im,stddevX,stddevY));
+  i_clear_error();
+
+  if (stddevX < 0) {
+    i_push_error(0, "stddevX must be positive");
+    return 0;
+  }
+  if (stddevY < 0) {
+    i_push_error(0, "stddevY must be positive");
+    return 0;
+  }
+
+  if( stddevX == stddevY && stddevY == 0 ) {
+    i_push_error(0, "stddevX or stddevY must be positive");
+    return 0;
+  }
+
+
+  /* totally silly cutoff */
+  if (stddevX > 1000) {
+    stddevX = 1000;
+  }
+  if (stddevY > 1000) {
+    stddevY = 1000;
+  }
+
+  timg = i_sametype(im, im->xsize, im->ysize);
+
+  if( stddevX > 0 ) {
+    /* Build Y coefficient matrix */
+    co = build_coeff( im, stddevX );
+    im_log((aIMCTX, 1, "i_gaussian2 X coeff radius=%i diamter=%i coeff=%p\n", co->radius, co->diameter, co->coeff));
+
+    /******************/
+    /* Process X blur */
+    im_log((aIMCTX, 1, "i_gaussian2 X blur from im=%p to timg=%p\n", im, timg));
+
+    pass.src = im;
+    pass.dest = timg;
+    pass.co = co;
+    gauss_bands(im, &pass, im->ysize,
+                im->bits <= 8 ? gauss_x_band_8 : gauss_x_band_double);
+
+    /* processing is im -> timg=yin -> im=yout */
+    yin = timg;
+    yout = im;
+  }
+  else {
+    im_log((aIMCTX, 1, "i_gaussian2 X coeff is unity\n"));
+
+    /* processing is im=yin -> timg=yout -> im */
+    yin = im;
+    yout = timg;
+  }
+  
+  if( stddevY > 0 ) {
+    if( stddevX != stddevY ) {
+      if( co != NULL ) {
+        free_coeff(co);
+        co = NULL;
+      }
+
+      /* Build Y coefficient matrix */
+      co = build_coeff( im, stddevY );
+      im_log((aIMCTX, 1, "i_gaussian2 Y coeff radius=%i diamter=%i coeff=%p\n", co->radius, co->diameter, co->coeff));
+    }
+
+    /******************/
+    /* Process Y blur */
+    im_log((aIMCTX, 1, "i_gaussian2 Y blur from yin=%p to yout=%p\n", yin, yout));
+
+    pass.src = yin;
+    pass.dest = yout;
+    pass.co = co;
+    gauss_bands(im, &pass, im->xsize,
+                im->bits <= 8 ? gauss_y_band_8 : gauss_y_band_double);
+
+    if( im != yout ) {
+      im_log((aIMCTX, 1, "i_gaussian2 copying yout=%p to im=%p\n", yout, im));
+      img_copy( im, yout );
+    }
+  }
+  else {
+    im_log((aIMCTX, 1, "i_gaussian2 Y coeff is unity\n"));
+    if( yin == timg ) {
+      im_log((aIMCTX, 1, "i_gaussian2 copying timg=%p to im=%p\n", timg, im));
+      img_copy( im, timg );
+    }
+  }
+
+  im_log((aIMCTX, 1, "i_gaussian2 im=%p\n", im));
+  im_log((aIMCTX, 1, "i_gaussian2 timg=%p\n", timg));
+  im_log((aIMCTX, 1, "i_gaussian2 yin=%p\n", yin));
+  im_log((aIMCTX, 1, "i_gaussian2 yout=%p\n", yout));
+
+  if( co != NULL )
+    free_coeff(co);
+
+  i_img_destroy(timg);
+  
+  return 1;
+}
+
+/* number of extended box passes used to approximate a gaussian,
+   more passes are more accurate but slower */
+#define GAUSS_BOX_PASSES 3
+
+/* number of columns processed at a time by the vertical passes */
+#define GAUSS_BOX_STRIP 32
+
+typedef struct {
+  i_img_dim radius;
+  double alpha;
+} t_ext_box;
+
+/*
+  Set up an extended box filter, GAUSS_BOX_PASSES of which have the
+  same variance as a gaussian with the given stddev.
+
+  The filter has weight 1 for taps within radius of the center and
+  weight alpha for the taps just outside that.
+
+  See Gwosdek, Grewenig, Bruhn and Weickert, "Theoretical Foundations
+  of Gaussian Convolution by Extended Box Filtering".
+*/
+
+static void
+ext_box_setup(t_ext_box *box, double stddev, i_img_dim size) {
+  double var = stddev * stddev / GAUSS_BOX_PASSES;
+  double r = floor(0.5 * sqrt(12.0 * var + 1.0) - 0.5);
+
+  if (r >= size) {
+    /* the box covers the whole line anyway */
+    box->radius = size;
+    box->alpha = 0;
+  }
+  else {
+    box->radius = (i_img_dim)r;
+    box->alpha = (2 * r + 1) * (3 * var - r * (r + 1))
+      / (6 * ((r + 1) * (r + 1) - var));
+  }
+}
+
+/*
+  Apply an extended box filter to count samples starting at line,
+  stride samples apart.
+
+  sums must have room for count+1 entries.
+
+  Like the exact code, taps outside the line are ignored and the
+  result scaled by the sum of the weights used.
+*/
+
+static void
+ext_box_line(double *line, ptrdiff_t stride, i_img_dim count,
+             double *sums, const t_ext_box *box) {
+  i_img_dim i;
+  i_img_dim r = box->radius;
+  double alpha = box->alpha;
+  double *p;
+
+  sums[0] = 0;
+  p = line;
+  for (i = 0; i < count; ++i) {
+    sums[i+1] = sums[i] + *p;
+    p += stride;
+  }
+
+  p = line;
+  for (i = 0; i < count; ++i) {
+    i_img_dim lo = i - r;
+    i_img_dim hi = i + r;
+    double sum, weight;
+
+    if (lo < 0)
+      lo = 0;
+    if (hi >= count)
+      hi = count - 1;
+    sum = sums[hi+1] - sums[lo];
+    weight = hi - lo + 1;
+    if (i - r - 1 >= 0) {
+      sum += alpha * (sums[i-r] - sums[i-r-1]);
+      weight += alpha;
+    }
+    if (i + r + 1 < count) {
+      sum += alpha * (sums[i+r+2] - sums[i+r+1]);
+      weight += alpha;
+    }
+    *p = sum / weight;
+    p += stride;
+  }
+}
+
+typedef struct {
+  i_img *im;
+  t_ext_box box;
+} t_box_pass;
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 368 "gaussian.im"
+
+/* blur rows start to end-1 horizontally */
+static void
+box_x_band_8(void *p, i_img_dim start, i_img_dim end) {
+  t_box_pass *pass = p;
+  i_img *im = pass->im;
+  size_t row_samples = (size_t)im->xsize * im->channels;
+  double *line = im_work_malloc(sizeof(double) * row_samples);
+  double *sums = im_work_malloc(sizeof(double) * (im->xsize + 1));
+  i_sample_t *samps = im_work_malloc(sizeof(i_sample_t) * row_samples);
+  i_img_dim y;
+  size_t i;
+  int ch, n;
+
+  for (y = start; y < end; ++y) {
+    i_gsamp(im, 0, im->xsize, y, samps, NULL, im->channels);
+    for (i = 0; i < row_samples; ++i)
+      line[i] = samps[i];
+    for (ch = 0; ch < im->channels; ++ch) {
+      for (n = 0; n < GAUSS_BOX_PASSES; ++n)
+        ext_box_line(line + ch, im->channels, im->xsize, sums, &pass->box);
+    }
+    for (i = 0; i < row_samples; ++i)
+      samps[i] = line[i] > 255 ? 255 : IM_LIMIT_8(IM_ROUND_8(line[i]));
+    i_psamp(im, 0, im->xsize, y, samps, NULL, im->channels);
+  }
+
+  im_work_free(samps);
+  im_work_free(sums);
+  im_work_free(line);
+}
+
+/* blur strips of GAUSS_BOX_STRIP columns, start to end-1, vertically */
+static void
+box_y_band_8(void *p, i_img_dim start, i_img_dim end) {
+  t_box_pass *pass = p;
+  i_img *im = pass->im;
+  size_t strip_samples = (size_t)GAUSS_BOX_STRIP * im->channels;
+  double *line = im_work_malloc(sizeof(double) * strip_samples * im->ysize);
+  double *sums = im_work_malloc(sizeof(double) * (im->ysize + 1));
+  i_sample_t *samps = im_work_malloc(sizeof(i_sample_t) * strip_samples);
+  i_img_dim strip, y;
+  size_t i;
+  int n;
+
+  for (strip = start; strip < end; ++strip) {
+    i_img_dim x = strip * GAUSS_BOX_STRIP;
+    i_img_dim width = im_min(GAUSS_BOX_STRIP, im->xsize - x);
+    size_t width_samples = (size_t)width * im->channels;
+    double *lp = line;
+
+    for (y = 0; y < im->ysize; ++y) {
+      i_gsamp(im, x, x + width, y, samps, NULL, im->channels);
+      for (i = 0; i < width_samples; ++i)
+        *lp++ = samps[i];
+    }
+    for (i = 0; i < width_samples; ++i) {
+      for (n = 0; n < GAUSS_BOX_PASSES; ++n)
+        ext_box_line(line + i, width_samples, im->ysize, sums, &pass->box);
+    }
+    lp = line;
+    for (y = 0; y < im->ysize; ++y) {
+      for (i = 0; i < width_samples; ++i) {
+        samps[i] = *lp > 255 ? 255 : IM_LIMIT_8(IM_ROUND_8(*lp));
+        ++lp;
+      }
+      i_psamp(im, x, x + width, y, samps, NULL, im->channels);
+    }
+  }
+
+  im_work_free(samps);
+  im_work_free(sums);
+  im_work_free(line);
+}
+
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 368 "gaussian.im"
+
+/* blur rows start to end-1 horizontally */
+static void
+box_x_band_double(void *p, i_img_dim start, i_img_dim end) {
+  t_box_pass *pass = p;
+  i_img *im = pass->im;
+  size_t row_samples = (size_t)im->xsize * im->channels;
+  double *line = im_work_malloc(sizeof(double) * row_samples);
+  double *sums = im_work_malloc(sizeof(double) * (im->xsize + 1));
+  i_fsample_t *samps = im_work_malloc(sizeof(i_fsample_t) * row_samples);
+  i_img_dim y;
+  size_t i;
+  int ch, n;
+
+  for (y = start; y < end; ++y) {
+    i_gsampf(im, 0, im->xsize, y, samps, NULL, im->channels);
+    for (i = 0; i < row_samples; ++i)
+      line[i] = samps[i];
+    for (ch = 0; ch < im->channels; ++ch) {
+      for (n = 0; n < GAUSS_BOX_PASSES; ++n)
+        ext_box_line(line + ch, im->channels, im->xsize, sums, &pass->box);
+    }
+    for (i = 0; i < row_samples; ++i)
+      samps[i] = line[i] > 1.0 ? 1.0 : IM_LIMIT_double(IM_ROUND_double(line[i]));
+    i_psampf(im, 0, im->xsize, y, samps, NULL, im->channels);
+  }
+
+  im_work_free(samps);
+  im_work_free(sums);
+  im_work_free(line);
+}
+
+/* blur strips of GAUSS_BOX_STRIP columns, start to end-1, vertically */
+static void
+box_y_band_double(void *p, i_img_dim start, i_img_dim end) {
+  t_box_pass *pass = p;
+  i_img *im = pass->im;
+  size_t strip_samples = (size_t)GAUSS_BOX_STRIP * im->channels;
+  double *line = im_work_malloc(sizeof(double) * strip_samples * im->ysize);
+  double *sums = im_work_malloc(sizeof(double) * (im->ysize + 1));
+  i_fsample_t *samps = im_work_malloc(sizeof(i_fsample_t) * strip_samples);
+  i_img_dim strip, y;
+  size_t i;
+  int n;
+
+  for (strip = start; strip < end; ++strip) {
+    i_img_dim x = strip * GAUSS_BOX_STRIP;
+    i_img_dim width = im_min(GAUSS_BOX_STRIP, im->xsize - x);
+    size_t width_samples = (size_t)width * im->channels;
+    double *lp = line;
+
+    for (y = 0; y < im->ysize; ++y) {
+      i_gsampf(im, x, x + width, y, samps, NULL, im->channels);
+      for (i = 0; i < width_samples; ++i)
+        *lp++ = samps[i];
+    }
+    for (i = 0; i < width_samples; ++i) {
+      for (n = 0; n < GAUSS_BOX_PASSES; ++n)
+        ext_box_line(line + i, width_samples, im->ysize, sums, &pass->box);
+    }
+    lp = line;
+    for (y = 0; y < im->ysize; ++y) {
+      for (i = 0; i < width_samples; ++i) {
+        samps[i] = *lp > 1.0 ? 1.0 : IM_LIMIT_double(IM_ROUND_double(*lp));
+        ++lp;
+      }
+      i_psampf(im, x, x + width, y, samps, NULL, im->channels);
+    }
+  }
+
+  im_work_free(samps);
+  im_work_free(sums);
+  im_work_free(line);
+}
+
+#line 444 "gaussian.im"
+
+/*
+  Gaussian blur approximated with a cascade of extended box filters.
+
+  Unlike i_gaussian2() the cost per pixel doesn't depend on the
+  standard deviation.
+
+  Each row, or strip of columns, is processed independently, so the
+  work is done in place and split across the worker threads.
+*/
+
+int
+i_gaussian_box(i_img *im, double stddevX, double stddevY) {
+  t_box_pass pass;
+  size_t strip_samples;
+  int threaded = i_img_work_safe(im);
+  dIMCTXim(im);
+
+  im_log((aIMCTX, 1,"i_gaussian_box(im %p, stddev %.2f,%.2f)\n",im,stddevX,stddevY));
+  i_clear_error();
+
+  if (stddevX < 0) {
+    i_push_error(0, "stddevX must be positive");
+    return 0;
+  }
+  if (stddevY < 0) {
+    i_push_error(0, "stddevY must be positive");
+    return 0;
+  }
+
+  if( stddevX == stddevY && stddevY == 0 ) {
+    i_push_error(0, "stddevX or stddevY must be positive");
+    return 0;
+  }
+
+  strip_samples = (size_t)GAUSS_BOX_STRIP * im->channels;
+  if ((size_t)im->ysize > im_size_t_max / sizeof(double) / strip_samples) {
+    i_push_error(0, "integer overflow calculating strip buffer size");
+    return 0;
+  }
+
+  pass.im = im;
+  if (stddevX > 0) {
+    im_work_band_f f = im->bits <= 8 ? box_x_band_8 : box_x_band_double;
+
+    ext_box_setup(&pass.box, stddevX, im->xsize);
+    im_log((aIMCTX, 1, "i_gaussian_box X radius=%" i_DF " alpha=%f\n",
+            i_DFc(pass.box.radius), pass.box.alpha));
+    if (threaded)
+      im_work_bands(aIMCTX, im->ysize, 4, f, &pass);
+    else
+      f(&pass, 0, im->ysize);
+  }
+
+  if (stddevY > 0) {
+    im_work_band_f f = im->bits <= 8 ? box_y_band_8 : box_y_band_double;
+    i_img_dim strips = (im->xsize + GAUSS_BOX_STRIP - 1) / GAUSS_BOX_STRIP;
+
+    ext_box_setup(&pass.box, stddevY, im->ysize);
+    im_log((aIMCTX, 1, "i_gaussian_box Y radius=%" i_DF " alpha=%f\n",
+            i_DFc(pass.box.radius), pass.box.alpha));
+    if (threaded)
+      im_work_bands(aIMCTX, strips, 1, f, &pass);
+    else
+      f(&pass, 0, strips);
+  }
+
+  return 1;
+}
@@ -34,12 +34,6 @@ Some of these functions are internal.
 
 im_context_t (*im_get_context)(void) = NULL;
 
-#define XAXIS 0
-#define YAXIS 1
-#define XYAXIS 2
-
-#define minmax(a,b,i) ( ((a>=i)?a: ( (b<=i)?b:i   )) )
-
 /*
 =item im_img_alloc(aIMCTX)
 X<im_img_alloc API>X<i_img_alloc API>
@@ -590,233 +584,6 @@ i_copy(i_img *src) {
   return im;
 }
 
-/*
-
-http://en.wikipedia.org/wiki/Lanczos_resampling
-
-*/
-
-static
-float
-Lanczos(float x) {
-  float PIx, PIx2;
-  
-  PIx = PI * x;
-  PIx2 = PIx / 2.0;
-  
-  if ((x >= 2.0) || (x <= -2.0)) return (0.0);
-  else if (x == 0.0) return (1.0);
-  else return(sin(PIx) / PIx * sin(PIx2) / PIx2);
-}
-
-
-/*
-=item i_scaleaxis(im, value, axis)
-
-Returns a new image object which is I<im> scaled by I<value> along
-wither the x-axis (I<axis> == 0) or the y-axis (I<axis> == 1).
-
-=cut
-*/
-
-i_img*
-i_scaleaxis(i_img *im, double Value, int Axis) {
-  i_img_dim hsize, vsize, i, j, k, l, lMax, iEnd, jEnd;
-  i_img_dim LanczosWidthFactor;
-  float *l0, *l1;
-  double OldLocation;
-  i_img_dim T; 
-  double t;
-  float F, PictureValue[MAXCHANNELS];
-  short psave;
-  i_color val,val1,val2;
-  i_img *new_img;
-  int has_alpha = i_img_has_alpha(im);
-  int color_chans = i_img_color_channels(im);
-  dIMCTXim(im);
-
-  i_clear_error();
-  im_log((aIMCTX, 1,"i_scaleaxis(im %p,Value %.2f,Axis %d)\n",im,Value,Axis));
-
-  if (Axis == XAXIS) {
-    hsize = (i_img_dim)(0.5 + im->xsize * Value);
-    if (hsize < 1) {
-      hsize = 1;
-      Value = 1.0 / im->xsize;
-    }
-    vsize = im->ysize;
-    
-    jEnd = hsize;
-    iEnd = vsize;
-  } else {
-    hsize = im->xsize;
-    vsize = (i_img_dim)(0.5 + im->ysize * Value);
-
-    if (vsize < 1) {
-      vsize = 1;
-      Value = 1.0 / im->ysize;
-    }
-
-    jEnd = vsize;
-    iEnd = hsize;
-  }
-  
-  new_img = i_img_8_new(hsize, vsize, im->channels);
-  if (!new_img) {
-    i_push_error(0, "cannot create output image");
-    return NULL;
-  }
-  
-  /* 1.4 is a magic number, setting it to 2 will cause rather blurred images */
-  LanczosWidthFactor = (Value >= 1) ? 1 : (i_img_dim) (1.4/Value); 
-  lMax = LanczosWidthFactor << 1;
-  
-  l0 = mymalloc(lMax * sizeof(float));
-  l1 = mymalloc(lMax * sizeof(float));
-  
-  for (j=0; j<jEnd; j++) {
-    OldLocation = ((double) j) / Value;
-    T = (i_img_dim) (OldLocation);
-    F = OldLocation - T;
-    
-    for (l = 0; l<lMax; l++) {
-      l0[lMax-l-1] = Lanczos(((float) (lMax-l-1) + F) / (float) LanczosWidthFactor);
-      l1[l]        = Lanczos(((float) (l+1)      - F) / (float) LanczosWidthFactor);
-    }
-    
-    /* Make sure filter is normalized */
-    t = 0.0;
-    for(l=0; l<lMax; l++) {
-      t+=l0[l];
-      t+=l1[l];
-    }
-    t /= (double)LanczosWidthFactor;
-    
-    for(l=0; l<lMax; l++) {
-      l0[l] /= t;
-      l1[l] /= t;
-    }
-
-    if (Axis == XAXIS) {
-      
-      for (i=0; i<iEnd; i++) {
-	for (k=0; k<im->channels; k++) PictureValue[k] = 0.0;
-	for (l=0; l<lMax; l++) {
-	  i_img_dim mx = T-lMax+l+1;
-	  i_img_dim Mx = T+l+1;
-	  mx = (mx < 0) ? 0 : mx;
-	  Mx = (Mx >= im->xsize) ? im->xsize-1 : Mx;
-	  
-	  i_gpix(im, Mx, i, &val1);
-	  i_gpix(im, mx, i, &val2);
-
-	  if (has_alpha) {
-	    i_sample_t alpha1 = val1.channel[color_chans];
-	    i_sample_t alpha2 = val2.channel[color_chans];
-	    for (k=0; k < color_chans; k++) {
-	      PictureValue[k] += l1[l]        * val1.channel[k] * alpha1 / 255;
-	      PictureValue[k] += l0[lMax-l-1] * val2.channel[k] * alpha2 / 255;
-	    }
-	    PictureValue[color_chans] += l1[l] * val1.channel[color_chans];
-	    PictureValue[color_chans] += l0[lMax-l-1] * val2.channel[color_chans];
-	  }
-	  else {
-	    for (k=0; k<im->channels; k++) {
-	      PictureValue[k] += l1[l]        * val1.channel[k];
-	      PictureValue[k] += l0[lMax-l-1] * val2.channel[k];
-	    }
-	  }
-	}
-
-	if (has_alpha) {
-	  float fa = PictureValue[color_chans] / LanczosWidthFactor;
-	  int alpha = minmax(0, 255, fa+0.5);
-	  if (alpha) {
-	    for (k = 0; k < color_chans; ++k) {
-	      psave = (short)(0.5+(PictureValue[k] / LanczosWidthFactor * 255 / fa));
-	      val.channel[k]=minmax(0,255,psave);
-	    }
-	    val.channel[color_chans] = alpha;
-	  }
-	  else {
-	    /* zero alpha, so the pixel has no color */
-	    for (k = 0; k < im->channels; ++k)
-	      val.channel[k] = 0;
-	  }
-	}
-	else {
-	  for(k=0;k<im->channels;k++) {
-	    psave = (short)(0.5+(PictureValue[k] / LanczosWidthFactor));
-	    val.channel[k]=minmax(0,255,psave);
-	  }
-	}
-	i_ppix(new_img, j, i, &val);
-      }
-      
-    } else {
-      
-      for (i=0; i<iEnd; i++) {
-	for (k=0; k<im->channels; k++) PictureValue[k] = 0.0;
-	for (l=0; l < lMax; l++) {
-	  i_img_dim mx = T-lMax+l+1;
-	  i_img_dim Mx = T+l+1;
-	  mx = (mx < 0) ? 0 : mx;
-	  Mx = (Mx >= im->ysize) ? im->ysize-1 : Mx;
-
-	  i_gpix(im, i, Mx, &val1);
-	  i_gpix(im, i, mx, &val2);
-	  if (has_alpha) {
-	    i_sample_t alpha1 = val1.channel[color_chans];
-	    i_sample_t alpha2 = val2.channel[color_chans];
-	    for (k=0; k < color_chans; k++) {
-	      PictureValue[k] += l1[l]        * val1.channel[k] * alpha1 / 255;
-	      PictureValue[k] += l0[lMax-l-1] * val2.channel[k] * alpha2 / 255;
-	    }
-	    PictureValue[color_chans] += l1[l] * val1.channel[color_chans];
-	    PictureValue[color_chans] += l0[lMax-l-1] * val2.channel[color_chans];
-	  }
-	  else {
-	    for (k=0; k<im->channels; k++) {
-	      PictureValue[k] += l1[l]        * val1.channel[k];
-	      PictureValue[k] += l0[lMax-l-1] * val2.channel[k];
-	    }
-	  }
-	}
-	if (has_alpha) {
-	  float fa = PictureValue[color_chans] / LanczosWidthFactor;
-	  int alpha = minmax(0, 255, fa+0.5);
-	  if (alpha) {
-	    for (k = 0; k < color_chans; ++k) {
-	      psave = (short)(0.5+(PictureValue[k] / LanczosWidthFactor * 255 / fa));
-	      val.channel[k]=minmax(0,255,psave);
-	    }
-	    val.channel[color_chans] = alpha;
-	  }
-	  else {
-	    for (k = 0; k < im->channels; ++k)
-	      val.channel[k] = 0;
-	  }
-	}
-	else {
-	  for(k=0;k<im->channels;k++) {
-	    psave = (short)(0.5+(PictureValue[k] / LanczosWidthFactor));
-	    val.channel[k]=minmax(0,255,psave);
-	  }
-	}
-	i_ppix(new_img, i, j, &val);
-      }
-      
-    }
-  }
-  myfree(l0);
-  myfree(l1);
-
-  im_log((aIMCTX, 1,"(%p) <- i_scaleaxis\n", new_img));
-
-  return new_img;
-}
-
-
 /* 
 =item i_scale_nn(im, scx, scy)
 
@@ -872,6 +639,8 @@ Returns an image of the same type (sample size, channels, paletted/direct).
 
 For paletted images the palette is copied from the source.
 
+If the source is tiled the new image is also tiled.
+
 =cut
 */
 
@@ -880,7 +649,10 @@ i_sametype(i_img *src, i_img_dim xsize, i_img_dim ysize) {
   dIMCTXim(src);
 
   if (src->type == i_direct_type) {
-    if (src->bits == 8) {
+    if (i_img_is_tiled(src)) {
+      return i_img_tiled_new(xsize, ysize, src->channels);
+    }
+    else if (src->bits == 8) {
       return i_img_empty_ch(NULL, xsize, ysize, src->channels);
     }
     else if (src->bits == i_16_bits) {
@@ -918,6 +690,8 @@ Returns an image of the same type (sample size).
 
 For paletted images the equivalent direct type is returned.
 
+If the source is tiled the new image is also tiled.
+
 =cut
 */
 
@@ -925,7 +699,10 @@ i_img *
 i_sametype_chans(i_img *src, i_img_dim xsize, i_img_dim ysize, int channels) {
   dIMCTXim(src);
 
-  if (src->bits == 8) {
+  if (i_img_is_tiled(src)) {
+    return i_img_tiled_new(xsize, ysize, channels);
+  }
+  else if (src->bits == 8) {
     return i_img_empty_ch(NULL, xsize, ysize, channels);
   }
   else if (src->bits == i_16_bits) {
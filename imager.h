@@ -182,6 +182,7 @@ undef_int i_flood_cfill_border(i_img *im, i_img_dim seedx, i_img_dim seedy, i_fi
 
 int i_gaussian    (i_img *im, double stddev);
 int i_gaussian2    (i_img *im, double stddevX, double stddevY);
+int i_gaussian_box (i_img *im, double stddevX, double stddevY);
 int i_conv        (i_img *im,const double *coeff,int len);
 void i_unsharp_mask(i_img *im, double stddev, double scale);
 
@@ -223,6 +224,11 @@ extern i_img *i_img_to_pal(i_img *src, i_quantize *quant);
 extern i_img *i_img_to_rgb(i_img *src);
 extern i_img *i_img_masked_new(i_img *targ, i_img *mask, i_img_dim x, i_img_dim y, 
                                i_img_dim w, i_img_dim h);
+extern i_img *im_img_lazy_new(pIMCTX, i_img_dim xsize, i_img_dim ysize,
+			      int channels, i_img_dim band_height,
+			      int band_count, i_img_lazy_read_t read,
+			      i_img_lazy_destroy_t destroy, void *data);
+extern i_img *im_img_tiled_new(pIMCTX, i_img_dim x, i_img_dim y, int ch);
 extern i_img *im_img_16_new(pIMCTX, i_img_dim x, i_img_dim y, int ch);
 extern i_img *i_img_to_rgb16(i_img *im);
 extern i_img *im_img_double_new(pIMCTX, i_img_dim x, i_img_dim y, int ch);
@@ -243,9 +249,11 @@ extern int im_add_file_magic(im_context_t ctx, const char *name,
   im_add_file_magic(aIMCTX, (name), (bits), (mask), (length))
 
 i_img   * i_readraw_wiol(io_glue *ig, i_img_dim x, i_img_dim y, int datachannels, int storechannels, int intrl);
+i_img   * i_readraw_lazy_wiol(io_glue *ig, i_img_dim x, i_img_dim y, int datachannels, int storechannels, int intrl, i_img_dim cache_rows);
 undef_int i_writeraw_wiol(i_img* im, io_glue *ig);
 
 i_img   * i_readpnm_wiol(io_glue *ig, int allow_incomplete);
+i_img   * i_readpnm_lazy_wiol(io_glue *ig, int allow_incomplete, i_img_dim cache_rows);
 i_img   ** i_readpnm_multi_wiol(io_glue *ig, int *count, int allow_incomplete);
 undef_int i_writeppm_wiol(i_img *im, io_glue *ig);
 
@@ -261,6 +269,8 @@ i_img   * i_readrgb_wiol(io_glue *ig, int length);
 undef_int i_writergb_wiol(i_img *img, io_glue *ig, int wierdpack, int compress, char *idstring, size_t idlen);
 
 i_img * i_scaleaxis(i_img *im, double Value, int Axis);
+i_img * i_scaleaxis_kernel(i_img *im, double Value, int Axis, const char *kernel);
+i_img * i_scale_kernel(i_img *im, double x_scale, double y_scale, const char *kernel);
 i_img * i_scale_nn(i_img *im, double scx, double scy);
 i_img * i_scale_mixing(i_img *src, i_img_dim width, i_img_dim height);
 i_img * i_haar(i_img *im);
@@ -354,6 +364,10 @@ im_get_image_file_limits(im_context_t ctx, i_img_dim *width, i_img_dim *height,
 extern int
 im_int_check_image_file_limits(im_context_t ctx, i_img_dim width, i_img_dim height, int channels, size_t sample_size);
 
+/* worker threads */
+extern int im_set_threads(im_context_t ctx, int threads);
+extern int im_get_threads(im_context_t ctx);
+
 /* memory allocation */
 void* mymalloc(size_t size);
 void  myfree(void *p);
@@ -7,6 +7,7 @@
 
 #include "imager.h"
 #include <stddef.h>
+#include <time.h>
 
 /* wrapper functions that implement the floating point sample version of a 
    function in terms of the 8-bit sample version
@@ -129,6 +130,7 @@ struct im_file_magic {
 };
 
 #define IM_ERROR_COUNT 20
+#define IM_LOG_DATE_SIZE 50
 typedef struct im_context_tag {
   int error_sp;
   size_t error_alloc[IM_ERROR_COUNT];
@@ -144,6 +146,11 @@ typedef struct im_context_tag {
   /* values supplied by lhead */
   const char *filename;
   int line;
+
+  /* formatted date for log_time, only reformatted when the second
+     changes */
+  time_t log_time;
+  char log_date[IM_LOG_DATE_SIZE];
 #endif
 
   /* file size limits */
@@ -157,11 +164,56 @@ typedef struct im_context_tag {
   /* registered file type magic */
   im_file_magic *file_magic;
 
+  /* worker threads, see workpthr.c */
+  int threads;
+  struct im_work_pool_tag *work_pool;
+
   ptrdiff_t refcount;
 } im_context_struct;
 
 #define DEF_BYTES_LIMIT 0x40000000
 
+/* maximum value for im_set_threads() */
+#define IM_MAX_THREADS 256
+
+/* splitting work across threads, see workpthr.c */
+typedef struct im_work_pool_tag im_work_pool;
+typedef void (*im_work_band_f)(void *data, i_img_dim start, i_img_dim end);
+
+extern void im_work_bands(im_context_t ctx, i_img_dim count, i_img_dim min_band,
+                          im_work_band_f f, void *data);
+extern int im_work_split(im_context_t ctx, i_img_dim count, i_img_dim min_band);
+extern void im_work_pool_destroy(im_work_pool *pool);
+
+/* band functions can't log, so use these instead of mymalloc()/myfree() */
+extern void *im_work_malloc(size_t size);
+extern void im_work_free(void *p);
+
+/* tiled images, see tiledimg.c */
+#define IM_TILE_SHIFT 6
+#define IM_TILE_SIZE (1 << IM_TILE_SHIFT)
+#define IM_TILE_MASK (IM_TILE_SIZE - 1)
+
+extern int i_img_is_tiled(const i_img *im);
+
+/* offset of the first sample of pixel (x, y) in a tiled image's idata */
+#define i_tiled_offset(im, x, y)					\
+  (((((size_t)((y) >> IM_TILE_SHIFT)					\
+      * (((im)->xsize + IM_TILE_MASK) >> IM_TILE_SHIFT)			\
+      + ((x) >> IM_TILE_SHIFT)) << (2 * IM_TILE_SHIFT))			\
+    + ((size_t)((y) & IM_TILE_MASK) << IM_TILE_SHIFT)			\
+    + ((x) & IM_TILE_MASK)) * (im)->channels)
+
+/* images that can be read and written from several threads at once,
+   as long as each thread writes to different pixels */
+#define i_img_work_safe(im) \
+  ((!(im)->isvirtual || i_img_is_tiled(im)) && (im)->type == i_direct_type)
+
 #define im_size_t_max (~(size_t)0)
 
+/* read a row of file data without copying it when possible, see
+   iolayer.c */
+extern ssize_t i_io_read_ptr(io_glue *ig, const unsigned char **pdata,
+                             void *buf, size_t size);
+
 #endif
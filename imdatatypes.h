@@ -394,6 +394,11 @@ struct i_img_ {
   im_context_t context;
 };
 
+/* source callbacks for lazy images, see lazyimg.c */
+typedef int (*i_img_lazy_read_t)(void *data, i_img_dim y, i_img_dim rows,
+				 i_sample_t *samples);
+typedef void (*i_img_lazy_destroy_t)(void *data);
+
 /* ext_data for paletted images
  */
 typedef struct {
@@ -401,6 +406,10 @@ typedef struct {
   int alloc; /* amount of space allocated for palette (in entries) */
   i_color *pal;
   int last_found;
+
+  /* colour to palette index hash for findcolor(), built when first
+     needed, see palimg.c */
+  short *hash;
 } i_img_pal_ext;
 
 /* Helper datatypes
@@ -817,6 +826,17 @@ color.
 
 C<pt_errdiff> - error diffusion dither.
 
+=item *
+
+C<pt_ordered> - offset each pixel by a value from an 8x8 ordered
+dither matrix, the same one as C<od_tiny>, before finding the closest
+color.
+
+=item *
+
+C<pt_bluenoise> - like C<pt_ordered> but using a 32x32 blue noise
+threshold map.
+
 =back
 
 =cut
@@ -827,7 +847,9 @@ typedef enum i_translate_tag {
   pt_giflib, /* get gif lib to do it (ignores make_colours) */
   pt_closest, /* just use the closest match within the hashbox */
   pt_perturb, /* randomly perturb the data - uses perturb_size*/
-  pt_errdiff /* error diffusion dither - uses errdiff */
+  pt_errdiff, /* error diffusion dither - uses errdiff */
+  pt_ordered, /* ordered dither with the od_tiny matrix */
+  pt_bluenoise /* ordered dither with a blue noise map */
 } i_translate;
 
 /*
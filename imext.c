@@ -218,9 +218,12 @@ im_ext_funcs imager_function_table =
     i_img_color_channels,
 
     /* level 10 */
-    im_decode_exif
+    im_decode_exif,
 
     /* level 11 */
+    im_io_new_mmap,
+    i_io_peek_ptr,
+    im_img_lazy_new
   };
 
 /* in general these functions aren't called by Imager internally, but
@@ -253,6 +253,12 @@ extern im_ext_funcs *imager_function_ext_table;
 
 #define im_decode_exif(im, data, len) ((im_extt->f_im_decode_exif)((im), (data), (len)))
 
+#define im_io_new_mmap(ctx, fd) ((im_extt->f_im_io_new_mmap)((ctx), (fd)))
+#define i_io_peek_ptr(ig, pdata, min, max) \
+  ((im_extt->f_i_io_peek_ptr)((ig), (pdata), (min), (max)))
+#define im_img_lazy_new(ctx, xsize, ysize, channels, band_height, band_count, read, destroy, data) \
+  ((im_extt->f_im_img_lazy_new)((ctx), (xsize), (ysize), (channels), (band_height), (band_count), (read), (destroy), (data)))
+
 #ifdef IMAGER_LOG
 #ifndef IMAGER_NO_CONTEXT
 #define mm_log(x) { i_lhead(__FILE__,__LINE__); i_loog x; } 
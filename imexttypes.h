@@ -38,7 +38,7 @@ extern "C" {
  will result in an increment of IMAGER_API_LEVEL.
 */
 
-#define IMAGER_API_LEVEL 10
+#define IMAGER_API_LEVEL 11
 
 typedef struct {
   int version;
@@ -277,7 +277,15 @@ typedef struct {
   /* IMAGER_API_LEVEL 10 functions will be added here */
   int (*f_im_decode_exif)(i_img *im, const unsigned char *data, size_t length);
 
-  /* IMAGER_API_LEVEL 11 functions will be added here */
+  /* IMAGER_API_LEVEL 11 */
+  i_io_glue_t *(*f_im_io_new_mmap)(im_context_t ctx, int fd);
+  ssize_t (*f_i_io_peek_ptr)(io_glue *ig, const unsigned char **pdata, size_t min, size_t max);
+  i_img *(*f_im_img_lazy_new)(im_context_t ctx, i_img_dim xsize, i_img_dim ysize,
+			      int channels, i_img_dim band_height, int band_count,
+			      i_img_lazy_read_t read, i_img_lazy_destroy_t destroy,
+			      void *data);
+
+  /* IMAGER_API_LEVEL 12 functions will be added here */
 } im_ext_funcs;
 
 #define PERL_FUNCTION_TABLE_NAME "Imager::__ext_func_table"
@@ -136,6 +136,9 @@ returns -1 and pushes an error.
 #define i_img_16_new(xsize, ysize, channels) im_img_16_new(aIMCTX, (xsize), (ysize), (channels))
 #define i_img_double_new(xsize, ysize, channels) im_img_double_new(aIMCTX, (xsize), (ysize), (channels))
 #define i_img_pal_new(xsize, ysize, channels, maxpal) im_img_pal_new(aIMCTX, (xsize), (ysize), (channels), (maxpal))
+#define i_img_tiled_new(xsize, ysize, channels) im_img_tiled_new(aIMCTX, (xsize), (ysize), (channels))
+#define i_img_lazy_new(xsize, ysize, channels, band_height, band_count, read, destroy, data) \
+  im_img_lazy_new(aIMCTX, (xsize), (ysize), (channels), (band_height), (band_count), (read), (destroy), (data))
 
 #define i_img_alloc() im_img_alloc(aIMCTX)
 #define i_img_init(im) im_img_init(aIMCTX, im)
@@ -144,6 +147,9 @@ returns -1 and pushes an error.
 #define i_get_image_file_limits(width, height, bytes) im_get_image_file_limits(aIMCTX, width, height, bytes)
 #define i_int_check_image_file_limits(width, height, channels, sample_size) im_int_check_image_file_limits(aIMCTX, width, height, channels, sample_size)
 
+#define i_set_threads(threads) im_set_threads(aIMCTX, threads)
+#define i_get_threads() im_get_threads(aIMCTX)
+
 #define i_clear_error() im_clear_error(aIMCTX)
 #define i_push_errorvf(code, fmt, args) im_push_errorvf(aIMCTX, code, fmt, args)
 #define i_push_error(code, msg) im_push_error(aIMCTX, code, msg)
@@ -152,6 +158,7 @@ returns -1 and pushes an error.
 #define io_new_fd(fd) im_io_new_fd(aIMCTX, (fd))
 #define io_new_bufchain() im_io_new_bufchain(aIMCTX)
 #define io_new_buffer(data, len, closecb, closectx) im_io_new_buffer(aIMCTX, (data), (len), (closecb), (closectx))
+#define io_new_mmap(fd) im_io_new_mmap(aIMCTX, (fd))
 #define io_new_cb(p, readcb, writecb, seekcb, closecb, destroycb) \
   im_io_new_cb(aIMCTX, (p), (readcb), (writecb), (seekcb), (closecb), (destroycb))
 
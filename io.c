@@ -285,6 +285,32 @@ myrealloc_file_line(void *block, size_t newsize, char *file, int line) {
 
 #endif /* IMAGER_MALLOC_DEBUG */
 
+/*
+  Allocation for worker thread band functions.
+
+  mymalloc() and myfree() log, and logging needs the current context,
+  which isn't available on a worker thread.  im_work_bands() runs
+  serially when IMAGER_DEBUG_MALLOC is defined, so these don't need to
+  take part in the malloc debugging.
+*/
+
+void *
+im_work_malloc(size_t size) {
+  void *buf;
+
+  if ((buf = malloc(size)) == NULL) {
+    fprintf(stderr, "Unable to malloc %ld.\n", (long)size);
+    exit(3);
+  }
+
+  return buf;
+}
+
+void
+im_work_free(void *p) {
+  free(p);
+}
+
 
 
 
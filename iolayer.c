@@ -10,6 +10,13 @@
 #endif
 #include <string.h>
 #include <errno.h>
+#include <sys/stat.h>
+#ifdef WIN32
+#include <io.h>
+#include <windows.h>
+#elif defined(IMAGER_MMAP)
+#include <sys/mman.h>
+#endif
 #include "imageri.h"
 
 #define IOL_DEB(x)
@@ -42,6 +49,12 @@ typedef struct {
   off_t cpos;
 } io_buffer;
 
+/* a mapped file, released by the io_buffer close callback */
+typedef struct {
+  void *data;
+  size_t size;
+} io_mmap_data;
+
 typedef struct {
   i_io_glue_t   base;
   void		*p;		/* Callback data */
@@ -121,6 +134,7 @@ static ssize_t fd_read(io_glue *ig, void *buf, size_t count);
 static ssize_t fd_write(io_glue *ig, const void *buf, size_t count);
 static off_t fd_seek(io_glue *ig, off_t offset, int whence);
 static int fd_close(io_glue *ig);
+static void fd_destroy(io_glue *ig);
 static ssize_t fd_size(io_glue *ig);
 static const char *my_strerror(int err);
 static void i_io_setup_buffer(io_glue *ig);
@@ -140,6 +154,7 @@ static ssize_t buffer_write(io_glue *ig, const void *buf, size_t count);
 static int buffer_close(io_glue *ig);
 static off_t buffer_seek(io_glue *igo, off_t offset, int whence);
 static void buffer_destroy(io_glue *igo);
+static const unsigned char *buffer_map(io_glue *igo, size_t *size);
 static io_blink*io_blink_new(void);
 static void io_bchain_advance(io_ex_bchain *ieb);
 static void io_destroy_bufchain(io_ex_bchain *ieb);
@@ -148,6 +163,7 @@ static ssize_t bufchain_write(io_glue *ig, const void *buf, size_t count);
 static int bufchain_close(io_glue *ig);
 static off_t bufchain_seek(io_glue *ig, off_t offset, int whence);
 static void bufchain_destroy(io_glue *ig);
+static const unsigned char *bufchain_map(io_glue *ig, size_t *size);
 
 /*
  * Methods for setting up data source
@@ -191,6 +207,7 @@ im_io_new_bufchain(pIMCTX) {
   ig->exdata    = ieb;
   ig->closecb   = bufchain_close;
   ig->destroycb = bufchain_destroy;
+  ig->mapcb     = bufchain_map;
 
   im_context_refinc(aIMCTX, "im_io_new_bufchain");
 
@@ -233,12 +250,143 @@ im_io_new_buffer(pIMCTX, const char *data, size_t len, i_io_closebufp_t closecb,
   
   ig->base.closecb   = buffer_close;
   ig->base.destroycb = buffer_destroy;
+  ig->base.mapcb     = buffer_map;
 
   im_context_refinc(aIMCTX, "im_io_new_bufchain");
 
   return (io_glue *)ig;
 }
 
+#if defined(WIN32) || defined(IMAGER_MMAP)
+
+static void
+mmap_release(void *p) {
+  io_mmap_data *map = p;
+
+#ifdef WIN32
+  UnmapViewOfFile(map->data);
+#else
+  munmap(map->data, map->size);
+#endif
+  myfree(map);
+}
+
+#endif
+
+/*
+=item im_io_new_mmap(ctx, file)
+X<im_io_new_mmap API>X<io_new_mmap API>
+=order 10
+=category I/O Layers
+
+Returns a new read only io_glue object that reads from a memory
+mapping of the regular file open on the file descriptor C<file>.
+
+Reads start from the current position of the file descriptor, and
+are served directly from the mapping rather than being copied
+through a read buffer.  The file descriptor isn't used after the
+call returns and can be closed.
+
+Returns NULL if the file can't be mapped, eg. if it isn't a regular
+file or the platform doesn't support mapping files.
+
+  ctx - an Imager context object
+  file - file descriptor to map
+
+Also callable as C<io_new_mmap(file)>.
+
+=cut
+*/
+
+io_glue *
+im_io_new_mmap(pIMCTX, int fd) {
+#if defined(WIN32) || defined(IMAGER_MMAP)
+  struct stat st;
+  off_t pos;
+  size_t size;
+  void *data;
+  io_mmap_data *map;
+  io_glue *ig;
+
+  im_log((aIMCTX, 1, "io_new_mmap(fd %d)\n", fd));
+
+  if (fstat(fd, &st) < 0) {
+    im_push_errorf(aIMCTX, errno, "fstat() failure: %s (%d)", my_strerror(errno), errno);
+    return NULL;
+  }
+  if (!S_ISREG(st.st_mode)) {
+    im_push_error(aIMCTX, 0, "only regular files can be mapped");
+    return NULL;
+  }
+  size = (size_t)st.st_size;
+  if ((off_t)size != st.st_size) {
+    im_push_error(aIMCTX, 0, "file too large to map");
+    return NULL;
+  }
+#ifdef WIN32
+  pos = _lseek(fd, 0, SEEK_CUR);
+#else
+  pos = lseek(fd, 0, SEEK_CUR);
+#endif
+  if (pos < 0) {
+    im_push_errorf(aIMCTX, errno, "lseek() failure: %s (%d)", my_strerror(errno), errno);
+    return NULL;
+  }
+
+  if (size == 0) {
+    /* an empty mapping isn't allowed */
+    ig = im_io_new_buffer(aIMCTX, "", 0, NULL, NULL);
+    im_log((aIMCTX, 1, "(%p) <- io_new_mmap (empty file)\n", ig));
+    return ig;
+  }
+
+#ifdef WIN32
+  {
+    HANDLE mapping = CreateFileMapping((HANDLE)_get_osfhandle(fd), NULL,
+                                       PAGE_READONLY, 0, 0, NULL);
+    if (!mapping) {
+      im_push_errorf(aIMCTX, 0, "CreateFileMapping() failure: %ld",
+                     (long)GetLastError());
+      return NULL;
+    }
+    /* the view keeps the mapping alive */
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data) {
+      im_push_errorf(aIMCTX, 0, "MapViewOfFile() failure: %ld",
+                     (long)GetLastError());
+      return NULL;
+    }
+  }
+#else
+  data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED) {
+    im_push_errorf(aIMCTX, errno, "mmap() failure: %s (%d)", my_strerror(errno), errno);
+    return NULL;
+  }
+#ifdef MADV_SEQUENTIAL
+  /* image files are almost always read from front to back */
+  madvise(data, size, MADV_SEQUENTIAL);
+#endif
+#endif
+
+  map = mymalloc(sizeof(io_mmap_data));
+  map->data = data;
+  map->size = size;
+  ig = im_io_new_buffer(aIMCTX, data, size, mmap_release, map);
+  if ((size_t)pos > size)
+    pos = size;
+  ((io_buffer *)ig)->cpos = pos;
+
+  im_log((aIMCTX, 1, "(%p) <- io_new_mmap\n", ig));
+  return ig;
+#else
+  (void)fd;
+  im_push_error(aIMCTX, 0, "memory mapped files aren't supported on this platform");
+  return NULL;
+#endif
+}
+
 
 /*
 =item im_io_new_fd(ctx, file)
@@ -423,6 +571,9 @@ io_glue_destroy(io_glue *ig) {
   dIMCTXio(ig);
   im_log((aIMCTX, 1, "io_glue_DESTROY(ig %p)\n", ig));
 
+  if (--ig->refcount > 0)
+    return;
+
   if (ig->destroycb)
     ig->destroycb(ig);
 
@@ -434,6 +585,50 @@ io_glue_destroy(io_glue *ig) {
   im_context_refdec(aIMCTX, "io_glue_destroy");
 }
 
+/*
+=item io_glue_keep(ig)
+
+Return an I/O layer reading the same source as C<ig> that stays valid
+once the caller destroys C<ig>, for readers like the lazy image
+sources that keep reading after they return.
+
+A file descriptor belongs to whoever opened it, so for descriptor
+layers this is a new layer on a duplicate of the descriptor, closed
+when that layer is destroyed.  Other layers own their source, so
+C<ig> itself is returned with another reference.
+
+Release the result with io_glue_destroy().  Returns NULL if the
+descriptor can't be duplicated.
+
+=cut
+*/
+
+io_glue *
+io_glue_keep(io_glue *ig) {
+  dIMCTXio(ig);
+  io_glue *result;
+  int fd;
+
+  if (ig->type != FDSEEK) {
+    ++ig->refcount;
+    return ig;
+  }
+
+#ifdef _MSC_VER
+  fd = _dup(((io_fdseek *)ig)->fd);
+#else
+  fd = dup(((io_fdseek *)ig)->fd);
+#endif
+  if (fd < 0) {
+    im_push_errorf(aIMCTX, errno, "dup() failure: %s (%d)", my_strerror(errno), errno);
+    return NULL;
+  }
+  result = im_io_new_fd(aIMCTX, fd);
+  result->destroycb = fd_destroy;
+
+  return result;
+}
+
 /*
 =item i_io_getc(ig)
 =category I/O Layers
@@ -469,7 +664,7 @@ i_io_getc_imp(io_glue *ig) {
     }
   }
 
-  if (!ig->buffer)
+  if (!ig->buffer && !ig->mapcb)
     i_io_setup_buffer(ig);
   
   if (!ig->read_ptr || ig->read_ptr == ig->read_end) {
@@ -498,10 +693,10 @@ i_io_peekc_imp(io_glue *ig) {
   if (ig->write_ptr)
     return EOF;
 
-  if (!ig->buffer)
+  if (!ig->buffer && !ig->mapcb)
     i_io_setup_buffer(ig);
 
-  if (!ig->buffered) {
+  if (!ig->buffered && !ig->mapcb) {
     ssize_t rc = i_io_raw_read(ig, ig->buffer, 1);
     if (rc > 0) {
       ig->read_ptr = ig->buffer;
@@ -567,7 +762,7 @@ i_io_peekn(io_glue *ig, void *buf, size_t size) {
     return -1;
   }
 
-  if (!ig->buffer)
+  if (!ig->buffer && !ig->mapcb)
     i_io_setup_buffer(ig);
 
   if ((!ig->read_ptr || (ssize_t)size > ig->read_end - ig->read_ptr)
@@ -578,6 +773,9 @@ i_io_peekn(io_glue *ig, void *buf, size_t size) {
   if (ig->read_ptr && ig->read_end != ig->read_ptr) {
     if ((ssize_t)size > ig->read_end - ig->read_ptr)
       size = ig->read_end - ig->read_ptr;
+    /* an in-memory source may have much more available */
+    if (size > ig->buf_size)
+      size = ig->buf_size;
 
     if (size)
       memcpy(buf, ig->read_ptr, size);
@@ -600,6 +798,107 @@ i_io_peekn(io_glue *ig, void *buf, size_t size) {
   return size;
 }
 
+/*
+=item i_io_peek_ptr(ig, &data, min, max)
+=category I/O Layers
+=synopsis const unsigned char *data;
+=synopsis ssize_t count = i_io_peek_ptr(ig, &data, row_size, row_size);
+
+Make at least C<min> bytes of the stream available in its buffer,
+if possible, and set C<data> to point at them, without copying them.
+
+Returns the number of bytes available at C<data>, never more than
+C<max>, which may be less than C<min> near the end of the stream, or
+if C<min> is larger than the stream's buffer.  Returns 0 at end of
+file or -1 on error.
+
+For in-memory sources, like io_new_buffer() and io_new_mmap() layers,
+C<data> points into the source data itself, and more than the buffer
+size may be available.
+
+The data is only valid until the next call on the stream, other than
+i_io_consume().  Use i_io_consume() to move past the bytes used.
+
+=cut
+*/
+
+ssize_t
+i_io_peek_ptr(io_glue *ig, const unsigned char **pdata, size_t min,
+	      size_t max) {
+  ssize_t count;
+
+  IOL_DEB(fprintf(IOL_DEBs, "i_io_peek_ptr(%p, %p, %u, %u)\n", ig, pdata,
+		  (unsigned)min, (unsigned)max));
+
+  if (ig->write_ptr) {
+    IOL_DEB(fprintf(IOL_DEBs, "i_io_peek_ptr() => -1 (write_ptr set)\n"));
+    return -1;
+  }
+
+  if (min < 1)
+    min = 1;
+
+  if ((!ig->read_ptr || (size_t)(ig->read_end - ig->read_ptr) < min)
+      && !(ig->buf_eof || ig->error)) {
+    i_io_read_fill(ig, min);
+  }
+
+  if (!ig->read_ptr || ig->read_ptr == ig->read_end) {
+    IOL_DEB(fprintf(IOL_DEBs, "i_io_peek_ptr() => %d\n", ig->error ? -1 : 0));
+    return ig->error ? -1 : 0;
+  }
+
+  count = ig->read_end - ig->read_ptr;
+  if ((size_t)count > max)
+    count = max;
+  *pdata = ig->read_ptr;
+
+  IOL_DEB(fprintf(IOL_DEBs, "i_io_peek_ptr() => %d\n", (int)count));
+
+  return count;
+}
+
+/*
+=item i_io_consume(ig, size)
+=category I/O Layers
+=synopsis i_io_consume(ig, count);
+
+A macro to move past C<size> bytes returned by i_io_peek_ptr().
+C<size> must be no larger than the count that returned.
+
+=cut
+*/
+
+/*
+=item i_io_read_ptr(ig, &data, buf, size)
+
+Point C<data> at the next C<size> bytes of the stream.  If they're all
+available from i_io_peek_ptr() they're used in place, otherwise
+they're read into C<buf>, which must have room for C<size> bytes.
+
+Rows larger than the buffer of a stream that isn't in memory are read
+directly into C<buf>, rather than through the buffer.
+
+Returns the number of bytes available at C<data>, as for i_io_read().
+
+The data is only valid until the next call on the stream.
+
+=cut
+*/
+
+ssize_t
+i_io_read_ptr(io_glue *ig, const unsigned char **pdata, void *buf,
+	      size_t size) {
+  if ((size <= ig->buf_size || ig->mapcb)
+      && i_io_peek_ptr(ig, pdata, size, size) == (ssize_t)size) {
+    i_io_consume(ig, size);
+    return size;
+  }
+
+  *pdata = buf;
+  return i_io_read(ig, buf, size);
+}
+
 /*
 =item i_io_putc(ig, c)
 =category I/O Layers
@@ -679,7 +978,7 @@ i_io_read(io_glue *ig, void *buf, size_t size) {
     return -1;
   }
 
-  if (!ig->buffer && ig->buffered)
+  if (!ig->buffer && ig->buffered && !ig->mapcb)
     i_io_setup_buffer(ig);
 
   if (ig->read_ptr && ig->read_ptr < ig->read_end) {
@@ -1027,6 +1326,8 @@ i_io_init(pIMCTX, io_glue *ig, int type, i_io_readp_t readcb, i_io_writep_t writ
   ig->buf_eof = 0;
   ig->error = 0;
   ig->buffered = 1;
+  ig->mapcb = NULL;
+  ig->refcount = 1;
 }
 
 /*
@@ -1153,9 +1454,9 @@ i_io_start_write(io_glue *ig) {
 
 static int
 i_io_read_fill(io_glue *ig, ssize_t needed) {
-  unsigned char *buf_end = ig->buffer + ig->buf_size;
-  unsigned char *buf_start = ig->buffer;
-  unsigned char *work = ig->buffer;
+  unsigned char *buf_end;
+  unsigned char *buf_start;
+  unsigned char *work;
   ssize_t rc;
   int good = 0;
 
@@ -1165,6 +1466,36 @@ i_io_read_fill(io_glue *ig, ssize_t needed) {
   if (ig->error || ig->buf_eof)
     return 0;
 
+  if (ig->mapcb && !(ig->read_ptr && ig->read_ptr < ig->read_end)) {
+    /* the read window is the next piece of the source's own data */
+    size_t size;
+    const unsigned char *data = ig->mapcb(ig, &size);
+
+    if (!size) {
+      ig->buf_eof = 1;
+      IOL_DEB(fprintf(IOL_DEBs, " i_io_read_fill -> mapped, setting eof\n"));
+      return 0;
+    }
+    ig->read_ptr = (unsigned char *)data;
+    ig->read_end = ig->read_ptr + size;
+
+    if ((ssize_t)size >= needed) {
+      IOL_DEB(fprintf(IOL_DEBs, "i_io_read_fill => 1, %u mapped\n",
+		      (unsigned)size));
+      return 1;
+    }
+    /* too short, so join it to the data that follows below */
+  }
+
+  /* an in-memory source only needs the buffer to join what's left of
+     the window to the data after it */
+  if (!ig->buffer)
+    i_io_setup_buffer(ig);
+
+  buf_end = ig->buffer + ig->buf_size;
+  buf_start = ig->buffer;
+  work = ig->buffer;
+
   if (needed > (ssize_t)ig->buf_size)
     needed = ig->buf_size;
 
@@ -1447,6 +1778,26 @@ buffer_read(io_glue *igo, void *buf, size_t count) {
 }
 
 
+/*
+=item buffer_map(ig, size)
+
+Returns the unread part of the buffer, and moves to the end of it.
+
+=cut
+*/
+
+static
+const unsigned char *
+buffer_map(io_glue *igo, size_t *size) {
+  io_buffer *ig = (io_buffer *)igo;
+  const unsigned char *result = (const unsigned char *)ig->data + ig->cpos;
+
+  *size = ig->len - ig->cpos;
+  ig->cpos = ig->len;
+
+  return result;
+}
+
 /*
 =item buffer_write(ig, buf, count)
 
@@ -1773,6 +2124,36 @@ bufchain_read(io_glue *ig, void *buf, size_t count) {
 
 
 
+/*
+=item bufchain_map(ig, size)
+
+Returns the rest of the current link of the chain, moving to the next
+link first if the current one has been read.
+
+=cut
+*/
+
+static
+const unsigned char *
+bufchain_map(io_glue *ig, size_t *size) {
+  io_ex_bchain *ieb = ig->exdata;
+  off_t clen = (ieb->cp == ieb->tail) ? ieb->tfill : (off_t)ieb->cp->len;
+  const unsigned char *result;
+
+  if (clen == ieb->cpos && ieb->cp != ieb->tail) {
+    ieb->cp = ieb->cp->next;
+    ieb->cpos = 0;
+    clen = (ieb->cp == ieb->tail) ? ieb->tfill : (off_t)ieb->cp->len;
+  }
+
+  result = (const unsigned char *)ieb->cp->buf + ieb->cpos;
+  *size = clen - ieb->cpos;
+  ieb->cpos = clen;
+  ieb->gpos += *size;
+
+  return result;
+}
+
 /*
 =item bufchain_write(ig, buf, count)
 
@@ -2004,6 +2385,15 @@ static int fd_close(io_glue *ig) {
   return 0;
 }
 
+/* only set for the descriptors io_glue_keep() duplicates */
+static void fd_destroy(io_glue *ig) {
+#ifdef _MSC_VER
+  _close(((io_fdseek *)ig)->fd);
+#else
+  close(((io_fdseek *)ig)->fd);
+#endif
+}
+
 static ssize_t fd_size(io_glue *ig) {
   dIMCTXio(ig);
   im_log((aIMCTX, 1, "fd_size(ig %p) unimplemented\n", ig));
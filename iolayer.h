@@ -25,9 +25,11 @@ void io_glue_gettypes    (io_glue *ig, int reqmeth);
 io_glue *im_io_new_fd(pIMCTX, int fd);
 io_glue *im_io_new_bufchain(pIMCTX);
 io_glue *im_io_new_buffer(pIMCTX, const char *data, size_t len, i_io_closebufp_t closecb, void *closedata);
+io_glue *im_io_new_mmap(pIMCTX, int fd);
 io_glue *im_io_new_cb(pIMCTX, void *p, i_io_readl_t readcb, i_io_writel_t writecb, i_io_seekl_t seekcb, i_io_closel_t closecb, i_io_destroyl_t destroycb);
 size_t   io_slurp(io_glue *ig, unsigned char **c);
 void     io_glue_destroy(io_glue *ig);
+io_glue *io_glue_keep(io_glue *ig);
 
 void i_io_dump(io_glue *ig, int flags);
 
@@ -35,6 +37,7 @@ void i_io_dump(io_glue *ig, int flags);
 extern int i_io_getc_imp(io_glue *ig);
 extern int i_io_peekc_imp(io_glue *ig);
 extern ssize_t i_io_peekn(io_glue *ig, void *buf, size_t size);
+extern ssize_t i_io_peek_ptr(io_glue *ig, const unsigned char **pdata, size_t min, size_t max);
 extern int i_io_putc_imp(io_glue *ig, int c);
 extern ssize_t i_io_read(io_glue *ig, void *buf, size_t size);
 extern ssize_t i_io_write(io_glue *ig, const void *buf, size_t size);
@@ -33,6 +33,7 @@ typedef ssize_t(*i_io_sizep_t) (io_glue *ig);
 
 typedef void   (*i_io_closebufp_t)(void *p);
 typedef void (*i_io_destroyp_t)(i_io_glue_t *ig);
+typedef const unsigned char *(*i_io_mapp_t)(io_glue *ig, size_t *size);
 
 
 /* Callbacks we get */
@@ -76,6 +77,15 @@ struct i_io_glue_t {
   int buffered;
 
   im_context_t context;
+
+  /* for sources already in memory, return the rest of the data and
+     move to the end, reads are then served from that data instead of
+     being copied into buffer */
+  i_io_mapp_t mapcb;
+
+  /* io_glue_destroy() only destroys the layer once this reaches zero,
+     see io_glue_keep() */
+  int refcount;
 };
 
 #define I_IO_DUMP_CALLBACKS 1
@@ -106,6 +116,8 @@ struct i_io_glue_t {
   ((ig)->write_ptr < (ig)->write_end && !(ig)->error ?	\
     *(ig)->write_ptr++ = (c) :	       \
       i_io_putc_imp(ig, (c)))
+#define i_io_consume(ig, size) \
+  ((void)((ig)->read_ptr += (size)))
 #define i_io_eof(ig) \
   ((ig)->read_ptr == (ig)->read_end && (ig)->buf_eof)
 #define i_io_error(ig) \
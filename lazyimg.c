@@ -0,0 +1,478 @@
+/*
+=head1 NAME
+
+lazyimg.c - implements images read on demand from a file
+
+=head1 SYNOPSIS
+
+  static int
+  my_read_rows(void *data, i_img_dim y, i_img_dim rows, i_sample_t *samples) {
+    ... fill rows * xsize * channels samples starting from row y ...
+  }
+
+  i_img *im = i_img_lazy_new(xsize, ysize, channels, 16, 16,
+                             my_read_rows, my_destroy, my_data);
+
+=head1 DESCRIPTION
+
+A lazy image is a read-only 8-bit direct color virtual image whose
+rows are read from a source callback as they're needed.  The rows are
+read a band at a time and a limited number of bands are kept, the
+least recently used band is discarded when another band is needed.
+
+This lets operations like crop(), scale() and copy() work on images
+much larger than memory, as long as they work a row at a time.
+
+=over
+
+=cut
+*/
+
+#define IMAGER_NO_CONTEXT
+
+#include "imager.h"
+#include "imageri.h"
+
+/*
+=item i_img_lazy_ext
+
+A pointer to this type of object is kept in the ext_data of a lazy
+image.
+
+=cut
+*/
+
+typedef struct {
+  i_img_lazy_read_t read;
+  i_img_lazy_destroy_t destroy;
+  void *data;
+  i_img_dim band_height;
+  int band_count;
+  size_t row_size; /* samples per row */
+  i_sample_t *samples; /* band_count bands of band_height rows */
+  i_img_dim *bands; /* the band held in each slot, or -1 */
+  unsigned long *used; /* when each slot was last used */
+  unsigned long use_count;
+  int last_slot;
+} i_img_lazy_ext;
+
+#define LAZYEXT(im) ((i_img_lazy_ext *)((im)->ext_data))
+
+static int ppix_lazy(i_img *im, i_img_dim x, i_img_dim y, const i_color *pix);
+static int ppixf_lazy(i_img *im, i_img_dim x, i_img_dim y, const i_fcolor *pix);
+static i_img_dim plin_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_color *vals);
+static i_img_dim plinf_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_fcolor *vals);
+static int gpix_lazy(i_img *im, i_img_dim x, i_img_dim y, i_color *pix);
+static i_img_dim glin_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_color *vals);
+static i_img_dim gsamp_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_sample_t *samps,
+			    const int *chans, int chan_count);
+static i_img_dim psamp_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y,
+			    const i_sample_t *samps, const int *chans, int chan_count);
+static i_img_dim psampf_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y,
+			     const i_fsample_t *samps, const int *chans, int chan_count);
+static void destroy_lazy(i_img *im);
+
+/*
+=item IIM_base_lazy
+
+The basic data we copy into a lazy image.
+
+=cut
+*/
+static i_img IIM_base_lazy =
+{
+  0, /* channels set */
+  0, 0, 0, /* xsize, ysize, bytes */
+  ~0U, /* ch_mask */
+  i_8_bits, /* bits */
+  i_direct_type, /* type */
+  1, /* virtual */
+  NULL, /* idata */
+  { 0, 0, NULL }, /* tags */
+  NULL, /* ext_data */
+
+  ppix_lazy, /* i_f_ppix */
+  ppixf_lazy, /* i_f_ppixf */
+  plin_lazy, /* i_f_plin */
+  plinf_lazy, /* i_f_plinf */
+  gpix_lazy, /* i_f_gpix */
+  i_gpixf_fp, /* i_f_gpixf */
+  glin_lazy, /* i_f_glin */
+  i_glinf_fp, /* i_f_glinf */
+  gsamp_lazy, /* i_f_gsamp */
+  i_gsampf_fp, /* i_f_gsampf */
+
+  NULL, /* i_f_gpal */
+  NULL, /* i_f_ppal */
+  NULL, /* i_f_addcolors */
+  NULL, /* i_f_getcolors */
+  NULL, /* i_f_colorcount */
+  NULL, /* i_f_maxcolors */
+  NULL, /* i_f_findcolor */
+  NULL, /* i_f_setcolors */
+
+  destroy_lazy, /* i_f_destroy */
+
+  i_gsamp_bits_fb,
+  NULL, /* i_f_psamp_bits */
+
+  psamp_lazy, /* i_f_psamp */
+  psampf_lazy, /* i_f_psampf */
+
+  NULL,
+  NULL
+};
+
+/*
+=item im_img_lazy_new(ctx, xsize, ysize, channels, band_height, band_count, read, destroy, data)
+X<im_img_lazy_new API>X<i_img_lazy_new API>
+=category Image creation/destruction
+=synopsis i_img *img = im_img_lazy_new(aIMCTX, width, height, channels, 16, 16, read_rows, destroy, data);
+=synopsis i_img *img = i_img_lazy_new(width, height, channels, 16, 16, read_rows, destroy, data);
+
+Creates a read-only 8-bit direct color image whose rows are read on
+demand.
+
+C<read> is called as C<read(data, y, rows, samples)> to fill
+C<samples> with C<rows> rows of C<xsize * channels> samples starting
+from row C<y>, where C<y> is a multiple of C<band_height>.  It should
+return non-zero on success, or push an error message and return zero.
+
+At most C<band_count> bands of C<band_height> rows are kept, when
+another band is needed the least recently used band is replaced.
+
+C<destroy>, if non-NULL, is called as C<destroy(data)> when the image
+is destroyed.  If the image can't be created C<destroy> isn't called.
+
+Writes to the image fail.
+
+=cut
+*/
+
+i_img *
+im_img_lazy_new(pIMCTX, i_img_dim xsize, i_img_dim ysize, int channels,
+		i_img_dim band_height, int band_count, i_img_lazy_read_t read,
+		i_img_lazy_destroy_t destroy, void *data) {
+  i_img *im;
+  i_img_lazy_ext *ext;
+  size_t row_size, band_bytes;
+  int i;
+
+  im_clear_error(aIMCTX);
+  if (xsize < 1 || ysize < 1) {
+    im_push_error(aIMCTX, 0, "Image sizes must be positive");
+    return NULL;
+  }
+  if (channels < 1 || channels > MAXCHANNELS) {
+    im_push_errorf(aIMCTX, 0, "channels must be between 1 and %d", MAXCHANNELS);
+    return NULL;
+  }
+  if (band_height < 1 || band_count < 1) {
+    im_push_error(aIMCTX, 0, "band height and count must be positive");
+    return NULL;
+  }
+  if (band_height > ysize)
+    band_height = ysize;
+  row_size = (size_t)xsize * channels;
+  band_bytes = row_size * band_height;
+  if (row_size / channels != (size_t)xsize
+      || band_bytes / band_height != row_size
+      || band_bytes * band_count / band_count != band_bytes) {
+    im_push_error(aIMCTX, 0, "integer overflow calculating cache size");
+    return NULL;
+  }
+
+  im = im_img_alloc(aIMCTX);
+  memcpy(im, &IIM_base_lazy, sizeof(i_img));
+  i_tags_new(&im->tags);
+  im->xsize = xsize;
+  im->ysize = ysize;
+  im->channels = channels;
+  ext = mymalloc(sizeof(*ext));
+  ext->read = read;
+  ext->destroy = destroy;
+  ext->data = data;
+  ext->band_height = band_height;
+  ext->band_count = band_count;
+  ext->row_size = row_size;
+  ext->samples = mymalloc(band_bytes * band_count);
+  ext->bands = mymalloc(sizeof(i_img_dim) * band_count);
+  ext->used = mymalloc(sizeof(unsigned long) * band_count);
+  for (i = 0; i < band_count; ++i) {
+    ext->bands[i] = -1;
+    ext->used[i] = 0;
+  }
+  ext->use_count = 0;
+  ext->last_slot = 0;
+  im->ext_data = ext;
+
+  im_img_init(aIMCTX, im);
+
+  return im;
+}
+
+/*
+=item lazy_row(im, y)
+
+Return a pointer to the samples for row C<y>, reading the band
+containing it if needed.  Returns NULL if the band can't be read.
+
+Internal function.
+
+=cut
+*/
+
+static const i_sample_t *
+lazy_row(i_img *im, i_img_dim y) {
+  i_img_lazy_ext *ext = LAZYEXT(im);
+  i_img_dim band = y / ext->band_height;
+  i_img_dim start, rows;
+  size_t band_size = ext->row_size * ext->band_height;
+  int slot, i;
+
+  slot = ext->last_slot;
+  if (ext->bands[slot] != band) {
+    slot = -1;
+    for (i = 0; i < ext->band_count; ++i) {
+      if (ext->bands[i] == band) {
+	slot = i;
+	break;
+      }
+    }
+    if (slot < 0) {
+      /* replace the least recently used band */
+      slot = 0;
+      for (i = 1; i < ext->band_count; ++i) {
+	if (ext->used[i] < ext->used[slot])
+	  slot = i;
+      }
+      start = band * ext->band_height;
+      rows = ext->band_height;
+      if (start + rows > im->ysize)
+	rows = im->ysize - start;
+      ext->bands[slot] = -1;
+      if (!ext->read(ext->data, start, rows, ext->samples + slot * band_size))
+	return NULL;
+      ext->bands[slot] = band;
+    }
+    ext->last_slot = slot;
+  }
+  ext->used[slot] = ++ext->use_count;
+
+  return ext->samples + slot * band_size
+    + (y - band * ext->band_height) * ext->row_size;
+}
+
+static int
+lazy_read_only(i_img *im) {
+  dIMCTXim(im);
+
+  im_push_error(aIMCTX, 0, "lazy images are read only");
+
+  return -1;
+}
+
+static int
+ppix_lazy(i_img *im, i_img_dim x, i_img_dim y, const i_color *pix) {
+  (void)x;
+  (void)y;
+  (void)pix;
+
+  return lazy_read_only(im);
+}
+
+static int
+ppixf_lazy(i_img *im, i_img_dim x, i_img_dim y, const i_fcolor *pix) {
+  (void)x;
+  (void)y;
+  (void)pix;
+
+  return lazy_read_only(im);
+}
+
+static i_img_dim
+plin_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_color *vals) {
+  (void)l;
+  (void)r;
+  (void)y;
+  (void)vals;
+
+  lazy_read_only(im);
+  return 0;
+}
+
+static i_img_dim
+plinf_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_fcolor *vals) {
+  (void)l;
+  (void)r;
+  (void)y;
+  (void)vals;
+
+  lazy_read_only(im);
+  return 0;
+}
+
+static i_img_dim
+psamp_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y,
+	   const i_sample_t *samps, const int *chans, int chan_count) {
+  (void)l;
+  (void)r;
+  (void)y;
+  (void)samps;
+  (void)chans;
+  (void)chan_count;
+
+  return lazy_read_only(im);
+}
+
+static i_img_dim
+psampf_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y,
+	    const i_fsample_t *samps, const int *chans, int chan_count) {
+  (void)l;
+  (void)r;
+  (void)y;
+  (void)samps;
+  (void)chans;
+  (void)chan_count;
+
+  return lazy_read_only(im);
+}
+
+static int
+gpix_lazy(i_img *im, i_img_dim x, i_img_dim y, i_color *pix) {
+  const i_sample_t *data;
+  int ch;
+
+  if (x < 0 || x >= im->xsize || y < 0 || y >= im->ysize)
+    return -1;
+
+  data = lazy_row(im, y);
+  if (!data)
+    return -1;
+  data += x * im->channels;
+  for (ch = 0; ch < im->channels; ++ch)
+    pix->channel[ch] = data[ch];
+
+  return 0;
+}
+
+static i_img_dim
+glin_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_color *vals) {
+  const i_sample_t *data;
+  i_img_dim i, count;
+  int ch;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize)
+    return 0;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  data = lazy_row(im, y);
+  if (!data)
+    return 0;
+  data += l * im->channels;
+  count = r - l;
+  for (i = 0; i < count; ++i) {
+    for (ch = 0; ch < im->channels; ++ch)
+      vals[i].channel[ch] = *data++;
+  }
+
+  return count;
+}
+
+static i_img_dim
+gsamp_lazy(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_sample_t *samps,
+	   const int *chans, int chan_count) {
+  const i_sample_t *data;
+  i_img_dim i, w, count;
+  int ch;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize)
+    return 0;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  if (chans) {
+    /* make sure we have good channel numbers */
+    for (ch = 0; ch < chan_count; ++ch) {
+      if (chans[ch] < 0 || chans[ch] >= im->channels) {
+	dIMCTXim(im);
+	im_push_errorf(aIMCTX, 0, "No channel %d in this image", chans[ch]);
+	return 0;
+      }
+    }
+  }
+  else if (chan_count <= 0 || chan_count > im->channels) {
+    dIMCTXim(im);
+    im_push_errorf(aIMCTX, 0, "chan_count %d out of range, must be >0, <= channels",
+		   chan_count);
+    return 0;
+  }
+
+  data = lazy_row(im, y);
+  if (!data)
+    return 0;
+  data += l * im->channels;
+  w = r - l;
+  count = 0;
+  if (chans) {
+    for (i = 0; i < w; ++i) {
+      for (ch = 0; ch < chan_count; ++ch)
+	*samps++ = data[chans[ch]];
+      count += chan_count;
+      data += im->channels;
+    }
+  }
+  else if (chan_count == im->channels) {
+    count = w * chan_count;
+    memcpy(samps, data, count);
+  }
+  else {
+    for (i = 0; i < w; ++i) {
+      for (ch = 0; ch < chan_count; ++ch)
+	*samps++ = data[ch];
+      count += chan_count;
+      data += im->channels;
+    }
+  }
+
+  return count;
+}
+
+/*
+=item destroy_lazy(im)
+
+The destruction handler for lazy images.
+
+Calls the source's destroy callback and releases the ext_data.
+
+Internal function.
+
+=cut
+*/
+
+static void
+destroy_lazy(i_img *im) {
+  i_img_lazy_ext *ext = LAZYEXT(im);
+
+  if (ext->destroy)
+    ext->destroy(ext->data);
+  myfree(ext->samples);
+  myfree(ext->bands);
+  myfree(ext->used);
+  myfree(ext);
+}
+
+/*
+=back
+
+=head1 AUTHOR
+
+Tony Cook <tonyc@cpan.org>
+
+=head1 SEE ALSO
+
+Imager(3)
+
+=cut
+*/
@@ -3,7 +3,7 @@ use 5.006;
 use Imager::Color;
 use strict;
 
-our $VERSION = "1.039";
+our $VERSION = "1.040";
 
 # the aim here is that we can:
 #  - add file based types in one place: here
@@ -163,6 +163,70 @@ sub draw {
   return $result;
 }
 
+sub draw_many {
+  my $self = shift;
+  my %input = @_;
+  my $image = $input{image};
+  unless ($image) {
+    $Imager::ERRSTR = 'No image supplied to $font->draw_many()';
+    return;
+  }
+  $image->_valid_image("draw_many")
+    or return;
+  my $strings = $input{strings};
+  unless (ref $strings && ref $strings eq "ARRAY") {
+    $image->_set_error("draw_many: strings must be an array reference");
+    return;
+  }
+  $input{aa} = _first($input{aa}, $input{antialias}, $self->{aa}, 1);
+  $input{align} = _first($input{align}, $self->{align}, 1);
+  $input{color} = _first($input{color}, $self->{color});
+  $input{size} = _first($input{size}, $self->{size});
+  unless (defined $input{size}) {
+    $image->_set_error("No font size provided");
+    return;
+  }
+  $input{utf8} = _first($input{utf8}, $self->{utf8}, 0);
+  $input{vlayout} = _first($input{vlayout}, $self->{vlayout}, 0);
+
+  # normalize each entry to [ x, y, string, color object ]
+  my @work;
+  my $index = 0;
+  for my $entry (@$strings) {
+    unless (ref $entry && ref $entry eq "ARRAY" && defined $entry->[2]) {
+      $image->_set_error("draw_many: strings[$index] must be [ x, y, string, color ]");
+      return;
+    }
+    my ($x, $y, $string, $color) = @$entry;
+    $color = Imager::_color(_first($color, $input{color}));
+    unless ($color) {
+      $image->_set_error("draw_many: strings[$index] has no valid color");
+      return;
+    }
+    push @work, [ $x || 0, $y || 0, $string, $color ];
+    ++$index;
+  }
+  $input{strings} = \@work;
+
+  my $result;
+  if ($self->can("_draw_many")) {
+    $result = $self->_draw_many(%input);
+  }
+  else {
+    $result = 1;
+    for my $entry (@work) {
+      $self->_draw(%input, x => $entry->[0], y => $entry->[1],
+                   string => $entry->[2], color => $entry->[3])
+        or do { $result = 0; last };
+    }
+  }
+  unless ($result) {
+    $image->_set_error($image->_error_as_msg());
+  }
+
+  return $result;
+}
+
 sub align {
   my $self = shift;
   my %input = ( halign => 'left', valign => 'baseline', 
@@ -889,6 +953,35 @@ returning glyph names.
 This is used by Imager's string() method to implement drawing text.
 See L<Imager::Draw/string()>.
 
+=item draw_many(image => $im, strings => \@strings, ...)
+
+Draws many strings to an image in one call, each at its own position
+and optionally in its own color, for example when labelling the
+features of a map.
+
+Each element of C<strings> is an array reference containing the x and
+y position, the text, and optionally the color to draw that text in:
+
+  $font->draw_many(image => $im, size => 12,
+                   strings => [ [ 10, 20, "Wellington" ],
+                                [ 140, 85, "Auckland", "#FF0000" ] ])
+    or die $im->errstr;
+
+The other parameters are the same as for L<Imager::Draw/string()>
+and apply to every string: C<size>, C<sizew>, C<aa>, C<align>,
+C<utf8>, C<vlayout>, and C<color>, which is used for strings that
+don't supply their own.  Drawing to a single C<channel> isn't
+supported.
+
+Drivers that can batch the work, currently only
+L<Imager::Font::FT2>, set up the font size and rendering state once
+for the whole call, which is much faster than calling string() for
+each text.  Other drivers draw each string in turn.
+
+Returns true on success.  On failure the error is available from
+C<< $im->errstr >>, and strings before the one that failed may have
+been drawn.
+
 =back
 
 =head1 MULTIPLE MASTER FONTS
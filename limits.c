@@ -205,3 +205,56 @@ im_int_check_image_file_limits(pIMCTX, i_img_dim width, i_img_dim height, int ch
 
   return 1;
 }
+
+/*
+=item im_set_threads(ctx, threads)
+X<im_set_threads API>X<i_set_threads API>
+=synopsis im_set_threads(aIMCTX, 4);
+=synopsis i_set_threads(4);
+
+Set the number of threads used for processing by filters and
+transformations that can split their work between threads.
+
+The default is 1, which does all processing in the calling thread.
+
+C<threads> must be between 1 and IM_MAX_THREADS, returns non-zero on
+success.
+
+Has no effect if Imager was built without thread support.
+
+Also callable as C<i_set_threads(threads)>.
+
+=cut
+*/
+
+int
+im_set_threads(pIMCTX, int threads) {
+  im_clear_error(aIMCTX);
+
+  if (threads < 1 || threads > IM_MAX_THREADS) {
+    im_push_errorf(aIMCTX, 0, "threads must be from 1 to %d", IM_MAX_THREADS);
+    return 0;
+  }
+
+  aIMCTX->threads = threads;
+
+  return 1;
+}
+
+/*
+=item im_get_threads(ctx)
+X<im_get_threads API>X<i_get_threads API>
+=synopsis int threads = im_get_threads(aIMCTX);
+=synopsis int threads = i_get_threads();
+
+Return the number of threads set by im_set_threads().
+
+Also callable as C<i_get_threads()>.
+
+=cut
+*/
+
+int
+im_get_threads(pIMCTX) {
+  return aIMCTX->threads;
+}
@@ -8,12 +8,15 @@
 
 #ifdef IMAGER_LOG
 
-#define DTBUFF 50
-#define DATABUFF DTBUFF+3+10+1+5+1+1
+/* messages that fit are written to the log with a single write */
+#define LOG_LINE_SIZE 1024
 
 #define LOG_DATE_FORMAT "%Y/%m/%d %H:%M:%S"
 
+#ifndef IMAGER_LOCALTIME_R
+/* localtime() returns a pointer to shared storage */
 static i_mutex_t log_mutex;
+#endif
 
 static void
 im_vloog(pIMCTX, int level, const char *fmt, va_list ap);
@@ -26,9 +29,11 @@ int
 im_init_log(pIMCTX, const char* name,int level) {
   i_clear_error();
 
+#ifndef IMAGER_LOCALTIME_R
   if (!log_mutex) {
     log_mutex = i_mutex_new();
   }
+#endif
 
   if (aIMCTX->lg_file) {
     if (aIMCTX->own_log)
@@ -93,26 +98,84 @@ This is an internal function called by the mm_log() macro.
 =cut
 */
 
+/* format the date for log messages, each context keeps its own copy
+   so logging doesn't need a lock */
 static void
-im_vloog(pIMCTX, int level, const char *fmt, va_list ap) {
-  time_t timi;
+log_format_date(pIMCTX, time_t now) {
   struct tm *str_tm;
-  char date_buffer[DTBUFF];
+#ifdef IMAGER_LOCALTIME_R
+  struct tm tm_buf;
+
+  str_tm = localtime_r(&now, &tm_buf);
+#else
+  i_mutex_lock(log_mutex);
+  str_tm = localtime(&now);
+#endif
+  if (str_tm)
+    strftime(aIMCTX->log_date, sizeof(aIMCTX->log_date), LOG_DATE_FORMAT,
+             str_tm);
+  else
+    strcpy(aIMCTX->log_date, "?");
+#ifndef IMAGER_LOCALTIME_R
+  i_mutex_unlock(log_mutex);
+#endif
+  aIMCTX->log_time = now;
+}
+
+static void
+im_vloog(pIMCTX, int level, const char *fmt, va_list ap) {
+  time_t now;
 
   if (!aIMCTX || !aIMCTX->lg_file || level > aIMCTX->log_level)
     return;
 
-  i_mutex_lock(log_mutex);
-  
-  timi = time(NULL);
-  str_tm = localtime(&timi);
-  strftime(date_buffer, DTBUFF, LOG_DATE_FORMAT, str_tm);
-  fprintf(aIMCTX->lg_file, "[%s] %10s:%-5d %3d: ", date_buffer,
+  now = time(NULL);
+  if (now != aIMCTX->log_time || !aIMCTX->log_date[0])
+    log_format_date(aIMCTX, now);
+
+#if defined(IMAGER_VSNPRINTF) && defined(va_copy)
+  {
+    /* format the whole line and write it at once, so lines from
+       contexts sharing stderr don't interleave */
+    char buf[LOG_LINE_SIZE];
+    int head_size = snprintf(buf, sizeof(buf), "[%s] %10s:%-5d %3d: ",
+                             aIMCTX->log_date, aIMCTX->filename,
+                             aIMCTX->line, level);
+    if (head_size > 0 && (size_t)head_size < sizeof(buf)) {
+      va_list ap2;
+      int msg_size;
+
+      va_copy(ap2, ap);
+      msg_size = vsnprintf(buf + head_size, sizeof(buf) - head_size, fmt, ap2);
+      va_end(ap2);
+      if (msg_size >= 0) {
+        size_t line_size = (size_t)head_size + msg_size;
+        char *line = buf;
+
+        if (line_size >= sizeof(buf)) {
+          /* not mymalloc(), which logs */
+          line = malloc(line_size + 1);
+          if (line) {
+            memcpy(line, buf, head_size);
+            vsnprintf(line + head_size, msg_size + 1, fmt, ap);
+          }
+        }
+        if (line) {
+          fwrite(line, 1, line_size, aIMCTX->lg_file);
+          fflush(aIMCTX->lg_file);
+          if (line != buf)
+            free(line);
+          return;
+        }
+      }
+    }
+  }
+#endif
+
+  fprintf(aIMCTX->lg_file, "[%s] %10s:%-5d %3d: ", aIMCTX->log_date,
 	  aIMCTX->filename, aIMCTX->line, level);
   vfprintf(aIMCTX->lg_file, fmt, ap);
   fflush(aIMCTX->lg_file);
-
-  i_mutex_unlock(log_mutex);
 }
 
 void
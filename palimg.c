@@ -37,6 +37,8 @@ static int i_colorcount_p(i_img *im);
 static int i_maxcolors_p(i_img *im);
 static int i_findcolor_p(i_img *im, const i_color *color, i_palidx *entry);
 static int i_setcolors_p(i_img *im, int index, const i_color *color, int count);
+static void pal_hash_add(i_img *im, int index);
+static void pal_hash_build(i_img *im);
 
 static void i_destroy_p(i_img *im);
 static i_img_dim 
@@ -146,6 +148,7 @@ im_img_pal_new(pIMCTX, i_img_dim x, i_img_dim y, int channels, int maxpal) {
   palext->count = 0;
   palext->alloc = maxpal;
   palext->last_found = -1;
+  palext->hash = NULL;
   im->ext_data = palext;
   i_tags_new(&im->tags);
   im->bytes = bytes;
@@ -276,6 +279,8 @@ static void i_destroy_p(i_img *im) {
     if (palext) {
       if (palext->pal)
         myfree(palext->pal);
+      if (palext->hash)
+        myfree(palext->hash);
       myfree(palext);
     }
   }
@@ -535,7 +540,10 @@ static int i_addcolors_p(i_img *im, const i_color *color, int count) {
 
     PALEXT(im)->count += count;
     while (count) {
-      PALEXT(im)->pal[index++] = *color++;
+      PALEXT(im)->pal[index] = *color++;
+      if (PALEXT(im)->hash)
+        pal_hash_add(im, index);
+      ++index;
       --count;
     }
 
@@ -571,6 +579,45 @@ static int color_eq(i_img *im, const i_color *c1, const i_color *c2) {
   return 1;
 }
 
+/* the hash has at least twice as many slots as the largest palette,
+   so there's always an empty slot to end a search */
+#define PAL_HASH_SIZE 512
+
+static unsigned
+pal_hash_slot(i_img *im, const i_color *c) {
+  unsigned long h = 0;
+  int ch;
+  for (ch = 0; ch < im->channels; ++ch)
+    h = (h << 8) | c->channel[ch];
+  return ((h * 2654435761UL) & 0xFFFFFFFFUL) >> (32 - 9);
+}
+
+/* add palette entry index to the hash, unless an earlier entry has
+   the same color, since findcolor() returns the first match */
+static void
+pal_hash_add(i_img *im, int index) {
+  short *hash = PALEXT(im)->hash;
+  const i_color *c = PALEXT(im)->pal + index;
+  unsigned slot = pal_hash_slot(im, c);
+  while (hash[slot] >= 0) {
+    if (color_eq(im, c, PALEXT(im)->pal + hash[slot]))
+      return;
+    slot = (slot + 1) & (PAL_HASH_SIZE - 1);
+  }
+  hash[slot] = index;
+}
+
+static void
+pal_hash_build(i_img *im) {
+  int i;
+  if (!PALEXT(im)->hash)
+    PALEXT(im)->hash = mymalloc(sizeof(short) * PAL_HASH_SIZE);
+  for (i = 0; i < PAL_HASH_SIZE; ++i)
+    PALEXT(im)->hash[i] = -1;
+  for (i = 0; i < PALEXT(im)->count; ++i)
+    pal_hash_add(im, i);
+}
+
 /*
 =item i_colorcount_p(i_img *im)
 
@@ -600,6 +647,11 @@ static int i_setcolors_p(i_img *im, int index, const i_color *colors, int count)
       PALEXT(im)->pal[index++] = *colors++;
       --count;
     }
+    /* an entry may have changed from or to a duplicate of another
+       entry, so rebuild from scratch */
+    if (PALEXT(im)->hash)
+      pal_hash_build(im);
+    PALEXT(im)->last_found = -1;
     return 1;
   }
 
@@ -613,7 +665,8 @@ static int i_setcolors_p(i_img *im, int index, const i_color *colors, int count)
 */
 static int i_findcolor_p(i_img *im, const i_color *color, i_palidx *entry) {
   if (PALEXT(im)->count) {
-    int i;
+    short *hash;
+    unsigned slot;
     /* often the same color comes up several times in a row */
     if (PALEXT(im)->last_found >= 0) {
       if (color_eq(im, color, PALEXT(im)->pal + PALEXT(im)->last_found)) {
@@ -621,11 +674,16 @@ static int i_findcolor_p(i_img *im, const i_color *color, i_palidx *entry) {
         return 1;
       }
     }
-    for (i = 0; i < PALEXT(im)->count; ++i) {
-      if (color_eq(im, color, PALEXT(im)->pal + i)) {
-        PALEXT(im)->last_found = *entry = i;
+    if (!PALEXT(im)->hash)
+      pal_hash_build(im);
+    hash = PALEXT(im)->hash;
+    slot = pal_hash_slot(im, color);
+    while (hash[slot] >= 0) {
+      if (color_eq(im, color, PALEXT(im)->pal + hash[slot])) {
+        PALEXT(im)->last_found = *entry = hash[slot];
         return 1;
       }
+      slot = (slot + 1) & (PAL_HASH_SIZE - 1);
     }
   }
   return 0;
@@ -145,7 +145,8 @@ read_pgm_ppm_bin8(io_glue *ig, i_img *im, int width, int height,
                   int channels, unsigned maxval, int allow_incomplete) {
   i_color *line, *linep;
   int read_size;
-  unsigned char *read_buf, *readp;
+  unsigned char *read_buf;
+  const unsigned char *readp;
   int x, y, ch;
   unsigned rounder = maxval / 2;
 
@@ -154,8 +155,7 @@ read_pgm_ppm_bin8(io_glue *ig, i_img *im, int width, int height,
   read_buf = mymalloc(read_size);
   for(y=0;y<height;y++) {
     linep = line;
-    readp = read_buf;
-    if (i_io_read(ig, read_buf, read_size) != read_size) {
+    if (i_io_read_ptr(ig, &readp, read_buf, read_size) != read_size) {
       myfree(line);
       myfree(read_buf);
       if (allow_incomplete) {
@@ -170,12 +170,8 @@ read_pgm_ppm_bin8(io_glue *ig, i_img *im, int width, int height,
       }
     }
     if (maxval == 255) {
-      for(x=0; x<width; x++) {
-        for(ch=0; ch<channels; ch++) {
-          linep->channel[ch] = *readp++;
-        }
-        ++linep;
-      }
+      /* the samples are already in the image's layout */
+      i_psamp(im, 0, width, y, readp, NULL, channels);
     }
     else {
       for(x=0; x<width; x++) {
@@ -188,8 +184,8 @@ read_pgm_ppm_bin8(io_glue *ig, i_img *im, int width, int height,
         }
         ++linep;
       }
+      i_plin(im, 0, width, y, line);
     }
-    i_plin(im, 0, width, y, line);
   }
   myfree(read_buf);
   myfree(line);
@@ -203,7 +199,8 @@ read_pgm_ppm_bin16(io_glue *ig, i_img *im, int width, int height,
                   int channels, unsigned maxval, int allow_incomplete) {
   i_fcolor *line, *linep;
   int read_size;
-  unsigned char *read_buf, *readp;
+  unsigned char *read_buf;
+  const unsigned char *readp;
   int x, y, ch;
   double maxvalf = maxval;
 
@@ -212,8 +209,7 @@ read_pgm_ppm_bin16(io_glue *ig, i_img *im, int width, int height,
   read_buf = mymalloc(read_size);
   for(y=0;y<height;y++) {
     linep = line;
-    readp = read_buf;
-    if (i_io_read(ig, read_buf, read_size) != read_size) {
+    if (i_io_read_ptr(ig, &readp, read_buf, read_size) != read_size) {
       myfree(line);
       myfree(read_buf);
       if (allow_incomplete) {
@@ -250,7 +246,8 @@ i_img *
 read_pbm_bin(io_glue *ig, i_img *im, int width, int height, int allow_incomplete) {
   i_palidx *line, *linep;
   int read_size;
-  unsigned char *read_buf, *readp;
+  unsigned char *read_buf;
+  const unsigned char *readp;
   int x, y;
   unsigned mask;
 
@@ -258,7 +255,7 @@ read_pbm_bin(io_glue *ig, i_img *im, int width, int height, int allow_incomplete
   read_size = (width + 7) / 8;
   read_buf = mymalloc(read_size);
   for(y = 0; y < height; y++) {
-    if (i_io_read(ig, read_buf, read_size) != read_size) {
+    if (i_io_read_ptr(ig, &readp, read_buf, read_size) != read_size) {
       myfree(line);
       myfree(read_buf);
       if (allow_incomplete) {
@@ -273,7 +270,6 @@ read_pbm_bin(io_glue *ig, i_img *im, int width, int height, int allow_incomplete
       }
     }
     linep = line;
-    readp = read_buf;
     mask = 0x80;
     for(x = 0; x < width; ++x) {
       *linep++ = *readp & mask ? 1 : 0;
@@ -420,38 +416,29 @@ read_pgm_ppm_ascii_16(io_glue *ig, i_img *im, int width, int height,
   return im;
 }
 
-/*
-=item i_readpnm_wiol(ig, allow_incomplete)
-
-Retrieve an image and stores in the iolayer object. Returns NULL on fatal error.
-
-   ig     - io_glue object
-   allow_incomplete - allows a partial file to be read successfully
-
-=cut
-*/
+typedef struct {
+  int type;
+  unsigned width, height, maxval, channels;
+} pnm_header;
 
-i_img *
-i_readpnm_wiol( io_glue *ig, int allow_incomplete) {
-  i_img* im;
+/* read the PNM header, leaving ig at the start of the image data */
+static int
+read_pnm_header(io_glue *ig, pnm_header *hdr) {
   int type;
   unsigned width, height, maxval, channels;
   int c;
 
-  i_clear_error();
-  mm_log((1,"i_readpnm(ig %p, allow_incomplete %d)\n", ig, allow_incomplete));
-
   c = i_io_getc(ig);
 
   if (c != 'P') {
     i_push_error(0, "bad header magic, not a PNM file");
     mm_log((1, "i_readpnm: Could not read header of file\n"));
-    return NULL;
+    return 0;
   }
 
   if ((c = i_io_getc(ig)) == EOF ) {
     mm_log((1, "i_readpnm: Could not read header of file\n"));
-    return NULL;
+    return 0;
   }
   
   type = c - '0';
@@ -459,18 +446,18 @@ i_readpnm_wiol( io_glue *ig, int allow_incomplete) {
   if (type < 1 || type > 6) {
     i_push_error(0, "unknown PNM file type, not a PNM file");
     mm_log((1, "i_readpnm: Not a pnm file\n"));
-    return NULL;
+    return 0;
   }
 
   if ( (c = i_io_getc(ig)) == EOF ) {
     mm_log((1, "i_readpnm: Could not read header of file\n"));
-    return NULL;
+    return 0;
   }
   
   if ( !misspace(c) ) {
     i_push_error(0, "unexpected character, not a PNM file");
     mm_log((1, "i_readpnm: Not a pnm file\n"));
-    return NULL;
+    return 0;
   }
   
   mm_log((1, "i_readpnm: image is a %s\n", typenames[type-1] ));
@@ -481,68 +468,87 @@ i_readpnm_wiol( io_glue *ig, int allow_incomplete) {
   if (!skip_comment(ig)) {
     i_push_error(0, "while skipping to width");
     mm_log((1, "i_readpnm: error reading before width\n"));
-    return NULL;
+    return 0;
   }
   
   if (!gnum(ig, &width)) {
     i_push_error(0, "could not read image width");
     mm_log((1, "i_readpnm: error reading width\n"));
-    return NULL;
+    return 0;
   }
 
   if (!skip_comment(ig)) {
     i_push_error(0, "while skipping to height");
     mm_log((1, "i_readpnm: error reading before height\n"));
-    return NULL;
+    return 0;
   }
 
   if (!gnum(ig, &height)) {
     i_push_error(0, "could not read image height");
     mm_log((1, "i_readpnm: error reading height\n"));
-    return NULL;
+    return 0;
   }
   
   if (!(type == 1 || type == 4)) {
     if (!skip_comment(ig)) {
       i_push_error(0, "while skipping to maxval");
       mm_log((1, "i_readpnm: error reading before maxval\n"));
-      return NULL;
+      return 0;
     }
 
     if (!gnum(ig, &maxval)) {
       i_push_error(0, "could not read maxval");
       mm_log((1, "i_readpnm: error reading maxval\n"));
-      return NULL;
+      return 0;
     }
 
     if (maxval == 0) {
       i_push_error(0, "maxval is zero - invalid pnm file");
       mm_log((1, "i_readpnm: maxval is zero, invalid pnm file\n"));
-      return NULL;
+      return 0;
     }
     else if (maxval > 65535) {
       i_push_errorf(0, "maxval of %d is over 65535 - invalid pnm file", 
 		    maxval);
       mm_log((1, "i_readpnm: maxval of %d is over 65535 - invalid pnm file\n", maxval));
-      return NULL;
+      return 0;
     }
   } else maxval=1;
 
   if ((c = i_io_getc(ig)) == EOF || !misspace(c)) {
     i_push_error(0, "garbage in header, invalid PNM file");
     mm_log((1, "i_readpnm: garbage in header\n"));
-    return NULL;
+    return 0;
   }
 
   channels = (type == 3 || type == 6) ? 3:1;
 
   if (!i_int_check_image_file_limits(width, height, channels, sizeof(i_sample_t))) {
     mm_log((1, "i_readpnm: image size exceeds limits\n"));
-    return NULL;
+    return 0;
   }
 
   mm_log((1, "i_readpnm: (%d x %d), channels = %d, maxval = %d\n", width, height, channels, maxval));
 
+  hdr->type = type;
+  hdr->width = width;
+  hdr->height = height;
+  hdr->maxval = maxval;
+  hdr->channels = channels;
+
+  return 1;
+}
+
+/* read the image data described by hdr */
+static i_img *
+read_pnm_body(io_glue *ig, const pnm_header *hdr, int allow_incomplete) {
+  i_img* im;
+  int type = hdr->type;
+  unsigned width = hdr->width;
+  unsigned height = hdr->height;
+  unsigned maxval = hdr->maxval;
+  unsigned channels = hdr->channels;
+
   if (type == 1 || type == 4) {
     i_color pbm_pal[2];
     pbm_pal[0].channel[0] = 255;
@@ -584,7 +590,7 @@ i_readpnm_wiol( io_glue *ig, int allow_incomplete) {
     break;
 
   default:
-    mm_log((1, "type %s [P%d] unsupported\n", typenames[type-1], type));
+    mm_log((1, "type P%d unsupported\n", type));
     return NULL;
   }
 
@@ -598,6 +604,154 @@ i_readpnm_wiol( io_glue *ig, int allow_incomplete) {
   return im;
 }
 
+/*
+=item i_readpnm_wiol(ig, allow_incomplete)
+
+Retrieve an image and stores in the iolayer object. Returns NULL on fatal error.
+
+   ig     - io_glue object
+   allow_incomplete - allows a partial file to be read successfully
+
+=cut
+*/
+
+i_img *
+i_readpnm_wiol( io_glue *ig, int allow_incomplete) {
+  pnm_header hdr;
+
+  i_clear_error();
+  mm_log((1,"i_readpnm(ig %p, allow_incomplete %d)\n", ig, allow_incomplete));
+
+  if (!read_pnm_header(ig, &hdr))
+    return NULL;
+
+  return read_pnm_body(ig, &hdr, allow_incomplete);
+}
+
+typedef struct {
+  io_glue *ig;
+  off_t offset; /* of the image data */
+  size_t row_size;
+  unsigned maxval;
+} pnm_lazy_source;
+
+static int
+pnm_lazy_read(void *p, i_img_dim y, i_img_dim rows, i_sample_t *samples) {
+  pnm_lazy_source *src = p;
+  size_t size = src->row_size * rows;
+
+  if (i_io_seek(src->ig, src->offset + (off_t)(src->row_size * y), SEEK_SET) < 0
+      || i_io_read(src->ig, samples, size) != (ssize_t)size) {
+    i_push_error(0, "short read - file truncated?");
+    return 0;
+  }
+  if (src->maxval != 255) {
+    unsigned rounder = src->maxval / 2;
+    size_t i;
+    for (i = 0; i < size; ++i) {
+      /* we just clamp samples to the correct range */
+      unsigned sample = samples[i];
+      if (sample > src->maxval)
+	sample = src->maxval;
+      samples[i] = (sample * 255 + rounder) / src->maxval;
+    }
+  }
+
+  return 1;
+}
+
+static void
+pnm_lazy_destroy(void *p) {
+  pnm_lazy_source *src = p;
+
+  io_glue_destroy(src->ig);
+  myfree(src);
+}
+
+/*
+=item i_readpnm_lazy_wiol(ig, allow_incomplete, cache_rows)
+
+Like i_readpnm_wiol(), but for binary PGM and PPM files with 8-bit
+samples the image returned is a lazy image that reads its rows from
+C<ig> as they're needed, keeping roughly C<cache_rows> rows in memory.
+
+C<ig> must be seekable.  The image keeps its own reference to the
+source, see io_glue_keep(), so C<ig> can be destroyed as usual.
+
+Other files, and files too short for the image size, are read as
+i_readpnm_wiol() would read them.
+
+=cut
+*/
+
+i_img *
+i_readpnm_lazy_wiol(io_glue *ig, int allow_incomplete, i_img_dim cache_rows) {
+  pnm_header hdr;
+  off_t start, end;
+  size_t row_size;
+  pnm_lazy_source *src;
+  i_img_dim band_height;
+  i_img *im;
+
+  i_clear_error();
+  mm_log((1,"i_readpnm_lazy_wiol(ig %p, allow_incomplete %d, cache_rows %" i_DF ")\n",
+	  ig, allow_incomplete, i_DFc(cache_rows)));
+
+  if (cache_rows < 1) {
+    i_push_error(0, "cache_rows must be positive");
+    return NULL;
+  }
+
+  if (!read_pnm_header(ig, &hdr))
+    return NULL;
+
+  if ((hdr.type != 5 && hdr.type != 6) || hdr.maxval > 255)
+    return read_pnm_body(ig, &hdr, allow_incomplete);
+
+  row_size = (size_t)hdr.width * hdr.channels;
+  start = i_io_seek(ig, 0, SEEK_CUR);
+  end = i_io_seek(ig, 0, SEEK_END);
+  if (start < 0 || end < 0) {
+    i_push_error(0, "lazy reads need a seekable file");
+    return NULL;
+  }
+  if ((size_t)(end - start) / row_size < hdr.height) {
+    /* truncated, let the normal reader handle allow_incomplete */
+    if (i_io_seek(ig, start, SEEK_SET) < 0) {
+      i_push_error(0, "cannot seek to image data");
+      return NULL;
+    }
+    return read_pnm_body(ig, &hdr, allow_incomplete);
+  }
+
+  src = mymalloc(sizeof(*src));
+  src->ig = io_glue_keep(ig);
+  if (!src->ig) {
+    myfree(src);
+    return NULL;
+  }
+  src->offset = start;
+  src->row_size = row_size;
+  src->maxval = hdr.maxval;
+
+  if (cache_rows > (i_img_dim)hdr.height)
+    cache_rows = hdr.height;
+  band_height = cache_rows < 16 ? cache_rows : 16;
+  im = i_img_lazy_new(hdr.width, hdr.height, hdr.channels, band_height,
+		      (int)((cache_rows + band_height - 1) / band_height),
+		      pnm_lazy_read, pnm_lazy_destroy, src);
+  if (!im) {
+    pnm_lazy_destroy(src);
+    return NULL;
+  }
+
+  i_tags_add(&im->tags, "i_format", 0, "pnm", -1, 0);
+  i_tags_setn(&im->tags, "pnm_maxval", hdr.maxval);
+  i_tags_setn(&im->tags, "pnm_type", hdr.type);
+
+  return im;
+}
+
 static void free_images(i_img **imgs, int count) {
   int i;
 
@@ -95,6 +95,7 @@ i_quant_makemap(i_quantize *quant, i_img **imgs, int count) {
 static void translate_closest(i_quantize *, i_img *, i_palidx *);
 static int translate_errdiff(i_quantize *, i_img *, i_palidx *);
 static void translate_addi(i_quantize *, i_img *, i_palidx *);
+static void translate_ordered(i_quantize *, i_img *, i_palidx *);
 
 /*
 =item i_quant_translate(C<quant>, C<img>)
@@ -148,6 +149,11 @@ i_quant_translate(i_quantize *quant, i_img *img) {
       return NULL;
     }
     break;
+
+  case pt_ordered:
+  case pt_bluenoise:
+    translate_ordered(quant, img, result);
+    break;
     
   case pt_perturb:
   default:
@@ -188,6 +194,11 @@ typedef struct {
   int pdc;
 } pbox;
 
+typedef struct {
+  i_sample_t rgb[3];
+  i_img_dim count;
+} quant_color_entry;
+
 static void prescan(i_img **im,int count, int cnum, cvec *clr, i_sample_t *line);
 static void reorder(pbox prescan[512]);
 static int pboxcmp(const pbox *a,const pbox *b);
@@ -206,7 +217,7 @@ static int
 pixbox(i_color *ic) { return ((ic->channel[0] & 224)<<1)+ ((ic->channel[1]&224)>>2) + ((ic->channel[2] &224) >> 5); }
 
 static int
-pixbox_ch(i_sample_t *chans) { return ((chans[0] & 224)<<1)+ ((chans[1]&224)>>2) + ((chans[2] &224) >> 5); }
+pixbox_ch(const i_sample_t *chans) { return ((chans[0] & 224)<<1)+ ((chans[1]&224)>>2) + ((chans[2] &224) >> 5); }
 
 static unsigned char
 g_sat(int in) {
@@ -229,7 +240,7 @@ eucl_d(cvec* cv,i_color *cl) { return PWR2(cv->r-cl->channel[0])+PWR2(cv->g-cl->
 
 static
 int
-eucl_d_ch(cvec* cv,i_sample_t *chans) { 
+eucl_d_ch(const cvec* cv,const i_sample_t *chans) { 
   return PWR2(cv->r - chans[0]) + PWR2(cv->g - chans[1]) 
     + PWR2(cv->b - chans[2]);
 }
@@ -296,6 +307,139 @@ for each side of the cube, but this will require even more memory.
 
 */
 
+/* more distinct colours than this and makemap_addi() just works from
+   the pixels */
+#define ADDI_HIST_LIMIT (1 << 20)
+
+/* or once this many colours have been found, if most pixels have
+   been distinct so far */
+#define ADDI_HIST_CHECK (1 << 16)
+
+/*
+  Collect the distinct colours in the images with the number of pixels
+  of each, so the refinement passes only need to search for each
+  colour once.  Since the sums are integers the result is the same
+  as processing each pixel.
+
+  Returns NULL if the images have too many colours for this to help.
+*/
+static quant_color_entry *
+addi_histogram(i_img **imgs, int count, i_sample_t *line,
+               size_t *pcolor_count) {
+  size_t size = 1 << 16;
+  size_t mask = size - 1;
+  size_t used = 0;
+  size_t seen = 0;
+  unsigned long *keys = mymalloc(sizeof(*keys) * size);
+  i_img_dim *counts = mymalloc(sizeof(*counts) * size);
+  quant_color_entry *colors;
+  size_t i, out;
+  int img_num;
+
+  memset(keys, 0, sizeof(*keys) * size);
+  for (img_num = 0; img_num < count; ++img_num) {
+    i_img *im = imgs[img_num];
+    const int *sample_indices = im->channels >= 3 ? NULL : gray_samples;
+    i_img_dim x, y;
+    for (y = 0; y < im->ysize; ++y) {
+      const i_sample_t *val = line;
+      i_gsamp(im, 0, im->xsize, y, line, sample_indices, 3);
+      for (x = 0; x < im->xsize; ++x, val += 3) {
+        /* 0 marks an empty slot */
+        unsigned long key = ((unsigned long)val[0] << 16 | val[1] << 8
+                             | val[2]) + 1;
+        size_t slot = ((key * 2654435761UL) & 0xFFFFFFFFUL) & mask;
+        while (keys[slot] && keys[slot] != key)
+          slot = (slot + 1) & mask;
+        if (keys[slot]) {
+          ++counts[slot];
+          continue;
+        }
+        if (used >= ADDI_HIST_LIMIT
+            || (used > ADDI_HIST_CHECK && used * 2 > seen + (size_t)x)) {
+          myfree(keys);
+          myfree(counts);
+          return NULL;
+        }
+        keys[slot] = key;
+        counts[slot] = 1;
+        if (++used * 2 > size) {
+          /* keep it at most half full */
+          size_t new_size = size * 2;
+          size_t new_mask = new_size - 1;
+          unsigned long *new_keys = mymalloc(sizeof(*keys) * new_size);
+          i_img_dim *new_counts = mymalloc(sizeof(*counts) * new_size);
+          memset(new_keys, 0, sizeof(*keys) * new_size);
+          for (i = 0; i < size; ++i) {
+            if (keys[i]) {
+              size_t new_slot =
+                ((keys[i] * 2654435761UL) & 0xFFFFFFFFUL) & new_mask;
+              while (new_keys[new_slot])
+                new_slot = (new_slot + 1) & new_mask;
+              new_keys[new_slot] = keys[i];
+              new_counts[new_slot] = counts[i];
+            }
+          }
+          myfree(keys);
+          myfree(counts);
+          keys = new_keys;
+          counts = new_counts;
+          size = new_size;
+          mask = new_mask;
+        }
+      }
+      seen += im->xsize;
+    }
+  }
+
+  colors = mymalloc(sizeof(*colors) * (used ? used : 1));
+  out = 0;
+  for (i = 0; i < size; ++i) {
+    if (keys[i]) {
+      unsigned long rgb = keys[i] - 1;
+      colors[out].rgb[0] = (rgb >> 16) & 0xFF;
+      colors[out].rgb[1] = (rgb >> 8) & 0xFF;
+      colors[out].rgb[2] = rgb & 0xFF;
+      colors[out].count = counts[i];
+      ++out;
+    }
+  }
+  myfree(keys);
+  myfree(counts);
+  *pcolor_count = used;
+
+  return colors;
+}
+
+typedef struct {
+  const cvec *clr;
+  const hashbox *hb;
+  const quant_color_entry *colors;
+  int *assign;
+} addi_assign_state;
+
+/* find the closest map entry for colors start to end-1 */
+static void
+addi_assign_band(void *p, i_img_dim start, i_img_dim end) {
+  addi_assign_state *state = p;
+  i_img_dim i;
+
+  for (i = start; i < end; ++i) {
+    const i_sample_t *val = state->colors[i].rgb;
+    const hashbox *hb = state->hb + pixbox_ch(val);
+    int j, cd, ld = 196608, bst_idx = 0;
+
+    for (j = 0; j < hb->cnt; ++j) {
+      cd = eucl_d_ch(state->clr + hb->vec[j], val);
+      if (cd < ld) {
+        ld = cd;
+        bst_idx = hb->vec[j];
+      }
+    }
+    state->assign[i] = bst_idx;
+  }
+}
+
 static void
 makemap_addi(i_quantize *quant, i_img **imgs, int count) {
   cvec *clr;
@@ -308,6 +452,9 @@ makemap_addi(i_quantize *quant, i_img **imgs, int count) {
   i_img_dim maxwidth = 0;
   i_sample_t *line;
   const int *sample_indices;
+  quant_color_entry *colors;
+  size_t color_count = 0;
+  addi_assign_state assign_state;
 
   mm_log((1, "makemap_addi(quant %p { mc_count=%d, mc_colors=%p }, imgs %p, count %d)\n", 
           quant, quant->mc_count, quant->mc_colors, imgs, count));
@@ -347,34 +494,61 @@ makemap_addi(i_quantize *quant, i_img **imgs, int count) {
   prescan(imgs, count, cnum, clr, line);
   cr_hashindex(clr, cnum, hb);
 
+  colors = addi_histogram(imgs, count, line, &color_count);
+  if (colors) {
+    mm_log((1, "makemap_addi: %lu distinct colors\n",
+            (unsigned long)color_count));
+    assign_state.clr = clr;
+    assign_state.hb = hb;
+    assign_state.colors = colors;
+    assign_state.assign = mymalloc(sizeof(int) * (color_count ? color_count : 1));
+  }
+
   for(iter=0;iter<3;iter++) {
-    for (img_num = 0; img_num < count; ++img_num) {
-      i_img *im = imgs[img_num];
-      sample_indices = im->channels >= 3 ? NULL : gray_samples;
-      for(y=0;y<im->ysize;y++) {
-        i_gsamp(im, 0, im->xsize, y, line, sample_indices, 3);
-        val = line;
-        for(x=0;x<im->xsize;x++) {
-          ld=196608;
-          /*i_gpix(im,x,y,&val);*/
-          currhb=pixbox_ch(val);
-          /*      printf("box = %d \n",currhb); */
-          for(i=0;i<hb[currhb].cnt;i++) { 
-            /*	printf("comparing: pix (%d,%d,%d) vec (%d,%d,%d)\n",val.channel[0],val.channel[1],val.channel[2],clr[hb[currhb].vec[i]].r,clr[hb[currhb].vec[i]].g,clr[hb[currhb].vec[i]].b); */
+    if (colors) {
+      size_t ci;
+
+      im_work_bands(imgs[0]->context, color_count, 1024, addi_assign_band,
+                    &assign_state);
+      for (ci = 0; ci < color_count; ++ci) {
+        cvec *c = clr + assign_state.assign[ci];
+        i_img_dim pixels = colors[ci].count;
+        c->mcount += pixels;
+        c->dr += colors[ci].rgb[0] * pixels;
+        c->dg += colors[ci].rgb[1] * pixels;
+        c->db += colors[ci].rgb[2] * pixels;
+      }
+    }
+    else {
+      /* too many colours, work from the pixels */
+      for (img_num = 0; img_num < count; ++img_num) {
+        i_img *im = imgs[img_num];
+        sample_indices = im->channels >= 3 ? NULL : gray_samples;
+        for(y=0;y<im->ysize;y++) {
+          i_gsamp(im, 0, im->xsize, y, line, sample_indices, 3);
+          val = line;
+          for(x=0;x<im->xsize;x++) {
+            ld=196608;
+            /*i_gpix(im,x,y,&val);*/
+            currhb=pixbox_ch(val);
+            /*      printf("box = %d \n",currhb); */
+            for(i=0;i<hb[currhb].cnt;i++) { 
+              /*	printf("comparing: pix (%d,%d,%d) vec (%d,%d,%d)\n",val.channel[0],val.channel[1],val.channel[2],clr[hb[currhb].vec[i]].r,clr[hb[currhb].vec[i]].g,clr[hb[currhb].vec[i]].b); */
             
-            cd=eucl_d_ch(&clr[hb[currhb].vec[i]],val);
-            if (cd<ld) {
-              ld=cd;     /* shortest distance yet */
-              bst_idx=hb[currhb].vec[i]; /* index of closest vector  yet */
+              cd=eucl_d_ch(&clr[hb[currhb].vec[i]],val);
+              if (cd<ld) {
+                ld=cd;     /* shortest distance yet */
+                bst_idx=hb[currhb].vec[i]; /* index of closest vector  yet */
+              }
             }
-          }
           
-          clr[bst_idx].mcount++;
-          clr[bst_idx].dr+=val[0];
-          clr[bst_idx].dg+=val[1];
-          clr[bst_idx].db+=val[2];
+            clr[bst_idx].mcount++;
+            clr[bst_idx].dr+=val[0];
+            clr[bst_idx].dg+=val[1];
+            clr[bst_idx].db+=val[2];
           
-          val += 3; /* next 3 samples (next pixel) */
+            val += 3; /* next 3 samples (next pixel) */
+          }
         }
       }
     }
@@ -458,16 +632,15 @@ makemap_addi(i_quantize *quant, i_img **imgs, int count) {
     mm_log((5, "  map entry %d: (%d, %d, %d)\n", i, clr[i].r, clr[i].g, clr[i].b));
 #endif
 
+  if (colors) {
+    myfree(assign_state.assign);
+    myfree(colors);
+  }
   i_mempool_destroy(&mp);
 
   mm_log((1, "makemap_addi() - %d colors\n", quant->mc_count));
 }
 
-typedef struct {
-  i_sample_t rgb[3];
-  i_img_dim count;
-} quant_color_entry;
-
 #define MEDIAN_CUT_COLORS 32768
 
 #define MED_CUT_INDEX(c) ((((c).rgb.r & 0xF8) << 7) | \
@@ -523,39 +696,93 @@ static void calc_part(medcut_partition *part, quant_color_entry *colors) {
   }
 }
 
-/* simple functions to sort by each channel - we could use a global, but 
-   that would be bad */
-
-static int
-color_sort_red(void const *left, void const *right) {
-  return ((quant_color_entry *)left)->rgb[0] - ((quant_color_entry *)right)->rgb[0];
+/* sort a partition by one channel, this is a stable counting sort,
+   since there are only 256 possible values */
+static void
+medcut_sort(quant_color_entry *colors, quant_color_entry *work, int size,
+            int ch) {
+  int pos[256];
+  int i, total;
+
+  for (i = 0; i < 256; ++i)
+    pos[i] = 0;
+  for (i = 0; i < size; ++i)
+    ++pos[colors[i].rgb[ch]];
+  total = 0;
+  for (i = 0; i < 256; ++i) {
+    int here = pos[i];
+    pos[i] = total;
+    total += here;
+  }
+  for (i = 0; i < size; ++i)
+    work[pos[colors[i].rgb[ch]]++] = colors[i];
+  memcpy(colors, work, sizeof(*colors) * size);
 }
 
-static int
-color_sort_green(void const *left, void const *right) {
-  return ((quant_color_entry *)left)->rgb[1] - ((quant_color_entry *)right)->rgb[1];
-}
+typedef struct {
+  i_img **imgs;
+  int count;
+  /* first row of each image if the rows of all images were numbered
+     in sequence, count+1 entries */
+  i_img_dim *row_start;
+  i_img_dim max_width;
+
+  /* the histogram, added to by each band */
+  i_img_dim *counts;
+  i_mutex_t mutex;
+} medcut_hist_state;
+
+/* count colours for rows start to end-1 into a histogram for this
+   band, then add it to the total */
+static void
+medcut_hist_band(void *p, i_img_dim start, i_img_dim end) {
+  medcut_hist_state *state = p;
+  i_img_dim *counts = im_work_malloc(sizeof(i_img_dim) * MEDIAN_CUT_COLORS);
+  i_color *line = im_work_malloc(sizeof(i_color) * state->max_width);
+  i_img_dim row, x;
+  int imgn = 0;
+  int i;
 
-static int
-color_sort_blue(void const *left, void const *right) {
-  return ((quant_color_entry *)left)->rgb[2] - ((quant_color_entry *)right)->rgb[2];
-}
+  for (i = 0; i < MEDIAN_CUT_COLORS; ++i)
+    counts[i] = 0;
+  for (row = start; row < end; ++row) {
+    i_img *im;
+    while (row >= state->row_start[imgn+1])
+      ++imgn;
+    im = state->imgs[imgn];
+    i_glin(im, 0, im->xsize, row - state->row_start[imgn], line);
+    if (im->channels > 2) {
+      for (x = 0; x < im->xsize; ++x) {
+        ++counts[MED_CUT_INDEX(line[x])];
+      }
+    }
+    else {
+      /* a gray-scale image, just use the first channel */
+      for (x = 0; x < im->xsize; ++x) {
+        ++counts[MED_CUT_GRAY_INDEX(line[x])];
+      }
+    }
+  }
 
-static int (*sorters[])(void const *, void const *) =
-{
-  color_sort_red,
-  color_sort_green,
-  color_sort_blue,
-};
+  i_mutex_lock(state->mutex);
+  for (i = 0; i < MEDIAN_CUT_COLORS; ++i)
+    state->counts[i] += counts[i];
+  i_mutex_unlock(state->mutex);
+
+  im_work_free(line);
+  im_work_free(counts);
+}
 
 static void
 makemap_mediancut(i_quantize *quant, i_img **imgs, int count) {
   quant_color_entry *colors;
   i_mempool mp;
   int imgn, i, ch;
-  i_img_dim x, y, max_width;
-  i_color *line;
+  i_img_dim max_width;
   int color_count;
+  quant_color_entry *sort_work;
+  medcut_hist_state hist;
+  int work_safe;
   i_img_dim total_pixels;
   medcut_partition *parts;
   int part_num;
@@ -585,29 +812,38 @@ makemap_mediancut(i_quantize *quant, i_img **imgs, int count) {
     if (imgs[imgn]->xsize > max_width)
       max_width = imgs[imgn]->xsize;
   }
-  line = i_mempool_alloc(&mp, sizeof(i_color) * max_width);
 
   /* build the stats */
+  hist.imgs = imgs;
+  hist.count = count;
+  hist.row_start = i_mempool_alloc(&mp, sizeof(i_img_dim) * (count + 1));
+  hist.max_width = max_width;
+  hist.counts = i_mempool_alloc(&mp, sizeof(i_img_dim) * MEDIAN_CUT_COLORS);
+  for (i = 0; i < MEDIAN_CUT_COLORS; ++i)
+    hist.counts[i] = 0;
   total_pixels = 0;
   chan_count = 1; /* assume we just have grayscale */
+  work_safe = 1;
+  hist.row_start[0] = 0;
   for (imgn = 0; imgn < count; ++imgn) {
     total_pixels += imgs[imgn]->xsize * imgs[imgn]->ysize;
-    for (y = 0; y < imgs[imgn]->ysize; ++y) {
-      i_glin(imgs[imgn], 0, imgs[imgn]->xsize, y, line);
-      if (imgs[imgn]->channels > 2) {
-        chan_count = 3;
-        for (x = 0; x < imgs[imgn]->xsize; ++x) {
-          ++colors[MED_CUT_INDEX(line[x])].count;
-        }
-      }
-      else {
-        /* a gray-scale image, just use the first channel */
-        for (x = 0; x < imgs[imgn]->xsize; ++x) {
-          ++colors[MED_CUT_GRAY_INDEX(line[x])].count;
-        }
-      }
-    }
+    hist.row_start[imgn+1] = hist.row_start[imgn] + imgs[imgn]->ysize;
+    if (imgs[imgn]->channels > 2)
+      chan_count = 3;
+    if (!i_img_work_safe(imgs[imgn]))
+      work_safe = 0;
   }
+  hist.mutex = i_mutex_new();
+  if (work_safe) {
+    im_work_bands(imgs[0]->context, hist.row_start[count], 16,
+                  medcut_hist_band, &hist);
+  }
+  else {
+    medcut_hist_band(&hist, 0, hist.row_start[count]);
+  }
+  i_mutex_destroy(hist.mutex);
+  for (i = 0; i < MEDIAN_CUT_COLORS; ++i)
+    colors[i].count = hist.counts[i];
 
   /* eliminate the empty colors */
   out = 0;
@@ -638,6 +874,7 @@ makemap_mediancut(i_quantize *quant, i_img **imgs, int count) {
   else {
     /* build the starting partition */
     parts = i_mempool_alloc(&mp, sizeof(*parts) * quant->mc_size);
+    sort_work = i_mempool_alloc(&mp, sizeof(*sort_work) * out);
     parts[0].start = 0;
     parts[0].size = out;
     parts[0].pixels = total_pixels;
@@ -672,8 +909,8 @@ makemap_mediancut(i_quantize *quant, i_img **imgs, int count) {
       
       workpart = parts+max_index;
       /*printf("splitting partition %d (pixels %ld, start %d, size %d)\n", max_index, workpart->pixels, workpart->start, workpart->size);*/
-      qsort(colors + workpart->start, workpart->size, sizeof(*colors),
-            sorters[max_ch]);
+      medcut_sort(colors + workpart->start, sort_work, workpart->size,
+                  max_ch);
       
       /* find the median or something like it we need to make sure both
          sides of the split have at least one color in them, so we don't
@@ -892,6 +1129,10 @@ makemap_palette(i_quantize *quant, i_img **imgs, int count) {
     CF_FIND - code that looks for the color in val and puts the best 
       matching index in bst_idx
     CF_CLEANUP - code to clean up, eg. releasing memory
+
+   and may define CF_WORK_SAFE as 1 if the search can be done from
+   worker threads, which means any memory is allocated with
+   im_work_malloc() and there's no shared state.
 */
 #ifndef IM_CF_COPTS
 /*#define IM_CFLINSEARCH*/
@@ -919,127 +1160,139 @@ is_gray_map(const i_quantize *quant) {
 
 #ifdef IM_CFHASHBOX
 
-/* The original version I wrote for this used the sort.
-   If this is defined then we use a sort to extract the indices for 
-   the hashbox */
-#define HB_SORT
-
-/* assume i is available */
-#define CF_VARS hashbox *hb = mymalloc(sizeof(hashbox) * 512); \
-               int currhb;  \
-               long ld, cd
-
-#ifdef HB_SORT
-
-static long *gdists; /* qsort is annoying */
-/* int might be smaller than long, so we need to do a real compare 
-   rather than a subtraction*/
-static int distcomp(void const *a, void const *b) {
-  long ra = gdists[*(int const *)a];
-  long rb = gdists[*(int const *)b];
-  if (ra < rb)
-    return -1;
-  else if (ra > rb)
-    return 1;
-  else
-    return 0;
-}
+/* the number of entries in the cache of colours already looked up */
+#define HB_CACHE_BITS 15
+#define HB_CACHE_SIZE (1 << HB_CACHE_BITS)
 
-#endif
+typedef struct {
+  /* candidate colours for each box, cnt is -1 until the box is first
+     used */
+  hashbox hb[512];
+
+  /* scratch space for filling a box */
+  long dists[256];
+
+  /* recently found colours, key is the rgb value plus 1, 0 for
+     unused entries */
+  unsigned long cache_key[HB_CACHE_SIZE];
+  i_palidx cache_idx[HB_CACHE_SIZE];
+} hb_find_t;
+
+#define CF_VARS hb_find_t *hbf = im_work_malloc(sizeof(hb_find_t))
+
+static void
+hbsetup(hb_find_t *hbf) {
+  int i;
+
+  for (i = 0; i < 512; ++i)
+    hbf->hb[i].cnt = -1;
+  memset(hbf->cache_key, 0, sizeof(hbf->cache_key));
+}
 
-/* for each hashbox build a list of colours that are in the hb or is closer
-   than other colours
+/* build the list of colours that are in the hashbox or closer than
+   other colours.
    This is pretty involved.  The original gifquant generated the hashbox
    as part of it's normal processing, but since the map generation is now 
    separated from the translation we need to do this on the spot.
+   Boxes are only filled when a pixel first lands in them, most images
+   only touch a small part of the colour cube.
    Any optimizations, even if they don't produce perfect results would be
    welcome.
  */
-static void hbsetup(i_quantize *quant, hashbox *hb) {
-  long *dists, mind, maxd;
-  int cr, cb, cg, hbnum, i;
+static void
+hbfill(i_quantize *quant, hb_find_t *hbf, int hbnum) {
+  hashbox *hb = hbf->hb + hbnum;
+  long *dists = hbf->dists;
+  long mind, maxd;
+  int i, j;
   i_color cenc;
-#ifdef HB_SORT
-  int *indices = mymalloc(quant->mc_count * sizeof(int)); 
-#endif
 
-  dists = mymalloc(quant->mc_count * sizeof(long)); 
-  for (cr = 0; cr < 8; ++cr) { 
-    for (cg = 0; cg < 8; ++cg) { 
-      for (cb = 0; cb < 8; ++cb) { 
-        /* centre of the hashbox */ 
-        cenc.channel[0] = cr*pboxjump+pboxjump/2; 
-        cenc.channel[1] = cg*pboxjump+pboxjump/2; 
-        cenc.channel[2] = cb*pboxjump+pboxjump/2; 
-        hbnum = pixbox(&cenc); 
-        hb[hbnum].cnt = 0; 
-        /* order indices in the order of distance from the hashbox */ 
-        for (i = 0; i < quant->mc_count; ++i) { 
-#ifdef HB_SORT
-          indices[i] = i; 
-#endif
-          dists[i] = ceucl_d(&cenc, quant->mc_colors+i); 
-        } 
-#ifdef HB_SORT
-	/* it should be possible to do this without a sort 
-	   but so far I'm too lazy */
-        gdists = dists; 
-        qsort(indices, quant->mc_count, sizeof(int), distcomp); 
-        /* any colors that can match are within mind+diagonal size of 
-	   a hashbox */ 
-        mind = dists[indices[0]]; 
-        i = 0; 
-	maxd = (sqrt(mind)+pboxjump)*(sqrt(mind)+pboxjump);
-        while (i < quant->mc_count && dists[indices[i]] < maxd) { 
-          hb[hbnum].vec[hb[hbnum].cnt++] = indices[i++]; 
-        } 
-#else
-	/* work out the minimum */
-	mind = 256*256*3;
-	for (i = 0; i < quant->mc_count; ++i) {
-	  if (dists[i] < mind) mind = dists[i];
-	}
-	/* transfer any colours that might be closest to a colour in 
-	   this hashbox */
-	maxd = (sqrt(mind)+pboxjump)*(sqrt(mind)+pboxjump);
-	for (i = 0; i < quant->mc_count; ++i) {
-	  if (dists[i] < maxd)
-	    hb[hbnum].vec[hb[hbnum].cnt++] = i;
-	}
-#endif
-      } 
-    } 
+  /* centre of the hashbox */ 
+  cenc.channel[0] = (hbnum >> 6) * pboxjump + pboxjump / 2;
+  cenc.channel[1] = ((hbnum >> 3) & 7) * pboxjump + pboxjump / 2;
+  cenc.channel[2] = (hbnum & 7) * pboxjump + pboxjump / 2;
+
+  mind = 256*256*3;
+  for (i = 0; i < quant->mc_count; ++i) {
+    dists[i] = ceucl_d(&cenc, quant->mc_colors+i);
+    if (dists[i] < mind)
+      mind = dists[i];
+  }
+
+  /* any colors that can match are within mind+diagonal size of 
+     a hashbox */ 
+  maxd = (sqrt(mind)+pboxjump)*(sqrt(mind)+pboxjump);
+
+  /* collect them in order of distance from the centre, nearest first
+     so the search below prefers them on ties */
+  hb->cnt = 0;
+  for (i = 0; i < quant->mc_count; ++i) {
+    if (dists[i] < maxd) {
+      j = hb->cnt++;
+      while (j > 0 && dists[hb->vec[j-1]] > dists[i]) {
+        hb->vec[j] = hb->vec[j-1];
+        --j;
+      }
+      hb->vec[j] = i;
+    }
   }
-#ifdef HB_SORT
-  myfree(indices); 
-#endif
-  myfree(dists) ;
 }
-#define CF_SETUP hbsetup(quant, hb)
 
-#define CF_FIND \
-  currhb = pixbox(&val); \
-  ld = 196608; \
-  for (i = 0; i < hb[currhb].cnt; ++i) { \
-    cd = ceucl_d(quant->mc_colors+hb[currhb].vec[i], &val); \
-    if (cd < ld) { ld = cd; bst_idx = hb[currhb].vec[i]; } \
+static int
+hbfind(i_quantize *quant, hb_find_t *hbf, i_color *val) {
+  unsigned long key = ((unsigned long)val->channel[0] << 16)
+    | (val->channel[1] << 8) | val->channel[2];
+  unsigned long slot =
+    ((key * 2654435761UL) & 0xFFFFFFFFUL) >> (32 - HB_CACHE_BITS);
+  hashbox *hb;
+  int hbnum = pixbox(val);
+  int i, bst_idx = 0;
+  long ld, cd;
+
+  if (hbf->cache_key[slot] == key + 1)
+    return hbf->cache_idx[slot];
+
+  hb = hbf->hb + hbnum;
+  if (hb->cnt < 0)
+    hbfill(quant, hbf, hbnum);
+
+  ld = 196608;
+  for (i = 0; i < hb->cnt; ++i) {
+    cd = ceucl_d(quant->mc_colors+hb->vec[i], val);
+    if (cd < ld) {
+      ld = cd;
+      bst_idx = hb->vec[i];
+    }
   }
 
-#define CF_CLEANUP myfree(hb)
+  hbf->cache_key[slot] = key + 1;
+  hbf->cache_idx[slot] = bst_idx;
+
+  return bst_idx;
+}
+
+#define CF_SETUP hbsetup(hbf)
+
+#define CF_FIND bst_idx = hbfind(quant, hbf, &val)
+
+#define CF_CLEANUP im_work_free(hbf)
+
+#define CF_WORK_SAFE 1
   
 #endif
 
 #ifdef IM_CFLINSEARCH
 /* as simple as it gets */
-#define CF_VARS long ld, cd
+#define CF_VARS long ld, cd; int cf_i
 #define CF_SETUP /* none needed */
 #define CF_FIND \
    ld = 196608; \
-   for (i = 0; i < quant->mc_count; ++i) { \
-     cd = ceucl_d(quant->mc_colors+i, &val); \
-     if (cd < ld) { ld = cd; bst_idx = i; } \
+   for (cf_i = 0; cf_i < quant->mc_count; ++cf_i) { \
+     cd = ceucl_d(quant->mc_colors+cf_i, &val); \
+     if (cd < ld) { ld = cd; bst_idx = cf_i; } \
    }
 #define CF_CLEANUP
+#define CF_WORK_SAFE 1
 #endif
 
 #ifdef IM_CFSORTCHAN
@@ -1268,56 +1521,42 @@ static int rand2dist_find(i_color val, i_quantize *quant, i_dists *dists, int in
 
 #endif
 
+#ifndef CF_WORK_SAFE
+#define CF_WORK_SAFE 0
+#endif
+
 static void translate_addi(i_quantize *quant, i_img *img, i_palidx *out) {
-  i_img_dim x, y, k;
-  int i, bst_idx = 0;
+  i_img_dim x, y;
+  int bst_idx = 0;
   i_color val;
+  i_color *line = mymalloc(sizeof(i_color) * img->xsize);
   int pixdev = quant->perturb;
   CF_VARS;
 
   CF_SETUP;
 
-  if (img->channels >= 3) {
-    if (pixdev) {
-      k=0;
-      for(y=0;y<img->ysize;y++) for(x=0;x<img->xsize;x++) {
-        i_gpix(img,x,y,&val);
-        val.channel[0]=g_sat(val.channel[0]+(int)(pixdev*frandn()));
-        val.channel[1]=g_sat(val.channel[1]+(int)(pixdev*frandn()));
-        val.channel[2]=g_sat(val.channel[2]+(int)(pixdev*frandn()));
-        CF_FIND;
-        out[k++]=bst_idx;
-      }
-    } else {
-      k=0;
-      for(y=0;y<img->ysize;y++) for(x=0;x<img->xsize;x++) {
-        i_gpix(img,x,y,&val);
-        CF_FIND;
-        out[k++]=bst_idx;
-      }
-    }
-  }
-  else {
-    if (pixdev) {
-      k=0;
-      for(y=0;y<img->ysize;y++) for(x=0;x<img->xsize;x++) {
-        i_gpix(img,x,y,&val);
-        val.channel[1] = val.channel[2] =
+  for (y = 0; y < img->ysize; ++y) {
+    i_glin(img, 0, img->xsize, y, line);
+    for (x = 0; x < img->xsize; ++x) {
+      val = line[x];
+      if (img->channels >= 3) {
+        if (pixdev) {
           val.channel[0]=g_sat(val.channel[0]+(int)(pixdev*frandn()));
-        CF_FIND;
-        out[k++]=bst_idx;
+          val.channel[1]=g_sat(val.channel[1]+(int)(pixdev*frandn()));
+          val.channel[2]=g_sat(val.channel[2]+(int)(pixdev*frandn()));
+        }
       }
-    } else {
-      k=0;
-      for(y=0;y<img->ysize;y++) for(x=0;x<img->xsize;x++) {
-        i_gpix(img,x,y,&val);
+      else {
+        if (pixdev)
+          val.channel[0]=g_sat(val.channel[0]+(int)(pixdev*frandn()));
         val.channel[1] = val.channel[2] = val.channel[0];
-        CF_FIND;
-        out[k++]=bst_idx;
       }
+      CF_FIND;
+      *out++ = bst_idx;
     }
   }
   CF_CLEANUP;
+  myfree(line);
 }
 
 static int floyd_map[] =
@@ -1363,6 +1602,7 @@ translate_errdiff(i_quantize *quant, i_img *img, i_palidx *out) {
   int mapw, maph, mapo;
   int i;
   errdiff_t *err;
+  i_color *line;
   i_img_dim errw;
   int difftotal;
   i_img_dim x, y, dx, dy;
@@ -1414,11 +1654,12 @@ translate_errdiff(i_quantize *quant, i_img *img, i_palidx *out) {
 
   CF_SETUP;
 
+  line = mymalloc(sizeof(i_color) * img->xsize);
   for (y = 0; y < img->ysize; ++y) {
+    i_glin(img, 0, img->xsize, y, line);
     for (x = 0; x < img->xsize; ++x) {
-      i_color val;
+      i_color val = line[x];
       errdiff_t perr;
-      i_gpix(img, x, y, &val);
       if (img->channels < 3) {
         val.channel[1] = val.channel[2] = val.channel[0];
       }
@@ -1456,6 +1697,7 @@ translate_errdiff(i_quantize *quant, i_img *img, i_palidx *out) {
     memset(err+(maph-1)*errw, 0, sizeof(*err)*errw);
   }
   CF_CLEANUP;
+  myfree(line);
   myfree(err);
 
   return 1;
@@ -1889,6 +2131,78 @@ orddith_maps[][64] =
   },
 };
 
+/* blue noise threshold map for pt_bluenoise
+   perl bluenoise.perl 32 1.5
+*/
+static unsigned char
+bluenoise_map[32*32] =
+{
+     68, 154,  11, 246,  65, 216, 148, 186,  34, 173, 132,  99, 148, 208, 254, 107,
+     66,  34,  97,  73,  29, 126, 186, 205,  16, 216,  34, 241,   4, 182,  50, 168,
+    228,  42, 177, 113, 194,   6,  55, 127,  78, 250,  64, 196,  10,  75,  47, 142,
+    201, 230, 123, 176,  55, 237,  93,  40,  78, 149,  59, 159, 209, 140, 115,  26,
+    103, 129, 221,  80, 134, 240, 104, 224,  15, 152,  44, 227, 124, 181, 223,  24,
+     85, 156,  12, 213, 146,   9, 165, 255, 130, 227,  88, 111,  31,  79, 238, 198,
+     77, 188,  56,  28, 172,  42, 155, 191,  89, 203, 113, 165,  30,  95, 159, 118,
+    243,  53, 194, 109,  77, 222, 117,  63, 198,   6, 173, 248, 193,  49, 160,  22,
+    254,  13, 143, 236,  95, 208,  69,  23, 135, 238,   2,  73, 248, 211,  60,   6,
+    185, 135,  28, 249,  45, 183,  21, 158,  98,  50, 138,  19, 126,  99, 217, 134,
+    172, 116, 210, 160,   4, 119, 252, 178,  54, 102, 183, 144,  48, 127, 177,  92,
+    219,  69,  95, 169, 141,  84, 206,  36, 232, 180, 214,  66, 230, 187,   1,  64,
+    199,  43,  84,  63, 189,  39, 148,  80, 217,  33, 225,  86, 197,  16, 148, 239,
+     41, 161, 202, 225,   0, 106, 242, 145, 122,  87,  31, 157,  82,  39, 143,  96,
+     30, 219, 109, 247, 133, 212,  97,  12, 170, 125, 157,  24, 115, 234,  71,  27,
+    110, 129,  23,  59, 122, 194,  53,  72,   8, 251, 108, 207, 122, 246, 165, 234,
+    125, 151,  10, 178,  27,  58, 240, 192, 108,  68, 248,  55, 212,  97, 168, 209,
+    188, 253,  76, 153, 235,  32, 173, 220, 162, 188,  51,  11, 179,  58,  20,  76,
+    193,  51, 231,  72, 164, 121, 154,  43, 231,  17, 184, 138, 175,   3, 131,  45,
+     89,   8, 175, 212,  87, 137, 103,  19,  84, 132, 229, 152,  90, 222, 114, 173,
+    245, 100, 138, 207,  93, 225,   0,  84, 136, 201,  94,  37,  76, 245,  61, 156,
+    233, 139, 108,  48,  13, 191, 249, 149, 204,  35,  66, 198,  27, 141, 204,   5,
+     86,  34, 184,  17,  46, 190, 112, 210, 168,  51, 120, 228, 151, 193, 117, 219,
+     31,  68, 200, 242, 121,  73,  39,  62, 119, 238, 100, 126, 249,  43, 104,  62,
+    224, 161, 115, 251, 132,  64, 241,  22,  71, 255,  10, 204,  29,  93,  12, 179,
+    103, 166,  23, 144, 179, 215, 159, 223,  21, 172,   2, 185,  74, 167, 234, 147,
+     12,  56, 211,  75, 174, 153,  35, 181, 144, 101, 163, 129,  60, 214, 145,  49,
+    250,  81, 230,  57,  93,   5, 104, 131, 195,  86, 150,  53, 213,  19, 120, 194,
+    177, 135,  30, 102,   6, 227,  88, 124, 213,  41,  78, 178, 232, 114,  72, 191,
+    126,   8, 113, 192,  36, 169, 243,  48,  71, 253, 110, 231, 134,  83,  38,  94,
+     70, 247, 166, 220, 190, 111,  57, 237,  15, 190, 244,   3,  40, 152, 240,  32,
+    217, 157, 205, 137, 226,  75, 143, 208,  25, 188,  40,  11, 200, 163, 239, 207,
+    121,  45,  92,  63, 136,  28, 200, 150,  69, 117, 140,  89, 199, 101,  18, 170,
+     88,  46,  67,  26,  99, 185,  14, 119,  90, 156, 128, 177,  98,  59, 142,   1,
+    189, 147, 235,  11, 161, 252,  47, 171,  94, 226,  52, 162, 218,  64, 186, 133,
+    110, 234, 175, 254, 125,  55, 233, 167, 240,  54, 224,  74, 246,  29, 110, 229,
+     77,  26, 202, 118, 213,  79, 127,   5, 206,  22, 183,  30, 128, 252,  49, 225,
+      3, 142,  82,  16, 212, 149,  36, 104,   4, 196, 112,  18, 152, 203, 172,  41,
+    158, 106, 176,  70,  32, 100, 181, 238, 112, 143, 245, 106,  82,  15, 151,  74,
+    206,  38, 197, 164,  96,  71, 192, 216,  81, 145,  40, 218, 130,  54,  87, 215,
+     16, 239,  50, 133, 245, 196,  57, 154,  37,  77,  56, 214, 175, 203, 114, 171,
+     96, 247, 116,  50, 226,   9, 160, 129,  59, 250, 169,  94, 190,   7, 255, 125,
+    187,  92, 221, 166,  25, 141,  13,  88, 224, 192, 159,   1, 131,  42, 237,  22,
+     54, 155,  25, 187, 139, 107, 244,  21, 184, 118,  25,  70, 231, 111, 146,  67,
+     46, 139,   4,  83, 119, 232, 209, 174, 122,  21, 100, 242,  65,  91, 142, 195,
+    223, 130,  69, 241,  79,  42, 205,  87,  47, 226, 206, 160,  45, 176,  29, 204,
+    243, 108, 211, 182,  67,  39, 106,  61, 253,  47, 200, 145, 222, 187,   9, 105,
+     80, 180, 210,   2, 167, 230, 123, 174, 150, 101,   0, 137,  81, 237, 102, 154,
+     19, 163,  35, 251, 146, 199, 161,   5, 136, 170,  82,  24, 117,  38, 157, 253,
+     44,  20, 120,  97, 149,  28,  65,  10, 201,  60, 243, 116, 197,  14, 219,  78,
+    189, 124,  61, 103,  13,  92, 239,  75, 211, 111, 227,  58, 179, 216,  72, 205,
+    140, 170, 236,  57, 221, 186, 105, 254, 130,  85, 178,  37, 156,  63, 131,  48,
+     91, 235, 202, 169, 229,  52, 123, 180,  33, 150,  14, 248,  91, 128,  17, 113,
+     61,  91, 196,  36, 127,  83, 215, 158,  41, 228,  18, 217,  95, 252, 171, 209,
+    140,   2,  76,  32, 134, 189,  20, 221,  62,  96, 198, 138, 166,  49, 242, 176,
+    228,   7, 147, 250,  14, 144,  51,  20, 195,  98, 165,  56, 141,   7, 114,  31,
+    244, 180, 153, 109, 218,  81, 158, 105, 244, 174,  38,  74,   7, 199, 146,  98,
+     37, 163, 115,  68, 181, 208, 112, 235,  66, 147, 116, 202,  80, 185, 222,  65,
+    120,  46, 210,  60,   9, 255,  44, 139,   0, 207, 123, 232, 107, 220,  26,  73,
+    195, 214,  85, 229,  43, 168,  79, 135, 182,   8, 249,  27, 233,  44, 101, 164,
+     23,  83, 233, 137, 182, 118, 201,  67, 164,  85,  53, 155, 183,  58, 133, 236,
+    121,  52,  17, 136, 102,   1, 246,  33, 223,  86,  52, 171, 128, 151,  15, 203,
+    132, 197,  99,  35, 162,  90,  24, 236, 109, 215,  18, 241,  33,  89, 167,   3,
+    184, 153, 247, 191, 218, 155,  62, 107, 162, 124, 193, 105,  70, 220,  90, 251,
+};
+
 static void
 transparent_ordered(i_quantize *quant, i_palidx *data, i_img *img,
 		    i_palidx trans_index)
@@ -1913,3 +2227,122 @@ transparent_ordered(i_quantize *quant, i_palidx *data, i_img *img,
   myfree(line);
 }
 
+typedef struct {
+  i_quantize *quant;
+  i_img *img;
+  i_palidx *out;
+  const unsigned char *map;
+  int map_size; /* width and height of map, a power of 2 */
+  int is_gray;
+  int offsets[256]; /* sample offset for each threshold value */
+} ordered_state;
+
+/* translate rows start to end-1 of the image */
+static void
+translate_ordered_band(void *p, i_img_dim start, i_img_dim end) {
+  ordered_state *state = p;
+  i_quantize *quant = state->quant;
+  i_img *img = state->img;
+  int mask = state->map_size - 1;
+  i_color *line = im_work_malloc(sizeof(i_color) * img->xsize);
+  i_img_dim x, y;
+  int bst_idx = 0;
+  CF_VARS;
+
+  CF_SETUP;
+  for (y = start; y < end; ++y) {
+    const unsigned char *map_row = state->map + (y & mask) * state->map_size;
+    i_palidx *out = state->out + y * img->xsize;
+
+    i_glin(img, 0, img->xsize, y, line);
+    for (x = 0; x < img->xsize; ++x) {
+      i_color val = line[x];
+      int off = state->offsets[map_row[x & mask]];
+      if (img->channels < 3) {
+        val.channel[1] = val.channel[2] = val.channel[0];
+      }
+      else if (state->is_gray) {
+	int gray = 0.5 + color_to_grey(&val);
+	val.channel[0] = val.channel[1] = val.channel[2] = gray;
+      }
+      val.channel[0] = g_sat(val.channel[0] + off);
+      val.channel[1] = g_sat(val.channel[1] + off);
+      val.channel[2] = g_sat(val.channel[2] + off);
+      CF_FIND;
+      out[x] = bst_idx;
+    }
+  }
+  CF_CLEANUP;
+  im_work_free(line);
+}
+
+/*
+  Ordered dither, each pixel is offset by a value from the threshold
+  map before finding the closest color.
+
+  The offsets are scaled by the average distance from each palette
+  entry to its nearest neighbour, measured as the largest channel
+  difference, so a pixel between two colors is dithered between them
+  rather than swamped by noise.
+
+  Unlike error diffusion each pixel only depends on its own value
+  and position, so the rows can be split between worker threads, and
+  an unchanged area of an image translates the same way in each frame
+  of an animation.
+*/
+static void
+translate_ordered(i_quantize *quant, i_img *img, i_palidx *out) {
+  ordered_state state;
+  double spread = 0;
+  int neighbours = 0;
+  int i, j, ch;
+
+  for (i = 0; i < quant->mc_count; ++i) {
+    int nearest = -1;
+    for (j = 0; j < quant->mc_count; ++j) {
+      int dist = 0;
+      for (ch = 0; ch < 3; ++ch) {
+	int diff = abs(quant->mc_colors[i].channel[ch]
+		       - quant->mc_colors[j].channel[ch]);
+	if (diff > dist)
+	  dist = diff;
+      }
+      /* ignore duplicates */
+      if (dist && (nearest < 0 || dist < nearest))
+	nearest = dist;
+    }
+    if (nearest > 0) {
+      spread += nearest;
+      ++neighbours;
+    }
+  }
+  if (neighbours)
+    spread /= neighbours;
+
+  mm_log((1, "translate_ordered: spread %g\n", spread));
+
+  if (quant->translate == pt_bluenoise) {
+    state.map = bluenoise_map;
+    state.map_size = 32;
+  }
+  else {
+    state.map = orddith_maps[od_tiny];
+    state.map_size = 8;
+  }
+  for (i = 0; i < 256; ++i) {
+    double off = ((i + 0.5) / 256.0 - 0.5) * spread;
+    state.offsets[i] = off < 0 ? (int)(off - 0.5) : (int)(off + 0.5);
+  }
+  state.quant = quant;
+  state.img = img;
+  state.out = out;
+  state.is_gray = is_gray_map(quant);
+
+  if (CF_WORK_SAFE && i_img_work_safe(img)) {
+    im_work_bands(img->context, img->ysize, 16, translate_ordered_band,
+		  &state);
+  }
+  else {
+    translate_ordered_band(&state, 0, img->ysize);
+  }
+}
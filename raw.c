@@ -1,6 +1,7 @@
 #include "imager.h"
 #include <stdio.h>
 #include "iolayer.h"
+#include "imageri.h"
 #ifndef _MSC_VER
 #include <unistd.h>
 #endif
@@ -29,11 +30,10 @@
 
 static
 void
-interleave(unsigned char *inbuffer,unsigned char *outbuffer,i_img_dim rowsize,int channels) {
+interleave(const unsigned char *inbuffer,unsigned char *outbuffer,i_img_dim rowsize,int channels) {
   i_img_dim ind,i;
   int ch;
   i=0;
-  if (inbuffer == outbuffer) return; /* Check if data is already in interleaved format */
   for (ind=0; ind<rowsize; ind++) 
     for (ch=0; ch<channels; ch++) 
       outbuffer[i++] = inbuffer[rowsize*ch+ind]; 
@@ -41,13 +41,11 @@ interleave(unsigned char *inbuffer,unsigned char *outbuffer,i_img_dim rowsize,in
 
 static
 void
-expandchannels(unsigned char *inbuffer, unsigned char *outbuffer, 
+expandchannels(const unsigned char *inbuffer, unsigned char *outbuffer, 
 	       i_img_dim xsize, int datachannels, int storechannels) {
   i_img_dim x;
   int ch;
   int copy_chans = storechannels > datachannels ? datachannels : storechannels;
-  if (inbuffer == outbuffer)
-    return; /* Check if data is already in expanded format */
   for(x = 0; x < xsize; x++) {
     for (ch = 0; ch < copy_chans; ch++) 
       outbuffer[x*storechannels+ch] = inbuffer[x*datachannels+ch];
@@ -65,6 +63,7 @@ i_readraw_wiol(io_glue *ig, i_img_dim x, i_img_dim y, int datachannels, int stor
   unsigned char *inbuffer;
   unsigned char *ilbuffer;
   unsigned char *exbuffer;
+  const unsigned char *row;
   
   size_t inbuflen,ilbuflen,exbuflen;
 
@@ -101,7 +100,7 @@ i_readraw_wiol(io_glue *ig, i_img_dim x, i_img_dim y, int datachannels, int stor
   
   k=0;
   while( k<im->ysize ) {
-    rc = i_io_read(ig, inbuffer, inbuflen);
+    rc = i_io_read_ptr(ig, &row, inbuffer, inbuflen);
     if (rc != (ssize_t)inbuflen) { 
       if (rc < 0)
 	i_push_error(0, "error reading file");
@@ -113,10 +112,18 @@ i_readraw_wiol(io_glue *ig, i_img_dim x, i_img_dim y, int datachannels, int stor
       if (datachannels != storechannels) myfree(exbuffer);
       return NULL;
     }
-    interleave(inbuffer,ilbuffer,im->xsize,datachannels);
-    expandchannels(ilbuffer,exbuffer,im->xsize,datachannels,storechannels);
+    /* row may point into the source's buffer, it's only copied into
+       ilbuffer or exbuffer if it isn't already in the right layout */
+    if (intrl != 0) {
+      interleave(row,ilbuffer,im->xsize,datachannels);
+      row = ilbuffer;
+    }
+    if (datachannels != storechannels) {
+      expandchannels(row,exbuffer,im->xsize,datachannels,storechannels);
+      row = exbuffer;
+    }
     /* FIXME: Do we ever want to save to a virtual image? */
-    memcpy(&(im->idata[im->xsize*storechannels*k]),exbuffer,exbuflen);
+    memcpy(&(im->idata[im->xsize*storechannels*k]),row,exbuflen);
     k++;
   }
 
@@ -130,6 +137,154 @@ i_readraw_wiol(io_glue *ig, i_img_dim x, i_img_dim y, int datachannels, int stor
 }
 
 
+typedef struct {
+  io_glue *ig;
+  off_t offset; /* of the image data */
+  i_img_dim xsize;
+  int datachannels;
+  int storechannels;
+  int intrl;
+  unsigned char *inbuffer;
+  unsigned char *ilbuffer;
+} raw_lazy_source;
+
+static int
+raw_lazy_read(void *p, i_img_dim y, i_img_dim rows, i_sample_t *samples) {
+  raw_lazy_source *src = p;
+  size_t inbuflen = src->xsize * src->datachannels;
+  size_t exbuflen = src->xsize * src->storechannels;
+  i_img_dim k;
+
+  if (i_io_seek(src->ig, src->offset + (off_t)(inbuflen * y), SEEK_SET) < 0) {
+    i_push_error(0, "error seeking in file");
+    return 0;
+  }
+  if (src->intrl == 0 && src->datachannels == src->storechannels) {
+    /* already in the image's layout */
+    if (i_io_read(src->ig, samples, inbuflen * rows) != (ssize_t)(inbuflen * rows)) {
+      i_push_error(0, "premature end of file");
+      return 0;
+    }
+    return 1;
+  }
+
+  for (k = 0; k < rows; ++k) {
+    unsigned char *row = src->inbuffer;
+    if (i_io_read(src->ig, src->inbuffer, inbuflen) != (ssize_t)inbuflen) {
+      i_push_error(0, "premature end of file");
+      return 0;
+    }
+    if (src->intrl != 0) {
+      interleave(row, src->ilbuffer, src->xsize, src->datachannels);
+      row = src->ilbuffer;
+    }
+    if (src->datachannels != src->storechannels)
+      expandchannels(row, samples, src->xsize, src->datachannels,
+		     src->storechannels);
+    else
+      memcpy(samples, row, exbuflen);
+    samples += exbuflen;
+  }
+
+  return 1;
+}
+
+static void
+raw_lazy_destroy(void *p) {
+  raw_lazy_source *src = p;
+
+  io_glue_destroy(src->ig);
+  myfree(src->inbuffer);
+  myfree(src->ilbuffer);
+  myfree(src);
+}
+
+/*
+  As i_readraw_wiol(), but the image returned reads its rows from ig
+  as they're needed, keeping roughly cache_rows rows in memory.
+
+  ig must be seekable, the image keeps its own reference to the
+  source with io_glue_keep().
+*/
+
+i_img *
+i_readraw_lazy_wiol(io_glue *ig, i_img_dim x, i_img_dim y, int datachannels,
+		    int storechannels, int intrl, i_img_dim cache_rows) {
+  raw_lazy_source *src;
+  off_t start, end;
+  size_t inbuflen;
+  i_img_dim band_height;
+  i_img *im;
+
+  i_clear_error();
+
+  mm_log((1, "i_readraw_lazy(ig %p,x %" i_DF ",y %" i_DF ",datachannels %d,storechannels %d,intrl %d, cache_rows %" i_DF ")\n",
+	  ig, i_DFc(x), i_DFc(y), datachannels, storechannels, intrl,
+	  i_DFc(cache_rows)));
+
+  if (intrl != 0 && intrl != 1) {
+    i_push_error(0, "raw_interleave must be 0 or 1");
+    return NULL;
+  }
+  if (storechannels < 1 || storechannels > 4) {
+    i_push_error(0, "raw_storechannels must be between 1 and 4");
+    return NULL;
+  }
+  if (datachannels < 1) {
+    i_push_error(0, "raw_datachannels must be positive");
+    return NULL;
+  }
+  if (cache_rows < 1) {
+    i_push_error(0, "cache_rows must be positive");
+    return NULL;
+  }
+  if (x < 1 || y < 1) {
+    i_push_error(0, "Image sizes must be positive");
+    return NULL;
+  }
+
+  inbuflen = (size_t)x * datachannels;
+  start = i_io_seek(ig, 0, SEEK_CUR);
+  end = i_io_seek(ig, 0, SEEK_END);
+  if (start < 0 || end < 0) {
+    i_push_error(0, "lazy reads need a seekable file");
+    return NULL;
+  }
+  if ((size_t)(end - start) / inbuflen < (size_t)y) {
+    i_push_error(0, "premature end of file");
+    return NULL;
+  }
+
+  src = mymalloc(sizeof(*src));
+  src->ig = io_glue_keep(ig);
+  if (!src->ig) {
+    myfree(src);
+    return NULL;
+  }
+  src->offset = start;
+  src->xsize = x;
+  src->datachannels = datachannels;
+  src->storechannels = storechannels;
+  src->intrl = intrl;
+  src->inbuffer = mymalloc(inbuflen);
+  src->ilbuffer = mymalloc(inbuflen);
+
+  if (cache_rows > y)
+    cache_rows = y;
+  band_height = cache_rows < 16 ? cache_rows : 16;
+  im = i_img_lazy_new(x, y, storechannels, band_height,
+		      (int)((cache_rows + band_height - 1) / band_height),
+		      raw_lazy_read, raw_lazy_destroy, src);
+  if (!im) {
+    raw_lazy_destroy(src);
+    return NULL;
+  }
+
+  i_tags_add(&im->tags, "i_format", 0, "raw", -1, 0);
+
+  return im;
+}
+
 
 undef_int
 i_writeraw_wiol(i_img* im, io_glue *ig) {
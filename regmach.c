@@ -9,7 +9,9 @@
 #define DBG(x) 
 #endif
 
-static float MAX_EXP_ARG; /* = log(DBL_MAX); */
+/* not a lazily initialized static, since i_rm_run() may be called
+   from several threads at once */
+#define MAX_EXP_ARG ((float)log(DBL_MAX))
 
 
 /* these functions currently assume RGB images - there seems to be some 
@@ -419,7 +421,6 @@ i_color i_rm_run(struct rm_op codes[], size_t code_count,
       break;
 
     case rbc_exp:
-      if (!MAX_EXP_ARG) MAX_EXP_ARG = log(DBL_MAX);
       if (na <= MAX_EXP_ARG) {
 	nout = exp(na);
       }
@@ -0,0 +1,854 @@
+#define IM_ROUND_8(x) ((int)((x)+0.5))
+#define IM_ROUND_double(x) (x)
+#define IM_LIMIT_8(x) ((x) < 0 ? 0 : (x) > 255 ? 255 : (x))
+#define IM_LIMIT_double(x) ((x) < 0.0 ? 0.0 : (x) > 1.0 ? 1.0 : (x))
+#line 1 "rotate.im"
+/*
+=head1 NAME
+
+  rotate.im - implements image rotations
+
+=head1 SYNOPSIS
+
+  i_img *i_rotate90(i_img *src, int degrees)
+
+=head1 DESCRIPTION
+
+Implements basic 90 degree rotations of an image.
+
+Other rotations will be added as tuits become available.
+
+=cut
+*/
+
+#include "imager.h"
+#include "imageri.h"
+#include <math.h> /* for floor() */
+
+#define ROT_DEBUG(x)
+
+/* the size of the blocks i_rotate90() transposes */
+#define ROT_BLOCK 32
+
+/* rotate a tiled image into a tiled target a source tile at a time,
+   each source tile lands on at most four target tiles, so both stay
+   in cache.  The target position is tx = tx0 + txx * x + txy * y, and
+   similarly for ty */
+static void
+rotate90_tiled(i_img *src, i_img *targ, int degrees) {
+  i_img_dim x, y, left, top, right, bottom;
+  i_img_dim tx0, txx, txy, ty0, tyx, tyy;
+  int channels = src->channels;
+
+  switch (degrees) {
+  case 90:
+    tx0 = src->ysize - 1; txx = 0; txy = -1;
+    ty0 = 0; tyx = 1; tyy = 0;
+    break;
+
+  case 180:
+    tx0 = src->xsize - 1; txx = -1; txy = 0;
+    ty0 = src->ysize - 1; tyx = 0; tyy = -1;
+    break;
+
+  default: /* 270 */
+    tx0 = 0; txx = 0; txy = 1;
+    ty0 = src->xsize - 1; tyx = -1; tyy = 0;
+    break;
+  }
+
+  for (top = 0; top < src->ysize; top += IM_TILE_SIZE) {
+    bottom = top + IM_TILE_SIZE < src->ysize ? top + IM_TILE_SIZE : src->ysize;
+    for (left = 0; left < src->xsize; left += IM_TILE_SIZE) {
+      right = left + IM_TILE_SIZE < src->xsize ? left + IM_TILE_SIZE : src->xsize;
+      for (y = top; y < bottom; ++y) {
+	const unsigned char *in = src->idata + i_tiled_offset(src, left, y);
+	for (x = left; x < right; ++x) {
+	  i_img_dim tx = tx0 + txx * x + txy * y;
+	  i_img_dim ty = ty0 + tyx * x + tyy * y;
+	  memcpy(targ->idata + i_tiled_offset(targ, tx, ty), in, channels);
+	  in += channels;
+	}
+      }
+    }
+  }
+}
+
+/* copy one pixel of size bytes, called with a constant size so the
+   compiler can use a plain load and store */
+#define ROT_COPY_BLOCK(size)						\
+  for (y = top; y < bottom; ++y) {					\
+    const unsigned char *in = src->idata + (y * src->xsize + left) * (size); \
+    unsigned char *out = targ->idata + (tystart * targ->xsize + tx0 + txy * y) * (size); \
+    for (x = left; x < right; ++x) {					\
+      memcpy(out + (x - left) * tystep, in, (size));			\
+      in += (size);							\
+    }									\
+  }
+
+/* rotate by 90 or 270 degrees between images stored as rows, copying
+   pixel_size byte pixels directly between the idata of each image a
+   block at a time, so the column-wise writes stay in cache */
+static void
+rotate90_rows(i_img *src, i_img *targ, int degrees, size_t pixel_size) {
+  i_img_dim x, y, left, top, right, bottom;
+  i_img_dim tx0, txy, tystart;
+  ptrdiff_t tystep;
+
+  for (top = 0; top < src->ysize; top += ROT_BLOCK) {
+    bottom = top + ROT_BLOCK < src->ysize ? top + ROT_BLOCK : src->ysize;
+    for (left = 0; left < src->xsize; left += ROT_BLOCK) {
+      right = left + ROT_BLOCK < src->xsize ? left + ROT_BLOCK : src->xsize;
+      /* source (x, y) lands in target column tx0 + txy * y, and the
+	 target row moves tystep bytes for each step in x */
+      if (degrees == 90) {
+	tx0 = src->ysize - 1;
+	txy = -1;
+	tystart = left;
+	tystep = (ptrdiff_t)targ->xsize * pixel_size;
+      }
+      else {
+	tx0 = 0;
+	txy = 1;
+	tystart = src->xsize - 1 - left;
+	tystep = -(ptrdiff_t)targ->xsize * pixel_size;
+      }
+      switch (pixel_size) {
+      case 1: ROT_COPY_BLOCK(1); break;
+      case 2: ROT_COPY_BLOCK(2); break;
+      case 3: ROT_COPY_BLOCK(3); break;
+      case 4: ROT_COPY_BLOCK(4); break;
+      case 6: ROT_COPY_BLOCK(6); break;
+      case 8: ROT_COPY_BLOCK(8); break;
+      case 16: ROT_COPY_BLOCK(16); break;
+      case 24: ROT_COPY_BLOCK(24); break;
+      case 32: ROT_COPY_BLOCK(32); break;
+      default: ROT_COPY_BLOCK(pixel_size); break;
+      }
+    }
+  }
+}
+
+i_img *i_rotate90(i_img *src, int degrees) {
+  i_img *targ;
+  i_img_dim x, y;
+
+  i_clear_error();
+
+  if (i_img_is_tiled(src)
+      && (degrees == 90 || degrees == 180 || degrees == 270)) {
+    /* i_sametype() keeps the tiled layout */
+    if (degrees == 180)
+      targ = i_sametype(src, src->xsize, src->ysize);
+    else
+      targ = i_sametype(src, src->ysize, src->xsize);
+    if (targ)
+      rotate90_tiled(src, targ, degrees);
+    return targ;
+  }
+
+  if (degrees == 180) {
+    /* essentially the same as flipxy(..., 2) except that it's not
+       done in place */
+    targ = i_sametype(src, src->xsize, src->ysize);
+    if (src->type == i_direct_type) {
+#line 150 "rotate.im"
+  if (src->bits <= 8) {
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 151 "rotate.im"
+      i_color *vals = mymalloc(src->xsize * sizeof(i_color));
+      for (y = 0; y < src->ysize; ++y) {
+	i_color tmp;
+	i_glin(src, 0, src->xsize, y, vals);
+	for (x = 0; x < src->xsize/2; ++x) {
+	  tmp = vals[x];
+	  vals[x] = vals[src->xsize - x - 1];
+	  vals[src->xsize - x - 1] = tmp;
+	}
+	i_plin(targ, 0, src->xsize, src->ysize - y - 1, vals);
+      }
+      myfree(vals);
+  }
+  else {
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 151 "rotate.im"
+      i_fcolor *vals = mymalloc(src->xsize * sizeof(i_fcolor));
+      for (y = 0; y < src->ysize; ++y) {
+	i_fcolor tmp;
+	i_glinf(src, 0, src->xsize, y, vals);
+	for (x = 0; x < src->xsize/2; ++x) {
+	  tmp = vals[x];
+	  vals[x] = vals[src->xsize - x - 1];
+	  vals[src->xsize - x - 1] = tmp;
+	}
+	i_plinf(targ, 0, src->xsize, src->ysize - y - 1, vals);
+      }
+      myfree(vals);
+  }
+#line 164 "rotate.im"
+    }
+    else {
+      i_palidx *vals = mymalloc(src->xsize * sizeof(i_palidx));
+
+      for (y = 0; y < src->ysize; ++y) {
+        i_palidx tmp;
+        i_gpal(src, 0, src->xsize, y, vals);
+        for (x = 0; x < src->xsize/2; ++x) {
+          tmp = vals[x];
+          vals[x] = vals[src->xsize - x - 1];
+          vals[src->xsize - x - 1] = tmp;
+        }
+        i_ppal(targ, 0, src->xsize, src->ysize - y - 1, vals);
+      }
+      
+      myfree(vals);
+    }
+
+    return targ;
+  }
+  else if (degrees == 270 || degrees == 90) {
+    /* transpose a block at a time, reading ROT_BLOCK short rows of the
+       source and writing the block's columns as short target rows, so
+       neither image is walked down a column a pixel at a time */
+    i_img_dim left, top, width, height;
+
+    targ = i_sametype(src, src->ysize, src->xsize);
+    if (!targ)
+      return NULL;
+    if (!i_img_virtual(src) && src->type == i_direct_type
+	&& !i_img_virtual(targ)) {
+      rotate90_rows(src, targ, degrees,
+		    src->bytes / src->xsize / src->ysize);
+    }
+    else if (src->type == i_direct_type) {
+#line 199 "rotate.im"
+  if (src->bits <= 8) {
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 200 "rotate.im"
+      i_color *block = mymalloc(ROT_BLOCK * ROT_BLOCK * sizeof(i_color));
+      i_color *row = mymalloc(ROT_BLOCK * sizeof(i_color));
+
+      for (top = 0; top < src->ysize; top += ROT_BLOCK) {
+	height = src->ysize - top < ROT_BLOCK ? src->ysize - top : ROT_BLOCK;
+	for (left = 0; left < src->xsize; left += ROT_BLOCK) {
+	  width = src->xsize - left < ROT_BLOCK ? src->xsize - left : ROT_BLOCK;
+	  for (y = 0; y < height; ++y)
+	    i_glin(src, left, left + width, top + y, block + y * ROT_BLOCK);
+	  for (x = 0; x < width; ++x) {
+	    if (degrees == 90) {
+	      for (y = 0; y < height; ++y)
+		row[height - 1 - y] = block[y * ROT_BLOCK + x];
+	      i_plin(targ, src->ysize - top - height, src->ysize - top,
+		      left + x, row);
+	    }
+	    else {
+	      for (y = 0; y < height; ++y)
+		row[y] = block[y * ROT_BLOCK + x];
+	      i_plin(targ, top, top + height, src->xsize - 1 - left - x, row);
+	    }
+	  }
+	}
+      }
+      myfree(row);
+      myfree(block);
+  }
+  else {
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 200 "rotate.im"
+      i_fcolor *block = mymalloc(ROT_BLOCK * ROT_BLOCK * sizeof(i_fcolor));
+      i_fcolor *row = mymalloc(ROT_BLOCK * sizeof(i_fcolor));
+
+      for (top = 0; top < src->ysize; top += ROT_BLOCK) {
+	height = src->ysize - top < ROT_BLOCK ? src->ysize - top : ROT_BLOCK;
+	for (left = 0; left < src->xsize; left += ROT_BLOCK) {
+	  width = src->xsize - left < ROT_BLOCK ? src->xsize - left : ROT_BLOCK;
+	  for (y = 0; y < height; ++y)
+	    i_glinf(src, left, left + width, top + y, block + y * ROT_BLOCK);
+	  for (x = 0; x < width; ++x) {
+	    if (degrees == 90) {
+	      for (y = 0; y < height; ++y)
+		row[height - 1 - y] = block[y * ROT_BLOCK + x];
+	      i_plinf(targ, src->ysize - top - height, src->ysize - top,
+		      left + x, row);
+	    }
+	    else {
+	      for (y = 0; y < height; ++y)
+		row[y] = block[y * ROT_BLOCK + x];
+	      i_plinf(targ, top, top + height, src->xsize - 1 - left - x, row);
+	    }
+	  }
+	}
+      }
+      myfree(row);
+      myfree(block);
+  }
+#line 227 "rotate.im"
+    }
+    else {
+      i_palidx *block = mymalloc(ROT_BLOCK * ROT_BLOCK * sizeof(i_palidx));
+      i_palidx *row = mymalloc(ROT_BLOCK * sizeof(i_palidx));
+
+      for (top = 0; top < src->ysize; top += ROT_BLOCK) {
+	height = src->ysize - top < ROT_BLOCK ? src->ysize - top : ROT_BLOCK;
+	for (left = 0; left < src->xsize; left += ROT_BLOCK) {
+	  width = src->xsize - left < ROT_BLOCK ? src->xsize - left : ROT_BLOCK;
+	  for (y = 0; y < height; ++y)
+	    i_gpal(src, left, left + width, top + y, block + y * ROT_BLOCK);
+	  for (x = 0; x < width; ++x) {
+	    if (degrees == 90) {
+	      for (y = 0; y < height; ++y)
+		row[height - 1 - y] = block[y * ROT_BLOCK + x];
+	      i_ppal(targ, src->ysize - top - height, src->ysize - top,
+		     left + x, row);
+	    }
+	    else {
+	      for (y = 0; y < height; ++y)
+		row[y] = block[y * ROT_BLOCK + x];
+	      i_ppal(targ, top, top + height, src->xsize - 1 - left - x, row);
+	    }
+	  }
+	}
+      }
+      myfree(row);
+      myfree(block);
+    }
+    return targ;
+  }
+  else {
+    i_push_error(0, "i_rotate90() only rotates at 90, 180, or 270 degrees");
+    return NULL;
+  }
+}
+
+/* linear interpolation */
+static i_color interp_i_color(i_color before, i_color after, double pos,
+                              int channels) {
+  i_color out;
+  int ch;
+
+  if (channels == 1 || channels == 3) {
+    for (ch = 0; ch < channels; ++ch)
+      out.channel[ch] = ((1-pos) * before.channel[ch] + pos * after.channel[ch]) + 0.5;
+  }
+  else {
+    int total_cover = (1-pos) * before.channel[channels-1]
+      + pos * after.channel[channels-1];
+
+    total_cover = I_LIMIT_8(total_cover);
+    if (total_cover) {
+      double before_alpha = before.channel[channels-1] / 255.0;
+      double after_alpha = after.channel[channels-1] / 255.0;
+      double total_alpha = before_alpha * (1-pos) + after_alpha * pos;
+
+      for (ch = 0; ch < channels-1; ++ch) {
+	int out_level = ((1-pos) * before.channel[ch] * before_alpha + 
+			 pos * after.channel[ch] * after_alpha) / total_alpha + 0.5;
+
+	out.channel[ch] = I_LIMIT_8(out_level);
+      }
+    }
+    else {
+      for (ch = 0; ch < channels-1; ++ch)
+	out.channel[ch] = 0;
+    }
+
+    out.channel[channels-1] = total_cover;
+  }
+
+  return out;
+}
+
+/* hopefully this will be inlined  (it is with -O3 with gcc 2.95.4) */
+/* linear interpolation */
+static i_fcolor interp_i_fcolor(i_fcolor before, i_fcolor after, double pos,
+                                int channels) {
+  i_fcolor out;
+  int ch;
+
+  if (channels == 1 || channels == 3) {
+    for (ch = 0; ch < channels; ++ch)
+      out.channel[ch] = (1-pos) * before.channel[ch] + pos * after.channel[ch];
+  }
+  else {
+    double total_cover = (1-pos) * before.channel[channels-1]
+      + pos * after.channel[channels-1];
+
+    total_cover = I_LIMIT_DOUBLE(total_cover);
+    if (total_cover) {
+      double before_alpha = before.channel[channels-1];
+      double after_alpha = after.channel[channels-1];
+      double total_alpha = before_alpha * (1-pos) + after_alpha * pos;
+
+      for (ch = 0; ch < channels-1; ++ch) {
+	double out_level = ((1-pos) * before.channel[ch] * before_alpha + 
+			 pos * after.channel[ch] * after_alpha) / total_alpha;
+
+	out.channel[ch] = I_LIMIT_DOUBLE(out_level);
+      }
+    }
+    else {
+      for (ch = 0; ch < channels-1; ++ch)
+	out.channel[ch] = 0;
+    }
+
+    out.channel[channels-1] = total_cover;
+  }
+
+  return out;
+}
+
+typedef struct {
+  i_img *src;
+  i_img *dest;
+  const double *matrix;
+  i_color back;
+  i_fcolor fback;
+} mt_state;
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 350 "rotate.im"
+
+/* transform rows start to end-1 of a direct colour image */
+static void
+mt_band_8(void *p, i_img_dim start, i_img_dim end) {
+  mt_state *state = p;
+  i_img *src = state->src;
+  const double *matrix = state->matrix;
+  i_img_dim xsize = state->dest->xsize;
+  i_color *vals = im_work_malloc(xsize * sizeof(i_color));
+  i_img_dim x, y;
+  i_img_dim i, j;
+  double sx, sy, sz;
+#ifdef IM_EIGHT_BIT
+  i_color back = state->back;
+#else
+#define interp_i_color interp_i_fcolor
+  i_color back = state->fback;
+#endif
+
+  for (y = start; y < end; ++y) {
+    for (x = 0; x < xsize; ++x) {
+      /* dividing by sz gives us the ability to do perspective 
+	 transforms */
+      sz = x * matrix[6] + y * matrix[7] + matrix[8];
+      if (fabs(sz) > 0.0000001) {
+	sx = (x * matrix[0] + y * matrix[1] + matrix[2]) / sz;
+	sy = (x * matrix[3] + y * matrix[4] + matrix[5]) / sz;
+      }
+      else {
+	sx = sy = 0;
+      }
+      
+      /* anything outside these ranges is either a broken co-ordinate
+	 or outside the source */
+      if (fabs(sz) > 0.0000001 
+	  && sx >= -1 && sx < src->xsize
+	  && sy >= -1 && sy < src->ysize) {
+	double fsx = floor(sx);
+	double fsy = floor(sy);
+	i_img_dim bx = fsx;
+	i_img_dim by = fsy;
+
+	ROT_DEBUG(fprintf(stderr, "map " i_DFp " to %g,%g\n", i_DFcp(x, y), sx, sy));
+	if (sx != fsx) {
+	  double dx = sx - fsx;
+	  if (sy != fsy) {
+	    i_color c[2][2]; 
+	    i_color ci2[2];
+	    double dy = sy - fsy;
+	    ROT_DEBUG(fprintf(stderr, " both non-int\n"));
+	    for (i = 0; i < 2; ++i)
+	      for (j = 0; j < 2; ++j)
+		if (i_gpix(src, bx+i, by+j, &c[j][i]))
+		  c[j][i] = back;
+	    for (j = 0; j < 2; ++j)
+	      ci2[j] = interp_i_color(c[j][0], c[j][1], dx, src->channels);
+	    vals[x] = interp_i_color(ci2[0], ci2[1], dy, src->channels);
+	  }
+	  else {
+	    i_color ci2[2];
+	    ROT_DEBUG(fprintf(stderr, " y int, x non-int\n"));
+	    for (i = 0; i < 2; ++i)
+	      if (i_gpix(src, bx+i, sy, ci2+i))
+		ci2[i] = back;
+	    vals[x] = interp_i_color(ci2[0], ci2[1], dx, src->channels);
+	  }
+	}
+	else {
+	  if (sy != fsy) {
+	    i_color ci2[2];
+	    double dy = sy - fsy;
+	    ROT_DEBUG(fprintf(stderr, " x int, y non-int\n"));
+	    for (i = 0; i < 2; ++i)
+	      if (i_gpix(src, bx, by+i, ci2+i))
+		ci2[i] = back;
+	    vals[x] = interp_i_color(ci2[0], ci2[1], dy, src->channels);
+	  }
+	  else {
+	    ROT_DEBUG(fprintf(stderr, " both int\n"));
+	    /* all the world's an integer */
+	    if (i_gpix(src, bx, by, vals+x))
+	      vals[x] = back;
+	  }
+	}
+      }
+      else {
+	vals[x] = back;
+      }
+    }
+    i_plin(state->dest, 0, xsize, y, vals);
+  }
+  im_work_free(vals);
+#undef interp_i_color
+}
+
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 350 "rotate.im"
+
+/* transform rows start to end-1 of a direct colour image */
+static void
+mt_band_double(void *p, i_img_dim start, i_img_dim end) {
+  mt_state *state = p;
+  i_img *src = state->src;
+  const double *matrix = state->matrix;
+  i_img_dim xsize = state->dest->xsize;
+  i_fcolor *vals = im_work_malloc(xsize * sizeof(i_fcolor));
+  i_img_dim x, y;
+  i_img_dim i, j;
+  double sx, sy, sz;
+#ifdef IM_EIGHT_BIT
+  i_fcolor back = state->back;
+#else
+#define interp_i_color interp_i_fcolor
+  i_fcolor back = state->fback;
+#endif
+
+  for (y = start; y < end; ++y) {
+    for (x = 0; x < xsize; ++x) {
+      /* dividing by sz gives us the ability to do perspective 
+	 transforms */
+      sz = x * matrix[6] + y * matrix[7] + matrix[8];
+      if (fabs(sz) > 0.0000001) {
+	sx = (x * matrix[0] + y * matrix[1] + matrix[2]) / sz;
+	sy = (x * matrix[3] + y * matrix[4] + matrix[5]) / sz;
+      }
+      else {
+	sx = sy = 0;
+      }
+      
+      /* anything outside these ranges is either a broken co-ordinate
+	 or outside the source */
+      if (fabs(sz) > 0.0000001 
+	  && sx >= -1 && sx < src->xsize
+	  && sy >= -1 && sy < src->ysize) {
+	double fsx = floor(sx);
+	double fsy = floor(sy);
+	i_img_dim bx = fsx;
+	i_img_dim by = fsy;
+
+	ROT_DEBUG(fprintf(stderr, "map " i_DFp " to %g,%g\n", i_DFcp(x, y), sx, sy));
+	if (sx != fsx) {
+	  double dx = sx - fsx;
+	  if (sy != fsy) {
+	    i_fcolor c[2][2]; 
+	    i_fcolor ci2[2];
+	    double dy = sy - fsy;
+	    ROT_DEBUG(fprintf(stderr, " both non-int\n"));
+	    for (i = 0; i < 2; ++i)
+	      for (j = 0; j < 2; ++j)
+		if (i_gpixf(src, bx+i, by+j, &c[j][i]))
+		  c[j][i] = back;
+	    for (j = 0; j < 2; ++j)
+	      ci2[j] = interp_i_color(c[j][0], c[j][1], dx, src->channels);
+	    vals[x] = interp_i_color(ci2[0], ci2[1], dy, src->channels);
+	  }
+	  else {
+	    i_fcolor ci2[2];
+	    ROT_DEBUG(fprintf(stderr, " y int, x non-int\n"));
+	    for (i = 0; i < 2; ++i)
+	      if (i_gpixf(src, bx+i, sy, ci2+i))
+		ci2[i] = back;
+	    vals[x] = interp_i_color(ci2[0], ci2[1], dx, src->channels);
+	  }
+	}
+	else {
+	  if (sy != fsy) {
+	    i_fcolor ci2[2];
+	    double dy = sy - fsy;
+	    ROT_DEBUG(fprintf(stderr, " x int, y non-int\n"));
+	    for (i = 0; i < 2; ++i)
+	      if (i_gpixf(src, bx, by+i, ci2+i))
+		ci2[i] = back;
+	    vals[x] = interp_i_color(ci2[0], ci2[1], dy, src->channels);
+	  }
+	  else {
+	    ROT_DEBUG(fprintf(stderr, " both int\n"));
+	    /* all the world's an integer */
+	    if (i_gpixf(src, bx, by, vals+x))
+	      vals[x] = back;
+	  }
+	}
+      }
+      else {
+	vals[x] = back;
+      }
+    }
+    i_plinf(state->dest, 0, xsize, y, vals);
+  }
+  im_work_free(vals);
+#undef interp_i_color
+}
+
+#line 446 "rotate.im"
+
+i_img *i_matrix_transform_bg(i_img *src, i_img_dim xsize, i_img_dim ysize, const double *matrix,
+			     const i_color *backp, const i_fcolor *fbackp) {
+  i_img *result = i_sametype(src, xsize, ysize);
+  int ch;
+  i_img_dim i;
+
+  if (src->type == i_direct_type) {
+    mt_state state;
+    im_work_band_f f = src->bits <= 8 ? mt_band_8 : mt_band_double;
+
+    state.src = src;
+    state.dest = result;
+    state.matrix = matrix;
+
+    /* each variant prefers the background of its own type */
+    if (backp) {
+      state.back = *backp;
+    }
+    else if (fbackp) {
+      for (ch = 0; ch < src->channels; ++ch) {
+	i_fsample_t fsamp;
+	fsamp = fbackp->channel[ch];
+	state.back.channel[ch] = fsamp < 0 ? 0 : fsamp > 1 ? 255 : fsamp * 255;
+      }
+    }
+    else {
+      for (ch = 0; ch < src->channels; ++ch)
+	state.back.channel[ch] = 0;
+    }
+    if (fbackp) {
+      state.fback = *fbackp;
+    }
+    else {
+      for (ch = 0; ch < src->channels; ++ch)
+	state.fback.channel[ch] = state.back.channel[ch] / 255.0;
+    }
+
+    /* each row of the result is independent */
+    if (i_img_work_safe(src))
+      im_work_bands(src->context, ysize, 4, f, &state);
+    else
+      f(&state, 0, ysize);
+  }
+  else {
+    /* don't interpolate for a palette based image */
+    i_palidx *vals = mymalloc(xsize * sizeof(i_palidx));
+    i_palidx back = 0;
+    int minval = 256 * 4;
+    i_img_dim x, y, ix, iy;
+    double sx, sy, sz;
+    i_color want_back;
+    i_fsample_t fsamp;
+
+    if (backp) {
+      want_back = *backp;
+    }
+    else if (fbackp) {
+      for (ch = 0; ch < src->channels; ++ch) {
+	fsamp = fbackp->channel[ch];
+	want_back.channel[ch] = fsamp < 0 ? 0 : fsamp > 1 ? 255 : fsamp * 255;
+      }
+    }
+    else {
+      for (ch = 0; ch < src->channels; ++ch)
+	want_back.channel[ch] = 0;
+    }
+    
+    /* find the closest color */
+    for (i = 0; i < i_colorcount(src); ++i) {
+      i_color temp;
+      int tempval;
+      i_getcolors(src, i, &temp, 1);
+      tempval = 0;
+      for (ch = 0; ch < src->channels; ++ch) {
+        tempval += abs(want_back.channel[ch] - temp.channel[ch]);
+      }
+      if (tempval < minval) {
+        back = i;
+        minval = tempval;
+      }
+    }
+
+    for (y = 0; y < ysize; ++y) {
+      for (x = 0; x < xsize; ++x) {
+        /* dividing by sz gives us the ability to do perspective 
+           transforms */
+        sz = x * matrix[6] + y * matrix[7] + matrix[8];
+        if (fabs(sz) > 0.0000001) {
+          sx = (x * matrix[0] + y * matrix[1] + matrix[2]) / sz;
+          sy = (x * matrix[3] + y * matrix[4] + matrix[5]) / sz;
+        }
+        else {
+          sx = sy = 0;
+        }
+        
+        /* anything outside these ranges is either a broken co-ordinate
+           or outside the source */
+        if (fabs(sz) > 0.0000001 
+            && sx >= -0.5 && sx < src->xsize-0.5
+            && sy >= -0.5 && sy < src->ysize-0.5) {
+          
+          /* all the world's an integer */
+          ix = (i_img_dim)(sx+0.5);
+          iy = (i_img_dim)(sy+0.5);
+          if (!i_gpal(src, ix, ix+1, iy, vals+x))
+	    vals[i] = back;
+        }
+        else {
+          vals[x] = back;
+        }
+      }
+      i_ppal(result, 0, xsize, y, vals);
+    }
+    myfree(vals);
+  }
+
+  return result;
+}
+
+i_img *i_matrix_transform(i_img *src, i_img_dim xsize, i_img_dim ysize, const double *matrix) {
+  return i_matrix_transform_bg(src, xsize, ysize, matrix, NULL, NULL);
+}
+
+static void
+i_matrix_mult(double *dest, const double *left, const double *right) {
+  int i, j, k;
+  double accum;
+  
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) {
+      accum = 0.0;
+      for (k = 0; k < 3; ++k) {
+        accum += left[3*i+k] * right[3*k+j];
+      }
+      dest[3*i+j] = accum;
+    }
+  }
+}
+
+#define numfmt "%23g"
+
+ROT_DEBUG(static void dump_mat(const char *name, double *f) {
+  fprintf(stderr, "%s:\n  " numfmt " " numfmt " " numfmt "\n"
+	  "  " numfmt " " numfmt " " numfmt "\n"
+	  "  " numfmt " " numfmt " " numfmt "\n",
+	  name, f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8]);
+  })
+
+i_img *i_rotate_exact_bg(i_img *src, double amount, 
+			 const i_color *backp, const i_fcolor *fbackp) {
+  double xlate1[9] = { 0 };
+  double rotate[9];
+  double xlate2[9] = { 0 };
+  double temp[9], matrix[9];
+  i_img_dim x1, x2, y1, y2, newxsize, newysize;
+
+  ROT_DEBUG(fprintf(stderr, "rotate angle %.20g\n", amount));
+
+  /* first translate the centre of the image to (0,0) */
+  xlate1[0] = 1;
+  xlate1[2] = (src->xsize-1)/2.0;
+  xlate1[4] = 1;
+  xlate1[5] = (src->ysize-1)/2.0;
+  xlate1[8] = 1;
+
+  ROT_DEBUG(dump_mat("xlate1", xlate1));
+
+  /* rotate around (0.0) */
+  rotate[0] = cos(amount);
+  rotate[1] = sin(amount);
+  rotate[2] = 0;
+  rotate[3] = -rotate[1];
+  rotate[4] = rotate[0];
+  rotate[5] = 0;
+  rotate[6] = 0;
+  rotate[7] = 0;
+  rotate[8] = 1;
+
+  ROT_DEBUG(dump_mat("rotate", rotate));
+
+  ROT_DEBUG(fprintf(stderr, "cos %g sin %g\n", rotate[0], rotate[1]));
+
+  x1 = ceil(fabs(src->xsize * rotate[0] + src->ysize * rotate[1]) - 0.0001);
+  x2 = ceil(fabs(src->xsize * rotate[0] - src->ysize * rotate[1]) - 0.0001);
+  y1 = ceil(fabs(src->xsize * rotate[3] + src->ysize * rotate[4]) - 0.0001);
+  y2 = ceil(fabs(src->xsize * rotate[3] - src->ysize * rotate[4]) - 0.0001);
+  ROT_DEBUG(fprintf(stderr, "x1 y1 " i_DFp " x2 y2 " i_DFp "\n", i_DFcp(x1, y1), i_DFcp(x2, y2)));
+  newxsize = x1 > x2 ? x1 : x2;
+  newysize = y1 > y2 ? y1 : y2;
+  /* translate the centre back to the center of the image */
+  xlate2[0] = 1;
+  xlate2[2] = -(newxsize-1)/2.0;
+  xlate2[4] = 1;
+  xlate2[5] = -(newysize-1)/2.0;
+  xlate2[8] = 1;
+
+  ROT_DEBUG(dump_mat("xlate2", xlate2));
+
+  i_matrix_mult(temp, xlate1, rotate);
+  i_matrix_mult(matrix, temp, xlate2);
+
+  ROT_DEBUG(dump_mat("matrxi", matrix));
+
+  return i_matrix_transform_bg(src, newxsize, newysize, matrix, backp, fbackp);
+}
+
+i_img *i_rotate_exact(i_img *src, double amount) {
+  return i_rotate_exact_bg(src, amount, NULL, NULL);
+}
+
+
+/*
+=back
+
+=head1 AUTHOR
+
+Tony Cook <tony@develop-help.com>
+
+=head1 SEE ALSO
+
+Imager(3)
+
+=cut
+*/
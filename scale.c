@@ -0,0 +1,1832 @@
+#define IM_ROUND_8(x) ((int)((x)+0.5))
+#define IM_ROUND_double(x) (x)
+#define IM_LIMIT_8(x) ((x) < 0 ? 0 : (x) > 255 ? 255 : (x))
+#define IM_LIMIT_double(x) ((x) < 0.0 ? 0.0 : (x) > 1.0 ? 1.0 : (x))
+#line 1 "scale.im"
+#include "imager.h"
+#include "imageri.h"
+#include <math.h>
+#include <string.h>
+
+#define XAXIS 0
+#define YAXIS 1
+
+/*
+ * i_scale_mixing() is based on code contained in pnmscale.c, part of
+ * the netpbm distribution.  No code was copied from pnmscale but
+ * the algorthm was and for this I thank the netpbm crew.
+ *
+ * Tony
+ */
+
+/* pnmscale.c - read a portable anymap and scale it
+**
+** Copyright (C) 1989, 1991 by Jef Poskanzer.
+**
+** Permission to use, copy, modify, and distribute this software and its
+** documentation for any purpose and without fee is hereby granted, provided
+** that the above copyright notice appear in all copies and that both that
+** copyright notice and this permission notice appear in supporting
+** documentation.  This software is provided "as is" without express or
+** implied warranty.
+**
+*/
+
+
+static void
+zero_row(i_fcolor *row, i_img_dim width, int channels);
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 35 "scale.im"
+static void
+accum_output_row_8(i_fcolor *accum, double fraction, i_color const *in,
+		 i_img_dim width, int channels);
+static void
+horizontal_scale_8(i_color *out, i_img_dim out_width, 
+                            i_fcolor const *in, i_img_dim in_width,
+                            int channels);
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 35 "scale.im"
+static void
+accum_output_row_double(i_fcolor *accum, double fraction, i_fcolor const *in,
+		 i_img_dim width, int channels);
+static void
+horizontal_scale_double(i_fcolor *out, i_img_dim out_width, 
+                            i_fcolor const *in, i_img_dim in_width,
+                            int channels);
+#line 43 "scale.im"
+
+typedef struct {
+  i_img *src;
+  i_img *result;
+  double y_scale;
+} scale_state;
+
+/*
+  The vertical accumulation for output row y depends on how much of
+  each source row earlier output rows have consumed, so replay that
+  bookkeeping, without touching any pixels, to find where a band
+  starting at output row start picks up.
+*/
+static void
+scale_band_start(const scale_state *state, i_img_dim start,
+                 i_img_dim *rowsreadp, double *rowsleftp) {
+  i_img_dim rowsread = 0;
+  double rowsleft = 0.0;
+  i_img_dim y;
+
+  for (y = 0; y < start; ++y) {
+    double fracrowtofill = 1.0;
+    while (fracrowtofill > 0) {
+      if (rowsleft <= 0) {
+        if (rowsread < state->src->ysize)
+          ++rowsread;
+        rowsleft = state->y_scale;
+      }
+      if (rowsleft < fracrowtofill) {
+        fracrowtofill -= rowsleft;
+        rowsleft = 0;
+      }
+      else {
+        rowsleft -= fracrowtofill;
+        fracrowtofill = 0;
+      }
+    }
+  }
+
+  *rowsreadp = rowsread;
+  *rowsleftp = rowsleft;
+}
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 87 "scale.im"
+
+/* produce output rows start to end-1 */
+static void
+scale_band_8(void *p, i_img_dim start, i_img_dim end) {
+  scale_state *state = p;
+  i_img *src = state->src;
+  i_img *result = state->result;
+  i_img_dim x_out = result->xsize;
+  i_img_dim y_out = result->ysize;
+  double y_scale = state->y_scale;
+  i_fcolor *accum_row = im_work_malloc(sizeof(i_fcolor) * src->xsize);
+  i_color *in_row = im_work_malloc(sizeof(i_color) * src->xsize);
+  i_color *xscale_row = im_work_malloc(sizeof(i_color) * x_out);
+  double rowsleft, fracrowtofill;
+  i_img_dim rowsread;
+  i_img_dim x, y;
+  int ch;
+
+  scale_band_start(state, start, &rowsread, &rowsleft);
+  if (y_out != src->ysize && rowsread > 0) {
+    /* the partly used row from the previous band */
+    i_glin(src, 0, src->xsize, rowsread - 1, in_row);
+  }
+
+  for (y = start; y < end; ++y) {
+    if (y_out == src->ysize) {
+      /* no vertical scaling, just load it */
+#ifdef IM_EIGHT_BIT
+      /* load and convert to doubles */
+      i_glin(src, 0, src->xsize, y, in_row);
+      for (x = 0; x < src->xsize; ++x) {
+        for (ch = 0; ch < src->channels; ++ch) {
+          accum_row[x].channel[ch] = in_row[x].channel[ch];
+        }
+      }
+#else
+      i_glin(src, 0, src->xsize, y, accum_row);
+#endif
+      /* alpha adjust if needed */
+      if (src->channels == 2 || src->channels == 4) {
+	for (x = 0; x < src->xsize; ++x) {
+	  for (ch = 0; ch < src->channels-1; ++ch) {
+	    accum_row[x].channel[ch] *=
+	      accum_row[x].channel[src->channels-1] / 255;
+	  }
+	}
+      }
+    }
+    else {
+      fracrowtofill = 1.0;
+      zero_row(accum_row, src->xsize, src->channels);
+      while (fracrowtofill > 0) {
+	if (rowsleft <= 0) {
+	  if (rowsread < src->ysize) {
+	    i_glin(src, 0, src->xsize, rowsread, in_row);
+	    ++rowsread;
+	  }
+	  /* else just use the last row read */
+
+	  rowsleft = y_scale;
+	}
+	if (rowsleft < fracrowtofill) {
+	  accum_output_row_8(accum_row, rowsleft, in_row, 
+                                      src->xsize, src->channels);
+	  fracrowtofill -= rowsleft;
+	  rowsleft = 0;
+	}
+	else {
+	  accum_output_row_8(accum_row, fracrowtofill, in_row, 
+                                      src->xsize, src->channels);
+	  rowsleft -= fracrowtofill;
+	  fracrowtofill = 0;
+	}
+      }
+    }
+    /* we've accumulated a vertically scaled row */
+    if (x_out == src->xsize) {
+#if IM_EIGHT_BIT
+      /* no need to scale, but we need to convert it */
+      if (result->channels == 2 || result->channels == 4) {
+	int alpha_chan = result->channels - 1;
+	for (x = 0; x < x_out; ++x) {
+	  double alpha = accum_row[x].channel[alpha_chan] / 255;
+	  if (alpha) {
+	    for (ch = 0; ch < alpha_chan; ++ch) {
+	      int val = accum_row[x].channel[ch] / alpha + 0.5;
+	      xscale_row[x].channel[ch] = IM_LIMIT_8(val);
+	    }
+	  }
+	  else {
+	    /* rather than leaving any color data as whatever was
+	       originally in the buffer, set it to black.  This isn't
+	       any more correct, but it gives us more compressible
+	       image data.
+	       RT #32324
+	    */
+	    for (ch = 0; ch < alpha_chan; ++ch) {
+	      xscale_row[x].channel[ch] = 0;
+	    }
+	  }
+	  xscale_row[x].channel[alpha_chan] = IM_LIMIT_8(accum_row[x].channel[alpha_chan]+0.5);
+	}
+      }
+      else {
+	for (x = 0; x < x_out; ++x) {
+	  for (ch = 0; ch < result->channels; ++ch)
+	    xscale_row[x].channel[ch] = IM_LIMIT_8(accum_row[x].channel[ch]+0.5);
+	}
+      }
+      i_plin(result, 0, x_out, y, xscale_row);
+#else
+      i_plin(result, 0, x_out, y, accum_row);
+#endif
+    }
+    else {
+      horizontal_scale_8(xscale_row, x_out, accum_row, 
+                                  src->xsize, src->channels);
+      i_plin(result, 0, x_out, y, xscale_row);
+    }
+  }
+
+  im_work_free(in_row);
+  im_work_free(xscale_row);
+  im_work_free(accum_row);
+}
+
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 87 "scale.im"
+
+/* produce output rows start to end-1 */
+static void
+scale_band_double(void *p, i_img_dim start, i_img_dim end) {
+  scale_state *state = p;
+  i_img *src = state->src;
+  i_img *result = state->result;
+  i_img_dim x_out = result->xsize;
+  i_img_dim y_out = result->ysize;
+  double y_scale = state->y_scale;
+  i_fcolor *accum_row = im_work_malloc(sizeof(i_fcolor) * src->xsize);
+  i_fcolor *in_row = im_work_malloc(sizeof(i_fcolor) * src->xsize);
+  i_fcolor *xscale_row = im_work_malloc(sizeof(i_fcolor) * x_out);
+  double rowsleft, fracrowtofill;
+  i_img_dim rowsread;
+  i_img_dim x, y;
+  int ch;
+
+  scale_band_start(state, start, &rowsread, &rowsleft);
+  if (y_out != src->ysize && rowsread > 0) {
+    /* the partly used row from the previous band */
+    i_glinf(src, 0, src->xsize, rowsread - 1, in_row);
+  }
+
+  for (y = start; y < end; ++y) {
+    if (y_out == src->ysize) {
+      /* no vertical scaling, just load it */
+#ifdef IM_EIGHT_BIT
+      /* load and convert to doubles */
+      i_glinf(src, 0, src->xsize, y, in_row);
+      for (x = 0; x < src->xsize; ++x) {
+        for (ch = 0; ch < src->channels; ++ch) {
+          accum_row[x].channel[ch] = in_row[x].channel[ch];
+        }
+      }
+#else
+      i_glinf(src, 0, src->xsize, y, accum_row);
+#endif
+      /* alpha adjust if needed */
+      if (src->channels == 2 || src->channels == 4) {
+	for (x = 0; x < src->xsize; ++x) {
+	  for (ch = 0; ch < src->channels-1; ++ch) {
+	    accum_row[x].channel[ch] *=
+	      accum_row[x].channel[src->channels-1] / 1.0;
+	  }
+	}
+      }
+    }
+    else {
+      fracrowtofill = 1.0;
+      zero_row(accum_row, src->xsize, src->channels);
+      while (fracrowtofill > 0) {
+	if (rowsleft <= 0) {
+	  if (rowsread < src->ysize) {
+	    i_glinf(src, 0, src->xsize, rowsread, in_row);
+	    ++rowsread;
+	  }
+	  /* else just use the last row read */
+
+	  rowsleft = y_scale;
+	}
+	if (rowsleft < fracrowtofill) {
+	  accum_output_row_double(accum_row, rowsleft, in_row, 
+                                      src->xsize, src->channels);
+	  fracrowtofill -= rowsleft;
+	  rowsleft = 0;
+	}
+	else {
+	  accum_output_row_double(accum_row, fracrowtofill, in_row, 
+                                      src->xsize, src->channels);
+	  rowsleft -= fracrowtofill;
+	  fracrowtofill = 0;
+	}
+      }
+    }
+    /* we've accumulated a vertically scaled row */
+    if (x_out == src->xsize) {
+#if IM_EIGHT_BIT
+      /* no need to scale, but we need to convert it */
+      if (result->channels == 2 || result->channels == 4) {
+	int alpha_chan = result->channels - 1;
+	for (x = 0; x < x_out; ++x) {
+	  double alpha = accum_row[x].channel[alpha_chan] / 1.0;
+	  if (alpha) {
+	    for (ch = 0; ch < alpha_chan; ++ch) {
+	      int val = accum_row[x].channel[ch] / alpha + 0.5;
+	      xscale_row[x].channel[ch] = IM_LIMIT_double(val);
+	    }
+	  }
+	  else {
+	    /* rather than leaving any color data as whatever was
+	       originally in the buffer, set it to black.  This isn't
+	       any more correct, but it gives us more compressible
+	       image data.
+	       RT #32324
+	    */
+	    for (ch = 0; ch < alpha_chan; ++ch) {
+	      xscale_row[x].channel[ch] = 0;
+	    }
+	  }
+	  xscale_row[x].channel[alpha_chan] = IM_LIMIT_double(accum_row[x].channel[alpha_chan]+0.5);
+	}
+      }
+      else {
+	for (x = 0; x < x_out; ++x) {
+	  for (ch = 0; ch < result->channels; ++ch)
+	    xscale_row[x].channel[ch] = IM_LIMIT_double(accum_row[x].channel[ch]+0.5);
+	}
+      }
+      i_plinf(result, 0, x_out, y, xscale_row);
+#else
+      i_plinf(result, 0, x_out, y, accum_row);
+#endif
+    }
+    else {
+      horizontal_scale_double(xscale_row, x_out, accum_row, 
+                                  src->xsize, src->channels);
+      i_plinf(result, 0, x_out, y, xscale_row);
+    }
+  }
+
+  im_work_free(in_row);
+  im_work_free(xscale_row);
+  im_work_free(accum_row);
+}
+
+#line 214 "scale.im"
+
+/*
+=item i_scale_mixing
+
+Returns a new image scaled to the given size.
+
+Unlike i_scale_axis() this does a simple coverage of pixels from
+source to target and doesn't resample.
+
+Adapted from pnmscale.
+
+=cut
+*/
+i_img *
+i_scale_mixing(i_img *src, i_img_dim x_out, i_img_dim y_out) {
+  i_img *result = NULL;
+  scale_state state;
+  im_work_band_f f;
+  size_t accum_row_bytes;
+
+  mm_log((1, "i_scale_mixing(src %p, out(" i_DFp "))\n", 
+	  src, i_DFcp(x_out, y_out)));
+
+  i_clear_error();
+
+  if (x_out <= 0) {
+    i_push_errorf(0, "output width %" i_DF " invalid", i_DFc(x_out));
+    return NULL;
+  }
+  if (y_out <= 0) {
+    i_push_errorf(0, "output height %" i_DF " invalid", i_DFc(y_out));
+    return NULL;
+  }
+
+  if (x_out == src->xsize && y_out == src->ysize) {
+    return i_copy(src);
+  }
+
+  /* the row buffers are no larger than these */
+  accum_row_bytes = sizeof(i_fcolor) * src->xsize;
+  if (accum_row_bytes / sizeof(i_fcolor) != (size_t)src->xsize) {
+    i_push_error(0, "integer overflow allocating accumulator row buffer");
+    return NULL;
+  }
+  if (sizeof(i_fcolor) * x_out / sizeof(i_fcolor) != (size_t)x_out) {
+    i_push_error(0, "integer overflow allocating output row buffer");
+    return NULL;
+  }
+
+  result = i_sametype_chans(src, x_out, y_out, src->channels);
+  if (!result)
+    return NULL;
+
+  state.src = src;
+  state.result = result;
+  state.y_scale = y_out / (double)src->ysize;
+
+  f = src->bits <= 8 ? scale_band_8 : scale_band_double;
+  if (i_img_work_safe(src) && i_img_work_safe(result))
+    im_work_bands(src->context, y_out, 4, f, &state);
+  else
+    f(&state, 0, y_out);
+
+  return result;
+}
+
+static void
+zero_row(i_fcolor *row, i_img_dim width, int channels) {
+  i_img_dim x;
+  int ch;
+
+  /* with IEEE floats we could just use memset() but that's not
+     safe in general under ANSI C.
+     memset() is slightly faster.
+  */
+  for (x = 0; x < width; ++x) {
+    for (ch = 0; ch < channels; ++ch)
+      row[x].channel[ch] = 0.0;
+  }
+}
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 296 "scale.im"
+
+static void
+accum_output_row_8(i_fcolor *accum, double fraction, i_color const *in,
+		 i_img_dim width, int channels) {
+  i_img_dim x;
+  int ch;
+
+  /* it's tempting to change this into a pointer iteration loop but
+     modern CPUs do the indexing as part of the instruction */
+  if (channels == 2 || channels == 4) {
+    for (x = 0; x < width; ++x) {
+      for (ch = 0; ch < channels-1; ++ch) {
+	accum[x].channel[ch] += in[x].channel[ch] * fraction * in[x].channel[channels-1] / 255;
+      }
+      accum[x].channel[channels-1] += in[x].channel[channels-1] * fraction;
+    }
+  }
+  else {
+    for (x = 0; x < width; ++x) {
+      for (ch = 0; ch < channels; ++ch) {
+	accum[x].channel[ch] += in[x].channel[ch] * fraction;
+      }
+    }
+  }
+}
+
+static void
+horizontal_scale_8(i_color *out, i_img_dim out_width, 
+		 i_fcolor const *in, i_img_dim in_width,
+		 int channels) {
+  double frac_col_to_fill, frac_col_left;
+  i_img_dim in_x;
+  i_img_dim out_x;
+  double x_scale = (double)out_width / in_width;
+  int ch;
+  double accum[MAXCHANNELS] = { 0 };
+  
+  frac_col_to_fill = 1.0;
+  out_x = 0;
+  for (in_x = 0; in_x < in_width; ++in_x) {
+    frac_col_left = x_scale;
+    while (frac_col_left >= frac_col_to_fill) {
+      for (ch = 0; ch < channels; ++ch)
+	accum[ch] += frac_col_to_fill * in[in_x].channel[ch];
+
+      if (channels == 2 || channels == 4) {
+	int alpha_chan = channels - 1;
+	double alpha = accum[alpha_chan] / 255;
+	if (alpha) {
+	  for (ch = 0; ch < alpha_chan; ++ch) {
+	    int val = IM_ROUND_8(accum[ch] / alpha);
+	    out[out_x].channel[ch] = IM_LIMIT_8(val);
+	  }
+	}
+	else {
+	  for (ch = 0; ch < alpha_chan; ++ch) {
+	    /* See RT #32324 (and mention above) */
+	    out[out_x].channel[ch] = 0;
+	  }
+	}
+	out[out_x].channel[alpha_chan] = IM_LIMIT_8(IM_ROUND_8(accum[alpha_chan]));
+      }
+      else {
+	for (ch = 0; ch < channels; ++ch) {
+	  int val = IM_ROUND_8(accum[ch]);
+	  out[out_x].channel[ch] = IM_LIMIT_8(val);
+	}
+      }
+      for (ch = 0; ch < channels; ++ch)
+	accum[ch] = 0;
+      frac_col_left -= frac_col_to_fill;
+      frac_col_to_fill = 1.0;
+      ++out_x;
+    }
+
+    if (frac_col_left > 0) {
+      for (ch = 0; ch < channels; ++ch) {
+	accum[ch] += frac_col_left * in[in_x].channel[ch];
+      }
+      frac_col_to_fill -= frac_col_left;
+    }
+  }
+
+  if (out_x < out_width-1 || out_x > out_width) {
+    i_fatal(3, "Internal error: out_x #" i_DF " out of range (width %" i_DF ")", i_DFc(out_x),
+            i_DFc(out_width));
+  }
+  
+  if (out_x < out_width) {
+    for (ch = 0; ch < channels; ++ch) {
+      accum[ch] += frac_col_to_fill * in[in_width-1].channel[ch];
+    }
+    if (channels == 2 || channels == 4) {
+      int alpha_chan = channels - 1;
+      double alpha = accum[alpha_chan] / 255;
+      if (alpha) {
+	for (ch = 0; ch < alpha_chan; ++ch) {
+	  int val = IM_ROUND_8(accum[ch] / alpha);
+	  out[out_x].channel[ch] = IM_LIMIT_8(val);
+	}
+      }
+      else {
+	for (ch = 0; ch < alpha_chan; ++ch) {
+	  /* See RT #32324 (and mention above) */
+	  out[out_x].channel[ch] = 0;
+	}
+      }
+      out[out_x].channel[alpha_chan] = IM_LIMIT_8(IM_ROUND_8(accum[alpha_chan]));
+    }
+    else {
+      for (ch = 0; ch < channels; ++ch) {
+	int val = IM_ROUND_8(accum[ch]);
+	out[out_x].channel[ch] = IM_LIMIT_8(val);
+      }
+    }
+  }
+}
+
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 296 "scale.im"
+
+static void
+accum_output_row_double(i_fcolor *accum, double fraction, i_fcolor const *in,
+		 i_img_dim width, int channels) {
+  i_img_dim x;
+  int ch;
+
+  /* it's tempting to change this into a pointer iteration loop but
+     modern CPUs do the indexing as part of the instruction */
+  if (channels == 2 || channels == 4) {
+    for (x = 0; x < width; ++x) {
+      for (ch = 0; ch < channels-1; ++ch) {
+	accum[x].channel[ch] += in[x].channel[ch] * fraction * in[x].channel[channels-1] / 1.0;
+      }
+      accum[x].channel[channels-1] += in[x].channel[channels-1] * fraction;
+    }
+  }
+  else {
+    for (x = 0; x < width; ++x) {
+      for (ch = 0; ch < channels; ++ch) {
+	accum[x].channel[ch] += in[x].channel[ch] * fraction;
+      }
+    }
+  }
+}
+
+static void
+horizontal_scale_double(i_fcolor *out, i_img_dim out_width, 
+		 i_fcolor const *in, i_img_dim in_width,
+		 int channels) {
+  double frac_col_to_fill, frac_col_left;
+  i_img_dim in_x;
+  i_img_dim out_x;
+  double x_scale = (double)out_width / in_width;
+  int ch;
+  double accum[MAXCHANNELS] = { 0 };
+  
+  frac_col_to_fill = 1.0;
+  out_x = 0;
+  for (in_x = 0; in_x < in_width; ++in_x) {
+    frac_col_left = x_scale;
+    while (frac_col_left >= frac_col_to_fill) {
+      for (ch = 0; ch < channels; ++ch)
+	accum[ch] += frac_col_to_fill * in[in_x].channel[ch];
+
+      if (channels == 2 || channels == 4) {
+	int alpha_chan = channels - 1;
+	double alpha = accum[alpha_chan] / 1.0;
+	if (alpha) {
+	  for (ch = 0; ch < alpha_chan; ++ch) {
+	    double val = IM_ROUND_double(accum[ch] / alpha);
+	    out[out_x].channel[ch] = IM_LIMIT_double(val);
+	  }
+	}
+	else {
+	  for (ch = 0; ch < alpha_chan; ++ch) {
+	    /* See RT #32324 (and mention above) */
+	    out[out_x].channel[ch] = 0;
+	  }
+	}
+	out[out_x].channel[alpha_chan] = IM_LIMIT_double(IM_ROUND_double(accum[alpha_chan]));
+      }
+      else {
+	for (ch = 0; ch < channels; ++ch) {
+	  double val = IM_ROUND_double(accum[ch]);
+	  out[out_x].channel[ch] = IM_LIMIT_double(val);
+	}
+      }
+      for (ch = 0; ch < channels; ++ch)
+	accum[ch] = 0;
+      frac_col_left -= frac_col_to_fill;
+      frac_col_to_fill = 1.0;
+      ++out_x;
+    }
+
+    if (frac_col_left > 0) {
+      for (ch = 0; ch < channels; ++ch) {
+	accum[ch] += frac_col_left * in[in_x].channel[ch];
+      }
+      frac_col_to_fill -= frac_col_left;
+    }
+  }
+
+  if (out_x < out_width-1 || out_x > out_width) {
+    i_fatal(3, "Internal error: out_x #" i_DF " out of range (width %" i_DF ")", i_DFc(out_x),
+            i_DFc(out_width));
+  }
+  
+  if (out_x < out_width) {
+    for (ch = 0; ch < channels; ++ch) {
+      accum[ch] += frac_col_to_fill * in[in_width-1].channel[ch];
+    }
+    if (channels == 2 || channels == 4) {
+      int alpha_chan = channels - 1;
+      double alpha = accum[alpha_chan] / 1.0;
+      if (alpha) {
+	for (ch = 0; ch < alpha_chan; ++ch) {
+	  double val = IM_ROUND_double(accum[ch] / alpha);
+	  out[out_x].channel[ch] = IM_LIMIT_double(val);
+	}
+      }
+      else {
+	for (ch = 0; ch < alpha_chan; ++ch) {
+	  /* See RT #32324 (and mention above) */
+	  out[out_x].channel[ch] = 0;
+	}
+      }
+      out[out_x].channel[alpha_chan] = IM_LIMIT_double(IM_ROUND_double(accum[alpha_chan]));
+    }
+    else {
+      for (ch = 0; ch < channels; ++ch) {
+	double val = IM_ROUND_double(accum[ch]);
+	out[out_x].channel[ch] = IM_LIMIT_double(val);
+      }
+    }
+  }
+}
+
+#line 415 "scale.im"
+
+/*
+=item i_scaleaxis(im, value, axis)
+
+Returns a new image object which is I<im> scaled by I<value> along
+wither the x-axis (I<axis> == 0) or the y-axis (I<axis> == 1).
+
+Equivalent to i_scaleaxis_kernel() with a C<NULL> kernel.
+
+=cut
+*/
+
+i_img *
+i_scaleaxis(i_img *im, double Value, int Axis) {
+  return i_scaleaxis_kernel(im, Value, Axis, NULL);
+}
+
+/*
+  Resampling kernels for i_scaleaxis_kernel()
+
+  http://en.wikipedia.org/wiki/Lanczos_resampling
+  Mitchell and Netravali, "Reconstruction Filters in Computer Graphics"
+*/
+
+static double
+sinc(double x) {
+  double pix = PI * x;
+
+  return x == 0.0 ? 1.0 : sin(pix) / pix;
+}
+
+static double
+lanczos2(double x) {
+  return x < 2.0 ? sinc(x) * sinc(x / 2.0) : 0.0;
+}
+
+static double
+lanczos3(double x) {
+  return x < 3.0 ? sinc(x) * sinc(x / 3.0) : 0.0;
+}
+
+static double
+bicubic(double x, double b, double c) {
+  if (x < 1.0)
+    return ((12 - 9 * b - 6 * c) * x * x * x
+            + (-18 + 12 * b + 6 * c) * x * x
+            + (6 - 2 * b)) / 6.0;
+  else if (x < 2.0)
+    return ((-b - 6 * c) * x * x * x
+            + (6 * b + 30 * c) * x * x
+            + (-12 * b - 48 * c) * x
+            + (8 * b + 24 * c)) / 6.0;
+  else
+    return 0.0;
+}
+
+static double
+mitchell(double x) {
+  return bicubic(x, 1.0 / 3, 1.0 / 3);
+}
+
+static double
+catrom(double x) {
+  return bicubic(x, 0.0, 0.5);
+}
+
+typedef struct {
+  const char *name;
+  double (*f)(double x); /* called with x >= 0 */
+  int radius;
+} scale_kernel;
+
+static const scale_kernel
+scale_kernels[] =
+  {
+    /* the first entry is the default, which keeps the sampling grid
+       and filter width used by earlier releases */
+    { "default", lanczos2, 2 },
+    { "lanczos2", lanczos2, 2 },
+    { "lanczos3", lanczos3, 3 },
+    { "mitchell", mitchell, 2 },
+    { "catrom", catrom, 2 },
+  };
+
+/* fixed point fraction bits for the 8-bit weights */
+#define SCALE_WEIGHT_BITS 14
+#define SCALE_WEIGHT_ONE (1 << SCALE_WEIGHT_BITS)
+
+/*
+  Per output position weights for one axis, calculated once rather
+  than for each row or column.
+
+  Taps that fall outside the source are folded into the edge sample,
+  so the inner loops never need to clamp.
+*/
+typedef struct {
+  i_img_dim out_size;
+  int taps; /* stride of the weight arrays */
+  i_img_dim *start;
+  int *count;
+  double *weights;
+  int *iweights; /* weights * SCALE_WEIGHT_ONE, summing to exactly that */
+} scale_table;
+
+static void
+scale_table_free(scale_table *tab) {
+  myfree(tab->start);
+  myfree(tab->count);
+  myfree(tab->weights);
+  myfree(tab->iweights);
+}
+
+static int
+scale_table_init(scale_table *tab, const scale_kernel *kernel,
+                 i_img_dim in_size, i_img_dim out_size, double value) {
+  double width;
+  double support;
+  double *raw;
+  i_img_dim j;
+
+  if (kernel == scale_kernels) {
+    /* 1.4 is a magic number, setting it to 2 will cause rather
+       blurred images */
+    width = value >= 1 ? 1 : (double)(i_img_dim)(1.4 / value);
+  }
+  else {
+    width = value >= 1 ? 1 : 1.0 / value;
+  }
+  support = kernel->radius * width;
+
+  tab->out_size = out_size;
+  tab->taps = (int)ceil(support) * 2 + 2;
+  if (tab->taps > in_size)
+    tab->taps = in_size;
+  if ((size_t)out_size > im_size_t_max / sizeof(double) / tab->taps) {
+    i_push_error(0, "integer overflow calculating scaling weights");
+    return 0;
+  }
+  tab->start = mymalloc(sizeof(i_img_dim) * out_size);
+  tab->count = mymalloc(sizeof(int) * out_size);
+  tab->weights = mymalloc(sizeof(double) * out_size * tab->taps);
+  tab->iweights = mymalloc(sizeof(int) * out_size * tab->taps);
+  raw = mymalloc(sizeof(double) * ((size_t)ceil(support) * 2 + 2));
+
+  for (j = 0; j < out_size; ++j) {
+    double center, total;
+    i_img_dim lo, hi, first, last, i;
+    double *w = tab->weights + (size_t)j * tab->taps;
+    int *iw = tab->iweights + (size_t)j * tab->taps;
+    int itotal, biggest;
+
+    if (kernel == scale_kernels) {
+      center = j / value;
+      lo = (i_img_dim)center - (i_img_dim)support + 1;
+      hi = (i_img_dim)center + (i_img_dim)support;
+    }
+    else {
+      center = (j + 0.5) / value - 0.5;
+      lo = (i_img_dim)floor(center - support) + 1;
+      hi = (i_img_dim)ceil(center + support) - 1;
+    }
+    if (lo > hi)
+      lo = hi = (i_img_dim)floor(center + 0.5);
+    for (i = lo; i <= hi; ++i)
+      raw[i - lo] = kernel->f(fabs(i - center) / width);
+
+    first = lo < 0 ? 0 : lo > in_size - 1 ? in_size - 1 : lo;
+    last = hi > in_size - 1 ? in_size - 1 : hi < 0 ? 0 : hi;
+    tab->start[j] = first;
+    tab->count[j] = last - first + 1;
+    for (i = 0; i < tab->count[j]; ++i)
+      w[i] = 0;
+    total = 0;
+    for (i = lo; i <= hi; ++i) {
+      i_img_dim src = i < first ? first : i > last ? last : i;
+      w[src - first] += raw[i - lo];
+      total += raw[i - lo];
+    }
+
+    if (fabs(total) < 1e-8) {
+      /* nothing useful under the kernel, use the nearest sample */
+      i_img_dim near = (i_img_dim)floor(center + 0.5);
+      near = near < first ? first : near > last ? last : near;
+      for (i = 0; i < tab->count[j]; ++i)
+        w[i] = 0;
+      w[near - first] = total = 1;
+    }
+
+    itotal = 0;
+    biggest = 0;
+    for (i = 0; i < tab->count[j]; ++i) {
+      w[i] /= total;
+      iw[i] = (int)floor(w[i] * SCALE_WEIGHT_ONE + 0.5);
+      itotal += iw[i];
+      if (w[i] > w[biggest])
+        biggest = i;
+    }
+    /* make sure a flat input gives a flat output */
+    iw[biggest] += SCALE_WEIGHT_ONE - itotal;
+  }
+
+  myfree(raw);
+
+  return 1;
+}
+
+typedef struct {
+  i_img *src;
+  i_img *dest;
+  const scale_table *tab;
+  int has_alpha;
+} scale_axis_state;
+
+typedef struct {
+  i_img *src;
+  i_img *dest;
+  const scale_table *xtab;
+  const scale_table *ytab;
+  int has_alpha;
+} scale_2d_state;
+
+/*
+  Fraction bits kept in the horizontally scaled rows for 8-bit images
+  without alpha, so rounding there doesn't show up in the output.
+
+  With alpha the premultiplied samples already use 16 bits and any
+  more would overflow the vertical accumulator.
+*/
+#define SCALE_EXTRA_BITS 6
+
+/* rounding arithmetic shift for possibly negative values */
+static int
+scale_descale(int value, int bits) {
+  int half = 1 << (bits - 1);
+
+  return value >= 0 ? (value + half) >> bits : -((half - value) >> bits);
+}
+
+#undef IM_EIGHT_BIT
+#define IM_EIGHT_BIT 1
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combine)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_color)
+#line 654 "scale.im"
+
+/*
+  Read a row of samples, converting them to the working form used
+  for accumulation.
+
+  When there's an alpha channel the color samples are multiplied by
+  alpha.  For 8-bit images the alpha channel is also multiplied by
+  255 so every channel has the same scale.
+*/
+static void
+scale_load_row_8(i_img *im, i_img_dim y, i_sample_t *samps,
+                          int *work, int has_alpha) {
+  size_t count = (size_t)im->xsize * im->channels;
+  size_t i;
+
+  i_gsamp(im, 0, im->xsize, y, samps, NULL, im->channels);
+  if (has_alpha) {
+    int color_chans = im->channels - 1;
+    i_img_dim x;
+    for (x = 0; x < im->xsize; ++x) {
+      i_sample_t const *s = samps + (size_t)x * im->channels;
+      int *w = work + (size_t)x * im->channels;
+      int ch;
+      for (ch = 0; ch < color_chans; ++ch)
+        w[ch] = (int)s[ch] * s[color_chans];
+#ifdef IM_EIGHT_BIT
+      w[color_chans] = s[color_chans] * 255;
+#else
+      w[color_chans] = s[color_chans];
+#endif
+    }
+  }
+  else {
+    for (i = 0; i < count; ++i)
+      work[i] = samps[i];
+  }
+}
+
+/* convert accumulated pixels back to samples */
+static void
+scale_finish_row_8(i_sample_t *out, int const *acc,
+                            i_img_dim width, int channels, int has_alpha,
+                            int frac_bits) {
+  i_img_dim x;
+  int ch;
+
+#ifndef IM_EIGHT_BIT
+  (void)frac_bits;
+#endif
+
+  if (has_alpha) {
+    int color_chans = channels - 1;
+    for (x = 0; x < width; ++x) {
+      int a = acc[color_chans];
+#ifdef IM_EIGHT_BIT
+      int alpha = a <= 0 ? 0 : (a + (255 << (frac_bits - 1))) / (255 << frac_bits);
+      if (alpha > 255)
+        alpha = 255;
+#else
+      double alpha = a <= 0 ? 0 : a > 1.0 ? 1.0 : a;
+#endif
+      if (alpha) {
+        for (ch = 0; ch < color_chans; ++ch) {
+#ifdef IM_EIGHT_BIT
+          double value = (double)acc[ch] * 255 / a + 0.5;
+          out[ch] = value < 0 ? 0 : value > 255 ? 255 : (i_sample_t)value;
+#else
+          double value = acc[ch] / a;
+          out[ch] = value < 0 ? 0 : value > 1.0 ? 1.0 : value;
+#endif
+        }
+        out[color_chans] = alpha;
+      }
+      else {
+        /* zero alpha, so the pixel has no color */
+        for (ch = 0; ch < channels; ++ch)
+          out[ch] = 0;
+      }
+      out += channels;
+      acc += channels;
+    }
+  }
+  else {
+    size_t count = (size_t)width * channels;
+    size_t i;
+    for (i = 0; i < count; ++i) {
+#ifdef IM_EIGHT_BIT
+      int value = acc[i] <= 0 ? 0
+        : (acc[i] + (1 << (frac_bits - 1))) >> frac_bits;
+      out[i] = value > 255 ? 255 : value;
+#else
+      out[i] = acc[i] < 0 ? 0 : acc[i] > 1.0 ? 1.0 : acc[i];
+#endif
+    }
+  }
+}
+
+/* resample a row of working samples to tab->out_size pixels */
+static void
+scale_row_8(int *acc, int const *work,
+                     const scale_table *tab, int channels) {
+  i_img_dim j;
+
+  for (j = 0; j < tab->out_size; ++j) {
+    int const *in = work + (size_t)tab->start[j] * channels;
+#ifdef IM_EIGHT_BIT
+    int const *w = tab->iweights + (size_t)j * tab->taps;
+#else
+    double const *w = tab->weights + (size_t)j * tab->taps;
+#endif
+    int count = tab->count[j];
+    int t, ch;
+
+    for (ch = 0; ch < channels; ++ch)
+      acc[ch] = 0;
+    for (t = 0; t < count; ++t) {
+      for (ch = 0; ch < channels; ++ch)
+        acc[ch] += w[t] * in[ch];
+      in += channels;
+    }
+    acc += channels;
+  }
+}
+
+/* add a row of working samples scaled by weight to acc */
+static void
+scale_accum_row_8(int *acc, int const *work,
+                           size_t count, int weight) {
+  size_t i;
+
+  for (i = 0; i < count; ++i)
+    acc[i] += weight * work[i];
+}
+
+/* scale rows start to end-1 horizontally */
+static void
+scale_x_band_8(void *p, i_img_dim start, i_img_dim end) {
+  scale_axis_state *state = p;
+  i_img *src = state->src;
+  int channels = src->channels;
+  i_img_dim out_width = state->dest->xsize;
+  i_sample_t *samps =
+    im_work_malloc(sizeof(i_sample_t) * im_max(src->xsize, out_width) * channels);
+  int *work = im_work_malloc(sizeof(int) * src->xsize * channels);
+  int *acc = im_work_malloc(sizeof(int) * out_width * channels);
+  i_img_dim y;
+
+  for (y = start; y < end; ++y) {
+    scale_load_row_8(src, y, samps, work, state->has_alpha);
+    scale_row_8(acc, work, state->tab, channels);
+    scale_finish_row_8(samps, acc, out_width, channels,
+                                state->has_alpha, SCALE_WEIGHT_BITS);
+    i_psamp(state->dest, 0, out_width, y, samps, NULL, channels);
+  }
+
+  im_work_free(samps);
+  im_work_free(work);
+  im_work_free(acc);
+}
+
+/*
+  produce output rows start to end-1 by scaling vertically
+
+  The source rows needed by successive output rows overlap, so the
+  last tab->taps rows read are kept in a ring buffer.
+*/
+static void
+scale_y_band_8(void *p, i_img_dim start, i_img_dim end) {
+  scale_axis_state *state = p;
+  i_img *src = state->src;
+  const scale_table *tab = state->tab;
+  size_t row_samples = (size_t)src->xsize * src->channels;
+  i_sample_t *samps = im_work_malloc(sizeof(i_sample_t) * row_samples);
+  int *rows = im_work_malloc(sizeof(int) * row_samples * tab->taps);
+  i_img_dim *row_y = im_work_malloc(sizeof(i_img_dim) * tab->taps);
+  int *acc = im_work_malloc(sizeof(int) * row_samples);
+  i_img_dim y;
+  int t;
+
+  for (t = 0; t < tab->taps; ++t)
+    row_y[t] = -1;
+
+  for (y = start; y < end; ++y) {
+#ifdef IM_EIGHT_BIT
+    int const *w = tab->iweights + (size_t)y * tab->taps;
+#else
+    double const *w = tab->weights + (size_t)y * tab->taps;
+#endif
+    size_t i;
+
+    for (i = 0; i < row_samples; ++i)
+      acc[i] = 0;
+    for (t = 0; t < tab->count[y]; ++t) {
+      i_img_dim sy = tab->start[y] + t;
+      int slot = sy % tab->taps;
+      int *row = rows + row_samples * slot;
+      if (row_y[slot] != sy) {
+        scale_load_row_8(src, sy, samps, row, state->has_alpha);
+        row_y[slot] = sy;
+      }
+      scale_accum_row_8(acc, row, row_samples, w[t]);
+    }
+    scale_finish_row_8(samps, acc, src->xsize, src->channels,
+                                state->has_alpha, SCALE_WEIGHT_BITS);
+    i_psamp(state->dest, 0, src->xsize, y, samps, NULL, src->channels);
+  }
+
+  im_work_free(samps);
+  im_work_free(rows);
+  im_work_free(row_y);
+  im_work_free(acc);
+}
+
+/*
+  Limit horizontally scaled samples to the range of the image, as the
+  intermediate image did when scaling one axis at a time, so the
+  overshoot from the negative lobes of the filter isn't amplified by
+  the vertical pass.
+
+  8-bit samples are also reduced from the fixed point weight scale to
+  extra_bits fraction bits.
+*/
+static void
+scale_limit_row_8(int *row, i_img_dim width, int channels,
+                           int has_alpha, int extra_bits) {
+#ifdef IM_EIGHT_BIT
+  int max = has_alpha ? 255 * 255 : 255 << extra_bits;
+#else
+  double max = 1.0;
+#endif
+  size_t count = (size_t)width * channels;
+  size_t i;
+
+#ifdef IM_EIGHT_BIT
+  for (i = 0; i < count; ++i)
+    row[i] = scale_descale(row[i], SCALE_WEIGHT_BITS - extra_bits);
+#else
+  (void)extra_bits;
+#endif
+
+  if (has_alpha) {
+    int color_chans = channels - 1;
+    i_img_dim x;
+    for (x = 0; x < width; ++x) {
+      int alpha = row[color_chans];
+      int ch;
+      if (alpha <= 0) {
+        for (ch = 0; ch < channels; ++ch)
+          row[ch] = 0;
+      }
+      else {
+        /* limit the unpremultiplied color, and keep it when alpha is
+           limited */
+        for (ch = 0; ch < color_chans; ++ch) {
+          int v = row[ch];
+          v = v < 0 ? 0 : v > alpha ? alpha : v;
+          if (alpha > max)
+            v = (int)((double)v * max / alpha);
+          row[ch] = v;
+        }
+        if (alpha > max)
+          row[color_chans] = max;
+      }
+      row += channels;
+    }
+  }
+  else {
+    for (i = 0; i < count; ++i)
+      row[i] = row[i] < 0 ? 0 : row[i] > max ? max : row[i];
+  }
+}
+
+/*
+  produce output rows start to end-1, scaling both axes
+
+  Source rows are scaled horizontally as they're needed, and the last
+  ytab->taps of those are kept in a ring buffer for the vertical pass.
+*/
+static void
+scale_2d_band_8(void *p, i_img_dim start, i_img_dim end) {
+  scale_2d_state *state = p;
+  i_img *src = state->src;
+  const scale_table *ytab = state->ytab;
+  int channels = src->channels;
+  i_img_dim out_width = state->dest->xsize;
+  size_t row_samples = (size_t)src->xsize * channels;
+  size_t out_samples = (size_t)out_width * channels;
+  i_sample_t *samps =
+    im_work_malloc(sizeof(i_sample_t) * im_max(row_samples, out_samples));
+  int *work = im_work_malloc(sizeof(int) * row_samples);
+  int *rows = im_work_malloc(sizeof(int) * out_samples * ytab->taps);
+  i_img_dim *row_y = im_work_malloc(sizeof(i_img_dim) * ytab->taps);
+  int *acc = im_work_malloc(sizeof(int) * out_samples);
+  int extra_bits = state->has_alpha ? 0 : SCALE_EXTRA_BITS;
+  i_img_dim y;
+  int t;
+
+#ifndef IM_EIGHT_BIT
+  (void)extra_bits;
+#endif
+
+  for (t = 0; t < ytab->taps; ++t)
+    row_y[t] = -1;
+
+  for (y = start; y < end; ++y) {
+#ifdef IM_EIGHT_BIT
+    int const *w = ytab->iweights + (size_t)y * ytab->taps;
+#else
+    double const *w = ytab->weights + (size_t)y * ytab->taps;
+#endif
+    size_t i;
+
+    for (i = 0; i < out_samples; ++i)
+      acc[i] = 0;
+    for (t = 0; t < ytab->count[y]; ++t) {
+      i_img_dim sy = ytab->start[y] + t;
+      int slot = sy % ytab->taps;
+      int *row = rows + out_samples * slot;
+      if (row_y[slot] != sy) {
+        scale_load_row_8(src, sy, samps, work, state->has_alpha);
+        scale_row_8(row, work, state->xtab, channels);
+        scale_limit_row_8(row, out_width, channels,
+                                   state->has_alpha, extra_bits);
+        row_y[slot] = sy;
+      }
+      scale_accum_row_8(acc, row, out_samples, w[t]);
+    }
+    scale_finish_row_8(samps, acc, out_width, channels,
+                                state->has_alpha,
+                                SCALE_WEIGHT_BITS + extra_bits);
+    i_psamp(state->dest, 0, out_width, y, samps, NULL, channels);
+  }
+
+  im_work_free(samps);
+  im_work_free(work);
+  im_work_free(rows);
+  im_work_free(row_y);
+  im_work_free(acc);
+}
+
+#undef IM_EIGHT_BIT
+#undef IM_FILL_COMBINE
+#define IM_FILL_COMBINE(fill) ((fill)->combinef)
+#undef IM_FILL_FILLER
+#define IM_FILL_FILLER(fill) ((fill)->f_fill_with_fcolor)
+#line 654 "scale.im"
+
+/*
+  Read a row of samples, converting them to the working form used
+  for accumulation.
+
+  When there's an alpha channel the color samples are multiplied by
+  alpha.  For 8-bit images the alpha channel is also multiplied by
+  255 so every channel has the same scale.
+*/
+static void
+scale_load_row_double(i_img *im, i_img_dim y, i_fsample_t *samps,
+                          double *work, int has_alpha) {
+  size_t count = (size_t)im->xsize * im->channels;
+  size_t i;
+
+  i_gsampf(im, 0, im->xsize, y, samps, NULL, im->channels);
+  if (has_alpha) {
+    int color_chans = im->channels - 1;
+    i_img_dim x;
+    for (x = 0; x < im->xsize; ++x) {
+      i_fsample_t const *s = samps + (size_t)x * im->channels;
+      double *w = work + (size_t)x * im->channels;
+      int ch;
+      for (ch = 0; ch < color_chans; ++ch)
+        w[ch] = (double)s[ch] * s[color_chans];
+#ifdef IM_EIGHT_BIT
+      w[color_chans] = s[color_chans] * 255;
+#else
+      w[color_chans] = s[color_chans];
+#endif
+    }
+  }
+  else {
+    for (i = 0; i < count; ++i)
+      work[i] = samps[i];
+  }
+}
+
+/* convert accumulated pixels back to samples */
+static void
+scale_finish_row_double(i_fsample_t *out, double const *acc,
+                            i_img_dim width, int channels, int has_alpha,
+                            int frac_bits) {
+  i_img_dim x;
+  int ch;
+
+#ifndef IM_EIGHT_BIT
+  (void)frac_bits;
+#endif
+
+  if (has_alpha) {
+    int color_chans = channels - 1;
+    for (x = 0; x < width; ++x) {
+      double a = acc[color_chans];
+#ifdef IM_EIGHT_BIT
+      int alpha = a <= 0 ? 0 : (a + (255 << (frac_bits - 1))) / (255 << frac_bits);
+      if (alpha > 255)
+        alpha = 255;
+#else
+      double alpha = a <= 0 ? 0 : a > 1.0 ? 1.0 : a;
+#endif
+      if (alpha) {
+        for (ch = 0; ch < color_chans; ++ch) {
+#ifdef IM_EIGHT_BIT
+          double value = (double)acc[ch] * 255 / a + 0.5;
+          out[ch] = value < 0 ? 0 : value > 255 ? 255 : (i_sample_t)value;
+#else
+          double value = acc[ch] / a;
+          out[ch] = value < 0 ? 0 : value > 1.0 ? 1.0 : value;
+#endif
+        }
+        out[color_chans] = alpha;
+      }
+      else {
+        /* zero alpha, so the pixel has no color */
+        for (ch = 0; ch < channels; ++ch)
+          out[ch] = 0;
+      }
+      out += channels;
+      acc += channels;
+    }
+  }
+  else {
+    size_t count = (size_t)width * channels;
+    size_t i;
+    for (i = 0; i < count; ++i) {
+#ifdef IM_EIGHT_BIT
+      int value = acc[i] <= 0 ? 0
+        : (acc[i] + (1 << (frac_bits - 1))) >> frac_bits;
+      out[i] = value > 255 ? 255 : value;
+#else
+      out[i] = acc[i] < 0 ? 0 : acc[i] > 1.0 ? 1.0 : acc[i];
+#endif
+    }
+  }
+}
+
+/* resample a row of working samples to tab->out_size pixels */
+static void
+scale_row_double(double *acc, double const *work,
+                     const scale_table *tab, int channels) {
+  i_img_dim j;
+
+  for (j = 0; j < tab->out_size; ++j) {
+    double const *in = work + (size_t)tab->start[j] * channels;
+#ifdef IM_EIGHT_BIT
+    int const *w = tab->iweights + (size_t)j * tab->taps;
+#else
+    double const *w = tab->weights + (size_t)j * tab->taps;
+#endif
+    int count = tab->count[j];
+    int t, ch;
+
+    for (ch = 0; ch < channels; ++ch)
+      acc[ch] = 0;
+    for (t = 0; t < count; ++t) {
+      for (ch = 0; ch < channels; ++ch)
+        acc[ch] += w[t] * in[ch];
+      in += channels;
+    }
+    acc += channels;
+  }
+}
+
+/* add a row of working samples scaled by weight to acc */
+static void
+scale_accum_row_double(double *acc, double const *work,
+                           size_t count, double weight) {
+  size_t i;
+
+  for (i = 0; i < count; ++i)
+    acc[i] += weight * work[i];
+}
+
+/* scale rows start to end-1 horizontally */
+static void
+scale_x_band_double(void *p, i_img_dim start, i_img_dim end) {
+  scale_axis_state *state = p;
+  i_img *src = state->src;
+  int channels = src->channels;
+  i_img_dim out_width = state->dest->xsize;
+  i_fsample_t *samps =
+    im_work_malloc(sizeof(i_fsample_t) * im_max(src->xsize, out_width) * channels);
+  double *work = im_work_malloc(sizeof(double) * src->xsize * channels);
+  double *acc = im_work_malloc(sizeof(double) * out_width * channels);
+  i_img_dim y;
+
+  for (y = start; y < end; ++y) {
+    scale_load_row_double(src, y, samps, work, state->has_alpha);
+    scale_row_double(acc, work, state->tab, channels);
+    scale_finish_row_double(samps, acc, out_width, channels,
+                                state->has_alpha, SCALE_WEIGHT_BITS);
+    i_psampf(state->dest, 0, out_width, y, samps, NULL, channels);
+  }
+
+  im_work_free(samps);
+  im_work_free(work);
+  im_work_free(acc);
+}
+
+/*
+  produce output rows start to end-1 by scaling vertically
+
+  The source rows needed by successive output rows overlap, so the
+  last tab->taps rows read are kept in a ring buffer.
+*/
+static void
+scale_y_band_double(void *p, i_img_dim start, i_img_dim end) {
+  scale_axis_state *state = p;
+  i_img *src = state->src;
+  const scale_table *tab = state->tab;
+  size_t row_samples = (size_t)src->xsize * src->channels;
+  i_fsample_t *samps = im_work_malloc(sizeof(i_fsample_t) * row_samples);
+  double *rows = im_work_malloc(sizeof(double) * row_samples * tab->taps);
+  i_img_dim *row_y = im_work_malloc(sizeof(i_img_dim) * tab->taps);
+  double *acc = im_work_malloc(sizeof(double) * row_samples);
+  i_img_dim y;
+  int t;
+
+  for (t = 0; t < tab->taps; ++t)
+    row_y[t] = -1;
+
+  for (y = start; y < end; ++y) {
+#ifdef IM_EIGHT_BIT
+    int const *w = tab->iweights + (size_t)y * tab->taps;
+#else
+    double const *w = tab->weights + (size_t)y * tab->taps;
+#endif
+    size_t i;
+
+    for (i = 0; i < row_samples; ++i)
+      acc[i] = 0;
+    for (t = 0; t < tab->count[y]; ++t) {
+      i_img_dim sy = tab->start[y] + t;
+      int slot = sy % tab->taps;
+      double *row = rows + row_samples * slot;
+      if (row_y[slot] != sy) {
+        scale_load_row_double(src, sy, samps, row, state->has_alpha);
+        row_y[slot] = sy;
+      }
+      scale_accum_row_double(acc, row, row_samples, w[t]);
+    }
+    scale_finish_row_double(samps, acc, src->xsize, src->channels,
+                                state->has_alpha, SCALE_WEIGHT_BITS);
+    i_psampf(state->dest, 0, src->xsize, y, samps, NULL, src->channels);
+  }
+
+  im_work_free(samps);
+  im_work_free(rows);
+  im_work_free(row_y);
+  im_work_free(acc);
+}
+
+/*
+  Limit horizontally scaled samples to the range of the image, as the
+  intermediate image did when scaling one axis at a time, so the
+  overshoot from the negative lobes of the filter isn't amplified by
+  the vertical pass.
+
+  8-bit samples are also reduced from the fixed point weight scale to
+  extra_bits fraction bits.
+*/
+static void
+scale_limit_row_double(double *row, i_img_dim width, int channels,
+                           int has_alpha, int extra_bits) {
+#ifdef IM_EIGHT_BIT
+  int max = has_alpha ? 255 * 255 : 255 << extra_bits;
+#else
+  double max = 1.0;
+#endif
+  size_t count = (size_t)width * channels;
+  size_t i;
+
+#ifdef IM_EIGHT_BIT
+  for (i = 0; i < count; ++i)
+    row[i] = scale_descale(row[i], SCALE_WEIGHT_BITS - extra_bits);
+#else
+  (void)extra_bits;
+#endif
+
+  if (has_alpha) {
+    int color_chans = channels - 1;
+    i_img_dim x;
+    for (x = 0; x < width; ++x) {
+      double alpha = row[color_chans];
+      int ch;
+      if (alpha <= 0) {
+        for (ch = 0; ch < channels; ++ch)
+          row[ch] = 0;
+      }
+      else {
+        /* limit the unpremultiplied color, and keep it when alpha is
+           limited */
+        for (ch = 0; ch < color_chans; ++ch) {
+          double v = row[ch];
+          v = v < 0 ? 0 : v > alpha ? alpha : v;
+          if (alpha > max)
+            v = (double)((double)v * max / alpha);
+          row[ch] = v;
+        }
+        if (alpha > max)
+          row[color_chans] = max;
+      }
+      row += channels;
+    }
+  }
+  else {
+    for (i = 0; i < count; ++i)
+      row[i] = row[i] < 0 ? 0 : row[i] > max ? max : row[i];
+  }
+}
+
+/*
+  produce output rows start to end-1, scaling both axes
+
+  Source rows are scaled horizontally as they're needed, and the last
+  ytab->taps of those are kept in a ring buffer for the vertical pass.
+*/
+static void
+scale_2d_band_double(void *p, i_img_dim start, i_img_dim end) {
+  scale_2d_state *state = p;
+  i_img *src = state->src;
+  const scale_table *ytab = state->ytab;
+  int channels = src->channels;
+  i_img_dim out_width = state->dest->xsize;
+  size_t row_samples = (size_t)src->xsize * channels;
+  size_t out_samples = (size_t)out_width * channels;
+  i_fsample_t *samps =
+    im_work_malloc(sizeof(i_fsample_t) * im_max(row_samples, out_samples));
+  double *work = im_work_malloc(sizeof(double) * row_samples);
+  double *rows = im_work_malloc(sizeof(double) * out_samples * ytab->taps);
+  i_img_dim *row_y = im_work_malloc(sizeof(i_img_dim) * ytab->taps);
+  double *acc = im_work_malloc(sizeof(double) * out_samples);
+  int extra_bits = state->has_alpha ? 0 : SCALE_EXTRA_BITS;
+  i_img_dim y;
+  int t;
+
+#ifndef IM_EIGHT_BIT
+  (void)extra_bits;
+#endif
+
+  for (t = 0; t < ytab->taps; ++t)
+    row_y[t] = -1;
+
+  for (y = start; y < end; ++y) {
+#ifdef IM_EIGHT_BIT
+    int const *w = ytab->iweights + (size_t)y * ytab->taps;
+#else
+    double const *w = ytab->weights + (size_t)y * ytab->taps;
+#endif
+    size_t i;
+
+    for (i = 0; i < out_samples; ++i)
+      acc[i] = 0;
+    for (t = 0; t < ytab->count[y]; ++t) {
+      i_img_dim sy = ytab->start[y] + t;
+      int slot = sy % ytab->taps;
+      double *row = rows + out_samples * slot;
+      if (row_y[slot] != sy) {
+        scale_load_row_double(src, sy, samps, work, state->has_alpha);
+        scale_row_double(row, work, state->xtab, channels);
+        scale_limit_row_double(row, out_width, channels,
+                                   state->has_alpha, extra_bits);
+        row_y[slot] = sy;
+      }
+      scale_accum_row_double(acc, row, out_samples, w[t]);
+    }
+    scale_finish_row_double(samps, acc, out_width, channels,
+                                state->has_alpha,
+                                SCALE_WEIGHT_BITS + extra_bits);
+    i_psampf(state->dest, 0, out_width, y, samps, NULL, channels);
+  }
+
+  im_work_free(samps);
+  im_work_free(work);
+  im_work_free(rows);
+  im_work_free(row_y);
+  im_work_free(acc);
+}
+
+#line 995 "scale.im"
+
+/* find a kernel by name, NULL for the default */
+static const scale_kernel *
+scale_find_kernel(const char *kernel) {
+  size_t i;
+
+  if (!kernel)
+    return scale_kernels;
+
+  for (i = 0; i < sizeof(scale_kernels) / sizeof(*scale_kernels); ++i) {
+    if (strcmp(kernel, scale_kernels[i].name) == 0)
+      return scale_kernels + i;
+  }
+
+  i_push_errorf(0, "unknown scaling kernel '%s'", kernel);
+  return NULL;
+}
+
+/* size of an axis after scaling, adjusting value if the result would
+   be less than 1 pixel */
+static i_img_dim
+scale_axis_size(i_img_dim in_size, double *value) {
+  i_img_dim out_size = (i_img_dim)(0.5 + in_size * *value);
+
+  if (out_size < 1) {
+    out_size = 1;
+    *value = 1.0 / in_size;
+  }
+
+  return out_size;
+}
+
+static i_img *
+scale_new_image(i_img *im, i_img_dim xsize, i_img_dim ysize) {
+  i_img *new_img;
+
+  if (im->bits <= 8)
+    new_img = i_img_8_new(xsize, ysize, im->channels);
+  else
+    new_img = i_sametype_chans(im, xsize, ysize, im->channels);
+  if (!new_img)
+    i_push_error(0, "cannot create output image");
+
+  return new_img;
+}
+
+/*
+=item i_scaleaxis_kernel(im, value, axis, kernel)
+
+Returns a new image which is I<im> scaled by I<value> along either
+the x-axis (I<axis> == 0) or the y-axis (I<axis> == 1), resampling
+with the named kernel, one of C<lanczos2>, C<lanczos3>, C<mitchell> or
+C<catrom>.  If I<kernel> is C<NULL> or C<default> the filter used by
+earlier versions of Imager is used.
+
+The weights for each output position are calculated once for the
+axis.  8-bit images are accumulated in fixed point, other images keep
+their sample size and are accumulated as doubles.
+
+=cut
+*/
+
+i_img *
+i_scaleaxis_kernel(i_img *im, double Value, int Axis, const char *kernel) {
+  i_img_dim hsize, vsize, in_size, out_size;
+  const scale_kernel *kern;
+  scale_table tab;
+  scale_axis_state state;
+  im_work_band_f f;
+  i_img *new_img;
+
+  i_clear_error();
+  mm_log((1,"i_scaleaxis_kernel(im %p,Value %.2f,Axis %d, kernel %s)\n",
+          im, Value, Axis, kernel ? kernel : "(null)"));
+
+  kern = scale_find_kernel(kernel);
+  if (!kern)
+    return NULL;
+
+  if (Axis == XAXIS) {
+    in_size = im->xsize;
+    out_size = hsize = scale_axis_size(im->xsize, &Value);
+    vsize = im->ysize;
+  } else {
+    in_size = im->ysize;
+    hsize = im->xsize;
+    out_size = vsize = scale_axis_size(im->ysize, &Value);
+  }
+
+  new_img = scale_new_image(im, hsize, vsize);
+  if (!new_img)
+    return NULL;
+
+  if (!scale_table_init(&tab, kern, in_size, out_size, Value)) {
+    i_img_destroy(new_img);
+    return NULL;
+  }
+
+  state.src = im;
+  state.dest = new_img;
+  state.tab = &tab;
+  state.has_alpha = i_img_has_alpha(im);
+  if (Axis == XAXIS)
+    f = im->bits <= 8 ? scale_x_band_8 : scale_x_band_double;
+  else
+    f = im->bits <= 8 ? scale_y_band_8 : scale_y_band_double;
+  if (i_img_work_safe(im))
+    im_work_bands(im->context, vsize, 4, f, &state);
+  else
+    f(&state, 0, vsize);
+
+  scale_table_free(&tab);
+
+  mm_log((1,"(%p) <- i_scaleaxis_kernel\n", new_img));
+
+  return new_img;
+}
+
+/*
+=item i_scale_kernel(im, x_scale, y_scale, kernel)
+
+Returns a new image which is I<im> scaled by I<x_scale> horizontally
+and I<y_scale> vertically, using the same filters and producing the
+same size image as calling i_scaleaxis_kernel() for each axis.
+
+Both axes are scaled in a single pass, keeping a ring buffer of
+horizontally scaled rows instead of a full size intermediate image,
+so the working memory is proportional to the output width times the
+number of filter taps.  Since there's no intermediate image the
+horizontal results aren't rounded to the sample size before the
+vertical pass.
+
+=cut
+*/
+
+i_img *
+i_scale_kernel(i_img *im, double x_scale, double y_scale, const char *kernel) {
+  i_img_dim hsize, vsize;
+  const scale_kernel *kern;
+  scale_table xtab, ytab;
+  scale_2d_state state;
+  im_work_band_f f;
+  i_img *new_img;
+
+  i_clear_error();
+  mm_log((1,"i_scale_kernel(im %p, x_scale %.2f, y_scale %.2f, kernel %s)\n",
+          im, x_scale, y_scale, kernel ? kernel : "(null)"));
+
+  kern = scale_find_kernel(kernel);
+  if (!kern)
+    return NULL;
+
+  hsize = scale_axis_size(im->xsize, &x_scale);
+  vsize = scale_axis_size(im->ysize, &y_scale);
+
+  new_img = scale_new_image(im, hsize, vsize);
+  if (!new_img)
+    return NULL;
+
+  if (!scale_table_init(&xtab, kern, im->xsize, hsize, x_scale)) {
+    i_img_destroy(new_img);
+    return NULL;
+  }
+  if (!scale_table_init(&ytab, kern, im->ysize, vsize, y_scale)) {
+    scale_table_free(&xtab);
+    i_img_destroy(new_img);
+    return NULL;
+  }
+  if ((size_t)ytab.taps > im_size_t_max / sizeof(double) / hsize / im->channels) {
+    i_push_error(0, "integer overflow calculating row buffer size");
+    scale_table_free(&xtab);
+    scale_table_free(&ytab);
+    i_img_destroy(new_img);
+    return NULL;
+  }
+
+  state.src = im;
+  state.dest = new_img;
+  state.xtab = &xtab;
+  state.ytab = &ytab;
+  state.has_alpha = i_img_has_alpha(im);
+  f = im->bits <= 8 ? scale_2d_band_8 : scale_2d_band_double;
+  if (i_img_work_safe(im))
+    im_work_bands(im->context, vsize, 4, f, &state);
+  else
+    f(&state, 0, vsize);
+
+  scale_table_free(&xtab);
+  scale_table_free(&ytab);
+
+  mm_log((1,"(%p) <- i_scale_kernel\n", new_img));
+
+  return new_img;
+}
@@ -4,7 +4,8 @@ use strict;
 use Test::More;
 BEGIN { use_ok("Imager", ':handy'); }
 
-use Imager::Test qw(image_bounds_checks test_image is_color3 isnt_image is_color4 is_fcolor3);
+use Imager::Test qw(image_bounds_checks test_image is_color3 isnt_image is_color4 is_fcolor3
+                    is_image);
 
 Imager->open_log(log => "testout/t023palette.log");
 
@@ -356,6 +357,44 @@ cmp_ok(Imager->errstr, '=~', qr/Channels must be positive and <= 4/,
   isnt_image($palim, $blank, "make sure paletted isn't all black");
 }
 
+for my $translate (qw(ordered bluenoise)) {
+  # ordered dithers
+  my $gray = Imager->new(xsize => 32, ysize => 32);
+  $gray->box(filled => 1, color => "#808080");
+  my $palim = $gray->to_paletted(make_colors => "mono",
+                                 translate => $translate);
+  ok($palim, "$translate: mid gray to mono");
+  my $white = 0;
+  for my $y (0 .. 31) {
+    $white += grep $_, $palim->getscanline(y => $y, type => "index");
+  }
+  ok($white > 400 && $white < 624, "$translate: about half white")
+    or diag "$white white pixels";
+  my $again = $gray->to_paletted(make_colors => "mono",
+                                 translate => $translate);
+  is_image($again, $palim, "$translate: same result each time");
+
+  my $black = Imager->new(xsize => 32, ysize => 32);
+  my $black_pal = $black->to_paletted(make_colors => "mono",
+                                      translate => $translate);
+  my @black_idx = $black_pal->getscanline(y => 5, type => "index");
+  ok(!grep($_, @black_idx), "$translate: black stays black");
+
+  # a gray palette uses the gray level
+  my $red = Imager->new(xsize => 32, ysize => 32);
+  $red->box(filled => 1, color => "#FF0000");
+  my $red_pal = $red->to_paletted(make_colors => "mono",
+                                  translate => $translate);
+  ok($red_pal, "$translate: red to mono");
+  my $red_white = 0;
+  for my $y (0 .. 31) {
+    $red_white += grep $_, $red_pal->getscanline(y => $y, type => "index");
+  }
+  ok($red_white > 100 && $red_white < 500,
+     "$translate: red dithered as gray")
+    or diag "$red_white white pixels";
+}
+
 { # check validation of palette entries
   my $im = Imager->new(xsize => 10, ysize => 10, type => 'paletted');
   $im->addcolors(colors => [ $black, $red ]);
@@ -659,6 +698,52 @@ my $psamp_outside_error = "Image position outside of image";
   is($col[0]->alpha, 255, "should have a 255 alpha");
 }
 
+{
+  # a full palette of closely clustered colours, each pixel is exactly
+  # one of them, so closest must find it, whether or not it's been
+  # seen before
+  my @colors = map Imager::Color->new(100 + ($_ >> 4), 60 + ($_ & 15),
+                                      80 + ($_ % 7)), 0 .. 255;
+  my $im = Imager->new(xsize => 256, ysize => 4);
+  my @expect;
+  for my $y (0 .. 3) {
+    my @row = map { ($_ * 37 + $y * 11) % 256 } 0 .. 255;
+    $im->setscanline(y => $y, pixels => [ @colors[@row] ]);
+    push @expect, @row;
+  }
+  my $palim = $im->to_paletted(make_colors => "none", colors => \@colors,
+                               translate => "closest");
+  ok($palim, "translate to clustered palette");
+  my @got = map $palim->getscanline(y => $_, type => "index"), 0 .. 3;
+  is_deeply(\@got, \@expect, "each pixel found its own colour");
+}
+
+{
+  # findcolor with a full palette, including duplicates, which must
+  # find the first matching entry
+  my $im = Imager->new(xsize => 20, ysize => 2, type => "paletted");
+  my @colors = map Imager::Color->new($_, 255 - $_, $_ % 3), 0 .. 249;
+  is($im->addcolors(colors => \@colors), "0 but true", "add 250 colors");
+  is($im->addcolors(colors => [ @colors[10, 20] ]), 250, "add duplicates");
+  is($im->findcolor(color => $colors[10]), 10, "find first of duplicates");
+  is($im->findcolor(color => $colors[249]), 249, "find last unique");
+  my @found = map $im->findcolor(color => $_), @colors;
+  is_deeply(\@found, [ 0 .. 249 ], "find each color");
+  ok(!defined $im->findcolor(color => [ 1, 1, 1 ]),
+     "color not in the palette");
+  is($im->addcolors(colors => [ [ 1, 1, 1 ] ]), 252, "add it");
+  is($im->findcolor(color => [ 1, 1, 1 ]), 252, "now found");
+  ok($im->setcolors(start => 10, colors => [ [ 2, 2, 2 ] ]),
+     "replace the first of a duplicate");
+  is($im->findcolor(color => $colors[10]), 250, "now find the duplicate");
+  is($im->findcolor(color => [ 2, 2, 2 ]), 10, "and the new color");
+  ok($im->setscanline(y => 1, x => 0, pixels => [ @colors[100 .. 119] ]),
+     "write colors in the palette");
+  is($im->type, "paletted", "still paletted");
+  is_deeply([ $im->getscanline(y => 1, type => "index") ], [ 100 .. 119 ],
+            "check indexes written");
+}
+
 Imager->close_log;
 
 done_testing();
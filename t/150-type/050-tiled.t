@@ -0,0 +1,126 @@
+#!perl -w
+use strict;
+use Test::More tests => 121;
+use Imager;
+use Imager::Test qw(test_image is_image image_bounds_checks mask_tests);
+
+-d "testout" or mkdir "testout";
+
+Imager->open_log(log => "testout/t050tiled.log");
+
+{
+  my $im = Imager->new(xsize => 100, ysize => 80, layout => "tiled");
+  ok($im, "make a tiled image");
+  is($im->layout, "tiled", "check layout");
+  is($im->bits, 8, "tiled images are 8-bit");
+  is($im->type, "direct", "and direct color");
+  ok($im->virtual, "and virtual, since idata isn't rows");
+  is(Imager->new(xsize => 10, ysize => 10)->layout, "rows",
+     "normal images have the rows layout");
+}
+
+{ # creation failures
+  ok(!Imager->new(xsize => 10, ysize => 10, layout => "tiled", bits => 16),
+     "16-bit tiled images aren't available");
+  is(Imager->errstr, "new: the tiled layout is only available for 8-bit direct color images",
+     "check message");
+  ok(!Imager->new(xsize => 10, ysize => 10, layout => "tiled", type => "paletted"),
+     "paletted tiled images aren't available");
+  ok(!Imager->new(xsize => 10, ysize => 10, layout => "spiral"),
+     "unknown layout");
+  is(Imager->errstr, "new: unknown value for layout 'spiral'", "check message");
+  ok(!Imager->new(xsize => 10, ysize => 10, layout => "tiled", channels => 5),
+     "too many channels");
+  is(Imager->errstr, "channels must be between 1 and 4", "check message");
+}
+
+{
+  my $im = Imager->new(xsize => 10, ysize => 10, layout => "tiled");
+  mask_tests($im, 0.005);
+}
+
+{
+  my $im = Imager->new(xsize => 10, ysize => 10, layout => "tiled");
+  image_bounds_checks($im);
+}
+
+# sizes that aren't a multiple of the tile size, with rows crossing
+# tile boundaries
+for my $channels (1 .. 4) {
+  my $base = test_image()->crop(width => 139, height => 77);
+  $channels < 3 and $base = $base->convert(preset => "gray");
+  $channels % 2 == 0 and $base = $base->convert(preset => "addalpha");
+  my $im = Imager->new(xsize => 139, ysize => 77, channels => $channels,
+		       layout => "tiled");
+  ok($im->paste(src => $base), "$channels channels: paste into tiled image");
+  is_image($im, $base, "$channels channels: matches");
+  is_image($im->copy, $base, "$channels channels: copy matches");
+  is($im->copy->layout, "tiled", "$channels channels: copy is tiled");
+  is_image($im->crop(left => 60, top => 30, width => 10, height => 40),
+	   $base->crop(left => 60, top => 30, width => 10, height => 40),
+	   "$channels channels: crop across tiles matches");
+  my @chans = reverse 0 .. $channels-1;
+  my @samples = $im->getsamples(y => 5, x => 50, width => 40, type => "float",
+				channels => \@chans);
+  is_deeply(\@samples,
+	    [ $base->getsamples(y => 5, x => 50, width => 40, type => "float",
+				channels => \@chans) ],
+	    "$channels channels: float samples match");
+  for my $degrees (90, 180, 270) {
+    my $rot = $im->rotate(right => $degrees);
+    is($rot->layout, "tiled", "$channels channels: rotate $degrees is tiled");
+    is_image($rot, $base->rotate(right => $degrees),
+	     "$channels channels: rotate $degrees matches");
+  }
+  for my $dir (qw(h v vh)) {
+    my $flip = $im->copy;
+    $flip->flip(dir => $dir);
+    my $expect = $base->copy;
+    $expect->flip(dir => $dir);
+    is_image($flip, $expect, "$channels channels: flip $dir matches");
+  }
+}
+
+{ # flip with a channel masked goes through the normal code
+  no if $] >= 5.014, warnings => 'Imager::channelmask';
+  my $base = test_image();
+  my $im = Imager->new(xsize => 150, ysize => 150, layout => "tiled");
+  $im->paste(src => $base);
+  $im->setmask(mask => 0x5);
+  $base = $base->copy;
+  $base->setmask(mask => 0x5);
+  $im->flip(dir => "vh");
+  $base->flip(dir => "vh");
+  $im->setmask(mask => ~0);
+  $base->setmask(mask => ~0);
+  is_image($im, $base, "masked flip matches");
+}
+
+{ # operations that write rows from worker threads
+  Imager->set_threads(4);
+  my $base = test_image();
+  my $im = Imager->new(xsize => 150, ysize => 150, layout => "tiled");
+  $im->paste(src => $base);
+  ok($im->filter(type => "gaussian", stddev => 2), "blur tiled image");
+  ok($base->filter(type => "gaussian", stddev => 2), "blur normal image");
+  is_image($im, $base, "results match");
+  Imager->set_threads(1);
+}
+
+{ # file writers that look at idata shouldn't for tiled images
+  my $base = test_image();
+  my $im = Imager->new(xsize => 150, ysize => 150, layout => "tiled");
+  $im->paste(src => $base);
+  for my $type (qw(pnm raw)) {
+    my ($data, $expect);
+    ok($im->write(data => \$data, type => $type), "write tiled as $type");
+    $base->write(data => \$expect, type => $type);
+    ok($data eq $expect, "$type data matches");
+  }
+}
+
+Imager->close_log;
+
+unless ($ENV{IMAGER_KEEP_FILES}) {
+  unlink "testout/t050tiled.log";
+}
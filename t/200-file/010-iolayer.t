@@ -973,6 +973,80 @@ SKIP:
   }
 }
 
+SKIP:
+{ # memory mapped files
+  $Config{d_mmap} || $^O eq "MSWin32"
+    or skip "no mmap() on this platform", 20;
+  my $data = join "", map chr(($_ * 7) % 256), 0 .. 19999;
+  my $file = "testout/t07mmap.dat";
+  {
+    open my $fh, ">", $file
+      or skip "Cannot create $file: $!", 20;
+    binmode $fh;
+    print $fh $data;
+    close $fh;
+  }
+
+  open my $fh, "<", $file
+    or skip "Cannot open $file: $!", 20;
+  binmode $fh;
+  sysseek $fh, 5, SEEK_SET;
+  my $io = Imager::io_new_mmap(fileno($fh));
+  ok($io, "map a file");
+  close $fh;
+  is($io->read2(10), substr($data, 5, 10),
+     "read starts from the descriptor position");
+  is($io->peekn(20000), substr($data, 15, 8192),
+     "peekn() is limited to the buffer size");
+  is($io->getc, ord substr($data, 15, 1), "getc");
+  is($io->seek(0, SEEK_CUR), 16, "seek reports the logical position");
+  is($io->seek(0, SEEK_SET), 0, "seek to start");
+  is($io->read2(20000), $data, "read the whole file in one go");
+  my $buf;
+  is($io->read($buf, 10), 0, "then we're at eof");
+  is($io->seek(-4, SEEK_END), 19996, "seek from the end");
+  is($io->read2(4), substr($data, -4), "read the tail");
+  is($io->write("x"), -1, "mapped files are read only");
+  is($io->seek(1, SEEK_END), -1, "can't seek past the end");
+  undef $io;
+
+  open $fh, "<", $file
+    or skip "Cannot open $file: $!", 8;
+  binmode $fh;
+  $io = Imager::IO->new_mmap(fileno($fh));
+  ok($io, "map with the Imager::IO constructor");
+  is($io->read2(3), substr($data, 0, 3), "and read from it");
+  undef $io;
+  close $fh;
+
+  {
+    my $empty = "testout/t07mmapempty.dat";
+    open my $efh, ">", $empty
+      or skip "Cannot create $empty: $!", 3;
+    close $efh;
+    open $efh, "<", $empty
+      or skip "Cannot open $empty: $!", 3;
+    my $eio = Imager::io_new_mmap(fileno($efh));
+    ok($eio, "map an empty file");
+    is($eio->read($buf, 10), 0, "eof straight away");
+    is($eio->getc, -1, "getc at eof");
+    undef $eio;
+    close $efh;
+    unlink $empty;
+  }
+
+ SKIP:
+  {
+    pipe my $rfh, my $wfh
+      or skip "no pipe: $!", 2;
+    ok(!Imager::io_new_mmap(fileno($rfh)), "can't map a pipe");
+    is(Imager->_error_as_msg, "only regular files can be mapped",
+       "check message");
+  }
+
+  unlink $file;
+}
+
 Imager->close_log;
 
 unless ($ENV{IMAGER_KEEP_FILES}) {
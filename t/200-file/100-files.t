@@ -6,6 +6,7 @@
 use strict;
 use Test::More;
 use Imager;
+use Imager::Test qw(is_color3);
 
 -d "testout" or mkdir "testout";
 
@@ -168,6 +169,25 @@ is(Imager->errstr, "check_file_limits: width must be a positive integer",
      "check message");
 }
 
+{ # write_stream() parameter checks
+  my $data;
+  ok(!Imager->write_stream(data => \$data, type => "pnm", xsize => 10,
+			   ysize => 10),
+     "fail to stream to a format without stream support");
+  is(Imager->errstr, "format 'pnm' doesn't support write_stream()",
+     "check message");
+  ok(!Imager->write_stream(data => \$data, type => "pnm", xsize => 0,
+			   ysize => 10),
+     "fail to stream a zero width image");
+  is(Imager->errstr, "write_stream: xsize must be a positive integer",
+     "check message");
+  ok(!Imager->write_stream(data => \$data, type => "pnm", xsize => 10,
+			   ysize => 10, channels => 5),
+     "fail to stream with too many channels");
+  is(Imager->errstr, "write_stream: channels must be from 1 to 4",
+     "check message");
+}
+
 # check file type probe
 probe_ok("49492A41", undef, "not quite tiff");
 probe_ok("4D4D0041", undef, "not quite tiff");
@@ -409,6 +429,123 @@ AVIS
      "test adding a file type works");
 }
 
+{
+  # region for formats that don't handle it themselves
+  my $im = Imager->new(xsize => 20, ysize => 10);
+  $im->box(filled => 1, color => "#FF0000", box => [ 5, 2, 8, 5 ]);
+  $im->settag(name => "i_xres", value => 72);
+  for my $type (qw(pnm bmp tga)) {
+    my $data;
+    ok($im->write(data => \$data, type => $type), "$type: write")
+      or next;
+    my $work = Imager->new;
+    ok($work->read(data => $data, type => $type, region => [ 5, 2, 9, 7 ]),
+       "$type: read a region")
+      or diag($work->errstr);
+    is($work->getwidth, 4, "$type: check width");
+    is($work->getheight, 5, "$type: check height");
+    is($work->tags(name => "i_format"), $type, "$type: tags kept");
+    is_color3($work->getpixel(x => 0, y => 0), 255, 0, 0,
+	      "$type: check top left");
+    is_color3($work->getpixel(x => 3, y => 3), 255, 0, 0,
+	      "$type: check bottom right of box");
+    is_color3($work->getpixel(x => 3, y => 4), 0, 0, 0,
+	      "$type: check below box");
+  }
+  my $data;
+  $im->write(data => \$data, type => "pnm");
+  {
+    my $work = Imager->new;
+    ok($work->read(data => $data, region => [ -5, 8, 100, 20 ]),
+       "read region overlapping the image");
+    is($work->getwidth, 20, "check width");
+    is($work->getheight, 2, "check height");
+  }
+  {
+    my $work = Imager->new;
+    ok(!$work->read(data => $data, region => [ 20, 0, 30, 10 ]),
+       "fail to read region outside the image");
+    is($work->errstr, "region is outside the image", "check message");
+  }
+  for my $bad ([ 1, 2, 3 ], "1,2,3,4", [ 0, 0, "a", 1 ], [ 0, 0, 1, undef ]) {
+    my $work = Imager->new;
+    ok(!$work->read(data => $data, region => $bad), "fail bad region");
+    like($work->errstr, qr/region must be an array reference/, "check message");
+  }
+  for my $bad ([ 5, 0, 5, 10 ], [ 0, 5, 10, 4 ]) {
+    my $work = Imager->new;
+    ok(!$work->read(data => $data, region => $bad), "fail empty region");
+    like($work->errstr, qr/region must have right > left/, "check message");
+  }
+}
+
+{
+  # reading through a mapping of the file
+  my $im = Imager::Test::test_image();
+  my $file = "testout/t1000mmap.ppm";
+  ok($im->write(file => $file), "write a file to map");
+  for my $type (undef, "pnm") {
+    my $note = $type ? "with type" : "probed";
+    my $work = Imager->new;
+    ok($work->read(file => $file, mmap => 1, $type ? (type => $type) : ()),
+       "read with mmap => 1 ($note)")
+      or diag $work->errstr;
+    is(Imager::i_img_diff($im->{IMG}, $work->{IMG}), 0,
+       "same as the original ($note)");
+  }
+  my @images = Imager->read_multi(file => $file, mmap => 1);
+  is(@images, 1, "read_multi with mmap => 1");
+  unlink $file;
+}
+
+{
+  # readers borrow rows from the I/O layer buffer when they can, make
+  # sure they get the same results from each kind of layer, with rows
+  # smaller and larger than the buffer
+  for my $width (50, 3000) {
+    my $im = Imager::Test::test_image()->scale(xpixels => $width, ypixels => 7,
+                                               type => "nonprop");
+    my $pal = $im->to_paletted(make_colors => "mono");
+    for my $test ([ pnm => $im ], [ pnm => $pal, pnm_write_wide_data => 1 ],
+                  [ bmp => $im ], [ bmp => $pal ], [ tga => $im ],
+                  [ raw => $im, raw_datachannels => 3, raw_storechannels => 3,
+                    xsize => $width, ysize => 7, raw_interleave => 0 ]) {
+      my ($type, $src, @opts) = @$test;
+      my $data;
+      ok($src->write(data => \$data, type => $type), "write $type $width")
+        or diag $src->errstr;
+      my $file = "testout/t1000borrow.$type";
+      ok($src->write(file => $file, type => $type), "write $type $width to file");
+      my $expect = Imager->new;
+      ok($expect->read(data => $data, type => $type, @opts),
+         "read $type $width from data")
+        or diag $expect->errstr;
+      my $chain = Imager::IO->new_bufchain;
+      $chain->raw_write($data);
+      $chain->raw_seek(0, 0);
+      my $pos = 0;
+      for my $input ([ file => { file => $file } ],
+                     [ mmap => { file => $file, mmap => 1 } ],
+                     [ bufchain => { io => $chain } ],
+                     [ callback => { callback => sub {
+                                       my $size = $_[0] < 1000 ? $_[0] : 1000;
+                                       my $part = substr($data, $pos, $size);
+                                       $pos += length $part;
+                                       $part;
+                                     },
+                                     seekcb => sub { $pos = $_[0] } } ]) {
+        my ($name, $in) = @$input;
+        my $work = Imager->new;
+        ok($work->read(%$in, type => $type, @opts), "read $type $width ($name)")
+          or diag $work->errstr;
+        is(Imager::i_img_diff($expect->{IMG}, $work->{IMG}), 0,
+           "same as from data ($type $width $name)");
+      }
+      unlink $file;
+    }
+  }
+}
+
 Imager->close_log;
 
 done_testing();
@@ -1,6 +1,6 @@
 #!perl -w
 use strict;
-use Test::More tests => 56;
+use Test::More tests => 67;
 use Imager qw(:all);
 use Imager::Test qw/is_color3 is_color4 test_image test_image_mono is_image/;
 
@@ -313,6 +313,34 @@ SKIP:
   is_image($im, $im2, "check they match");
 }
 
+{ # lazy reads
+  for my $test ([ "t103_base.raw", 3, 0 ], [ "t103_3to4.raw", 4, 0 ],
+		[ "t103_line_int.raw", 3, 1 ]) {
+    my ($file, $datachannels, $interleave) = @$test;
+    my $im = Imager->new(file => "testout/$file", type => "raw",
+			 xsize => 4, ysize => 4, lazy => 1, lazy_cache => 3,
+			 raw_datachannels => $datachannels,
+			 raw_storechannels => 3,
+			 raw_interleave => $interleave);
+    ok($im, "lazy read $file")
+      or diag(Imager->errstr);
+    is(i_img_diff($im->{IMG}, $baseimg), 0, "lazy $file matches");
+  }
+  my $lazy = Imager->new(file => "testout/t103_base.raw", type => "raw",
+			 xsize => 4, ysize => 4, lazy => 1,
+			 raw_datachannels => 3, raw_storechannels => 4,
+			 raw_interleave => 0);
+  ok($lazy, "lazy read expanding to 4 channels");
+  is($lazy->getchannels, 4, "got 4 channels");
+  ok($lazy->virtual, "lazy image is virtual");
+  ok(!Imager->new(file => "testout/t103_base.raw", type => "raw",
+		  xsize => 4, ysize => 5, lazy => 1,
+		  raw_datachannels => 3, raw_storechannels => 3,
+		  raw_interleave => 0),
+     "lazy read of a short file fails");
+  like(Imager->errstr, qr/premature end of file/, "check message");
+}
+
 Imager->close_log;
 
 unless ($ENV{IMAGER_KEEP_FILES}) {
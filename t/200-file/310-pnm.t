@@ -1,6 +1,6 @@
 #!perl -w
 use Imager ':all';
-use Test::More tests => 205;
+use Test::More tests => 229;
 use strict;
 use Imager::Test qw(test_image_raw test_image_16 is_color3 is_color1 is_image test_image_named);
 
@@ -468,6 +468,22 @@ print "# check error handling\n";
   is( $imgs[2]->getheight, 2, " ... width=2" );
 }
 
+{
+  # pnm has no streaming reader, read_multi_iter() falls back to read_multi()
+  my $iter = Imager->read_multi_iter(file => 'testimg/multiple.ppm');
+  ok($iter, "make an iterator");
+  my @types;
+  while (my $im = $iter->next) {
+    push @types, $im->tags(name => 'pnm_type');
+  }
+  ok(!Imager->errstr, "no error at the end");
+  is_deeply(\@types, [ 1, 6, 5 ], "got the images in order");
+  ok(!$iter->next, "still at the end");
+  ok(!Imager->read_multi_iter(file => 'testimg/nosuchfile.ppm'),
+     "fail to make an iterator for a missing file");
+  ok(Imager->errstr, "with an error message");
+}
+
 {
   my $im = Imager->new;
   ok($im->read(file => 'testimg/bad_asc.ppm', type => 'pnm',
@@ -629,6 +645,65 @@ print "# check error handling\n";
   }
 }
 
+{ # lazy reads
+  my $im = test_image_raw();
+  my $base = Imager->new;
+  $base->{IMG} = $im;
+  ok($base->write(file => "testout/t104_lazy.ppm"), "write an image to read lazily");
+  push @files, "t104_lazy.ppm";
+  my $lazy = Imager->new(file => "testout/t104_lazy.ppm", lazy => 1,
+			 lazy_cache => 20);
+  ok($lazy, "lazy read")
+    or diag(Imager->errstr);
+  ok($lazy->virtual, "lazy image is virtual");
+  is_image($lazy, $base, "lazy image matches");
+  is_image($lazy->crop(left => 10, top => 100, width => 50, height => 40),
+	   $base->crop(left => 10, top => 100, width => 50, height => 40),
+	   "crop of lazy image matches");
+  is_image($lazy->scale(scalefactor => 0.5), $base->scale(scalefactor => 0.5),
+	   "scale of lazy image matches");
+  ok(!$lazy->setscanline(y => 0, pixels => [ NC(255, 0, 0) ]),
+     "can't write to a lazy image");
+  is(Imager->_error_as_msg, "lazy images are read only", "check message");
+
+  open my $fh, "<", "testout/t104_lazy.ppm"
+    or die "Cannot open testout/t104_lazy.ppm: $!";
+  binmode $fh;
+  my $lazy_fh = Imager->new(fh => $fh, lazy => 1, lazy_cache => 1);
+  ok($lazy_fh && $lazy_fh->virtual, "lazy read from a regular file handle");
+  undef $fh;
+  is_image($lazy_fh, $base, "matches, even with the handle dropped");
+
+  # the image keeps the source alive, not the Imager object
+  my $masked = Imager->new(file => "testout/t104_lazy.ppm", lazy => 1,
+			   lazy_cache => 1)->masked(left => 10, top => 10);
+  is_image($masked, $base->crop(left => 10, top => 10),
+	   "read through a masked child of a dropped lazy image");
+
+  # descriptors belong to the caller, so the image reads a duplicate
+  open my $fdfh, "<", "testout/t104_lazy.ppm"
+    or die "Cannot open testout/t104_lazy.ppm: $!";
+  binmode $fdfh;
+  my $lazy_fd = Imager->new(io => Imager::io_new_fd(fileno($fdfh)), lazy => 1,
+			    lazy_cache => 1)->masked;
+  close $fdfh;
+  is_image($lazy_fd, $base, "matches with the descriptor closed");
+
+  my $maxval = Imager->new(file => "testimg/maxval.ppm", lazy => 1);
+  ok($maxval && $maxval->virtual, "lazy read of a maxval 63 image");
+  is_image($maxval, Imager->new(file => "testimg/maxval.ppm"),
+	   "scaled samples match");
+
+  my $p3 = Imager->new(file => "testimg/maxval_asc.ppm", lazy => 1);
+  ok($p3 && !$p3->virtual, "text images are read normally");
+  my $b16 = Imager->new(file => "testimg/maxval_65536.ppm", lazy => 1);
+  ok(!$b16 || !$b16->virtual, "16-bit images aren't read lazily");
+  my $short = Imager->new(file => "testimg/short_bin.ppm", lazy => 1,
+			  allow_incomplete => 1);
+  ok($short && !$short->virtual, "truncated images are read normally");
+  is($short->tags(name => "i_incomplete"), 1, "and marked incomplete");
+}
+
 Imager->close_log;
 
 unless ($ENV{IMAGER_KEEP_FILES}) {
@@ -1,7 +1,7 @@
 #!perl -w
 
 use strict;
-use Test::More tests => 28;
+use Test::More tests => 42;
 
 use Imager qw/NC/;
 use Imager::Test qw(is_image is_color3);
@@ -263,6 +263,63 @@ my $black = Imager::Color->new(0, 0, 0);
        "check error message");
 }
 
+{ # self-intersecting polygons follow the fill mode
+  my @star = map [ 50 + 45 * cos($_ * 4 * PI / 5),
+		   50 + 45 * sin($_ * 4 * PI / 5) ], 0 .. 4;
+  my $eo = Imager->new(xsize => 100, ysize => 100);
+  ok($eo->polygon(points => \@star, color => $white), "draw even/odd star");
+  is_color3($eo->getpixel(x => 50, y => 50), 0, 0, 0,
+	    "even/odd: center is unfilled");
+  is_color3($eo->getpixel(x => 80, y => 50), 255, 255, 255,
+	    "even/odd: point is filled");
+  my $nz = Imager->new(xsize => 100, ysize => 100);
+  ok($nz->polygon(points => \@star, color => $white, mode => "nonzero"),
+     "draw non-zero star");
+  is_color3($nz->getpixel(x => 50, y => 50), 255, 255, 255,
+	    "non-zero: center is filled");
+  is_color3($nz->getpixel(x => 80, y => 50), 255, 255, 255,
+	    "non-zero: point is filled");
+}
+
+{ # partial coverage is the covered area
+  my $im = Imager->new(xsize => 6, ysize => 2);
+  ok($im->polygon(points => [ [ 1.3, 0 ], [ 4.7, 0 ], [ 4.7, 2 ], [ 1.3, 2 ] ],
+		  color => $white), "draw with fractional vertical edges");
+  is_deeply([ $im->getsamples(y => 0, channels => [ 0 ]) ],
+	    [ 0, 179, 255, 255, 179, 0 ], "70% coverage at both edges");
+}
+
+{ # polygons extending past the edges of the image
+  my $im = Imager->new(xsize => 20, ysize => 20);
+  ok($im->polygon(points => [ [ -1000, -50 ], [ 10, -50 ],
+			      [ 10, 1e6 ], [ -1000, 1e6 ] ],
+		  color => $white), "draw off the left, top and bottom");
+  my $cmp = Imager->new(xsize => 20, ysize => 20);
+  $cmp->box(filled => 1, color => $white, box => [ 0, 0, 9, 19 ]);
+  is_image($im, $cmp, "covers the left half");
+  my $im2 = Imager->new(xsize => 20, ysize => 20);
+  ok($im2->polygon(points => [ [ 10, 5 ], [ 1e6, 5 ], [ 1e6, 15 ], [ 10, 15 ] ],
+		   fill => { solid => $white }), "draw off the right");
+  my $cmp2 = Imager->new(xsize => 20, ysize => 20);
+  $cmp2->box(filled => 1, color => $white, box => [ 10, 5, 19, 14 ]);
+  is_image($im2, $cmp2, "covers to the right edge");
+}
+
+{ # small polygons on a wide image only change the pixels they cover
+  my $im = Imager->new(xsize => 5000, ysize => 10);
+  $im->box(filled => 1, color => "#808080");
+  ok($im->polypolygon(points => [ [ [ 10, 14, 14, 10 ], [ 2, 2, 6, 6 ] ],
+				  [ [ 4000, 4003, 4003 ], [ 1, 1, 9 ] ] ],
+		      color => $white, filled => 1),
+     "draw small polygons far apart");
+  my $cmp = Imager->new(xsize => 5000, ysize => 10);
+  $cmp->box(filled => 1, color => "#808080");
+  $cmp->box(filled => 1, color => $white, box => [ 10, 2, 13, 5 ]);
+  $cmp->polygon(points => [ [ 4000, 1 ], [ 4003, 1 ], [ 4003, 9 ] ],
+		color => $white);
+  is_image($im, $cmp, "only the polygons changed");
+}
+
 Imager->close_log;
 
 Imager::malloc_state();
@@ -1,6 +1,6 @@
 #!perl -w
 use strict;
-use Test::More tests => 165;
+use Test::More tests => 174;
 
 use Imager ':handy';
 use Imager::Fill;
@@ -696,6 +696,65 @@ SKIP:
   is_image($im, $cmp, "check test image");
 }
 
+{ # fountain fills sample the segments into a ramp when they can
+  require Imager::Fountain;
+  my $fount = Imager::Fountain->simple(positions => [ 0, 0.25, 1 ],
+				       colors => [ "#000000", "#FF8000", "#FFFFFF" ]);
+  my $fill = Imager::Fill->new
+    (
+     fountain => "linear",
+     segments => $fount,
+     xa => 0, ya => 0,
+     xb => 100, yb => 0,
+    );
+  ok($fill, "make linear fountain fill");
+  my $im = Imager->new(xsize => 101, ysize => 1, bits => "double");
+  ok($im->box(fill => $fill), "fill with it");
+  my @bad;
+  for my $x (0 .. 100) {
+    my $v = $x / 100;
+    my @expect = $v < 0.25
+      ? map $_ * $v / 0.25, 1, 128/255, 0
+      : map { $_ + (1 - $_) * ($v - 0.25) / 0.75 } 1, 128/255, 0;
+    my @got = ($im->getpixel(x => $x, y => 0, type => "float")->rgba)[0 .. 2];
+    grep(abs($got[$_] - $expect[$_]) > 0.0005, 0 .. 2)
+      and push @bad, "$x: (@got) vs (@expect)";
+  }
+  is_deeply(\@bad, [], "check ramp colors");
+
+  # gaps between segments aren't filled
+  my $gap = Imager::Fountain->new;
+  $gap->add(start => 0, middle => 0.2, end => 0.4,
+	    c0 => "#FF0000", c1 => "#FF0000");
+  $gap->add(start => 0.6, middle => 0.8, end => 1.0,
+	    c0 => "#0000FF", c1 => "#0000FF");
+  my $gim = Imager->new(xsize => 101, ysize => 1);
+  $gim->box(filled => 1, color => "#00FF00");
+  ok($gim->filter(type => "fountain", segments => $gap,
+		  xa => 0, ya => 0, xb => 100, yb => 0),
+     "fountain filter with a gap between segments");
+  is_color3($gim->getpixel(x => 20, y => 0), 255, 0, 0, "first segment");
+  is_color3($gim->getpixel(x => 50, y => 0), 0, 255, 0, "gap left alone");
+  is_color3($gim->getpixel(x => 80, y => 0), 0, 0, 255, "second segment");
+
+  # circle super-sampling of a flat fill is still that color
+  my $flat = Imager::Fountain->simple(positions => [ 0, 1 ],
+				      colors => [ "#204060", "#204060" ]);
+  my $cfill = Imager::Fill->new
+    (
+     fountain => "radial",
+     segments => $flat,
+     xa => 10, ya => 10,
+     xb => 20, yb => 10,
+     super_sample => "circle",
+     ssample_param => 8,
+    );
+  my $cim = Imager->new(xsize => 20, ysize => 20);
+  ok($cim->box(fill => $cfill), "fill with circle super-sampling");
+  is_color3($cim->getpixel(x => 5, y => 15), 0x20, 0x40, 0x60,
+	    "check super-sampled color");
+}
+
 sub color_close {
   my ($c1, $c2) = @_;
 
@@ -1,6 +1,6 @@
 #!perl -w
 use strict;
-use Test::More tests => 232;
+use Test::More tests => 264;
 
 BEGIN { use_ok(Imager=>':all') }
 use Imager::Test qw(is_image is_color4 is_image_similar);
@@ -217,6 +217,53 @@ SKIP:
 	    "check we set alpha=0 pixels to zero on scaling");
 }
 
+{ # resampling kernels
+  my $flat = Imager->new(xsize => 60, ysize => 40);
+  $flat->box(filled => 1, color => [ 100, 150, 200 ]);
+  for my $kernel (qw(default lanczos2 lanczos3 mitchell catrom)) {
+    for my $factor (0.3, 1.7) {
+      my $sc = $flat->scale(scalefactor => $factor, kernel => $kernel);
+      ok($sc, "scale flat $kernel $factor")
+	or diag $flat->errstr;
+      my $cmp = Imager->new(xsize => $sc->getwidth, ysize => $sc->getheight);
+      $cmp->box(filled => 1, color => [ 100, 150, 200 ]);
+      is_image($sc, $cmp, "flat image stays flat ($kernel $factor)");
+    }
+  }
+
+  my $sc = $flat->scale(scalefactor => 0.5, kernel => "unknown");
+  ok(!$sc, "unknown kernel fails");
+  is($flat->errstr, "unable to scale image: unknown scaling kernel 'unknown'",
+     "check message");
+  ok(!$flat->scaleX(kernel => "unknown"), "unknown kernel fails (scaleX)");
+  ok(!$flat->scaleY(kernel => "unknown"), "unknown kernel fails (scaleY)");
+}
+
+{ # single pass scaling should match scaling each axis in turn
+  my $base = Imager->new(file => "testimg/penguin-base.ppm");
+  for my $kernel (qw(default lanczos3)) {
+    for my $factor (0.3, 1.3) {
+      my $one = $base->scale(scalefactor => $factor, kernel => $kernel);
+      my $two = $base->scaleX(scalefactor => $factor, kernel => $kernel)
+	->scaleY(scalefactor => $factor, kernel => $kernel);
+      is_image_similar($one, $two, $one->getwidth * $one->getheight * 3 / 10,
+		       "single pass close to two passes ($kernel $factor)");
+    }
+  }
+}
+
+{ # normal scaling keeps the sample size
+  my $base = Imager->new(file => "testimg/penguin-base.ppm");
+  my $small = $base->scale(scalefactor => 0.4, kernel => "lanczos3");
+  for my $im ($base->to_rgb16, $base->to_rgb_double) {
+    my $bits = $im->bits;
+    my $sc = $im->scale(scalefactor => 0.4, kernel => "lanczos3");
+    is($sc->bits, $bits, "$bits bit image stays $bits bits");
+    is_image_similar($sc, $small, $sc->getwidth * $sc->getheight * 3,
+		     "$bits bit result close to 8-bit result");
+  }
+}
+
 { # scale_calculate
   my $im = Imager->new(xsize => 100, ysize => 120);
   is_deeply([ $im->scale_calculate(scalefactor => 0.5) ],
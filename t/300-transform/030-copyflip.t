@@ -1,6 +1,6 @@
 #!perl -w
 use strict;
-use Test::More tests => 95;
+use Test::More tests => 111;
 use Imager;
 use Imager::Test qw(is_color3 is_image is_imaged test_image_double test_image isnt_image is_image_similar);
 
@@ -277,6 +277,41 @@ sub rot_test {
   # $diff->write(file => "testout/t64rotdiff.png");
 }
 
+{ # rotate right is done a block at a time, check against a pixel at
+  # a time rotation with sizes that aren't a multiple of the block
+  my $base = test_image()->crop(width => 70, height => 45);
+  my @images =
+    (
+     [ "gray", $base->convert(preset => "gray") ],
+     [ "graya", $base->convert(preset => "gray")->convert(preset => "addalpha") ],
+     [ "rgb", $base ],
+     [ "rgba", $base->convert(preset => "addalpha") ],
+     [ "16-bit", $base->to_rgb16 ],
+     [ "double", $base->to_rgb_double ],
+     [ "paletted", $base->to_paletted ],
+     [ "masked", $base->masked(left => 1, top => 2, right => 67, bottom => 44) ],
+    );
+  for my $entry (@images) {
+    my ($name, $im) = @$entry;
+    my ($w, $h) = ($im->getwidth, $im->getheight);
+    for my $degrees (90, 270) {
+      my $expect = Imager->new(xsize => $h, ysize => $w,
+			       channels => $im->getchannels,
+			       bits => $im->bits);
+      for my $y (0 .. $h-1) {
+	for my $x (0 .. $w-1) {
+	  my $c = $im->getpixel(x => $x, y => $y, type => "float");
+	  $degrees == 90
+	    ? $expect->setpixel(x => $h-1-$y, y => $x, color => $c)
+	    : $expect->setpixel(x => $y, y => $w-1-$x, color => $c);
+	}
+      }
+      my $rot = $im->rotate(right => $degrees);
+      is_imaged($rot, $expect, 0, "$name: rotate right $degrees");
+    }
+  }
+}
+
 {
   my $empty = Imager->new;
   ok(!$empty->rotate(degrees => 90), "can't rotate an empty image");
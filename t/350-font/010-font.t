@@ -1,7 +1,8 @@
 #!perl -w
 use strict;
 use Imager;
-use Test::More tests => 14;
+use Test::More tests => 20;
+use Imager::Test qw(is_image);
 
 unshift @INC, "t";
 
@@ -57,3 +58,24 @@ use Imager::Font::Test;
   is($empty->errstr, "align_string: empty input image",
      "check error message");
 }
+
+{ # draw_many() for drivers without _draw_many()
+  my $font = Imager::Font::Test->new(size => 10, color => "#FFFFFF");
+  my @strings = ( [ 5, 15, "ab" ], [ 20, 40, "cde", "#00FF00" ] );
+  my $im = Imager->new(xsize => 50, ysize => 50);
+  ok($font->draw_many(image => $im, strings => \@strings),
+     "draw_many with a driver that draws each string");
+  my $cmp = Imager->new(xsize => 50, ysize => 50);
+  $cmp->string(font => $font, x => 5, y => 15, text => "ab");
+  $cmp->string(font => $font, x => 20, y => 40, text => "cde",
+	       color => "#00FF00");
+  is($im->getcolorcount, 3, "both strings drawn");
+  is_image($im, $cmp, "same as drawing with string()");
+
+  ok(!$font->draw_many(image => $im, strings => [ [ 0, 0, "x", "#XYZ" ] ]),
+     "bad color");
+  is($im->errstr, "draw_many: strings[0] has no valid color",
+     "check message");
+  ok(!$font->draw_many(image => Imager->new, strings => [ ]),
+     "can't draw on an empty image");
+}
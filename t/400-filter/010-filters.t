@@ -1,7 +1,7 @@
 #!perl -w
 use strict;
 use Imager qw(:handy);
-use Test::More tests => 137;
+use Test::More tests => 156;
 
 -d "testout" or mkdir "testout";
 
@@ -57,6 +57,18 @@ test($imbase, {type=>'conv', coef=>[ 0.3, 1, 0.3, ], },
   is_image_similar($work8, $work16, 80000, "8 and 16 bit conv match");
 }
 
+{
+  # compare against a simple per-pixel implementation, including an
+  # even length kernel and edge clamping
+  my $src = $imbase->crop(left => 20, top => 30, width => 17, height => 13);
+  for my $coef ([ 0.3, 1, 0.3 ], [ 1, 2 ], [ -0.5, 1, 2, 3, -0.5 ]) {
+    my $work = $src->copy;
+    ok($work->filter(type => "conv", coef => $coef),
+       "conv with @$coef");
+    is_image($work, _conv_ref($src, $coef), "check against reference");
+  }
+}
+
 {
   my $gauss = test($imbase, {type=>'gaussian', stddev=>5 },
 		   'testout/t61_gaussian.ppm');
@@ -95,6 +107,38 @@ test($imbase, {type=>'conv', coef=>[ 0.3, 1, 0.3, ], },
   is_image_similar($gauss, $gauss16, 250000, "8 and 16 gaussian match");
 }
 
+{
+  # the box method approximates the exact method
+  for my $im ($imbase, $imbase->to_rgb16) {
+    my $bits = $im->bits;
+    my $exact = $im->copy;
+    ok($exact->filter(type => "gaussian", stddev => 3), "exact $bits");
+    my $box = $im->copy;
+    ok($box->filter(type => "gaussian", stddev => 3, method => "box"),
+       "box $bits")
+      or diag $box->errstr;
+    # the 8-bit exact filter stops at 2 stddev, so it's further off
+    is_image_similar($box, $exact, $bits == 8 ? 200000 : 25000,
+                     "box and exact similar ($bits)");
+  }
+
+  my $exact = $imbase->copy;
+  ok($exact->filter(type => "gaussian2", stddevX => 0, stddevY => 4),
+     "exact Y only");
+  my $box = $imbase->copy;
+  ok($box->filter(type => "gaussian2", stddevX => 0, stddevY => 4,
+                  method => "box"), "box Y only");
+  is_image_similar($box, $exact, 200000, "box and exact similar Y only");
+
+  my $work = $imbase->copy;
+  ok(!$work->filter(type => "gaussian", stddev => 3, method => "fast"),
+     "unknown method");
+  is($work->errstr, "gaussian: unknown method 'fast'", "check message");
+  ok(!$work->filter(type => "gaussian2", stddevX => -1, stddevY => 1,
+                    method => "box"), "negative stddev fails");
+  is($work->errstr, "stddevX must be positive", "check message");
+}
+
 
 test($imbase, { type=>'gradgen', dist=>1,
                    xo=>[ 10,  10, 120 ],
@@ -512,3 +556,39 @@ sub color_close {
   }
   return 1;
 }
+
+# the original per-pixel i_conv() algorithm, for 8-bit images
+sub _conv_ref {
+  my ($src, $coef) = @_;
+
+  my $center = int((@$coef - 1) / 2);
+  my $pc = 0;
+  $pc += $_ for @$coef;
+  my ($w, $h, $chans) = ($src->getwidth, $src->getheight, $src->getchannels);
+  my @rows = map [ $src->getsamples(y => $_) ], 0 .. $h-1;
+  my $pass = sub {
+    my ($in, $pos) = @_;
+    my @out;
+    for my $y (0 .. $h-1) {
+      for my $x (0 .. $w-1) {
+        for my $ch (0 .. $chans-1) {
+          my $res = 0;
+          for my $c (0 .. $#$coef) {
+            my ($xi, $yi) = $pos->($x, $y, $c - $center);
+            $res += $in->[$yi][$xi * $chans + $ch] * $coef->[$c];
+          }
+          my $temp = $res / $pc;
+          $out[$y][$x * $chans + $ch] = $temp < 0 ? 0 : $temp > 255 ? 255 : int($temp);
+        }
+      }
+    }
+    \@out;
+  };
+  my $clamp = sub { $_[0] < 0 ? 0 : $_[0] >= $_[1] ? $_[1]-1 : $_[0] };
+  my $horiz = $pass->(\@rows, sub { ($clamp->($_[0] + $_[2], $w), $_[1]) });
+  my $vert = $pass->($horiz, sub { ($_[0], $clamp->($_[1] + $_[2], $h)) });
+  my $out = Imager->new(xsize => $w, ysize => $h, channels => $chans);
+  $out->setsamples(y => $_, data => $vert->[$_]) for 0 .. $h-1;
+
+  $out;
+}
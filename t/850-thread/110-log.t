@@ -34,7 +34,7 @@ use Imager;
 Imager->open_log(log => "testout/t080log1.log")
   or plan skip_all => "Cannot open log file: " . Imager->errstr;
 
-plan tests => 3;
+plan tests => 7;
 
 Imager->log("main thread a\n");
 
@@ -82,6 +82,54 @@ is_deeply(\%log1, { map {; $_ => 1 } @log1 },
 is_deeply(\%log2, { map {; $_ => 1 } @log2 },
 	  "check messages in child thread log");
 
+{
+  # cloned contexts share the log file, each message is written with
+  # a single write, so lines from different threads don't interleave
+  Imager->open_log(log => "testout/t080log3.log")
+    or die "Cannot open third log file: ", Imager->errstr;
+  my $long = "x" x 2000;
+  my @threads = map {
+    my $id = $_;
+    threads->create
+      (
+       sub {
+         for my $i (1 .. 200) {
+           Imager->log("thread $id message $i\n");
+           Imager->log("thread $id long $i $long\n") if $i % 50 == 0;
+         }
+         1;
+       }
+      );
+  } 1 .. 4;
+  my $joined = grep $_->join, @threads;
+  is($joined, 4, "all logging threads joined");
+  Imager->close_log();
+
+  open my $fh, "<", "testout/t080log3.log"
+    or die "Cannot open testout/t080log3.log: $!";
+  my %seen;
+  my $bad = 0;
+  while (<$fh>) {
+    chomp;
+    if (m(^\[\d+/\d+/\d+ \d+:\d+:\d+\] +\S+:\d+ +\d+: (.*)$)) {
+      ++$seen{$1};
+    }
+    else {
+      ++$bad;
+    }
+  }
+  is($bad, 0, "no mangled lines");
+  my @expected = map {
+    my $id = $_;
+    ((map "thread $id message $_", 1 .. 200),
+     (map "thread $id long $_ $long", 50, 100, 150, 200));
+  } 1 .. 4;
+  my @missing = grep !$seen{$_}, @expected;
+  is(scalar(@missing), 0, "all messages logged")
+    or diag "missing: @missing[0 .. ($#missing > 4 ? 4 : $#missing)]";
+  ok(!grep($_ != 1, values %seen), "and only once");
+}
+
 # grab the messages from the given log
 sub parse_log {
   my ($filename) = @_;
@@ -103,6 +151,7 @@ sub parse_log {
 }
 
 END {
-  unlink "testout/t080log1.log", "testout/t080log2.log"
+  unlink "testout/t080log1.log", "testout/t080log2.log",
+    "testout/t080log3.log"
     unless $ENV{IMAGER_KEEP_FILES};
 }
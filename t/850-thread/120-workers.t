@@ -0,0 +1,135 @@
+#!perl
+use strict;
+use Imager;
+use Imager::Test qw(test_image test_image_16 test_image_double is_image
+                    is_imaged);
+use Config;
+use Test::More tests => 60;
+
+-d "testout" or mkdir "testout";
+
+Imager->open_log(log => "testout/t850workers.log");
+
+# set_threads() and get_threads() work whether or not Imager was
+# built with worker threads, without them the work is just done in
+# the calling thread.
+
+is(Imager->get_threads, 1, "default to no worker threads");
+ok(!Imager->set_threads(0), "can't set 0 threads");
+is(Imager->errstr, "threads must be from 1 to 256", "check message");
+ok(!Imager->set_threads(257), "can't set too many threads");
+is(Imager->get_threads, 1, "failures left it unchanged");
+ok(Imager->set_threads(4), "set 4 threads");
+is(Imager->get_threads, 4, "and we have 4");
+ok(Imager->set_threads(1), "back to 1");
+
+my @images =
+  (
+   [ "8-bit", test_image() ],
+   [ "16-bit", test_image_16() ],
+   [ "double", test_image_double() ],
+  );
+push @images, [ "alpha", $images[0][1]->convert(preset => "addalpha") ];
+
+my @ops =
+  (
+   [ conv => sub { $_[0]->filter(type => "conv", coef => [ 1, 2, 3, 2, 1 ]) } ],
+   [ gaussian => sub { $_[0]->filter(type => "gaussian", stddev => 2.5) } ],
+   [ gaussian2 => sub { $_[0]->filter(type => "gaussian2", stddevX => 0, stddevY => 3) } ],
+   [ "gaussian box" => sub { $_[0]->filter(type => "gaussian", stddev => 5, method => "box") } ],
+   [ scale => sub { $_[0]->scale(xpixels => 71, ypixels => 113, type => "nonprop", qtype => "mixing") } ],
+   [ "scale normal" => sub { $_[0]->scale(scalefactor => 0.6, kernel => "lanczos3") } ],
+   [ rotate => sub { $_[0]->rotate(degrees => 31, back => "#0000FF") } ],
+   [ transform2 => sub { Imager::transform2({ rpnexpr => "y x 2 / getp1" }, $_[0]) } ],
+   [ mediancut => sub { $_[0]->to_paletted(make_colors => "mediancut") } ],
+   [ ordered => sub { $_[0]->to_paletted(make_colors => "webmap", translate => "ordered") } ],
+   [ bluenoise => sub { $_[0]->to_paletted(make_colors => "mediancut", translate => "bluenoise") } ],
+  );
+
+# results with worker threads should match those without exactly
+for my $entry (@images) {
+  my ($name, $im) = @$entry;
+  for my $op_entry (@ops) {
+    my ($op_name, $op) = @$op_entry;
+    $op_name eq "transform2" && $im->bits ne 8
+      and next; # transform2() always produces 8-bit images
+    my @result;
+    for my $threads (1, 4) {
+      Imager->set_threads($threads);
+      my $work = $im->copy;
+      my $result = $op->($work);
+      ref $result or $result = $work;
+      push @result, $result;
+    }
+    if ($im->bits eq "double") {
+      is_imaged($result[0], $result[1], 0, "$name $op_name: 4 threads matches 1");
+    }
+    else {
+      is_image($result[0], $result[1], "$name $op_name: 4 threads matches 1");
+    }
+  }
+}
+
+{
+  # a small image is done in the calling thread
+  Imager->set_threads(4);
+  my $im = Imager->new(xsize => 3, ysize => 2);
+  ok($im->filter(type => "conv", coef => [ 1, 2, 1 ]), "conv on a tiny image");
+  Imager->set_threads(1);
+}
+
+{
+  # images that aren't safe to use from worker threads are filtered
+  # in the calling thread, for conv() that's in place
+  my %makers =
+    (
+     paletted => sub { test_image()->to_paletted(make_colors => "mono") },
+     masked => sub {
+       my $base = test_image();
+       return ($base->masked(left => 10, top => 10), $base);
+     },
+    );
+  for my $name (sort keys %makers) {
+    Imager->set_threads(1);
+    my ($expect, $expect_base) = $makers{$name}->();
+    ok($expect->filter(type => "conv", coef => [ 1, 2, 3, 2, 1 ]),
+       "$name: conv with 1 thread");
+    for my $threads (2, 8) {
+      Imager->set_threads($threads);
+      my ($work, $work_base) = $makers{$name}->();
+      $work->filter(type => "conv", coef => [ 1, 2, 3, 2, 1 ]);
+      is_image($work, $expect, "$name: $threads threads matches 1");
+    }
+  }
+  Imager->set_threads(1);
+}
+
+SKIP:
+{
+  # the worker threads don't exist in a forked child, make sure it
+  # starts its own
+  $Config{d_fork}
+    or skip "no fork", 3;
+  Imager->set_threads(3);
+  my $im = test_image();
+  my $expect = $im->copy;
+  ok($expect->filter(type => "gaussian", stddev => 2), "blur in parent");
+  my $pid = fork;
+  defined $pid
+    or skip "fork failed: $!", 2;
+  unless ($pid) {
+    my $work = $im->copy;
+    $work->filter(type => "gaussian", stddev => 2)
+      or exit 1;
+    exit(Imager::i_img_diff($work->{IMG}, $expect->{IMG}) ? 1 : 0);
+  }
+  is(waitpid($pid, 0), $pid, "child exited");
+  is($?, 0, "child got the same result");
+  Imager->set_threads(1);
+}
+
+Imager->close_log;
+
+unless ($ENV{IMAGER_KEEP_FILES}) {
+  unlink "testout/t850workers.log";
+}
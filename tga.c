@@ -164,7 +164,7 @@ each of blue, green, red, and attribute.
 
 static
 void
-color_unpack(unsigned char *buf, int bytepp, i_color *val) {
+color_unpack(const unsigned char *buf, int bytepp, i_color *val) {
   switch (bytepp) {
   case 1:
     val->gray.gray_color = buf[0];
@@ -420,25 +420,28 @@ tga_header_pack(tga_header *header, unsigned char headbuf[18]) {
 /*
 =item tga_source_read(s, buf, pixels)
 
-Reads pixel number of pixels from source s into buffer buf.  Takes
-care of decompressing the stream if needed.
+Reads pixel number of pixels from source s, decompressing the stream
+if needed.  Returns a pointer to the pixels, which is into the stream
+buffer for uncompressed data when possible, or buf otherwise.
+Returns NULL on failure.
 
     s - data source 
-    buf - destination buffer
-    pixels - number of pixels to put into buffer
+    buf - buffer for the pixels
+    pixels - number of pixels to read
 
 =cut
 */
 
 static
-int
+const unsigned char *
 tga_source_read(tga_source *s, unsigned char *buf, size_t pixels) {
   size_t cp = 0;
   size_t j, k;
   if (!s->compressed) {
-    if ((size_t)i_io_read(s->ig, buf, pixels*s->bytepp)
-        != pixels*s->bytepp) return 0;
-    return 1;
+    const unsigned char *data;
+    if ((size_t)i_io_read_ptr(s->ig, &data, buf, pixels*s->bytepp)
+        != pixels*s->bytepp) return NULL;
+    return data;
   }
   
   while(cp < pixels) {
@@ -446,7 +449,7 @@ tga_source_read(tga_source *s, unsigned char *buf, size_t pixels) {
     if (s->len == 0) s->state = NoInit;
     switch (s->state) {
     case NoInit:
-      if (i_io_read(s->ig, &s->hdr, 1) != 1) return 0;
+      if (i_io_read(s->ig, &s->hdr, 1) != 1) return NULL;
 
       s->len = (s->hdr &~(1<<7))+1;
       s->state = (s->hdr & (1<<7)) ? Rle : Raw;
@@ -458,7 +461,7 @@ tga_source_read(tga_source *s, unsigned char *buf, size_t pixels) {
       }
       if (s->state == Rle
           && (size_t)i_io_read(s->ig, s->cval, s->bytepp) != s->bytepp) {
-        return 0;
+        return NULL;
       }
 
       break;
@@ -473,14 +476,14 @@ tga_source_read(tga_source *s, unsigned char *buf, size_t pixels) {
       ml = i_min(s->len, pixels-cp);
       if ((size_t)i_io_read(s->ig, buf+cp*s->bytepp, ml*s->bytepp)
           != ml*s->bytepp) {
-        return 0;
+        return NULL;
       }
       cp     += ml;
       s->len -= ml;
       break;
     }
   }
-  return 1;
+  return buf;
 }
 
 
@@ -800,17 +803,22 @@ i_readtga_wiol(io_glue *ig, int length) {
   if (!mapped) linebuf = mymalloc(width*sizeof(i_color));
   
   for(y=0; y<height; y++) {
-    if (!tga_source_read(&src, databuf, width)) {
+    const unsigned char *data = tga_source_read(&src, databuf, width);
+    if (!data) {
       i_push_error(errno, "read for targa data failed");
       if (linebuf) myfree(linebuf);
       myfree(databuf);
       if (img) i_img_destroy(img);
       return NULL;
     }
-    if (mapped && header.colourmaporigin) for(x=0; x<width; x++) databuf[x] -= header.colourmaporigin;
-    if (mapped) i_ppal(img, 0, width, header.imagedescriptor & (1<<5) ? y : height-1-y, databuf);
+    if (mapped && header.colourmaporigin) {
+      /* data may be in the stream buffer, so adjust a copy */
+      for(x=0; x<width; x++) databuf[x] = data[x] - header.colourmaporigin;
+      data = databuf;
+    }
+    if (mapped) i_ppal(img, 0, width, header.imagedescriptor & (1<<5) ? y : height-1-y, data);
     else {
-      for(x=0; x<width; x++) color_unpack(databuf+x*src.bytepp, src.bytepp, linebuf+x);
+      for(x=0; x<width; x++) color_unpack(data+x*src.bytepp, src.bytepp, linebuf+x);
       i_plin(img, 0, width, header.imagedescriptor & (1<<5) ? y : height-1-y, linebuf);
     }
   }
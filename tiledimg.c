@@ -0,0 +1,530 @@
+/*
+=head1 NAME
+
+tiledimg.c - implements 8-bit images stored as square tiles
+
+=head1 SYNOPSIS
+
+  i_img *im = i_img_tiled_new(xsize, ysize, channels);
+
+=head1 DESCRIPTION
+
+A tiled image is an 8-bit direct color image with its samples stored
+as IM_TILE_SIZE x IM_TILE_SIZE tiles rather than as whole rows, each
+tile is contiguous in memory, and the tiles are stored a row of tiles
+at a time.  The right and bottom tiles are padded out to a full tile.
+
+This keeps pixels that are close vertically close in memory, which
+helps operations that work down columns, like rotating and flipping,
+on wide images.  Row access through the normal image functions works
+across tiles a tile-width segment at a time.
+
+Since the layout isn't what code accessing idata directly expects,
+tiled images are marked virtual.  They can still be written from
+several worker threads, see i_img_work_safe().
+
+=over
+
+=cut
+*/
+
+#define IMAGER_NO_CONTEXT
+
+#include "imager.h"
+#include "imageri.h"
+
+static int ppix_tiled(i_img *im, i_img_dim x, i_img_dim y, const i_color *val);
+static int gpix_tiled(i_img *im, i_img_dim x, i_img_dim y, i_color *val);
+static i_img_dim glin_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_color *vals);
+static i_img_dim plin_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_color *vals);
+static int ppixf_tiled(i_img *im, i_img_dim x, i_img_dim y, const i_fcolor *val);
+static int gpixf_tiled(i_img *im, i_img_dim x, i_img_dim y, i_fcolor *val);
+static i_img_dim glinf_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_fcolor *vals);
+static i_img_dim plinf_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_fcolor *vals);
+static i_img_dim gsamp_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_sample_t *samps, const int *chans, int chan_count);
+static i_img_dim gsampf_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_fsample_t *samps, const int *chans, int chan_count);
+static i_img_dim psamp_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_sample_t *samps, const int *chans, int chan_count);
+static i_img_dim psampf_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_fsample_t *samps, const int *chans, int chan_count);
+
+/*
+=item IIM_base_tiled
+
+The basic data we copy into a tiled image.
+
+=cut
+*/
+
+static i_img IIM_base_tiled =
+{
+  0, /* channels set */
+  0, 0, 0, /* xsize, ysize, bytes */
+  ~0U, /* ch_mask */
+  i_8_bits, /* bits */
+  i_direct_type, /* type */
+  1, /* virtual */
+  NULL, /* idata */
+  { 0, 0, NULL }, /* tags */
+  NULL, /* ext_data */
+
+  ppix_tiled, /* i_f_ppix */
+  ppixf_tiled, /* i_f_ppixf */
+  plin_tiled, /* i_f_plin */
+  plinf_tiled, /* i_f_plinf */
+  gpix_tiled, /* i_f_gpix */
+  gpixf_tiled, /* i_f_gpixf */
+  glin_tiled, /* i_f_glin */
+  glinf_tiled, /* i_f_glinf */
+  gsamp_tiled, /* i_f_gsamp */
+  gsampf_tiled, /* i_f_gsampf */
+
+  NULL, /* i_f_gpal */
+  NULL, /* i_f_ppal */
+  NULL, /* i_f_addcolors */
+  NULL, /* i_f_getcolors */
+  NULL, /* i_f_colorcount */
+  NULL, /* i_f_maxcolors */
+  NULL, /* i_f_findcolor */
+  NULL, /* i_f_setcolors */
+
+  NULL, /* i_f_destroy */
+
+  i_gsamp_bits_fb,
+  NULL, /* i_f_psamp_bits */
+
+  psamp_tiled,
+  psampf_tiled,
+
+  NULL,
+  NULL
+};
+
+/*
+=item im_img_tiled_new(ctx, x, y, ch)
+X<im_img_tiled_new API>X<i_img_tiled_new API>
+=synopsis i_img *img = im_img_tiled_new(aIMCTX, width, height, channels);
+=synopsis i_img *img = i_img_tiled_new(width, height, channels);
+
+Creates a new 8-bit direct color image I<x> pixels wide and I<y>
+pixels high with I<ch> channels, stored as tiles.
+
+=cut
+*/
+
+i_img *
+im_img_tiled_new(pIMCTX, i_img_dim x, i_img_dim y, int ch) {
+  i_img *im;
+  size_t tiles_across, tiles_down, tile_bytes, bytes;
+
+  im_log((aIMCTX, 1,"im_img_tiled_new(x %" i_DF ", y %" i_DF ", ch %d)\n",
+	  i_DFc(x), i_DFc(y), ch));
+
+  if (x < 1 || y < 1) {
+    im_push_error(aIMCTX, 0, "Image sizes must be positive");
+    return NULL;
+  }
+  if (ch < 1 || ch > MAXCHANNELS) {
+    im_push_errorf(aIMCTX, 0, "channels must be between 1 and %d", MAXCHANNELS);
+    return NULL;
+  }
+
+  /* the tiles are padded out to a full tile */
+  tiles_across = ((size_t)x + IM_TILE_MASK) >> IM_TILE_SHIFT;
+  tiles_down = ((size_t)y + IM_TILE_MASK) >> IM_TILE_SHIFT;
+  tile_bytes = (size_t)IM_TILE_SIZE * IM_TILE_SIZE * ch;
+  if (tiles_down > im_size_t_max / tile_bytes / tiles_across) {
+    im_push_error(aIMCTX, 0, "integer overflow calculating image allocation");
+    return NULL;
+  }
+  bytes = tiles_across * tiles_down * tile_bytes;
+
+  im = im_img_alloc(aIMCTX);
+  memcpy(im, &IIM_base_tiled, sizeof(i_img));
+  i_tags_new(&im->tags);
+  im->xsize = x;
+  im->ysize = y;
+  im->channels = ch;
+  im->bytes = bytes;
+  im->idata = mymalloc(bytes);
+  memset(im->idata, 0, bytes);
+
+  im_img_init(aIMCTX, im);
+
+  im_log((aIMCTX, 1,"(%p) <- im_img_tiled_new\n",im));
+
+  return im;
+}
+
+/*
+=item i_img_is_tiled(im)
+
+Returns true if I<im> is a tiled image, so its idata can be accessed
+with i_tiled_offset().
+
+=cut
+*/
+
+int
+i_img_is_tiled(const i_img *im) {
+  return im->i_f_gsamp == gsamp_tiled;
+}
+
+/* find the part of row y from l to r within the tile containing l,
+   returning the number of pixels and setting *data to the first
+   sample */
+static i_img_dim
+tile_segment(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y,
+	     unsigned char **data) {
+  i_img_dim end = (l | IM_TILE_MASK) + 1;
+
+  *data = im->idata + i_tiled_offset(im, l, y);
+
+  return (end < r ? end : r) - l;
+}
+
+static int
+ppix_tiled(i_img *im, i_img_dim x, i_img_dim y, const i_color *val) {
+  int ch;
+  unsigned char *data;
+
+  if (x < 0 || x >= im->xsize || y < 0 || y >= im->ysize)
+    return -1;
+
+  data = im->idata + i_tiled_offset(im, x, y);
+  for (ch = 0; ch < im->channels; ++ch)
+    if (im->ch_mask & (1 << ch))
+      data[ch] = val->channel[ch];
+
+  return 0;
+}
+
+static int
+gpix_tiled(i_img *im, i_img_dim x, i_img_dim y, i_color *val) {
+  int ch;
+  unsigned char *data;
+
+  if (x < 0 || x >= im->xsize || y < 0 || y >= im->ysize) {
+    for (ch = 0; ch < im->channels; ++ch)
+      val->channel[ch] = 0;
+    return -1;
+  }
+
+  data = im->idata + i_tiled_offset(im, x, y);
+  for (ch = 0; ch < im->channels; ++ch)
+    val->channel[ch] = data[ch];
+
+  return 0;
+}
+
+static int
+ppixf_tiled(i_img *im, i_img_dim x, i_img_dim y, const i_fcolor *val) {
+  int ch;
+  unsigned char *data;
+
+  if (x < 0 || x >= im->xsize || y < 0 || y >= im->ysize)
+    return -1;
+
+  data = im->idata + i_tiled_offset(im, x, y);
+  for (ch = 0; ch < im->channels; ++ch)
+    if (im->ch_mask & (1 << ch))
+      data[ch] = SampleFTo8(val->channel[ch]);
+
+  return 0;
+}
+
+static int
+gpixf_tiled(i_img *im, i_img_dim x, i_img_dim y, i_fcolor *val) {
+  int ch;
+  unsigned char *data;
+
+  if (x < 0 || x >= im->xsize || y < 0 || y >= im->ysize)
+    return -1;
+
+  data = im->idata + i_tiled_offset(im, x, y);
+  for (ch = 0; ch < im->channels; ++ch)
+    val->channel[ch] = Sample8ToF(data[ch]);
+
+  return 0;
+}
+
+static i_img_dim
+glin_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_color *vals) {
+  int ch;
+  i_img_dim count, i, result;
+  unsigned char *data;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize)
+    return 0;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  result = r - l;
+  while (l < r) {
+    count = tile_segment(im, l, r, y, &data);
+    for (i = 0; i < count; ++i) {
+      for (ch = 0; ch < im->channels; ++ch)
+	vals->channel[ch] = *data++;
+      ++vals;
+    }
+    l += count;
+  }
+
+  return result;
+}
+
+static i_img_dim
+plin_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_color *vals) {
+  int ch;
+  i_img_dim count, i, result;
+  unsigned char *data;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize)
+    return 0;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  result = r - l;
+  while (l < r) {
+    count = tile_segment(im, l, r, y, &data);
+    for (i = 0; i < count; ++i) {
+      for (ch = 0; ch < im->channels; ++ch) {
+	if (im->ch_mask & (1 << ch))
+	  *data = vals->channel[ch];
+	++data;
+      }
+      ++vals;
+    }
+    l += count;
+  }
+
+  return result;
+}
+
+static i_img_dim
+glinf_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_fcolor *vals) {
+  int ch;
+  i_img_dim count, i, result;
+  unsigned char *data;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize)
+    return 0;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  result = r - l;
+  while (l < r) {
+    count = tile_segment(im, l, r, y, &data);
+    for (i = 0; i < count; ++i) {
+      for (ch = 0; ch < im->channels; ++ch)
+	vals->channel[ch] = Sample8ToF(*data++);
+      ++vals;
+    }
+    l += count;
+  }
+
+  return result;
+}
+
+static i_img_dim
+plinf_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, const i_fcolor *vals) {
+  int ch;
+  i_img_dim count, i, result;
+  unsigned char *data;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize)
+    return 0;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  result = r - l;
+  while (l < r) {
+    count = tile_segment(im, l, r, y, &data);
+    for (i = 0; i < count; ++i) {
+      for (ch = 0; ch < im->channels; ++ch) {
+	if (im->ch_mask & (1 << ch))
+	  *data = SampleFTo8(vals->channel[ch]);
+	++data;
+      }
+      ++vals;
+    }
+    l += count;
+  }
+
+  return result;
+}
+
+/* validate the channel list for the sample functions, returns the
+   number of channels in the list or 0 on failure */
+static int
+check_chans(i_img *im, const int *chans, int chan_count) {
+  int ch;
+  dIMCTXim(im);
+
+  if (chans) {
+    for (ch = 0; ch < chan_count; ++ch) {
+      if (chans[ch] < 0 || chans[ch] >= im->channels) {
+	im_push_errorf(aIMCTX, 0, "No channel %d in this image", chans[ch]);
+	return 0;
+      }
+    }
+  }
+  else if (chan_count <= 0 || chan_count > im->channels) {
+    im_push_errorf(aIMCTX, 0, "chan_count %d out of range, must be >0, <= channels",
+		   chan_count);
+    return 0;
+  }
+
+  return 1;
+}
+
+static i_img_dim
+gsamp_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_sample_t *samps,
+	    const int *chans, int chan_count) {
+  int ch;
+  i_img_dim count, i, result;
+  unsigned char *data;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize)
+    return 0;
+  if (!check_chans(im, chans, chan_count))
+    return 0;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  result = (r - l) * chan_count;
+  while (l < r) {
+    count = tile_segment(im, l, r, y, &data);
+    if (chans) {
+      for (i = 0; i < count; ++i) {
+	for (ch = 0; ch < chan_count; ++ch)
+	  *samps++ = data[chans[ch]];
+	data += im->channels;
+      }
+    }
+    else if (chan_count == im->channels) {
+      memcpy(samps, data, count * chan_count);
+      samps += count * chan_count;
+    }
+    else {
+      for (i = 0; i < count; ++i) {
+	for (ch = 0; ch < chan_count; ++ch)
+	  *samps++ = data[ch];
+	data += im->channels;
+      }
+    }
+    l += count;
+  }
+
+  return result;
+}
+
+static i_img_dim
+gsampf_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y, i_fsample_t *samps,
+	     const int *chans, int chan_count) {
+  int ch;
+  i_img_dim count, i, result;
+  unsigned char *data;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize)
+    return 0;
+  if (!check_chans(im, chans, chan_count))
+    return 0;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  result = (r - l) * chan_count;
+  while (l < r) {
+    count = tile_segment(im, l, r, y, &data);
+    for (i = 0; i < count; ++i) {
+      for (ch = 0; ch < chan_count; ++ch)
+	*samps++ = Sample8ToF(data[chans ? chans[ch] : ch]);
+      data += im->channels;
+    }
+    l += count;
+  }
+
+  return result;
+}
+
+static i_img_dim
+psamp_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y,
+	    const i_sample_t *samps, const int *chans, int chan_count) {
+  int ch;
+  i_img_dim count, i, result;
+  unsigned char *data;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize) {
+    dIMCTXim(im);
+    im_push_error(aIMCTX, 0, "Image position outside of image");
+    return -1;
+  }
+  if (!check_chans(im, chans, chan_count))
+    return -1;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  result = (r - l) * chan_count;
+  while (l < r) {
+    count = tile_segment(im, l, r, y, &data);
+    for (i = 0; i < count; ++i) {
+      for (ch = 0; ch < chan_count; ++ch) {
+	int chan = chans ? chans[ch] : ch;
+	if (im->ch_mask & (1 << chan))
+	  data[chan] = *samps;
+	++samps;
+      }
+      data += im->channels;
+    }
+    l += count;
+  }
+
+  return result;
+}
+
+static i_img_dim
+psampf_tiled(i_img *im, i_img_dim l, i_img_dim r, i_img_dim y,
+	     const i_fsample_t *samps, const int *chans, int chan_count) {
+  int ch;
+  i_img_dim count, i, result;
+  unsigned char *data;
+
+  if (y < 0 || y >= im->ysize || l < 0 || l >= im->xsize) {
+    dIMCTXim(im);
+    im_push_error(aIMCTX, 0, "Image position outside of image");
+    return -1;
+  }
+  if (!check_chans(im, chans, chan_count))
+    return -1;
+  if (r > im->xsize)
+    r = im->xsize;
+
+  result = (r - l) * chan_count;
+  while (l < r) {
+    count = tile_segment(im, l, r, y, &data);
+    for (i = 0; i < count; ++i) {
+      for (ch = 0; ch < chan_count; ++ch) {
+	int chan = chans ? chans[ch] : ch;
+	if (im->ch_mask & (1 << chan))
+	  data[chan] = SampleFTo8(*samps);
+	++samps;
+      }
+      data += im->channels;
+    }
+    l += count;
+  }
+
+  return result;
+}
+
+/*
+=back
+
+=head1 AUTHOR
+
+Tony Cook <tonyc@cpan.org>
+
+=head1 SEE ALSO
+
+Imager(3)
+
+=cut
+*/
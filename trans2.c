@@ -1,4 +1,5 @@
 #include "imager.h"
+#include "imageri.h"
 #include "regmach.h"
 
 /*
@@ -29,6 +30,46 @@ over the image - most of the work is done in L<regmach.c>
 =cut
 */
 
+typedef struct {
+  i_img *dest;
+  struct rm_op *ops;
+  int ops_count;
+  double *n_regs;
+  int n_regs_count;
+  i_color *c_regs;
+  int c_regs_count;
+  i_img **in_imgs;
+  int in_imgs_count;
+} trans2_state;
+
+/* run the program for columns start to end-1, each band gets its own
+   copy of the registers */
+static void
+trans2_band(void *p, i_img_dim start, i_img_dim end) {
+  trans2_state *state = p;
+  double *n_regs = im_work_malloc(sizeof(double) * state->n_regs_count);
+  i_color *c_regs = im_work_malloc(sizeof(i_color) * state->c_regs_count);
+  i_img_dim x, y;
+  i_color val;
+
+  memcpy(n_regs, state->n_regs, sizeof(double) * state->n_regs_count);
+  memcpy(c_regs, state->c_regs, sizeof(i_color) * state->c_regs_count);
+
+  for (x = start; x < end; ++x) {
+    for (y = 0; y < state->dest->ysize; ++y) {
+      n_regs[0] = x;
+      n_regs[1] = y;
+      val = i_rm_run(state->ops, state->ops_count, n_regs, state->n_regs_count,
+                     c_regs, state->c_regs_count,
+                     state->in_imgs, state->in_imgs_count);
+      i_ppix(state->dest, x, y, &val);
+    }
+  }
+
+  im_work_free(n_regs);
+  im_work_free(c_regs);
+}
+
 i_img* i_transform2(i_img_dim width, i_img_dim height, int channels,
 		    struct rm_op *ops, int ops_count, 
 		    double *n_regs, int n_regs_count, 
@@ -36,10 +77,10 @@ i_img* i_transform2(i_img_dim width, i_img_dim height, int channels,
 		    i_img **in_imgs, int in_imgs_count)
 {
   i_img *new_img;
-  i_img_dim x, y;
-  i_color val;
+  trans2_state state;
   int i;
   int need_images;
+  int threaded;
 
   i_clear_error();
   
@@ -69,15 +110,27 @@ i_img* i_transform2(i_img_dim width, i_img_dim height, int channels,
   */
 
   new_img = i_img_empty_ch(NULL, width, height, channels);
-  for (x = 0; x < width; ++x) {
-    for (y = 0; y < height; ++y) {
-      n_regs[0] = x;
-      n_regs[1] = y;
-      val = i_rm_run(ops, ops_count, n_regs, n_regs_count, c_regs, c_regs_count, 
-		   in_imgs, in_imgs_count);
-      i_ppix(new_img, x, y, &val);
-    }
+
+  state.dest = new_img;
+  state.ops = ops;
+  state.ops_count = ops_count;
+  state.n_regs = n_regs;
+  state.n_regs_count = n_regs_count;
+  state.c_regs = c_regs;
+  state.c_regs_count = c_regs_count;
+  state.in_imgs = in_imgs;
+  state.in_imgs_count = in_imgs_count;
+
+  threaded = 1;
+  for (i = 0; i < in_imgs_count; ++i) {
+    if (!i_img_work_safe(in_imgs[i]))
+      threaded = 0;
   }
+
+  if (threaded)
+    im_work_bands(new_img->context, width, 4, trans2_band, &state);
+  else
+    trans2_band(&state, 0, width);
   
   return new_img;
 }
@@ -0,0 +1,34 @@
+/*
+  no worker threads, for non-threaded builds
+*/
+
+#include "imageri.h"
+
+/* documented in workpthr.c */
+
+struct im_work_pool_tag {
+  int dummy;
+};
+
+void
+im_work_pool_destroy(im_work_pool *pool) {
+  (void)pool;
+}
+
+int
+im_work_split(im_context_t ctx, i_img_dim count, i_img_dim min_band) {
+  (void)ctx;
+  (void)count;
+  (void)min_band;
+
+  return 0;
+}
+
+void
+im_work_bands(im_context_t ctx, i_img_dim count, i_img_dim min_band,
+              im_work_band_f f, void *data) {
+  (void)ctx;
+  (void)min_band;
+
+  f(data, 0, count);
+}
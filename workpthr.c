@@ -0,0 +1,286 @@
+/*
+=head1 NAME
+
+workpthr.c - split image processing work across threads, using pthreads
+
+=head1 SYNOPSIS
+
+  static void
+  do_rows(void *data, i_img_dim start, i_img_dim end) {
+    ... process rows start to end-1 ...
+  }
+
+  if (i_img_work_safe(im))
+    im_work_bands(aIMCTX, im->ysize, 16, do_rows, &state);
+  else
+    do_rows(&state, 0, im->ysize);
+
+=head1 DESCRIPTION
+
+Splits a range of rows (or columns, or anything else) into bands and
+processes them with a pool of worker threads owned by the context.
+
+The number of threads is set with im_set_threads(), the default of 1
+does all the work in the calling thread.
+
+The band function is called from worker threads, so it must not
+touch the error stack, log, or call any function that needs the
+current context via dIMCTX, and must only write to images that are
+safe to write from multiple threads, see i_img_work_safe().  Use
+im_work_malloc() and im_work_free() for work buffers, since
+mymalloc() and myfree() log.
+
+=over
+
+=cut
+*/
+
+#include "imageri.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+struct im_work_pool_tag {
+  int thread_count;
+  pthread_t *threads;
+
+  /* the process that created the workers, they don't survive fork() */
+  pid_t pid;
+
+  pthread_mutex_t mutex;
+  pthread_cond_t start_cond;
+  pthread_cond_t done_cond;
+
+  /* incremented for each new job */
+  unsigned long generation;
+  int shutdown;
+
+  /* the current job */
+  im_work_band_f f;
+  void *data;
+  i_img_dim count;
+  i_img_dim band_size;
+  i_img_dim next_start;
+
+  /* number of workers yet to finish the current job */
+  int active;
+};
+
+/* process bands until there are none left, called with the mutex
+   locked */
+static void
+work_run_bands(im_work_pool *pool) {
+  while (pool->next_start < pool->count) {
+    i_img_dim start = pool->next_start;
+    i_img_dim end = start + pool->band_size;
+    if (end > pool->count)
+      end = pool->count;
+    pool->next_start = end;
+
+    pthread_mutex_unlock(&pool->mutex);
+    pool->f(pool->data, start, end);
+    pthread_mutex_lock(&pool->mutex);
+  }
+}
+
+static void *
+work_thread(void *p) {
+  im_work_pool *pool = p;
+  /* workers are only started by work_pool_new(), before any jobs */
+  unsigned long seen = 0;
+
+  pthread_mutex_lock(&pool->mutex);
+  for (;;) {
+    while (!pool->shutdown && pool->generation == seen)
+      pthread_cond_wait(&pool->start_cond, &pool->mutex);
+    if (pool->shutdown)
+      break;
+    seen = pool->generation;
+
+    work_run_bands(pool);
+
+    if (--pool->active == 0)
+      pthread_cond_signal(&pool->done_cond);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+
+  return NULL;
+}
+
+static void
+work_pool_stop(im_work_pool *pool, int count) {
+  int i;
+
+  pthread_mutex_lock(&pool->mutex);
+  pool->shutdown = 1;
+  pthread_cond_broadcast(&pool->start_cond);
+  pthread_mutex_unlock(&pool->mutex);
+
+  for (i = 0; i < count; ++i)
+    pthread_join(pool->threads[i], NULL);
+}
+
+static im_work_pool *
+work_pool_new(int thread_count) {
+  im_work_pool *pool = malloc(sizeof(im_work_pool));
+  int i;
+
+  if (!pool)
+    return NULL;
+  pool->threads = malloc(sizeof(pthread_t) * thread_count);
+  if (!pool->threads) {
+    free(pool);
+    return NULL;
+  }
+  pool->thread_count = thread_count;
+  pool->pid = getpid();
+  pool->generation = 0;
+  pool->shutdown = 0;
+  pool->active = 0;
+  pool->next_start = pool->count = 0;
+  pthread_mutex_init(&pool->mutex, NULL);
+  pthread_cond_init(&pool->start_cond, NULL);
+  pthread_cond_init(&pool->done_cond, NULL);
+
+  for (i = 0; i < thread_count; ++i) {
+    if (pthread_create(pool->threads + i, NULL, work_thread, pool) != 0) {
+      work_pool_stop(pool, i);
+      pool->thread_count = 0;
+      im_work_pool_destroy(pool);
+      return NULL;
+    }
+  }
+
+  return pool;
+}
+
+/*
+=item im_work_pool_destroy(pool)
+
+Stop the worker threads and release the pool.
+
+Called when the context is destroyed.
+
+=cut
+*/
+
+void
+im_work_pool_destroy(im_work_pool *pool) {
+  if (!pool)
+    return;
+
+  if (pool->pid == getpid()) {
+    if (pool->thread_count)
+      work_pool_stop(pool, pool->thread_count);
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->start_cond);
+    pthread_cond_destroy(&pool->done_cond);
+  }
+  /* else we're a forked child, the workers don't exist here and the
+     mutex and condition variables may be in any state, leak them */
+
+  free(pool->threads);
+  free(pool);
+}
+
+/*
+=item im_work_split(ctx, count, min_band)
+
+Returns non-zero if im_work_bands() will split C<count> into more
+than one band, so callers can skip setup that's only needed when
+bands run at the same time, like copying an image filtered in place.
+
+=cut
+*/
+
+int
+im_work_split(im_context_t ctx, i_img_dim count, i_img_dim min_band) {
+#ifdef IMAGER_DEBUG_MALLOC
+  /* the debug malloc isn't thread safe */
+  (void)ctx;
+  (void)count;
+  (void)min_band;
+  return 0;
+#else
+  if (min_band < 1)
+    min_band = 1;
+
+  return ctx->threads > 1 && count >= min_band * 2;
+#endif
+}
+
+/*
+=item im_work_bands(ctx, count, min_band, f, data)
+
+Call C<f(data, start, end)> for bands covering C<0> to C<count-1>,
+using the context's worker threads if im_set_threads() has been
+called.
+
+Bands will be at least C<min_band> long except for the last band.
+
+Returns when all of the bands have been processed.
+
+=cut
+*/
+
+void
+im_work_bands(im_context_t ctx, i_img_dim count, i_img_dim min_band,
+              im_work_band_f f, void *data) {
+  im_work_pool *pool;
+  i_img_dim band_size;
+  int threads = ctx->threads;
+
+  if (!im_work_split(ctx, count, min_band)) {
+    f(data, 0, count);
+    return;
+  }
+  if (min_band < 1)
+    min_band = 1;
+
+  pool = ctx->work_pool;
+  if (pool && (pool->thread_count != threads - 1 || pool->pid != getpid())) {
+    im_work_pool_destroy(pool);
+    pool = ctx->work_pool = NULL;
+  }
+  if (!pool) {
+    pool = ctx->work_pool = work_pool_new(threads - 1);
+    if (!pool) {
+      /* couldn't start the threads, do it ourselves */
+      f(data, 0, count);
+      return;
+    }
+  }
+
+  /* a few bands per thread so a slow band doesn't hold everyone up */
+  band_size = (count + threads * 4 - 1) / (threads * 4);
+  if (band_size < min_band)
+    band_size = min_band;
+
+  pthread_mutex_lock(&pool->mutex);
+  pool->f = f;
+  pool->data = data;
+  pool->count = count;
+  pool->band_size = band_size;
+  pool->next_start = 0;
+  pool->active = pool->thread_count;
+  ++pool->generation;
+  pthread_cond_broadcast(&pool->start_cond);
+
+  work_run_bands(pool);
+
+  /* wait for every worker to see the job, so none of them can touch
+     f or data after we return */
+  while (pool->active > 0)
+    pthread_cond_wait(&pool->done_cond, &pool->mutex);
+  pthread_mutex_unlock(&pool->mutex);
+}
+
+/*
+=back
+
+=head1 SEE ALSO
+
+Imager(3), limits.c
+
+=cut
+*/
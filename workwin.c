@@ -0,0 +1,203 @@
+/*
+  worker threads using Win32 threads
+*/
+
+#include "imageri.h"
+
+#include <windows.h>
+
+/* documented in workpthr.c */
+
+struct im_work_pool_tag {
+  int thread_count;
+  HANDLE *threads;
+
+  CRITICAL_SECTION section;
+  CONDITION_VARIABLE start_cond;
+  CONDITION_VARIABLE done_cond;
+
+  /* incremented for each new job */
+  unsigned long generation;
+  int shutdown;
+
+  /* the current job */
+  im_work_band_f f;
+  void *data;
+  i_img_dim count;
+  i_img_dim band_size;
+  i_img_dim next_start;
+
+  /* number of workers yet to finish the current job */
+  int active;
+};
+
+/* process bands until there are none left, called with the critical
+   section entered */
+static void
+work_run_bands(im_work_pool *pool) {
+  while (pool->next_start < pool->count) {
+    i_img_dim start = pool->next_start;
+    i_img_dim end = start + pool->band_size;
+    if (end > pool->count)
+      end = pool->count;
+    pool->next_start = end;
+
+    LeaveCriticalSection(&pool->section);
+    pool->f(pool->data, start, end);
+    EnterCriticalSection(&pool->section);
+  }
+}
+
+static DWORD WINAPI
+work_thread(LPVOID p) {
+  im_work_pool *pool = p;
+  /* workers are only started by work_pool_new(), before any jobs */
+  unsigned long seen = 0;
+
+  EnterCriticalSection(&pool->section);
+  for (;;) {
+    while (!pool->shutdown && pool->generation == seen)
+      SleepConditionVariableCS(&pool->start_cond, &pool->section, INFINITE);
+    if (pool->shutdown)
+      break;
+    seen = pool->generation;
+
+    work_run_bands(pool);
+
+    if (--pool->active == 0)
+      WakeConditionVariable(&pool->done_cond);
+  }
+  LeaveCriticalSection(&pool->section);
+
+  return 0;
+}
+
+static void
+work_pool_stop(im_work_pool *pool, int count) {
+  int i;
+
+  EnterCriticalSection(&pool->section);
+  pool->shutdown = 1;
+  WakeAllConditionVariable(&pool->start_cond);
+  LeaveCriticalSection(&pool->section);
+
+  for (i = 0; i < count; ++i) {
+    WaitForSingleObject(pool->threads[i], INFINITE);
+    CloseHandle(pool->threads[i]);
+  }
+}
+
+static im_work_pool *
+work_pool_new(int thread_count) {
+  im_work_pool *pool = malloc(sizeof(im_work_pool));
+  int i;
+
+  if (!pool)
+    return NULL;
+  pool->threads = malloc(sizeof(HANDLE) * thread_count);
+  if (!pool->threads) {
+    free(pool);
+    return NULL;
+  }
+  pool->thread_count = thread_count;
+  pool->generation = 0;
+  pool->shutdown = 0;
+  pool->active = 0;
+  pool->next_start = pool->count = 0;
+  InitializeCriticalSection(&pool->section);
+  InitializeConditionVariable(&pool->start_cond);
+  InitializeConditionVariable(&pool->done_cond);
+
+  for (i = 0; i < thread_count; ++i) {
+    pool->threads[i] = CreateThread(NULL, 0, work_thread, pool, 0, NULL);
+    if (pool->threads[i] == NULL) {
+      work_pool_stop(pool, i);
+      pool->thread_count = 0;
+      im_work_pool_destroy(pool);
+      return NULL;
+    }
+  }
+
+  return pool;
+}
+
+void
+im_work_pool_destroy(im_work_pool *pool) {
+  if (!pool)
+    return;
+
+  if (pool->thread_count)
+    work_pool_stop(pool, pool->thread_count);
+  DeleteCriticalSection(&pool->section);
+
+  free(pool->threads);
+  free(pool);
+}
+
+int
+im_work_split(im_context_t ctx, i_img_dim count, i_img_dim min_band) {
+#ifdef IMAGER_DEBUG_MALLOC
+  /* the debug malloc isn't thread safe */
+  (void)ctx;
+  (void)count;
+  (void)min_band;
+  return 0;
+#else
+  if (min_band < 1)
+    min_band = 1;
+
+  return ctx->threads > 1 && count >= min_band * 2;
+#endif
+}
+
+void
+im_work_bands(im_context_t ctx, i_img_dim count, i_img_dim min_band,
+              im_work_band_f f, void *data) {
+  im_work_pool *pool;
+  i_img_dim band_size;
+  int threads = ctx->threads;
+
+  if (!im_work_split(ctx, count, min_band)) {
+    f(data, 0, count);
+    return;
+  }
+  if (min_band < 1)
+    min_band = 1;
+
+  pool = ctx->work_pool;
+  if (pool && pool->thread_count != threads - 1) {
+    im_work_pool_destroy(pool);
+    pool = ctx->work_pool = NULL;
+  }
+  if (!pool) {
+    pool = ctx->work_pool = work_pool_new(threads - 1);
+    if (!pool) {
+      /* couldn't start the threads, do it ourselves */
+      f(data, 0, count);
+      return;
+    }
+  }
+
+  /* a few bands per thread so a slow band doesn't hold everyone up */
+  band_size = (count + threads * 4 - 1) / (threads * 4);
+  if (band_size < min_band)
+    band_size = min_band;
+
+  EnterCriticalSection(&pool->section);
+  pool->f = f;
+  pool->data = data;
+  pool->count = count;
+  pool->band_size = band_size;
+  pool->next_start = 0;
+  pool->active = pool->thread_count;
+  ++pool->generation;
+  WakeAllConditionVariable(&pool->start_cond);
+
+  work_run_bands(pool);
+
+  /* wait for every worker to see the job, so none of them can touch
+     f or data after we return */
+  while (pool->active > 0)
+    SleepConditionVariableCS(&pool->done_cond, &pool->section, INFINITE);
+  LeaveCriticalSection(&pool->section);
+}